@@ -30,18 +30,12 @@ int main()
     }};
 
     IntMatrix matrixCopy{matrix}; // matrix copy not really needed, it's just for demonstrating the usage of the copy constructor
-    IntMatrix columnSubtotalsMatrix{{1, matrix.getNrOfColumns()}, 0};
+
+    // the subtotals of all columns are calculated within a single (row by row) pass through the matrix
+    IntMatrix columnSubtotalsMatrix{1, matrix.getNrOfColumns(), matrix.columnSums()};
 
     for (int columnNumber{0}; columnNumber < matrix.getNrOfColumns(); ++columnNumber)
     {
-        int currentSubtotal{0};
-
-        for (IntMatrix::ConstNIterator it{matrix.constNColumnBegin(columnNumber)}; it != matrix.constNColumnEnd(columnNumber); ++it)
-        {
-            currentSubtotal += *it;
-        }
-
-        columnSubtotalsMatrix.at(0, columnNumber) = currentSubtotal;
         std::sort(matrixCopy.reverseNColumnBegin(columnNumber), matrixCopy.reverseNColumnEnd(columnNumber));
     }
 
@@ -71,22 +65,9 @@ int main()
     printMatrix(matrix);
 
     const int rowPositionToInsert{1};
-    matrix.insertRow(rowPositionToInsert);
 
-    for (IntMatrix::ZIterator it{matrix.zRowBegin(rowPositionToInsert)}; it != matrix.zRowEnd(rowPositionToInsert); ++it)
-    {
-        const auto columnNr = it.getColumnNr();
-
-        if (columnNr.has_value())
-        {
-            *it = columnSubtotalsMatrix.at(0, *columnNr);
-        }
-        else
-        {
-            assert(false);
-            break;
-        }
-    }
+    // the new row elements are directly constructed from the subtotals (no default construction and overwriting needed)
+    matrix.insertRow(rowPositionToInsert, std::ranges::subrange{columnSubtotalsMatrix.constZRowBegin(0), columnSubtotalsMatrix.constZRowEnd(0)});
 
     std::cout << "After inserting the subtotals on row " << rowPositionToInsert + 1 << " the final matrix is: " << std::endl;
 
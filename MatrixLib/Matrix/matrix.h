@@ -2,13 +2,25 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <optional>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "../Utils/concurrencyutils.h"
+#include "../Utils/decompositionutils.h"
 #include "../Utils/errorhandling.h"
 #include "../Utils/iteratorutils.h"
+#include "../Utils/multiplicationutils.h"
+#include "../Utils/reductionutils.h"
 
 #ifndef USE_SMALL_DIMENSIONS
 using matrix_size_t = uint32_t;
@@ -30,13 +42,104 @@ constexpr matrix_size_t maxAllowedDimension()
     return c_MaxAllowedDimension;
 }
 
+namespace Matr
+{
+// tag type for constructing matrixes with elements that are not initialized (see the matching Matrix constructor)
+struct UninitializedTag
+{
+    explicit UninitializedTag() = default;
+};
+
+inline constexpr UninitializedTag uninitialized{};
+} // namespace Matr
+
 template <typename T>
 concept MatrixElementType =
     std::default_initializable<T> && std::copy_constructible<T> && std::move_constructible<T> &&
     std::is_copy_assignable_v<T> && std::is_move_assignable_v<T> && std::swappable<T> && std::equality_comparable<T>;
 
+// element types for which the matrix product can be computed
+template <typename T>
+concept MultipliableElementType = MatrixElementType<T> && requires(const T& first, const T& second, T& result) {
+    { first * second } -> std::convertible_to<T>;
+    result += first * second;
+};
+
+// element types supported by the decompositions and linear solvers (division and pivoting by magnitude are required)
+template <typename T>
+concept DecomposableElementType = MultipliableElementType<T> && std::floating_point<T>;
+
+// element types supported by the predefined row/column reductions (sums, minimum/maximum and mean values)
+template <typename T>
+concept ArithmeticElementType = MatrixElementType<T> && std::is_arithmetic_v<T> && !std::same_as<T, bool>;
+
+template <MatrixElementType T> class Matrix;
+template <MatrixElementType T> class MatrixBuilder;
+template <MultipliableElementType T>
+Matrix<T> multiply(const Matrix<T>& a, const Matrix<T>& b, const Matr::ExecutionPolicy& executionPolicy);
+template <MultipliableElementType T>
+void gemm(const T& alpha, const Matrix<T>& a, const Matrix<T>& b, const T& beta, Matrix<T>& c,
+          const Matr::ExecutionPolicy& executionPolicy);
+template <ArithmeticElementType T>
+Matrix<T> strassenMultiply(const Matrix<T>& a, const Matrix<T>& b, size_t threshold,
+                           const Matr::ExecutionPolicy& executionPolicy);
+template <MultipliableElementType T>
+std::vector<T> multiply(const Matrix<T>& a, std::type_identity_t<std::span<const T>> x);
+template <MultipliableElementType T>
+std::vector<T> multiply(std::type_identity_t<std::span<const T>> x, const Matrix<T>& a);
+template <MultipliableElementType T>
+void gemv(const T& alpha, const Matrix<T>& a, std::type_identity_t<std::span<const T>> x, const T& beta,
+          std::type_identity_t<std::span<T>> y);
+template <DecomposableElementType T>
+std::tuple<Matrix<T>, Matrix<T>, std::vector<matrix_size_t>> luDecompose(const Matrix<T>& a);
+template <DecomposableElementType T> Matrix<T> solve(const Matrix<T>& a, const Matrix<T>& b);
+template <DecomposableElementType T> T determinant(const Matrix<T>& a);
+template <DecomposableElementType T> void cholesky(Matrix<T>& a, const Matr::ExecutionPolicy& executionPolicy);
+template <DecomposableElementType T> Matrix<T> choleskySolve(const Matrix<T>& l, const Matrix<T>& b);
+template <DecomposableElementType T> std::pair<Matrix<T>, Matrix<T>> qr(const Matrix<T>& a);
+template <DecomposableElementType T> Matrix<T> leastSquares(const Matrix<T>& a, const Matrix<T>& b);
+template <MatrixElementType T> class MatrixReferenceExpression;
+
+// lazily evaluated element-wise expression (built by the arithmetic operators/functions at the end of this file), its
+// elements are computed on request by evaluate() so no intermediate matrixes are needed
+template <typename Expression>
+concept MatrixExpression = requires(const Expression& expression, matrix_size_t rowNr, matrix_size_t columnNr) {
+    typename Expression::value_type;
+    { expression.getNrOfRows() } -> std::same_as<matrix_size_t>;
+    { expression.getNrOfColumns() } -> std::same_as<matrix_size_t>;
+    expression.evaluate(rowNr, columnNr);
+};
+
 template <MatrixElementType T> class Matrix
 {
+    friend class MatrixBuilder<T>;
+    friend class MatrixReferenceExpression<T>;
+
+    template <MultipliableElementType U>
+    friend Matrix<U> multiply(const Matrix<U>& a, const Matrix<U>& b, const Matr::ExecutionPolicy& executionPolicy);
+    template <MultipliableElementType U>
+    friend void gemm(const U& alpha, const Matrix<U>& a, const Matrix<U>& b, const U& beta, Matrix<U>& c,
+                     const Matr::ExecutionPolicy& executionPolicy);
+    template <ArithmeticElementType U>
+    friend Matrix<U> strassenMultiply(const Matrix<U>& a, const Matrix<U>& b, size_t threshold,
+                                      const Matr::ExecutionPolicy& executionPolicy);
+    template <MultipliableElementType U>
+    friend std::vector<U> multiply(const Matrix<U>& a, std::type_identity_t<std::span<const U>> x);
+    template <MultipliableElementType U>
+    friend std::vector<U> multiply(std::type_identity_t<std::span<const U>> x, const Matrix<U>& a);
+    template <MultipliableElementType U>
+    friend void gemv(const U& alpha, const Matrix<U>& a, std::type_identity_t<std::span<const U>> x, const U& beta,
+                     std::type_identity_t<std::span<U>> y);
+    template <DecomposableElementType U>
+    friend std::tuple<Matrix<U>, Matrix<U>, std::vector<matrix_size_t>> luDecompose(const Matrix<U>& a);
+    template <DecomposableElementType U> friend Matrix<U> solve(const Matrix<U>& a, const Matrix<U>& b);
+    template <DecomposableElementType U> friend U determinant(const Matrix<U>& a);
+    template <DecomposableElementType U>
+    friend void cholesky(Matrix<U>& a, const Matr::ExecutionPolicy& executionPolicy);
+    template <DecomposableElementType U> friend Matrix<U> choleskySolve(const Matrix<U>& l, const Matrix<U>& b);
+    template <DecomposableElementType U> friend std::pair<Matrix<U>, Matrix<U>> qr(const Matrix<U>& a);
+    template <DecomposableElementType U> friend Matrix<U> leastSquares(const Matrix<U>& a, const Matrix<U>& b);
+
 public:
     using size_type = matrix_size_t;
     using diff_type = matrix_diff_t;
@@ -254,12 +357,196 @@ public:
                                        // (diagonal 0) does no longer pass through element (0, 0)
     };
 
+    // lightweight view of a matrix with rows and columns swapped (no data is moved); the view iterators traverse the
+    // underlying matrix (e.g. the view ZIterator is the matrix NIterator) so their row and column numbers refer to the
+    // matrix; the view should not be used after the matrix gets resized or re-allocated
+    class TransposedView
+    {
+    public:
+        using ZIterator = typename Matrix<T>::NIterator;
+        using NIterator = typename Matrix<T>::ZIterator;
+
+        size_type getNrOfRows() const;
+        size_type getNrOfColumns() const;
+        bool isEmpty() const;
+
+        T& at(size_type rowNr, size_type columnNr);
+        const T& at(size_type rowNr, size_type columnNr) const;
+
+        ZIterator zBegin();
+        ZIterator zEnd();
+        ZIterator zRowBegin(size_type rowNr);
+        ZIterator zRowEnd(size_type rowNr);
+        ZIterator getZIterator(size_type rowNr, size_type columnNr);
+
+        NIterator nBegin();
+        NIterator nEnd();
+        NIterator nColumnBegin(size_type columnNr);
+        NIterator nColumnEnd(size_type columnNr);
+        NIterator getNIterator(size_type rowNr, size_type columnNr);
+
+        ZIterator begin();
+        ZIterator end();
+
+    private:
+        friend class Matrix<T>;
+
+        explicit TransposedView(Matrix& matrix);
+
+        Matrix* m_pMatrix;
+    };
+
+    class ConstTransposedView
+    {
+    public:
+        using ConstZIterator = typename Matrix<T>::ConstNIterator;
+        using ConstNIterator = typename Matrix<T>::ConstZIterator;
+
+        ConstTransposedView(const TransposedView& transposedView);
+
+        size_type getNrOfRows() const;
+        size_type getNrOfColumns() const;
+        bool isEmpty() const;
+
+        const T& at(size_type rowNr, size_type columnNr) const;
+
+        ConstZIterator constZBegin() const;
+        ConstZIterator constZEnd() const;
+        ConstZIterator constZRowBegin(size_type rowNr) const;
+        ConstZIterator constZRowEnd(size_type rowNr) const;
+        ConstZIterator getConstZIterator(size_type rowNr, size_type columnNr) const;
+
+        ConstNIterator constNBegin() const;
+        ConstNIterator constNEnd() const;
+        ConstNIterator constNColumnBegin(size_type columnNr) const;
+        ConstNIterator constNColumnEnd(size_type columnNr) const;
+        ConstNIterator getConstNIterator(size_type rowNr, size_type columnNr) const;
+
+        ConstZIterator begin() const;
+        ConstZIterator end() const;
+
+    private:
+        friend class Matrix<T>;
+
+        explicit ConstTransposedView(const Matrix& matrix);
+
+        const Matrix* m_pMatrix;
+    };
+
+    // view with a logical-to-physical column map: reordering the columns of the view only updates the map (O(1) for
+    // swapping, O(number of columns) for permuting/moving), the matrix elements are rearranged in a single pass by
+    // materializeColumnOrder(); the view should not be used after the number of matrix columns changes
+    class ColumnOrderView
+    {
+    public:
+        size_type getNrOfRows() const;
+        size_type getNrOfColumns() const;
+        bool isEmpty() const;
+
+        T& at(size_type rowNr, size_type columnNr);
+        const T& at(size_type rowNr, size_type columnNr) const;
+
+        size_type getPhysicalColumnNr(size_type columnNr) const;
+        bool isPhysicalOrder() const;
+
+        void swapColumns(size_type firstColumnNr, size_type secondColumnNr);
+        void permuteColumns(const std::vector<size_type>& permutation);
+
+        // the column is moved to the destination position, the columns in between are shifted by one position
+        void moveColumn(size_type columnNr, size_type destColumnNr);
+
+        // applies the logical column order to the matrix (afterwards logical and physical order are identical)
+        void materializeColumnOrder();
+
+    private:
+        friend class Matrix<T>;
+
+        explicit ColumnOrderView(Matrix& matrix);
+
+        Matrix* m_pMatrix;
+        std::vector<size_type> m_PhysicalColumnNrs;
+    };
+
+    // view of a block of consecutive matrix rows and columns (no data is moved), the row and column numbers are
+    // relative to the block; the view should not be used after the matrix gets resized or re-allocated
+    class BlockView
+    {
+    public:
+        size_type getNrOfRows() const;
+        size_type getNrOfColumns() const;
+        bool isEmpty() const;
+
+        // position of the block within the matrix
+        size_type getRowOffset() const;
+        size_type getColumnOffset() const;
+
+        T& at(size_type rowNr, size_type columnNr);
+        const T& at(size_type rowNr, size_type columnNr) const;
+
+        // the elements of a block row are contiguous in memory
+        std::span<T> getRow(size_type rowNr);
+        std::span<const T> getRow(size_type rowNr) const;
+
+    private:
+        friend class Matrix<T>;
+
+        BlockView(Matrix& matrix, size_type rowOffset, size_type columnOffset, size_type nrOfRows,
+                  size_type nrOfColumns);
+
+        Matrix* m_pMatrix;
+        size_type m_RowOffset;
+        size_type m_ColumnOffset;
+        size_type m_NrOfRows;
+        size_type m_NrOfColumns;
+    };
+
+    class ConstBlockView
+    {
+    public:
+        ConstBlockView(const BlockView& blockView);
+
+        size_type getNrOfRows() const;
+        size_type getNrOfColumns() const;
+        bool isEmpty() const;
+
+        size_type getRowOffset() const;
+        size_type getColumnOffset() const;
+
+        const T& at(size_type rowNr, size_type columnNr) const;
+
+        std::span<const T> getRow(size_type rowNr) const;
+
+    private:
+        friend class Matrix<T>;
+
+        ConstBlockView(const Matrix& matrix, size_type rowOffset, size_type columnOffset, size_type nrOfRows,
+                       size_type nrOfColumns);
+
+        const Matrix* m_pMatrix;
+        size_type m_RowOffset;
+        size_type m_ColumnOffset;
+        size_type m_NrOfRows;
+        size_type m_NrOfColumns;
+    };
+
     Matrix();
     Matrix(size_type nrOfRows, size_type nrOfColumns, std::vector<T>&& vec);
     Matrix(dimensions_t dimensions, const T& value);
+
+    // elements of trivial types (e.g. int, double) are left uninitialized (they should be written before being read),
+    // the other ones are default constructed
+    Matrix(dimensions_t dimensions, Matr::UninitializedTag);
+
     Matrix(size_type nrOfRowsColumns, const std::pair<T, T>& diagMatrixValues);
     Matrix(const Matrix& matrix);
     Matrix(Matrix&& matrix);
+
+    // the expression (e.g. A * 2 + B - D) is evaluated in a single pass, each element being computed directly into the
+    // matrix memory (if the evaluation throws, the elements computed so far are destroyed and the memory is released)
+    template <MatrixExpression Expression>
+        requires std::same_as<typename Expression::value_type, T>
+    explicit Matrix(const Expression& expression);
+
     ~Matrix();
 
     T& at(size_type rowNr, size_type columnNr);
@@ -268,6 +555,12 @@ public:
     Matrix& operator=(const Matrix& matrix);
     Matrix& operator=(Matrix&& matrix);
 
+    // when the dimensions match the elements are overwritten in place, so the matrix can be an operand of the
+    // expression (e.g. A = A * 2 + B); otherwise the matrix is re-allocated
+    template <MatrixExpression Expression>
+        requires std::same_as<typename Expression::value_type, T>
+    Matrix& operator=(const Expression& expression);
+
     // transfers ownership of the data to the user (object becomes empty and user becomes responsible for de-allocating
     // the data properly)
     void* getBaseArray(size_type& nrOfElements);
@@ -282,8 +575,99 @@ public:
 #endif
     bool isEmpty() const;
 
+    // transposition is performed within the currently allocated memory whenever the capacity allows it, otherwise the
+    // matrix gets reallocated
     void transpose();
 
+    // same capacity rules as for transpose(): the tiles of a square matrix are distributed among the threads of the
+    // execution policy; a non-square matrix is transposed within the allocated memory if the capacity allows it (the
+    // threads move the elements along distinct chains/cycles of positions), otherwise the threads move the tiles into
+    // the newly allocated memory
+    void transpose(const Matr::ExecutionPolicy& executionPolicy);
+
+    // O(1) alternative to transpose() for read-once scenarios (e.g. computing A^T * x)
+    TransposedView transposedView();
+    ConstTransposedView transposedView() const;
+
+    // mirroring: the vertical flip (upside down) only reverses the row pointers, the horizontal flip (left-right)
+    // reverses the elements of each row in place
+    void flipVertical();
+    void flipHorizontal();
+
+    // clockwise rotations; rotating by 90/270 degrees combines a vertical flip with the (tiled) transposition, so the
+    // capacity and threading rules of transpose() apply
+    void rotate90();
+    void rotate90(const Matr::ExecutionPolicy& executionPolicy);
+    void rotate180();
+    void rotate270();
+    void rotate270(const Matr::ExecutionPolicy& executionPolicy);
+
+    // reductions traverse the elements in storage (row-major) order: each row is reduced on its own, while the columns
+    // are reduced together by accumulating their results within a vector (no strided column traversal); the result for
+    // a row/column is operation(...operation(operation(init, first element), second element)..., last element)
+    template <typename Operation> std::vector<T> reduceRows(const Operation& operation, const T& init) const;
+    template <typename Operation> std::vector<T> reduceColumns(const Operation& operation, const T& init) const;
+
+    // the rows are distributed among threads; for reduceColumns() the operation should be associative, as the results
+    // obtained by the threads for their rows get combined; an exception thrown by the operation (or by an allocation)
+    // on any thread is rethrown by the calling thread once all threads are done
+    template <typename Operation>
+    std::vector<T> reduceRows(const Operation& operation, const T& init,
+                              const Matr::ExecutionPolicy& executionPolicy) const;
+    template <typename Operation>
+    std::vector<T> reduceColumns(const Operation& operation, const T& init,
+                                 const Matr::ExecutionPolicy& executionPolicy) const;
+
+    // predefined reductions for arithmetic types, the elements being accumulated in a vectorization friendly order;
+    // the mean values of integral elements are computed as double
+    std::vector<T> rowSums() const
+        requires ArithmeticElementType<T>;
+    std::vector<T> rowSums(const Matr::ExecutionPolicy& executionPolicy) const
+        requires ArithmeticElementType<T>;
+    std::vector<T> columnSums() const
+        requires ArithmeticElementType<T>;
+    std::vector<T> columnSums(const Matr::ExecutionPolicy& executionPolicy) const
+        requires ArithmeticElementType<T>;
+    std::vector<T> rowMin() const
+        requires ArithmeticElementType<T>;
+    std::vector<T> rowMin(const Matr::ExecutionPolicy& executionPolicy) const
+        requires ArithmeticElementType<T>;
+    std::vector<T> rowMax() const
+        requires ArithmeticElementType<T>;
+    std::vector<T> rowMax(const Matr::ExecutionPolicy& executionPolicy) const
+        requires ArithmeticElementType<T>;
+    std::vector<Matr::MeanType<T>> rowMean() const
+        requires ArithmeticElementType<T>;
+    std::vector<Matr::MeanType<T>> rowMean(const Matr::ExecutionPolicy& executionPolicy) const
+        requires ArithmeticElementType<T>;
+    std::vector<T> columnMin() const
+        requires ArithmeticElementType<T>;
+    std::vector<T> columnMin(const Matr::ExecutionPolicy& executionPolicy) const
+        requires ArithmeticElementType<T>;
+    std::vector<T> columnMax() const
+        requires ArithmeticElementType<T>;
+    std::vector<T> columnMax(const Matr::ExecutionPolicy& executionPolicy) const
+        requires ArithmeticElementType<T>;
+    std::vector<Matr::MeanType<T>> columnMean() const
+        requires ArithmeticElementType<T>;
+    std::vector<Matr::MeanType<T>> columnMean(const Matr::ExecutionPolicy& executionPolicy) const
+        requires ArithmeticElementType<T>;
+
+    // sum of the main diagonal elements of a square matrix
+    T trace() const
+        requires ArithmeticElementType<T>;
+
+    // sums of all diagonals (D-Iterator numbering) respectively anti-diagonals (M-Iterator numbering), computed within
+    // a single row-major pass (no per-element index arithmetic); the sum of diagonal diagonalNr is located at index
+    // diagonalNr + getNrOfRows() - 1
+    std::vector<T> diagonalSums() const
+        requires ArithmeticElementType<T>;
+    std::vector<T> antiDiagonalSums() const
+        requires ArithmeticElementType<T>;
+
+    // copies the elements of the diagonal (D-Iterator numbering) into a contiguous vector
+    std::vector<T> diagonal(diff_type diagonalNr) const;
+
     void clear();
 
     // resize and don't init new elements (user has the responsibility to init them), existing elements retain their old
@@ -293,6 +677,16 @@ public:
     // resize and fill new elements with value of dataType, existing elements retain their old values
     void resize(size_type nrOfRows, size_type nrOfColumns, const T& dataType);
 
+    // resize when all elements are going to be overwritten: the existing elements are discarded (never moved to
+    // re-allocated memory) and, same as for the uninitialized constructor, the elements of trivial types are not
+    // initialized; capacity is adjusted the same way as for resize()
+    void resizeForOverwrite(size_type nrOfRows, size_type nrOfColumns);
+
+    // re-arrange the elements (taken in row-major order) under new dimensions, the number of elements should remain
+    // unchanged; when the elements are stored contiguously (no free column capacity, rows consecutive in memory) only
+    // the row pointers are re-mapped, otherwise the elements are moved once to memory allocated without free capacity
+    void reshape(size_type nrOfRows, size_type nrOfColumns);
+
     // reserve capacity without changing dimensions and element values
     void reserve(size_type rowCapacity, size_type columnCapacity);
 
@@ -302,24 +696,122 @@ public:
     void insertRow(size_type rowNr, const T& value);
     void insertColumn(size_type columnNr);
     void insertColumn(size_type columnNr, const T& value);
+
+    // the new row/column is constructed directly from the provided elements (moved when the range is an rvalue owning
+    // them), their number should match the number of columns/rows
+    template <std::ranges::forward_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+    void insertRow(size_type rowNr, Range&& elements);
+
+    template <std::ranges::forward_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+    void insertColumn(size_type columnNr, Range&& elements);
+
+    // each element of the new row/column is constructed in place from the provided arguments
+    template <typename... Args>
+        requires std::constructible_from<T, Args&...>
+    void emplaceRow(size_type rowNr, Args&&... args);
+
+    template <typename... Args>
+        requires std::constructible_from<T, Args&...>
+    void emplaceColumn(size_type columnNr, Args&&... args);
+
+    // insert a block of rows/columns by performing a single capacity check (and a single re-allocation or shift)
+    void insertRows(size_type rowNr, size_type nrOfRows);
+    void insertRows(size_type rowNr, size_type nrOfRows, const T& value);
+    void insertColumns(size_type columnNr, size_type nrOfColumns);
+    void insertColumns(size_type columnNr, size_type nrOfColumns, const T& value);
+
+    // the new rows are initialized row by row from the provided elements, their number should be a multiple of the
+    // number of columns
+    template <std::ranges::forward_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+    void insertRows(size_type rowNr, Range&& elements);
+
+    // the new columns are initialized column by column from the provided elements, their number should be a multiple of
+    // the number of rows
+    template <std::ranges::forward_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+    void insertColumns(size_type columnNr, Range&& elements);
+
+    // overwrites the elements of an existing row/column (moved when the range is an rvalue owning them), their number
+    // should match the number of columns/rows
+    template <std::ranges::forward_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+    void assignRow(size_type rowNr, Range&& elements);
+
+    template <std::ranges::forward_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+    void assignColumn(size_type columnNr, Range&& elements);
+
     void eraseRow(size_type rowNr);
     void eraseColumn(size_type columnNr);
 
+    // erase a set of rows/columns in a single compaction pass, the positions should be strictly ascending
+    void eraseRows(std::span<const size_type> rowNrs);
+    void eraseColumns(std::span<const size_type> columnNrs);
+
+    // erases the rows for which the predicate (called with the row elements) returns true, the number of erased rows is
+    // returned
+    template <typename Predicate>
+        requires std::predicate<Predicate&, std::span<const T>>
+    size_type eraseRowsIf(Predicate predicate);
+
     // vertical concatenation (cumulated rows)
     void catByRow(Matrix& matrix);
 
     // horizontal concatenation (cumulated columns)
     void catByColumn(Matrix& matrix);
 
+    // multi-way vertical/horizontal concatenation: the final dimensions are computed first so the matrix is reallocated
+    // at most once, then the content of each (distinct) matrix is moved in and the matrix is cleared; empty matrixes
+    // are skipped (this matrix can be empty too), null, duplicate or current matrix entries are not allowed
+    void concatRows(std::span<Matrix* const> matrixes);
+    void concatColumns(std::span<Matrix* const> matrixes);
+
     // vertical splitting
     void splitByRow(Matrix& matrix, Matrix<T>::size_type splitRowNr);
 
     // horizontal splitting
     void splitByColumn(Matrix& matrix, size_type splitColumnNr);
 
+    // multi-way splitting at the given (strictly ascending) row/column numbers, each one being the first row/column of
+    // a new block: the blocks are moved exactly once into newly allocated matrixes (no spare capacity) and this matrix
+    // gets cleared
+    std::vector<Matrix> splitRows(std::span<const size_type> splitRowNrs);
+    std::vector<Matrix> splitColumns(std::span<const size_type> splitColumnNrs);
+
+    // same splitting rules, yet the blocks are views of this matrix so no data is moved (e.g. for sharding the matrix
+    // among threads)
+    std::vector<BlockView> splitRowsIntoViews(std::span<const size_type> splitRowNrs);
+    std::vector<ConstBlockView> splitRowsIntoViews(std::span<const size_type> splitRowNrs) const;
+    std::vector<BlockView> splitColumnsIntoViews(std::span<const size_type> splitColumnNrs);
+    std::vector<ConstBlockView> splitColumnsIntoViews(std::span<const size_type> splitColumnNrs) const;
+
+    // copy of the block with the given position and dimensions (the resulting matrix has no spare capacity)
+    Matrix extract(size_type rowNr, size_type columnNr, size_type nrOfRows, size_type nrOfColumns) const;
+
+    // the source matrix block (position and dimensions provided as the first arguments) overwrites the same-sized block
+    // of this matrix starting at (rowNr, columnNr); the rvalue overload moves the block elements (the other source
+    // elements stay unchanged); trivially copyable elements are copied row by row with memcpy
+    void assignBlock(const Matrix& matrix, size_type matrixRowNr, size_type matrixColumnNr, size_type nrOfRows,
+                     size_type nrOfColumns, size_type rowNr, size_type columnNr);
+    void assignBlock(Matrix&& matrix, size_type matrixRowNr, size_type matrixColumnNr, size_type nrOfRows,
+                     size_type nrOfColumns, size_type rowNr, size_type columnNr);
+
     void swapRows(size_type firstRowNr, size_type secondRowNr);
     void swapColumns(size_type firstColumnNr, size_type secondColumnNr);
 
+    // the row/column with number permutation[nr] is moved to position nr (rows: only the row pointers are exchanged)
+    void permuteRows(const std::vector<size_type>& permutation);
+    void permuteColumns(const std::vector<size_type>& permutation);
+
+    // returns the permutation that restores the initial row/column order after applying the provided permutation
+    static std::vector<size_type> getInversePermutation(const std::vector<size_type>& permutation);
+
+    // column reordering without moving any elements until the new order gets materialized
+    ColumnOrderView columnOrderView();
+
     // the template type should have operator == implemented, otherwise a template specialization is required
     bool operator==(const Matrix& matrix) const;
 
@@ -438,12 +930,37 @@ private:
     // caller
     std::pair<size_type, size_type> _resizeWithUninitializedNewElements(size_type nrOfRows, size_type nrOfColumns);
 
-    // inserts the uninitialized row into the required position, initialialization is left to the caller
-    void _insertUninitializedRow(size_type rowNr);
+    // inserts the uninitialized rows into the required position, initialialization is left to the caller
+    void _insertUninitializedRows(size_type rowNr, size_type nrOfRows);
+
+    // inserts the uninitialized columns into the required position (the existing elements are shifted to make room for
+    // them), initialization is left to the caller
+    void _insertUninitializedColumns(size_type columnNr, size_type nrOfColumns);
+
+    // returns the element pointed to by the iterator as rvalue if the range is an rvalue that owns its elements (so
+    // they can be moved), otherwise as is (they get copied)
+    template <typename Range, typename Iterator> static decltype(auto) _getRangeElement(const Iterator& elementIt);
 
-    // inserts the uninitialized column either into the required position or into the last position (depending on
-    // available column capacity)
-    size_type _insertUninitializedColumn(size_type columnNr);
+    // transposes a square matrix with normalized capacity offsets by swapping the elements located symmetrically to the
+    // main diagonal (the swaps are performed tile by tile for better cache usage, the rows of tiles are distributed
+    // among threads)
+    void _swapTranspose(size_t nrOfThreads);
+
+    // transposes the matrix within the allocated memory by moving each element along the cycle (or chain) of positions
+    // it belongs to, the row and column capacity should be large enough to contain the transposed matrix (the chains
+    // and cycles are distributed among threads)
+    void _cycleTranspose(size_t nrOfThreads);
+
+    // transposes the matrix by moving the elements tile by tile into newly allocated memory, each thread constructs a
+    // contiguous band of destination rows (first-touch friendly)
+    void _moveTranspose(size_t nrOfThreads);
+
+    // reductions by an associative and commutative operation (sums, minimum/maximum values), the elements of a row
+    // might be reduced in any order
+    template <typename Result, typename Operation>
+    std::vector<Result> _reduceRowsUnordered(const Operation& operation, size_t nrOfThreads) const;
+    template <typename Result, typename Operation>
+    std::vector<Result> _reduceColumnsUnordered(const Operation& operation, size_t nrOfThreads) const;
 
     // erases the row or column (depending on isRow) by reallocating memory and putting back all elements except the
     // row/column (dimension element) to be removed
@@ -455,11 +972,22 @@ private:
     // erases the column without changing matrix capacity (shift right columns to left)
     void _shiftEraseColumn(size_type columnNr);
 
-    // places the first column into the new position by performing a rotation
-    void _rotateFirstColumn(size_type newColumnNr);
+    // batched versions of the above functions (the positions are strictly ascending and within matrix bounds)
+    void _reallocEraseDimensionElements(std::span<const size_type> dimensionElementNrs, bool isRow);
+    void _shiftEraseRows(std::span<const size_type> rowNrs);
+    void _shiftEraseColumns(std::span<const size_type> columnNrs);
+
+    // checks the positions passed to eraseRows()/eraseColumns()
+    static bool _arePositionsStrictlyAscending(std::span<const size_type> positions);
 
-    // places the last column into the new position by performing a rotation
-    void _rotateLastColumn(size_type newColumnNr);
+    // checks that the block with the given position and dimensions is contained within the matrix
+    bool _isBlockWithinBounds(size_type rowNr, size_type columnNr, size_type nrOfRows, size_type nrOfColumns) const;
+
+    // checks the positions used for splitting the matrix into multiple blocks (none of the blocks should be empty)
+    void _checkSplitPositions(std::span<const size_type> splitPositions, bool areRowPositions) const;
+
+    // checks that each position within [0, nrOfPositions) occurs exactly once
+    static bool _isPermutation(const std::vector<size_type>& permutation, size_t nrOfPositions);
 
     // moves the matrix rows to top (row capacity offset set to 0) as preparation for performing specific operations
     // (capacity can the be re-distributed by calling _normalizeRowCapacity())
@@ -497,6 +1025,12 @@ private:
     void _moveInitItems(Matrix& matrix, size_type matrixStartingRowNr, size_type matrixColumnOffset,
                         size_type startingRowNr, size_type columnOffset, size_type nrOfRows, size_type nrOfColumns);
 
+    // overwrite (already initialized) elements by copying/moving them from source matrix
+    void _copyAssignItems(const Matrix& matrix, size_type matrixStartingRowNr, size_type matrixColumnOffset,
+                          size_type startingRowNr, size_type columnOffset, size_type nrOfRows, size_type nrOfColumns);
+    void _moveAssignItems(Matrix& matrix, size_type matrixStartingRowNr, size_type matrixColumnOffset,
+                          size_type startingRowNr, size_type columnOffset, size_type nrOfRows, size_type nrOfColumns);
+
     // initialize all or part of the elements by filling in the same value
     void _fillInitItems(size_type startingRowNr, size_type columnOffset, size_type nrOfRows, size_type nrOfColumns,
                         const T& value);
@@ -533,6 +1067,118 @@ private:
     std::optional<size_type> m_ColumnCapacityOffset;
 };
 
+// builds a matrix row by row (e.g. when ingesting data), the row capacity is grown geometrically so each element is
+// moved at most a (small) constant number of times on average; the storage is then handed over to the resulting matrix
+// without copying or moving any element
+template <MatrixElementType T> class MatrixBuilder
+{
+public:
+    using size_type = typename Matrix<T>::size_type;
+
+    // 0 columns: the number of columns is determined by the first appended row
+    explicit MatrixBuilder(size_type nrOfColumns = 0, size_type rowCapacity = 0);
+
+    // the number of elements should match the number of columns (the elements get moved when the range is an rvalue
+    // owning them)
+    template <std::ranges::forward_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+    void appendRow(Range&& elements);
+
+    void reserve(size_type rowCapacity);
+
+    // the built matrix has the row capacity accumulated so far (might be larger than the number of rows) and the column
+    // capacity equal to the number of columns; the builder is brought to its initial state
+    Matrix<T> finish();
+
+    size_type getNrOfRows() const;
+    size_type getNrOfColumns() const;
+    size_type getRowCapacity() const;
+
+private:
+    // moves the rows into a new memory area that can contain the requested number of rows (all spare row capacity is
+    // kept at the bottom so rows can be appended without any shifting)
+    void _reallocRows(size_type rowCapacity);
+
+    Matrix<T> m_Matrix;
+    size_type m_RequiredNrOfColumns;
+    size_type m_RequestedRowCapacity;
+};
+
+// the expression classes below are not meant to be used directly, they are created by the arithmetic operators and
+// functions (see free functions); the referenced matrixes should not be modified or destroyed until evaluation
+template <MatrixElementType T> class MatrixReferenceExpression
+{
+public:
+    using value_type = T;
+    using size_type = typename Matrix<T>::size_type;
+
+    explicit MatrixReferenceExpression(const Matrix<T>& matrix);
+
+    size_type getNrOfRows() const;
+    size_type getNrOfColumns() const;
+    const T& evaluate(size_type rowNr, size_type columnNr) const;
+
+private:
+    const T* const* m_pRows;
+    size_type m_NrOfRows;
+    size_type m_NrOfColumns;
+};
+
+// scalar operand, it has the dimensions of the other operand so each element of it is "combined" with the scalar
+template <MatrixElementType T> class ScalarMatrixExpression
+{
+public:
+    using value_type = T;
+    using size_type = typename Matrix<T>::size_type;
+
+    ScalarMatrixExpression(const T& value, size_type nrOfRows, size_type nrOfColumns);
+
+    size_type getNrOfRows() const;
+    size_type getNrOfColumns() const;
+    const T& evaluate(size_type rowNr, size_type columnNr) const;
+
+private:
+    T m_Value;
+    size_type m_NrOfRows;
+    size_type m_NrOfColumns;
+};
+
+template <typename Operation, MatrixExpression Operand> class UnaryMatrixExpression
+{
+public:
+    using value_type = typename Operand::value_type;
+    using size_type = matrix_size_t;
+
+    explicit UnaryMatrixExpression(const Operand& operand);
+
+    size_type getNrOfRows() const;
+    size_type getNrOfColumns() const;
+    decltype(auto) evaluate(size_type rowNr, size_type columnNr) const;
+
+private:
+    Operand m_Operand;
+};
+
+template <typename Operation, MatrixExpression Lhs, MatrixExpression Rhs>
+    requires std::same_as<typename Lhs::value_type, typename Rhs::value_type>
+class BinaryMatrixExpression
+{
+public:
+    using value_type = typename Lhs::value_type;
+    using size_type = matrix_size_t;
+
+    // the operands should have the same dimensions
+    BinaryMatrixExpression(const Lhs& lhs, const Rhs& rhs);
+
+    size_type getNrOfRows() const;
+    size_type getNrOfColumns() const;
+    decltype(auto) evaluate(size_type rowNr, size_type columnNr) const;
+
+private:
+    Lhs m_Lhs;
+    Rhs m_Rhs;
+};
+
 // 1) ZIterator - iterates within matrix from [0][0] to the end row by row
 template <MatrixElementType T> typename Matrix<T>::ZIterator& Matrix<T>::ZIterator::operator++()
 {
@@ -2718,1173 +3364,2790 @@ template <MatrixElementType T> bool Matrix<T>::ConstReverseMIterator::_isEmpty()
     CHECK_MITERATOR_IS_EMPTY(m_pMatrixPtr, m_DiagonalNr, m_DiagonalSize, m_DiagonalIndex, m_NrOfMatrixColumns);
 }
 
-// matrix methods
+// 17) TransposedView - rows of the view are the columns of the underlying matrix
 
-template <MatrixElementType T> Matrix<T>::Matrix()
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::TransposedView::getNrOfRows() const
 {
-    _allocMemory(0, 0);
+    return m_pMatrix->getNrOfColumns();
 }
 
-template <MatrixElementType T>
-Matrix<T>::Matrix(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns, std::vector<T>&& vec)
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::TransposedView::getNrOfColumns() const
 {
-    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
-
-    CHECK_ERROR_CONDITION(0 == nrOfRows || 0 == nrOfColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
-    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension || nrOfColumns > c_MaxAllowedDimension,
-                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
-    CHECK_ERROR_CONDITION(nrOfRows * nrOfColumns > vec.size(),
-                          Matr::errorMessages[Matr::Errors::INSUFFICIENT_ELEMENTS_FOR_INIT]);
-
-    const size_type c_RowCapacityToAlloc{
-        std::min(static_cast<size_type>(nrOfRows + nrOfRows / 4), c_MaxAllowedDimension)};
-    const size_type c_ColumnCapacityToAlloc{
-        std::min(static_cast<size_type>(nrOfColumns + nrOfColumns / 4), c_MaxAllowedDimension)};
-
-    _allocMemory(nrOfRows, nrOfColumns, c_RowCapacityToAlloc, c_ColumnCapacityToAlloc);
-
-    typename std::vector<T>::iterator vecIterator{vec.begin()};
-
-    /* absRowNr = absolute row number, i.e. number of the row within "physical" matrix (that includes free row/column
-       capacity) When the "abs" keyword is missing (i.e. rowNr), then the row number within "logical" (actually used)
-       matrix (excluding free capacity) is meant (see other methods too)
-    */
-    for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
-    {
-        std::uninitialized_move_n(vecIterator, m_NrOfColumns, m_pBaseArrayPtr[absRowNr]);
-        vecIterator += m_NrOfColumns;
-    }
+    return m_pMatrix->getNrOfRows();
 }
 
-template <MatrixElementType T> Matrix<T>::Matrix(Matrix<T>::dimensions_t dimensions, const T& value)
+template <MatrixElementType T> bool Matrix<T>::TransposedView::isEmpty() const
 {
-    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
-    const auto& [nrOfRows, nrOfColumns] = dimensions;
-
-    CHECK_ERROR_CONDITION(0 == nrOfRows || 0 == nrOfColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
-    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension || nrOfColumns > c_MaxAllowedDimension,
-                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
-
-    const size_type c_RowCapacityToAlloc{
-        std::min(static_cast<size_type>(nrOfRows + nrOfRows / 4), c_MaxAllowedDimension)};
-    const size_type c_ColumnCapacityToAlloc{
-        std::min(static_cast<size_type>(nrOfColumns + nrOfColumns / 4), c_MaxAllowedDimension)};
-
-    _allocMemory(nrOfRows, nrOfColumns, c_RowCapacityToAlloc, c_ColumnCapacityToAlloc);
-    _fillInitItems(0, 0, nrOfRows, nrOfColumns, value);
+    return m_pMatrix->isEmpty();
 }
 
 template <MatrixElementType T>
-Matrix<T>::Matrix(Matrix<T>::size_type nrOfRowsColumns, const std::pair<T, T>& diagMatrixValues)
+T& Matrix<T>::TransposedView::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
 {
-    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
-
-    CHECK_ERROR_CONDITION(0 == nrOfRowsColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
-    CHECK_ERROR_CONDITION(nrOfRowsColumns > c_MaxAllowedDimension,
-                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
-
-    const size_type c_RowColumnCapacityToAlloc{
-        std::min(static_cast<size_type>(nrOfRowsColumns + nrOfRowsColumns / 4), c_MaxAllowedDimension)};
-
-    _allocMemory(nrOfRowsColumns, nrOfRowsColumns, c_RowColumnCapacityToAlloc, c_RowColumnCapacityToAlloc);
+    return m_pMatrix->at(columnNr, rowNr);
+}
 
-    const auto& [allButMainDiagValue, mainDiagValue]{diagMatrixValues};
+template <MatrixElementType T>
+const T& Matrix<T>::TransposedView::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
+{
+    return std::as_const(*m_pMatrix).at(columnNr, rowNr);
+}
 
-    for (size_type absRowNr{*m_RowCapacityOffset}, columnNr{0}; columnNr < nrOfRowsColumns; ++columnNr, ++absRowNr)
-    {
-        T* const pRowBegin{m_pBaseArrayPtr[absRowNr]};
-        T* const pMainDiagElement{m_pBaseArrayPtr[absRowNr] + columnNr};
-        T* const pRowEnd{m_pBaseArrayPtr[absRowNr] + nrOfRowsColumns};
+template <MatrixElementType T> typename Matrix<T>::TransposedView::ZIterator Matrix<T>::TransposedView::zBegin()
+{
+    return m_pMatrix->nBegin();
+}
 
-        std::uninitialized_fill(pRowBegin, pMainDiagElement, allButMainDiagValue);
-        std::uninitialized_fill(pMainDiagElement, pMainDiagElement + 1, mainDiagValue);
-        std::uninitialized_fill(pMainDiagElement + 1, pRowEnd, allButMainDiagValue);
-    }
+template <MatrixElementType T> typename Matrix<T>::TransposedView::ZIterator Matrix<T>::TransposedView::zEnd()
+{
+    return m_pMatrix->nEnd();
 }
 
 template <MatrixElementType T>
-Matrix<T>::Matrix(const Matrix<T>& matrix)
-    : Matrix{}
+typename Matrix<T>::TransposedView::ZIterator Matrix<T>::TransposedView::zRowBegin(Matrix<T>::size_type rowNr)
 {
-    _copyAssignMatrix(matrix);
+    return m_pMatrix->nColumnBegin(rowNr);
 }
 
 template <MatrixElementType T>
-Matrix<T>::Matrix(Matrix<T>&& matrix)
-    : Matrix{}
+typename Matrix<T>::TransposedView::ZIterator Matrix<T>::TransposedView::zRowEnd(Matrix<T>::size_type rowNr)
 {
-    _moveAssignMatrix(matrix);
+    return m_pMatrix->nColumnEnd(rowNr);
 }
 
-template <MatrixElementType T> Matrix<T>::~Matrix()
+template <MatrixElementType T>
+typename Matrix<T>::TransposedView::ZIterator Matrix<T>::TransposedView::getZIterator(
+    Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
 {
-    _deallocMemory();
+    return m_pMatrix->getNIterator(columnNr, rowNr);
 }
 
-template <MatrixElementType T> T& Matrix<T>::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+template <MatrixElementType T> typename Matrix<T>::TransposedView::NIterator Matrix<T>::TransposedView::nBegin()
 {
-    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows || columnNr >= m_NrOfColumns,
-                          Matr::errorMessages[Matr::Errors::INVALID_ELEMENT_INDEX]);
-    return m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr][columnNr];
+    return m_pMatrix->zBegin();
 }
 
-template <MatrixElementType T> const T& Matrix<T>::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
+template <MatrixElementType T> typename Matrix<T>::TransposedView::NIterator Matrix<T>::TransposedView::nEnd()
 {
-    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows || columnNr >= m_NrOfColumns,
-                          Matr::errorMessages[Matr::Errors::INVALID_ELEMENT_INDEX]);
-    return m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr][columnNr];
+    return m_pMatrix->zEnd();
 }
 
-template <MatrixElementType T> Matrix<T>& Matrix<T>::operator=(const Matrix<T>& matrix)
+template <MatrixElementType T>
+typename Matrix<T>::TransposedView::NIterator Matrix<T>::TransposedView::nColumnBegin(Matrix<T>::size_type columnNr)
 {
-    _copyAssignMatrix(matrix);
-    return *this;
+    return m_pMatrix->zRowBegin(columnNr);
 }
 
-template <MatrixElementType T> Matrix<T>& Matrix<T>::operator=(Matrix<T>&& matrix)
+template <MatrixElementType T>
+typename Matrix<T>::TransposedView::NIterator Matrix<T>::TransposedView::nColumnEnd(Matrix<T>::size_type columnNr)
 {
-    _moveAssignMatrix(matrix);
-    return *this;
+    return m_pMatrix->zRowEnd(columnNr);
 }
 
-// a contiguous unidimensional array with the matrix elements (in row order) is returned to user
-template <MatrixElementType T> void* Matrix<T>::getBaseArray(Matrix<T>::size_type& nrOfElements)
+template <MatrixElementType T>
+typename Matrix<T>::TransposedView::NIterator Matrix<T>::TransposedView::getNIterator(
+    Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
 {
-    void* pAllocPtr{nullptr};
-
-    if (!isEmpty())
-    {
-        shrinkToFit(); // when transfering ownership user should get exactly the number of elements contained in the
-                       // used lines and columns (no extra capacity to be included)
-        pAllocPtr = _convertToArray(nrOfElements);
-    }
-    else
-    {
-        nrOfElements = 0;
-    }
-
-    return pAllocPtr;
+    return m_pMatrix->getZIterator(columnNr, rowNr);
 }
 
-template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::getNrOfRows() const
+template <MatrixElementType T> typename Matrix<T>::TransposedView::ZIterator Matrix<T>::TransposedView::begin()
 {
-    return m_NrOfRows;
+    return zBegin();
 }
 
-template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::getNrOfColumns() const
+template <MatrixElementType T> typename Matrix<T>::TransposedView::ZIterator Matrix<T>::TransposedView::end()
 {
-    return m_NrOfColumns;
+    return zEnd();
 }
 
-template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::getRowCapacity() const
+template <MatrixElementType T>
+Matrix<T>::TransposedView::TransposedView(Matrix<T>& matrix)
+    : m_pMatrix{&matrix}
 {
-    return m_RowCapacity;
 }
 
-template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::getColumnCapacity() const
+// 18) ConstTransposedView
+
+template <MatrixElementType T>
+Matrix<T>::ConstTransposedView::ConstTransposedView(const Matrix<T>::TransposedView& transposedView)
+    : m_pMatrix{transposedView.m_pMatrix}
 {
-    return m_ColumnCapacity;
 }
-#ifdef USE_CAPACITY_OFFSET
-template <MatrixElementType T> std::optional<typename Matrix<T>::size_type> Matrix<T>::getRowCapacityOffset() const
+
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::ConstTransposedView::getNrOfRows() const
 {
-    return m_RowCapacityOffset;
+    return m_pMatrix->getNrOfColumns();
 }
 
-template <MatrixElementType T> std::optional<typename Matrix<T>::size_type> Matrix<T>::getColumnCapacityOffset() const
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::ConstTransposedView::getNrOfColumns() const
 {
-    return m_ColumnCapacityOffset;
+    return m_pMatrix->getNrOfRows();
 }
-#endif
-template <MatrixElementType T> bool Matrix<T>::isEmpty() const
-{
-    if (m_pAllocPtr)
-    {
-        assert(m_pBaseArrayPtr && m_NrOfRows > 0 && m_NrOfColumns > 0 && m_RowCapacity >= m_NrOfRows &&
-               m_ColumnCapacity >= m_NrOfColumns && m_RowCapacityOffset >= 0 && m_ColumnCapacityOffset >= 0);
-    }
-    else
-    {
-        assert(!m_pBaseArrayPtr && 0 == m_NrOfRows && 0 == m_NrOfColumns && 0 == m_RowCapacity &&
-               0 == m_ColumnCapacity && !m_RowCapacityOffset.has_value() && !m_ColumnCapacityOffset.has_value());
-    }
 
-    return !m_pAllocPtr;
+template <MatrixElementType T> bool Matrix<T>::ConstTransposedView::isEmpty() const
+{
+    return m_pMatrix->isEmpty();
 }
 
-template <MatrixElementType T> void Matrix<T>::transpose()
+template <MatrixElementType T>
+const T& Matrix<T>::ConstTransposedView::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
 {
-    if (!isEmpty())
-    {
-        constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
-
-        const size_type c_NewNrOfRows{m_NrOfColumns};
-        const size_type c_NewNrOfColumns{m_NrOfRows};
-        const size_type c_NewRowCapacity{
-            m_RowCapacity < m_NrOfColumns
-                ? std::min(static_cast<size_type>(m_NrOfColumns + m_NrOfColumns / 4), c_MaxAllowedDimension)
-                : m_RowCapacity};
-        const size_type c_NewColumnCapacity{
-            m_ColumnCapacity < m_NrOfRows
-                ? std::min(static_cast<size_type>(m_NrOfRows + m_NrOfRows / 4), c_MaxAllowedDimension)
-                : m_ColumnCapacity};
-
-        Matrix helperMatrix{std::move(*this)};
-
-        _deallocMemory(); // not actually required, just for "safety" and consistency purposes
-        _allocMemory(helperMatrix.m_NrOfColumns, helperMatrix.m_NrOfRows, c_NewRowCapacity, c_NewColumnCapacity);
-
-        // no use of _moveInitItems(), too much overhead
-        for (size_type absRowNr{*m_RowCapacityOffset}, rowNr{0}; rowNr < c_NewNrOfRows; ++rowNr, ++absRowNr)
-        {
-            for (size_type helperMatrixAbsRowNr{*helperMatrix.m_RowCapacityOffset}, columnNr{0};
-                 columnNr < c_NewNrOfColumns; ++columnNr, ++helperMatrixAbsRowNr)
-            {
-                std::uninitialized_move_n(helperMatrix.m_pBaseArrayPtr[helperMatrixAbsRowNr] + rowNr, 1,
-                                          m_pBaseArrayPtr[absRowNr] + columnNr);
-            }
-        }
-    }
+    return m_pMatrix->at(columnNr, rowNr);
 }
 
-template <MatrixElementType T> void Matrix<T>::clear()
+template <MatrixElementType T>
+typename Matrix<T>::ConstTransposedView::ConstZIterator Matrix<T>::ConstTransposedView::constZBegin() const
 {
-    _deallocMemory();
+    return m_pMatrix->constNBegin();
 }
 
-template <MatrixElementType T> void Matrix<T>::resize(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
+template <MatrixElementType T>
+typename Matrix<T>::ConstTransposedView::ConstZIterator Matrix<T>::ConstTransposedView::constZEnd() const
 {
-    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
-
-    CHECK_ERROR_CONDITION(0 == nrOfRows || 0 == nrOfColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
-    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension || nrOfColumns > c_MaxAllowedDimension,
-                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
-
-    const auto [c_NrOfRemainingRows,
-                c_NrOfRemainingColumns]{_resizeWithUninitializedNewElements(nrOfRows, nrOfColumns)};
-
-    // initialize new elements to the right side of the retained ones
-    if (m_NrOfColumns > c_NrOfRemainingColumns)
-    {
-        _defaultConstructInitItems(0, c_NrOfRemainingColumns, c_NrOfRemainingRows,
-                                   m_NrOfColumns - c_NrOfRemainingColumns);
-    }
+    return m_pMatrix->constNEnd();
+}
 
-    // same for the ones below
-    if (m_NrOfRows > c_NrOfRemainingRows)
-    {
-        _defaultConstructInitItems(c_NrOfRemainingRows, 0, nrOfRows - c_NrOfRemainingRows, m_NrOfColumns);
-    }
+template <MatrixElementType T>
+typename Matrix<T>::ConstTransposedView::ConstZIterator Matrix<T>::ConstTransposedView::constZRowBegin(
+    Matrix<T>::size_type rowNr) const
+{
+    return m_pMatrix->constNColumnBegin(rowNr);
+}
 
-    _normalizeRowCapacity();
+template <MatrixElementType T>
+typename Matrix<T>::ConstTransposedView::ConstZIterator Matrix<T>::ConstTransposedView::constZRowEnd(
+    Matrix<T>::size_type rowNr) const
+{
+    return m_pMatrix->constNColumnEnd(rowNr);
 }
 
 template <MatrixElementType T>
-void Matrix<T>::resize(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns, const T& value)
+typename Matrix<T>::ConstTransposedView::ConstZIterator Matrix<T>::ConstTransposedView::getConstZIterator(
+    Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
 {
-    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+    return m_pMatrix->getConstNIterator(columnNr, rowNr);
+}
 
-    CHECK_ERROR_CONDITION(0 == nrOfRows || 0 == nrOfColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
-    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension || nrOfColumns > c_MaxAllowedDimension,
-                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+template <MatrixElementType T>
+typename Matrix<T>::ConstTransposedView::ConstNIterator Matrix<T>::ConstTransposedView::constNBegin() const
+{
+    return m_pMatrix->constZBegin();
+}
 
-    const auto [c_NrOfRemainingRows,
-                c_NrOfRemainingColumns]{_resizeWithUninitializedNewElements(nrOfRows, nrOfColumns)};
+template <MatrixElementType T>
+typename Matrix<T>::ConstTransposedView::ConstNIterator Matrix<T>::ConstTransposedView::constNEnd() const
+{
+    return m_pMatrix->constZEnd();
+}
 
-    // initialize new elements to the right side of the retained ones
-    if (m_NrOfColumns > c_NrOfRemainingColumns)
-    {
-        _fillInitItems(0, c_NrOfRemainingColumns, c_NrOfRemainingRows, m_NrOfColumns - c_NrOfRemainingColumns, value);
-    }
+template <MatrixElementType T>
+typename Matrix<T>::ConstTransposedView::ConstNIterator Matrix<T>::ConstTransposedView::constNColumnBegin(
+    Matrix<T>::size_type columnNr) const
+{
+    return m_pMatrix->constZRowBegin(columnNr);
+}
 
-    // same for the ones below
-    if (m_NrOfRows > c_NrOfRemainingRows)
-    {
-        _fillInitItems(c_NrOfRemainingRows, 0, nrOfRows - c_NrOfRemainingRows, m_NrOfColumns, value);
-    }
+template <MatrixElementType T>
+typename Matrix<T>::ConstTransposedView::ConstNIterator Matrix<T>::ConstTransposedView::constNColumnEnd(
+    Matrix<T>::size_type columnNr) const
+{
+    return m_pMatrix->constZRowEnd(columnNr);
+}
 
-    _normalizeRowCapacity();
+template <MatrixElementType T>
+typename Matrix<T>::ConstTransposedView::ConstNIterator Matrix<T>::ConstTransposedView::getConstNIterator(
+    Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
+{
+    return m_pMatrix->getConstZIterator(columnNr, rowNr);
 }
 
 template <MatrixElementType T>
-void Matrix<T>::reserve(Matrix<T>::size_type rowCapacity, Matrix<T>::size_type columnCapacity)
+typename Matrix<T>::ConstTransposedView::ConstZIterator Matrix<T>::ConstTransposedView::begin() const
 {
-    if (!isEmpty())
-    {
-        constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+    return constZBegin();
+}
 
-        const size_type c_NewRowCapacity{std::clamp<size_type>(rowCapacity, m_NrOfRows, c_MaxAllowedDimension)};
-        const size_type c_NewColumnCapacity{
-            std::clamp<size_type>(columnCapacity, m_NrOfColumns, c_MaxAllowedDimension)};
+template <MatrixElementType T>
+typename Matrix<T>::ConstTransposedView::ConstZIterator Matrix<T>::ConstTransposedView::end() const
+{
+    return constZEnd();
+}
 
-        if (m_RowCapacity != c_NewRowCapacity || m_ColumnCapacity != c_NewColumnCapacity)
-        {
-            Matrix matrix{std::move(*this)};
+template <MatrixElementType T>
+Matrix<T>::ConstTransposedView::ConstTransposedView(const Matrix<T>& matrix)
+    : m_pMatrix{&matrix}
+{
+}
 
-            _deallocMemory(); // actually not required, just for safety purposes
-            _allocMemory(matrix.m_NrOfRows, matrix.m_NrOfColumns, c_NewRowCapacity, c_NewColumnCapacity);
+// 19) ColumnOrderView - column columnNr of the view is column m_PhysicalColumnNrs[columnNr] of the matrix
 
-            // move the retained items back
-            _moveInitItems(matrix, 0, 0, 0, 0, matrix.m_NrOfRows, matrix.m_NrOfColumns);
-        }
-    }
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::ColumnOrderView::getNrOfRows() const
+{
+    return m_pMatrix->getNrOfRows();
 }
 
-template <MatrixElementType T> void Matrix<T>::shrinkToFit()
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::ColumnOrderView::getNrOfColumns() const
 {
-    if (m_RowCapacity != m_NrOfRows || m_ColumnCapacity != m_NrOfColumns)
-    {
-        Matrix helperMatrix{std::move(*this)};
-
-        _deallocMemory(); // just for safety purposes, not actually needed
-        _allocMemory(helperMatrix.m_NrOfRows, helperMatrix.m_NrOfColumns);
-        _moveInitItems(helperMatrix, 0, 0, 0, 0, m_NrOfRows, m_NrOfColumns);
-    }
+    return m_pMatrix->getNrOfColumns();
 }
 
-template <MatrixElementType T> void Matrix<T>::insertRow(Matrix<T>::size_type rowNr)
+template <MatrixElementType T> bool Matrix<T>::ColumnOrderView::isEmpty() const
 {
-    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
-
-    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
-    CHECK_ERROR_CONDITION(c_MaxAllowedDimension == m_NrOfRows,
-                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
-    CHECK_ERROR_CONDITION(rowNr > m_NrOfRows, Matr::errorMessages[Matr::Errors::INSERT_ROW_NONCONTIGUOUS]);
-
-    _insertUninitializedRow(rowNr);
-
-    std::uninitialized_default_construct_n(m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr], m_NrOfColumns);
+    return m_pMatrix->isEmpty();
 }
 
-template <MatrixElementType T> void Matrix<T>::insertRow(Matrix<T>::size_type rowNr, const T& value)
+template <MatrixElementType T>
+T& Matrix<T>::ColumnOrderView::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
 {
-    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+    CHECK_ERROR_CONDITION(columnNr >= m_PhysicalColumnNrs.size(),
+                          Matr::errorMessages[Matr::Errors::INVALID_ELEMENT_INDEX]);
 
-    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
-    CHECK_ERROR_CONDITION(c_MaxAllowedDimension == m_NrOfRows,
-                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
-    CHECK_ERROR_CONDITION(rowNr > m_NrOfRows, Matr::errorMessages[Matr::Errors::INSERT_ROW_NONCONTIGUOUS]);
+    return m_pMatrix->at(rowNr, m_PhysicalColumnNrs[columnNr]);
+}
 
-    _insertUninitializedRow(rowNr);
+template <MatrixElementType T>
+const T& Matrix<T>::ColumnOrderView::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
+{
+    CHECK_ERROR_CONDITION(columnNr >= m_PhysicalColumnNrs.size(),
+                          Matr::errorMessages[Matr::Errors::INVALID_ELEMENT_INDEX]);
 
-    std::uninitialized_fill_n(m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr], m_NrOfColumns, value);
+    return std::as_const(*m_pMatrix).at(rowNr, m_PhysicalColumnNrs[columnNr]);
 }
 
-template <MatrixElementType T> void Matrix<T>::insertColumn(Matrix<T>::size_type columnNr)
+template <MatrixElementType T>
+typename Matrix<T>::size_type Matrix<T>::ColumnOrderView::getPhysicalColumnNr(Matrix<T>::size_type columnNr) const
 {
-    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
-
-    CHECK_ERROR_CONDITION(!m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
-    CHECK_ERROR_CONDITION(c_MaxAllowedDimension == m_NrOfColumns,
-                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
-    CHECK_ERROR_CONDITION(columnNr > m_NrOfColumns, Matr::errorMessages[Matr::Errors::INSERT_COLUMN_NONCONTIGUOUS]);
+    CHECK_ERROR_CONDITION(columnNr >= m_PhysicalColumnNrs.size(),
+                          Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
 
-    const size_type c_UninitializedColumnNr{_insertUninitializedColumn(columnNr)};
+    return m_PhysicalColumnNrs[columnNr];
+}
 
-    for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
-    {
-        std::uninitialized_default_construct_n(m_pBaseArrayPtr[absRowNr] + c_UninitializedColumnNr, 1);
-    }
+template <MatrixElementType T> bool Matrix<T>::ColumnOrderView::isPhysicalOrder() const
+{
+    bool isPhysicalOrder{true};
 
-    // the rotation of the column should be done after initialization, otherwise an error occurs when rotating
-    // uninitialized elements
-    if (c_UninitializedColumnNr != columnNr)
+    for (size_t columnNr{0}; columnNr < m_PhysicalColumnNrs.size(); ++columnNr)
     {
-        if (0 == c_UninitializedColumnNr)
+        if (m_PhysicalColumnNrs[columnNr] != columnNr)
         {
-            _rotateFirstColumn(columnNr);
-        }
-        else if (m_NrOfColumns - 1 == c_UninitializedColumnNr)
-        {
-            _rotateLastColumn(columnNr);
-        }
-        else
-        {
-            assert(false);
+            isPhysicalOrder = false;
+            break;
         }
     }
+
+    return isPhysicalOrder;
 }
 
-template <MatrixElementType T> void Matrix<T>::insertColumn(Matrix<T>::size_type columnNr, const T& value)
+template <MatrixElementType T>
+void Matrix<T>::ColumnOrderView::swapColumns(Matrix<T>::size_type firstColumnNr, Matrix<T>::size_type secondColumnNr)
 {
-    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+    CHECK_ERROR_CONDITION(firstColumnNr >= m_PhysicalColumnNrs.size() || secondColumnNr >= m_PhysicalColumnNrs.size(),
+                          Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
 
-    CHECK_ERROR_CONDITION(!m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
-    CHECK_ERROR_CONDITION(c_MaxAllowedDimension == m_NrOfColumns,
-                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
-    CHECK_ERROR_CONDITION(columnNr > m_NrOfColumns, Matr::errorMessages[Matr::Errors::INSERT_COLUMN_NONCONTIGUOUS]);
+    std::swap(m_PhysicalColumnNrs[firstColumnNr], m_PhysicalColumnNrs[secondColumnNr]);
+}
 
-    const size_type c_UninitializedColumnNr{_insertUninitializedColumn(columnNr)};
+template <MatrixElementType T>
+void Matrix<T>::ColumnOrderView::permuteColumns(const std::vector<Matrix<T>::size_type>& permutation)
+{
+    CHECK_ERROR_CONDITION(!_isPermutation(permutation, m_PhysicalColumnNrs.size()),
+                          Matr::errorMessages[Matr::Errors::INVALID_PERMUTATION]);
 
-    _fillInitItems(0, c_UninitializedColumnNr, m_NrOfRows, 1, value);
+    const std::vector<size_type> c_InitialPhysicalColumnNrs{m_PhysicalColumnNrs};
 
-    // the rotation of the column should be done after initialization, otherwise an error occurs when rotating
-    // uninitialized elements
-    if (c_UninitializedColumnNr != columnNr)
+    for (size_t columnNr{0}; columnNr < permutation.size(); ++columnNr)
     {
-        if (0 == c_UninitializedColumnNr)
-        {
-            _rotateFirstColumn(columnNr);
-        }
-        else if (m_NrOfColumns - 1 == c_UninitializedColumnNr)
-        {
-            _rotateLastColumn(columnNr);
-        }
-        else
-        {
-            assert(false);
-        }
+        m_PhysicalColumnNrs[columnNr] = c_InitialPhysicalColumnNrs[permutation[columnNr]];
     }
 }
 
-template <MatrixElementType T> void Matrix<T>::eraseRow(Matrix<T>::size_type rowNr)
+template <MatrixElementType T>
+void Matrix<T>::ColumnOrderView::moveColumn(Matrix<T>::size_type columnNr, Matrix<T>::size_type destColumnNr)
 {
-    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows, Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
+    CHECK_ERROR_CONDITION(columnNr >= m_PhysicalColumnNrs.size() || destColumnNr >= m_PhysicalColumnNrs.size(),
+                          Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
 
-    if (1 == m_NrOfRows)
+    auto columnIt{m_PhysicalColumnNrs.begin() + columnNr};
+    auto destColumnIt{m_PhysicalColumnNrs.begin() + destColumnNr};
+
+    if (columnNr < destColumnNr)
     {
-        _deallocMemory();
+        std::rotate(columnIt, columnIt + 1, destColumnIt + 1);
     }
-    else if (const size_type c_RemainingNrOfRows{static_cast<size_type>(m_NrOfRows - 1)};
-             c_RemainingNrOfRows <= m_RowCapacity / 4)
+    else if (columnNr > destColumnNr)
     {
-        _reallocEraseDimensionElement(rowNr, true);
+        std::rotate(destColumnIt, columnIt, columnIt + 1);
     }
-    else
+}
+
+template <MatrixElementType T> void Matrix<T>::ColumnOrderView::materializeColumnOrder()
+{
+    if (!isPhysicalOrder())
     {
-        _shiftEraseRow(rowNr);
+        m_pMatrix->permuteColumns(m_PhysicalColumnNrs);
+        std::iota(m_PhysicalColumnNrs.begin(), m_PhysicalColumnNrs.end(), size_type{0});
     }
 }
 
-template <MatrixElementType T> void Matrix<T>::eraseColumn(Matrix<T>::size_type columnNr)
+template <MatrixElementType T>
+Matrix<T>::ColumnOrderView::ColumnOrderView(Matrix<T>& matrix)
+    : m_pMatrix{&matrix}
+    , m_PhysicalColumnNrs(matrix.getNrOfColumns())
 {
-    CHECK_ERROR_CONDITION(columnNr >= m_NrOfColumns, Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
-
-    if (1 == m_NrOfColumns)
-    {
-        _deallocMemory();
-    }
-    else if (const size_type c_RemainingNrOfColumns{static_cast<size_type>(m_NrOfColumns - 1)};
-             c_RemainingNrOfColumns <= m_ColumnCapacity / 4)
-    {
-        _reallocEraseDimensionElement(columnNr, false);
-    }
-    else
-    {
-        _shiftEraseColumn(columnNr);
-    }
+    std::iota(m_PhysicalColumnNrs.begin(), m_PhysicalColumnNrs.end(), size_type{0});
 }
 
-template <MatrixElementType T> void Matrix<T>::catByRow(Matrix<T>& matrix)
-{
-    if (&matrix != this)
-    {
-        CHECK_ERROR_CONDITION(m_NrOfColumns != matrix.m_NrOfColumns,
-                              Matr::errorMessages[Matr::Errors::MATRIXES_UNEQUAL_ROW_LENGTH]);
-    }
-
-    const size_type c_OldNrOfRows{m_NrOfRows};
-    const size_type c_NewNrOfRows{static_cast<size_type>(m_NrOfRows + matrix.m_NrOfRows)};
+// 20) BlockView - element (rowNr, columnNr) of the view is element (m_RowOffset + rowNr, m_ColumnOffset + columnNr) of
+// the matrix
 
-    CHECK_ERROR_CONDITION(c_NewNrOfRows > maxAllowedDimension(),
-                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::BlockView::getNrOfRows() const
+{
+    return m_NrOfRows;
+}
 
-    if (c_NewNrOfRows <= m_RowCapacity)
-    {
-        _alignToTop();
-        m_NrOfRows = c_NewNrOfRows;
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::BlockView::getNrOfColumns() const
+{
+    return m_NrOfColumns;
+}
 
-        if (&matrix != this)
-        {
-            _moveInitItems(matrix, 0, 0, c_OldNrOfRows, 0, matrix.m_NrOfRows, matrix.m_NrOfColumns);
-        }
-        else
-        {
-            _copyInitItems(*this, 0, 0, c_OldNrOfRows, 0, c_OldNrOfRows, m_NrOfColumns);
-        }
+template <MatrixElementType T> bool Matrix<T>::BlockView::isEmpty() const
+{
+    return 0 == m_NrOfRows;
+}
 
-        _normalizeRowCapacity();
-    }
-    else
-    {
-        const size_type c_OldColumnCapacity{m_ColumnCapacity};
-        Matrix helperMatrix{std::move(*this)};
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::BlockView::getRowOffset() const
+{
+    return m_RowOffset;
+}
 
-        _deallocMemory(); // actually not required, just for safety purposes
-        _allocMemory(c_NewNrOfRows, helperMatrix.m_NrOfColumns, c_NewNrOfRows, c_OldColumnCapacity);
-        _moveInitItems(helperMatrix, 0, 0, 0, 0, helperMatrix.m_NrOfRows, helperMatrix.m_NrOfColumns);
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::BlockView::getColumnOffset() const
+{
+    return m_ColumnOffset;
+}
 
-        if (&matrix != this)
-        {
-            _moveInitItems(matrix, 0, 0, c_OldNrOfRows, 0, matrix.m_NrOfRows, matrix.m_NrOfColumns);
-        }
-        else
-        {
-            _copyInitItems(*this, 0, 0, c_OldNrOfRows, 0, c_OldNrOfRows, m_NrOfColumns);
-        }
-    }
+template <MatrixElementType T>
+T& Matrix<T>::BlockView::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows || columnNr >= m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::INVALID_ELEMENT_INDEX]);
 
-    // clear the source matrix as its content is no longer usable
-    if (&matrix != this)
-    {
-        matrix._deallocMemory();
-    }
+    return m_pMatrix->at(m_RowOffset + rowNr, m_ColumnOffset + columnNr);
 }
 
-template <MatrixElementType T> void Matrix<T>::catByColumn(Matrix& matrix)
+template <MatrixElementType T>
+const T& Matrix<T>::BlockView::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
 {
-    if (&matrix != this)
-    {
-        CHECK_ERROR_CONDITION(m_NrOfRows != matrix.m_NrOfRows,
-                              Matr::errorMessages[Matr::Errors::MATRIXES_UNEQUAL_COLUMN_LENGTH]);
-    }
-
-    const size_type c_OldNrOfColumns{m_NrOfColumns};
-    const size_type c_NewNrOfColumns{static_cast<size_type>(m_NrOfColumns + matrix.m_NrOfColumns)};
+    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows || columnNr >= m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::INVALID_ELEMENT_INDEX]);
 
-    CHECK_ERROR_CONDITION(c_NewNrOfColumns > maxAllowedDimension(),
-                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+    return std::as_const(*m_pMatrix).at(m_RowOffset + rowNr, m_ColumnOffset + columnNr);
+}
 
-    if (!matrix.isEmpty())
-    {
-        if (c_NewNrOfColumns <= m_ColumnCapacity)
-        {
-            const size_type c_ColumnConcatenationSpace{
-                static_cast<size_type>(m_ColumnCapacity - *m_ColumnCapacityOffset)};
+template <MatrixElementType T> std::span<T> Matrix<T>::BlockView::getRow(Matrix<T>::size_type rowNr)
+{
+    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows, Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
 
-            // if not enough available capacity on the right side, then the columns should be shifted left by the
-            // minimal count of positions that ensure the concatenated content fits
-            if (c_NewNrOfColumns > c_ColumnConcatenationSpace)
-            {
-                const size_type c_NrOfColumnsToShiftLeft{
-                    static_cast<size_type>(c_NewNrOfColumns - c_ColumnConcatenationSpace)};
-                _shiftColumnsLeft(c_NrOfColumnsToShiftLeft);
-            }
+    return {m_pMatrix->m_pBaseArrayPtr[*m_pMatrix->m_RowCapacityOffset + m_RowOffset + rowNr] + m_ColumnOffset,
+            m_NrOfColumns};
+}
 
-            m_NrOfColumns = c_NewNrOfColumns;
+template <MatrixElementType T> std::span<const T> Matrix<T>::BlockView::getRow(Matrix<T>::size_type rowNr) const
+{
+    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows, Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
 
-            if (&matrix != this)
-            {
-                _moveInitItems(matrix, 0, 0, 0, c_OldNrOfColumns, matrix.m_NrOfRows, matrix.m_NrOfColumns);
-            }
-            else
-            {
-                _copyInitItems(*this, 0, 0, 0, c_OldNrOfColumns, m_NrOfRows, c_OldNrOfColumns);
-            }
-        }
-        else
-        {
-            const size_type c_OldRowCapacity{m_RowCapacity};
-            const size_type c_NewColumnCapacity{std::max(m_ColumnCapacity, c_NewNrOfColumns)};
+    return {m_pMatrix->m_pBaseArrayPtr[*m_pMatrix->m_RowCapacityOffset + m_RowOffset + rowNr] + m_ColumnOffset,
+            m_NrOfColumns};
+}
 
-            Matrix helperMatrix{std::move(*this)};
+template <MatrixElementType T>
+Matrix<T>::BlockView::BlockView(Matrix<T>& matrix, Matrix<T>::size_type rowOffset, Matrix<T>::size_type columnOffset,
+                                Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
+    : m_pMatrix{&matrix}
+    , m_RowOffset{rowOffset}
+    , m_ColumnOffset{columnOffset}
+    , m_NrOfRows{nrOfRows}
+    , m_NrOfColumns{nrOfColumns}
+{
+}
 
-            _deallocMemory(); // actually not required, just for safety purposes
-            _allocMemory(helperMatrix.m_NrOfRows, c_NewNrOfColumns, c_OldRowCapacity, c_NewColumnCapacity);
+// 21) ConstBlockView
 
-            _moveInitItems(helperMatrix, 0, 0, 0, 0, helperMatrix.m_NrOfRows, helperMatrix.m_NrOfColumns);
+template <MatrixElementType T>
+Matrix<T>::ConstBlockView::ConstBlockView(const Matrix<T>::BlockView& blockView)
+    : m_pMatrix{blockView.m_pMatrix}
+    , m_RowOffset{blockView.m_RowOffset}
+    , m_ColumnOffset{blockView.m_ColumnOffset}
+    , m_NrOfRows{blockView.m_NrOfRows}
+    , m_NrOfColumns{blockView.m_NrOfColumns}
+{
+}
 
-            if (&matrix != this)
-            {
-                _moveInitItems(matrix, 0, 0, 0, c_OldNrOfColumns, matrix.m_NrOfRows, matrix.m_NrOfColumns);
-            }
-            else
-            {
-                _copyInitItems(*this, 0, 0, 0, c_OldNrOfColumns, m_NrOfRows, c_OldNrOfColumns);
-            }
-        }
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::ConstBlockView::getNrOfRows() const
+{
+    return m_NrOfRows;
+}
 
-        // clear the source matrix as its content is no longer usable
-        if (&matrix != this)
-        {
-            matrix._deallocMemory();
-        }
-    }
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::ConstBlockView::getNrOfColumns() const
+{
+    return m_NrOfColumns;
 }
 
-template <MatrixElementType T> void Matrix<T>::splitByRow(Matrix& matrix, size_type splitRowNr)
+template <MatrixElementType T> bool Matrix<T>::ConstBlockView::isEmpty() const
 {
-    CHECK_ERROR_CONDITION(&matrix == this, Matr::errorMessages[Matr::Errors::CURRENT_MATRIX_AS_ARGUMENT]);
-    CHECK_ERROR_CONDITION(splitRowNr >= m_NrOfRows, Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
-    CHECK_ERROR_CONDITION(0 == splitRowNr, Matr::errorMessages[Matr::Errors::RESULT_NO_ROWS]);
+    return 0 == m_NrOfRows;
+}
 
-    const size_type c_NewDestNrOfRows{static_cast<size_type>(m_NrOfRows - splitRowNr)};
-    const size_type c_NewDestRowCapacity{std::max<size_type>(matrix.m_RowCapacity, c_NewDestNrOfRows)};
-    const size_type c_NewDestColumnCapacity{std::max<size_type>(matrix.m_ColumnCapacity, m_NrOfColumns)};
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::ConstBlockView::getRowOffset() const
+{
+    return m_RowOffset;
+}
 
-    if (matrix.isEmpty() || c_NewDestRowCapacity > matrix.m_RowCapacity ||
-        c_NewDestColumnCapacity > matrix.m_ColumnCapacity)
-    {
-        matrix._deallocMemory();
-        matrix._allocMemory(c_NewDestNrOfRows, m_NrOfColumns, c_NewDestRowCapacity, c_NewDestColumnCapacity);
-    }
-    else
-    {
-        matrix._remapMemory(c_NewDestNrOfRows, m_NrOfColumns);
-    }
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::ConstBlockView::getColumnOffset() const
+{
+    return m_ColumnOffset;
+}
 
-    matrix._moveInitItems(*this, splitRowNr, 0, 0, 0, c_NewDestNrOfRows, m_NrOfColumns);
+template <MatrixElementType T>
+const T& Matrix<T>::ConstBlockView::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
+{
+    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows || columnNr >= m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::INVALID_ELEMENT_INDEX]);
 
-    _destroyItems(splitRowNr, 0, c_NewDestNrOfRows, m_NrOfColumns);
-    m_NrOfRows = splitRowNr;
-    _normalizeRowCapacity();
+    return m_pMatrix->at(m_RowOffset + rowNr, m_ColumnOffset + columnNr);
 }
 
-template <MatrixElementType T> void Matrix<T>::splitByColumn(Matrix& matrix, size_type splitColumnNr)
+template <MatrixElementType T> std::span<const T> Matrix<T>::ConstBlockView::getRow(Matrix<T>::size_type rowNr) const
 {
-    CHECK_ERROR_CONDITION(&matrix == this, Matr::errorMessages[Matr::Errors::CURRENT_MATRIX_AS_ARGUMENT]);
-    CHECK_ERROR_CONDITION(splitColumnNr >= m_NrOfColumns, Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
-    CHECK_ERROR_CONDITION(0 == splitColumnNr, Matr::errorMessages[Matr::Errors::RESULT_NO_COLUMNS]);
+    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows, Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
 
-    const size_type c_NewDestNrOfColumns{static_cast<size_type>(m_NrOfColumns - splitColumnNr)};
-    const size_type c_NewDestRowCapacity{std::max<size_type>(matrix.m_RowCapacity, m_NrOfRows)};
-    const size_type c_NewDestColumnCapacity{std::max<size_type>(matrix.m_ColumnCapacity, c_NewDestNrOfColumns)};
+    return {m_pMatrix->m_pBaseArrayPtr[*m_pMatrix->m_RowCapacityOffset + m_RowOffset + rowNr] + m_ColumnOffset,
+            m_NrOfColumns};
+}
 
-    if (matrix.isEmpty() || c_NewDestRowCapacity > matrix.m_RowCapacity ||
-        c_NewDestColumnCapacity > matrix.m_ColumnCapacity)
-    {
-        matrix._deallocMemory();
-        matrix._allocMemory(m_NrOfRows, c_NewDestNrOfColumns, c_NewDestRowCapacity, c_NewDestColumnCapacity);
-    }
-    else
-    {
-        matrix._remapMemory(m_NrOfRows, c_NewDestNrOfColumns);
-    }
+template <MatrixElementType T>
+Matrix<T>::ConstBlockView::ConstBlockView(const Matrix<T>& matrix, Matrix<T>::size_type rowOffset,
+                                          Matrix<T>::size_type columnOffset, Matrix<T>::size_type nrOfRows,
+                                          Matrix<T>::size_type nrOfColumns)
+    : m_pMatrix{&matrix}
+    , m_RowOffset{rowOffset}
+    , m_ColumnOffset{columnOffset}
+    , m_NrOfRows{nrOfRows}
+    , m_NrOfColumns{nrOfColumns}
+{
+}
 
-    matrix._moveInitItems(*this, 0, splitColumnNr, 0, 0, m_NrOfRows, c_NewDestNrOfColumns);
+// matrix methods
 
-    _destroyItems(0, splitColumnNr, m_NrOfRows, c_NewDestNrOfColumns);
-    m_NrOfColumns = splitColumnNr;
+template <MatrixElementType T> Matrix<T>::Matrix()
+{
+    _allocMemory(0, 0);
 }
 
 template <MatrixElementType T>
-void Matrix<T>::swapRows(Matrix<T>::size_type firstRowNr, Matrix<T>::size_type secondRowNr)
+Matrix<T>::Matrix(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns, std::vector<T>&& vec)
 {
-    CHECK_ERROR_CONDITION(firstRowNr >= m_NrOfRows || secondRowNr >= m_NrOfRows,
-                          Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
 
-    const size_type c_FirstAbsRowNr{static_cast<size_type>(*m_RowCapacityOffset + firstRowNr)};
-    const size_type c_SecondAbsRowNr{static_cast<size_type>(*m_RowCapacityOffset + secondRowNr)};
+    CHECK_ERROR_CONDITION(0 == nrOfRows || 0 == nrOfColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
+    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension || nrOfColumns > c_MaxAllowedDimension,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+    CHECK_ERROR_CONDITION(nrOfRows * nrOfColumns > vec.size(),
+                          Matr::errorMessages[Matr::Errors::INSUFFICIENT_ELEMENTS_FOR_INIT]);
 
-    if (c_FirstAbsRowNr != c_SecondAbsRowNr)
+    const size_type c_RowCapacityToAlloc{
+        std::min(static_cast<size_type>(nrOfRows + nrOfRows / 4), c_MaxAllowedDimension)};
+    const size_type c_ColumnCapacityToAlloc{
+        std::min(static_cast<size_type>(nrOfColumns + nrOfColumns / 4), c_MaxAllowedDimension)};
+
+    _allocMemory(nrOfRows, nrOfColumns, c_RowCapacityToAlloc, c_ColumnCapacityToAlloc);
+
+    typename std::vector<T>::iterator vecIterator{vec.begin()};
+
+    /* absRowNr = absolute row number, i.e. number of the row within "physical" matrix (that includes free row/column
+       capacity) When the "abs" keyword is missing (i.e. rowNr), then the row number within "logical" (actually used)
+       matrix (excluding free capacity) is meant (see other methods too)
+    */
+    for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
     {
-        // exchanging row pointers is enough and greatly optimizes the speed of execution
-        std::swap(m_pBaseArrayPtr[c_FirstAbsRowNr], m_pBaseArrayPtr[c_SecondAbsRowNr]);
+        std::uninitialized_move_n(vecIterator, m_NrOfColumns, m_pBaseArrayPtr[absRowNr]);
+        vecIterator += m_NrOfColumns;
     }
 }
 
-template <MatrixElementType T>
-void Matrix<T>::swapColumns(Matrix<T>::size_type firstColumnNr, Matrix<T>::size_type secondColumnNr)
+template <MatrixElementType T> Matrix<T>::Matrix(Matrix<T>::dimensions_t dimensions, const T& value)
 {
-    CHECK_ERROR_CONDITION(firstColumnNr >= m_NrOfColumns || secondColumnNr >= m_NrOfColumns,
-                          Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+    const auto& [nrOfRows, nrOfColumns] = dimensions;
 
-    if (firstColumnNr != secondColumnNr)
-    {
-        for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
-        {
-            std::swap(m_pBaseArrayPtr[absRowNr][firstColumnNr], m_pBaseArrayPtr[absRowNr][secondColumnNr]);
-        }
-    }
+    CHECK_ERROR_CONDITION(0 == nrOfRows || 0 == nrOfColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
+    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension || nrOfColumns > c_MaxAllowedDimension,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+
+    const size_type c_RowCapacityToAlloc{
+        std::min(static_cast<size_type>(nrOfRows + nrOfRows / 4), c_MaxAllowedDimension)};
+    const size_type c_ColumnCapacityToAlloc{
+        std::min(static_cast<size_type>(nrOfColumns + nrOfColumns / 4), c_MaxAllowedDimension)};
+
+    _allocMemory(nrOfRows, nrOfColumns, c_RowCapacityToAlloc, c_ColumnCapacityToAlloc);
+    _fillInitItems(0, 0, nrOfRows, nrOfColumns, value);
 }
 
-template <MatrixElementType T> bool Matrix<T>::operator==(const Matrix<T>& matrix) const
+template <MatrixElementType T> Matrix<T>::Matrix(Matrix<T>::dimensions_t dimensions, Matr::UninitializedTag)
 {
-    bool areEqual{true};
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+    const auto& [nrOfRows, nrOfColumns] = dimensions;
 
-    if (&matrix != this)
-    {
-        // matrix emptiness should be checked first in order to avoid accessing (std::optional) capacity offsets of
-        // empty matrixes (see second case: "else if")
-        if (const bool isCurrentMatrixEmpty{isEmpty()}, isOtherMatrixEmpty{matrix.isEmpty()};
-            isCurrentMatrixEmpty || isOtherMatrixEmpty)
-        {
-            areEqual = isCurrentMatrixEmpty && isOtherMatrixEmpty;
-        }
-        else if (m_NrOfRows == matrix.m_NrOfRows && m_NrOfColumns == matrix.m_NrOfColumns)
-        {
-            for (size_type absRowNr{*m_RowCapacityOffset}, matrixAbsRowNr{*matrix.m_RowCapacityOffset};
-                 absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr, ++matrixAbsRowNr)
-            {
-                areEqual = areEqual && std::equal(m_pBaseArrayPtr[absRowNr], m_pBaseArrayPtr[absRowNr] + m_NrOfColumns,
-                                                  matrix.m_pBaseArrayPtr[matrixAbsRowNr]);
+    CHECK_ERROR_CONDITION(0 == nrOfRows || 0 == nrOfColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
+    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension || nrOfColumns > c_MaxAllowedDimension,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
 
-                if (!areEqual)
-                {
-                    break;
-                }
-            }
-        }
-        else
-        {
-            areEqual = false;
-        }
-    }
+    const size_type c_RowCapacityToAlloc{
+        std::min(static_cast<size_type>(nrOfRows + nrOfRows / 4), c_MaxAllowedDimension)};
+    const size_type c_ColumnCapacityToAlloc{
+        std::min(static_cast<size_type>(nrOfColumns + nrOfColumns / 4), c_MaxAllowedDimension)};
 
-    return areEqual;
-}
+    _allocMemory(nrOfRows, nrOfColumns, c_RowCapacityToAlloc, c_ColumnCapacityToAlloc);
 
-template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::zBegin()
-{
-    GET_FORWARD_NON_DIAG_BEGIN_ITERATOR(ZIterator,
-                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                        m_NrOfRows, m_NrOfColumns);
+    if constexpr (!std::is_trivial_v<T>)
+    {
+        _defaultConstructInitItems(0, 0, nrOfRows, nrOfColumns);
+    }
 }
 
-template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::zEnd()
+template <MatrixElementType T>
+Matrix<T>::Matrix(Matrix<T>::size_type nrOfRowsColumns, const std::pair<T, T>& diagMatrixValues)
 {
-    GET_FORWARD_END_ZITERATOR(ZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                              m_NrOfRows, m_NrOfColumns);
-}
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
 
-template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::zRowBegin(Matrix<T>::size_type rowNr)
-{
-    GET_FORWARD_ROW_BEGIN_ZITERATOR(ZIterator,
-                                    m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                    m_NrOfRows, m_NrOfColumns, rowNr);
-}
+    CHECK_ERROR_CONDITION(0 == nrOfRowsColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
+    CHECK_ERROR_CONDITION(nrOfRowsColumns > c_MaxAllowedDimension,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
 
-template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::zRowEnd(Matrix<T>::size_type rowNr)
-{
-    GET_FORWARD_ROW_END_ZITERATOR(ZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                  m_NrOfRows, m_NrOfColumns, rowNr);
+    const size_type c_RowColumnCapacityToAlloc{
+        std::min(static_cast<size_type>(nrOfRowsColumns + nrOfRowsColumns / 4), c_MaxAllowedDimension)};
+
+    _allocMemory(nrOfRowsColumns, nrOfRowsColumns, c_RowColumnCapacityToAlloc, c_RowColumnCapacityToAlloc);
+
+    const auto& [allButMainDiagValue, mainDiagValue]{diagMatrixValues};
+
+    for (size_type absRowNr{*m_RowCapacityOffset}, columnNr{0}; columnNr < nrOfRowsColumns; ++columnNr, ++absRowNr)
+    {
+        T* const pRowBegin{m_pBaseArrayPtr[absRowNr]};
+        T* const pMainDiagElement{m_pBaseArrayPtr[absRowNr] + columnNr};
+        T* const pRowEnd{m_pBaseArrayPtr[absRowNr] + nrOfRowsColumns};
+
+        std::uninitialized_fill(pRowBegin, pMainDiagElement, allButMainDiagValue);
+        std::uninitialized_fill(pMainDiagElement, pMainDiagElement + 1, mainDiagValue);
+        std::uninitialized_fill(pMainDiagElement + 1, pRowEnd, allButMainDiagValue);
+    }
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ZIterator Matrix<T>::getZIterator(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+Matrix<T>::Matrix(const Matrix<T>& matrix)
+    : Matrix{}
 {
-    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    _copyAssignMatrix(matrix);
 }
 
-template <MatrixElementType T> typename Matrix<T>::ConstZIterator Matrix<T>::constZBegin() const
+template <MatrixElementType T>
+Matrix<T>::Matrix(Matrix<T>&& matrix)
+    : Matrix{}
 {
-    GET_FORWARD_NON_DIAG_BEGIN_ITERATOR(ConstZIterator,
-                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                        m_NrOfRows, m_NrOfColumns);
+    _moveAssignMatrix(matrix);
 }
 
-template <MatrixElementType T> typename Matrix<T>::ConstZIterator Matrix<T>::constZEnd() const
+template <MatrixElementType T>
+template <MatrixExpression Expression>
+    requires std::same_as<typename Expression::value_type, T>
+Matrix<T>::Matrix(const Expression& expression)
 {
-    GET_FORWARD_END_ZITERATOR(ConstZIterator,
-                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                              m_NrOfColumns);
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    const size_type c_NrOfRows{expression.getNrOfRows()};
+    const size_type c_NrOfColumns{expression.getNrOfColumns()};
+    const size_type c_RowCapacityToAlloc{
+        std::min(static_cast<size_type>(c_NrOfRows + c_NrOfRows / 4), c_MaxAllowedDimension)};
+    const size_type c_ColumnCapacityToAlloc{
+        std::min(static_cast<size_type>(c_NrOfColumns + c_NrOfColumns / 4), c_MaxAllowedDimension)};
+
+    _allocMemory(c_NrOfRows, c_NrOfColumns, c_RowCapacityToAlloc, c_ColumnCapacityToAlloc);
+
+    size_type rowNr{0};
+    size_type columnNr{0};
+
+    try
+    {
+        for (; rowNr < m_NrOfRows; ++rowNr)
+        {
+            T* const pRow{m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr]};
+
+            for (columnNr = 0; columnNr < m_NrOfColumns; ++columnNr)
+            {
+                std::construct_at(pRow + columnNr, expression.evaluate(rowNr, columnNr));
+            }
+        }
+    }
+    catch (...)
+    {
+        // no destructor call for a partially constructed object: destroy the computed elements, release the memory
+        _destroyItems(0, 0, rowNr, m_NrOfColumns);
+        std::destroy_n(m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr], columnNr);
+        std::free(m_pBaseArrayPtr);
+        std::free(m_pAllocPtr);
+
+        throw;
+    }
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstZIterator Matrix<T>::constZRowBegin(Matrix<T>::size_type rowNr) const
+template <MatrixElementType T> Matrix<T>::~Matrix()
 {
-    GET_FORWARD_ROW_BEGIN_ZITERATOR(ConstZIterator,
-                                    m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                    m_NrOfRows, m_NrOfColumns, rowNr);
+    _deallocMemory();
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstZIterator Matrix<T>::constZRowEnd(Matrix<T>::size_type rowNr) const
+template <MatrixElementType T> T& Matrix<T>::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
 {
-    GET_FORWARD_ROW_END_ZITERATOR(ConstZIterator,
-                                  m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                  m_NrOfRows, m_NrOfColumns, rowNr);
+    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows || columnNr >= m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::INVALID_ELEMENT_INDEX]);
+    return m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr][columnNr];
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstZIterator Matrix<T>::getConstZIterator(Matrix<T>::size_type rowNr,
-                                                                Matrix<T>::size_type columnNr) const
+template <MatrixElementType T> const T& Matrix<T>::at(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
 {
-    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ConstZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows || columnNr >= m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::INVALID_ELEMENT_INDEX]);
+    return m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr][columnNr];
 }
 
-template <MatrixElementType T> typename Matrix<T>::ReverseZIterator Matrix<T>::reverseZBegin()
+template <MatrixElementType T> Matrix<T>& Matrix<T>::operator=(const Matrix<T>& matrix)
 {
-    GET_REVERSE_NON_DIAG_BEGIN_ITERATOR(ReverseZIterator,
-                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                        m_NrOfRows, m_NrOfColumns);
+    _copyAssignMatrix(matrix);
+    return *this;
 }
 
-template <MatrixElementType T> typename Matrix<T>::ReverseZIterator Matrix<T>::reverseZEnd()
+template <MatrixElementType T> Matrix<T>& Matrix<T>::operator=(Matrix<T>&& matrix)
 {
-    GET_REVERSE_END_ZITERATOR(ReverseZIterator,
-                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                              m_NrOfColumns);
+    _moveAssignMatrix(matrix);
+    return *this;
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ReverseZIterator Matrix<T>::reverseZRowBegin(Matrix<T>::size_type rowNr)
+template <MatrixExpression Expression>
+    requires std::same_as<typename Expression::value_type, T>
+Matrix<T>& Matrix<T>::operator=(const Expression& expression)
 {
-    GET_REVERSE_ROW_BEGIN_ZITERATOR(ReverseZIterator,
-                                    m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                    m_NrOfRows, m_NrOfColumns, rowNr);
+    if (m_NrOfRows == expression.getNrOfRows() && m_NrOfColumns == expression.getNrOfColumns())
+    {
+        // each element is computed only from the operand elements located on the same position so it can be
+        // overwritten even if the matrix is an operand
+        for (size_type rowNr{0}; rowNr < m_NrOfRows; ++rowNr)
+        {
+            T* const pRow{m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr]};
+
+            for (size_type columnNr{0}; columnNr < m_NrOfColumns; ++columnNr)
+            {
+                pRow[columnNr] = expression.evaluate(rowNr, columnNr);
+            }
+        }
+    }
+    else
+    {
+        Matrix matrix{expression};
+        _moveAssignMatrix(matrix);
+    }
+
+    return *this;
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ReverseZIterator Matrix<T>::reverseZRowEnd(Matrix<T>::size_type rowNr)
+// a contiguous unidimensional array with the matrix elements (in row order) is returned to user
+template <MatrixElementType T> void* Matrix<T>::getBaseArray(Matrix<T>::size_type& nrOfElements)
 {
-    GET_REVERSE_ROW_END_ZITERATOR(ReverseZIterator,
-                                  m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                  m_NrOfRows, m_NrOfColumns, rowNr);
+    void* pAllocPtr{nullptr};
+
+    if (!isEmpty())
+    {
+        shrinkToFit(); // when transfering ownership user should get exactly the number of elements contained in the
+                       // used lines and columns (no extra capacity to be included)
+        pAllocPtr = _convertToArray(nrOfElements);
+    }
+    else
+    {
+        nrOfElements = 0;
+    }
+
+    return pAllocPtr;
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ReverseZIterator Matrix<T>::getReverseZIterator(Matrix<T>::size_type rowNr,
-                                                                    Matrix<T>::size_type columnNr)
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::getNrOfRows() const
 {
-    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ReverseZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    return m_NrOfRows;
 }
 
-template <MatrixElementType T> typename Matrix<T>::ConstReverseZIterator Matrix<T>::constReverseZBegin() const
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::getNrOfColumns() const
 {
-    GET_REVERSE_NON_DIAG_BEGIN_ITERATOR(ConstReverseZIterator,
-                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                        m_NrOfRows, m_NrOfColumns);
+    return m_NrOfColumns;
 }
 
-template <MatrixElementType T> typename Matrix<T>::ConstReverseZIterator Matrix<T>::constReverseZEnd() const
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::getRowCapacity() const
 {
-    GET_REVERSE_END_ZITERATOR(ConstReverseZIterator,
-                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                              m_NrOfColumns);
+    return m_RowCapacity;
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstReverseZIterator Matrix<T>::constReverseZRowBegin(Matrix<T>::size_type rowNr) const
+template <MatrixElementType T> typename Matrix<T>::size_type Matrix<T>::getColumnCapacity() const
 {
-    GET_REVERSE_ROW_BEGIN_ZITERATOR(ConstReverseZIterator,
-                                    m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                    m_NrOfRows, m_NrOfColumns, rowNr);
+    return m_ColumnCapacity;
 }
-
-template <MatrixElementType T>
-typename Matrix<T>::ConstReverseZIterator Matrix<T>::constReverseZRowEnd(Matrix<T>::size_type rowNr) const
+#ifdef USE_CAPACITY_OFFSET
+template <MatrixElementType T> std::optional<typename Matrix<T>::size_type> Matrix<T>::getRowCapacityOffset() const
 {
-    GET_REVERSE_ROW_END_ZITERATOR(ConstReverseZIterator,
-                                  m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                  m_NrOfRows, m_NrOfColumns, rowNr);
+    return m_RowCapacityOffset;
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstReverseZIterator Matrix<T>::getConstReverseZIterator(Matrix<T>::size_type rowNr,
-                                                                              Matrix<T>::size_type columnNr) const
+template <MatrixElementType T> std::optional<typename Matrix<T>::size_type> Matrix<T>::getColumnCapacityOffset() const
 {
-    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ConstReverseZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    return m_ColumnCapacityOffset;
 }
-
-template <MatrixElementType T> typename Matrix<T>::NIterator Matrix<T>::nBegin()
+#endif
+template <MatrixElementType T> bool Matrix<T>::isEmpty() const
 {
-    GET_FORWARD_NON_DIAG_BEGIN_ITERATOR(NIterator,
-                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                        m_NrOfRows, m_NrOfColumns);
+    if (m_pAllocPtr)
+    {
+        assert(m_pBaseArrayPtr && m_NrOfRows > 0 && m_NrOfColumns > 0 && m_RowCapacity >= m_NrOfRows &&
+               m_ColumnCapacity >= m_NrOfColumns && m_RowCapacityOffset >= 0 && m_ColumnCapacityOffset >= 0);
+    }
+    else
+    {
+        assert(!m_pBaseArrayPtr && 0 == m_NrOfRows && 0 == m_NrOfColumns && 0 == m_RowCapacity &&
+               0 == m_ColumnCapacity && !m_RowCapacityOffset.has_value() && !m_ColumnCapacityOffset.has_value());
+    }
+
+    return !m_pAllocPtr;
 }
 
-template <MatrixElementType T> typename Matrix<T>::NIterator Matrix<T>::nEnd()
+template <MatrixElementType T> void Matrix<T>::transpose()
 {
-    GET_FORWARD_END_NITERATOR(NIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                              m_NrOfRows, m_NrOfColumns);
+    transpose(Matr::ExecutionPolicy{1});
 }
 
-template <MatrixElementType T> typename Matrix<T>::NIterator Matrix<T>::nColumnBegin(Matrix<T>::size_type columnNr)
+template <MatrixElementType T> void Matrix<T>::transpose(const Matr::ExecutionPolicy& executionPolicy)
 {
-    GET_FORWARD_COLUMN_BEGIN_NITERATOR(NIterator,
-                                       m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                       m_NrOfRows, m_NrOfColumns, columnNr);
+    const size_t c_NrOfThreads{executionPolicy.getNrOfThreads()};
+
+    if (isEmpty())
+    {
+        // nothing to transpose
+    }
+    else if (m_NrOfRows == m_NrOfColumns && *m_RowCapacityOffset == (m_RowCapacity - m_NrOfRows) / 2 &&
+             *m_ColumnCapacityOffset == (m_ColumnCapacity - m_NrOfColumns) / 2)
+    {
+        _swapTranspose(c_NrOfThreads);
+    }
+    else if (m_RowCapacity >= m_NrOfColumns && m_ColumnCapacity >= m_NrOfRows)
+    {
+        // preferred to the transposition into new memory as it doesn't double the memory usage (required for very large
+        // matrixes)
+        _cycleTranspose(c_NrOfThreads);
+    }
+    else
+    {
+        _moveTranspose(c_NrOfThreads);
+    }
 }
 
-template <MatrixElementType T> typename Matrix<T>::NIterator Matrix<T>::nColumnEnd(Matrix<T>::size_type columnNr)
+template <MatrixElementType T> typename Matrix<T>::TransposedView Matrix<T>::transposedView()
 {
-    GET_FORWARD_COLUMN_END_NITERATOR(NIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, columnNr);
+    return TransposedView{*this};
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::NIterator Matrix<T>::getNIterator(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+template <MatrixElementType T> typename Matrix<T>::ConstTransposedView Matrix<T>::transposedView() const
 {
-    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        NIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    return ConstTransposedView{*this};
 }
 
-template <MatrixElementType T> typename Matrix<T>::ConstNIterator Matrix<T>::constNBegin() const
+template <MatrixElementType T> void Matrix<T>::flipVertical()
 {
-    GET_FORWARD_NON_DIAG_BEGIN_ITERATOR(ConstNIterator,
-                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                        m_NrOfRows, m_NrOfColumns);
+    if (!isEmpty())
+    {
+        T** pStartingRow{m_pBaseArrayPtr + *m_RowCapacityOffset};
+        std::reverse(pStartingRow, pStartingRow + m_NrOfRows);
+    }
 }
 
-template <MatrixElementType T> typename Matrix<T>::ConstNIterator Matrix<T>::constNEnd() const
+template <MatrixElementType T> void Matrix<T>::flipHorizontal()
 {
-    GET_FORWARD_END_NITERATOR(ConstNIterator,
-                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                              m_NrOfColumns);
+    for (size_type rowNr{0}; rowNr < m_NrOfRows; ++rowNr)
+    {
+        T* const pRow{m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr]};
+        std::reverse(pRow, pRow + m_NrOfColumns);
+    }
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstNIterator Matrix<T>::constNColumnBegin(Matrix<T>::size_type columnNr) const
+template <MatrixElementType T> void Matrix<T>::rotate90()
 {
-    GET_FORWARD_COLUMN_BEGIN_NITERATOR(ConstNIterator,
-                                       m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                       m_NrOfRows, m_NrOfColumns, columnNr);
+    rotate90(Matr::ExecutionPolicy{1});
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstNIterator Matrix<T>::constNColumnEnd(Matrix<T>::size_type columnNr) const
+template <MatrixElementType T> void Matrix<T>::rotate90(const Matr::ExecutionPolicy& executionPolicy)
 {
-    GET_FORWARD_COLUMN_END_NITERATOR(ConstNIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, columnNr);
+    // element [rowNr][columnNr] moves to [columnNr][m_NrOfRows - 1 - rowNr]
+    flipVertical();
+    transpose(executionPolicy);
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstNIterator Matrix<T>::getConstNIterator(Matrix<T>::size_type rowNr,
-                                                                Matrix<T>::size_type columnNr) const
+template <MatrixElementType T> void Matrix<T>::rotate180()
 {
-    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ConstNIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    flipVertical();
+    flipHorizontal();
 }
 
-template <MatrixElementType T> typename Matrix<T>::ReverseNIterator Matrix<T>::reverseNBegin()
+template <MatrixElementType T> void Matrix<T>::rotate270()
 {
-    GET_REVERSE_NON_DIAG_BEGIN_ITERATOR(ReverseNIterator,
-                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                        m_NrOfRows, m_NrOfColumns);
+    rotate270(Matr::ExecutionPolicy{1});
 }
 
-template <MatrixElementType T> typename Matrix<T>::ReverseNIterator Matrix<T>::reverseNEnd()
+template <MatrixElementType T> void Matrix<T>::rotate270(const Matr::ExecutionPolicy& executionPolicy)
 {
-    GET_REVERSE_END_NITERATOR(ReverseNIterator,
-                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                              m_NrOfColumns);
+    // element [rowNr][columnNr] moves to [m_NrOfColumns - 1 - columnNr][rowNr]
+    transpose(executionPolicy);
+    flipVertical();
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ReverseNIterator Matrix<T>::reverseNColumnBegin(Matrix<T>::size_type columnNr)
+template <typename Operation>
+std::vector<T> Matrix<T>::reduceRows(const Operation& operation, const T& init) const
 {
-    GET_REVERSE_COLUMN_BEGIN_NITERATOR(ReverseNIterator,
-                                       m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                       m_NrOfRows, m_NrOfColumns, columnNr);
+    return reduceRows(operation, init, Matr::ExecutionPolicy{1});
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ReverseNIterator Matrix<T>::reverseNColumnEnd(Matrix<T>::size_type columnNr)
+template <typename Operation>
+std::vector<T> Matrix<T>::reduceColumns(const Operation& operation, const T& init) const
 {
-    GET_REVERSE_COLUMN_END_NITERATOR(ReverseNIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, columnNr);
+    return reduceColumns(operation, init, Matr::ExecutionPolicy{1});
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ReverseNIterator Matrix<T>::getReverseNIterator(Matrix<T>::size_type rowNr,
-                                                                    Matrix<T>::size_type columnNr)
+template <typename Operation>
+std::vector<T> Matrix<T>::reduceRows(const Operation& operation, const T& init,
+                                     const Matr::ExecutionPolicy& executionPolicy) const
 {
-    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ReverseNIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
-}
+    std::vector<T> result;
 
-template <MatrixElementType T> typename Matrix<T>::ConstReverseNIterator Matrix<T>::constReverseNBegin() const
-{
-    GET_REVERSE_NON_DIAG_BEGIN_ITERATOR(ConstReverseNIterator,
-                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                        m_NrOfRows, m_NrOfColumns);
-}
+    if (!isEmpty())
+    {
+        result = Matr::runRowReduction<T>(m_NrOfRows, m_pBaseArrayPtr + *m_RowCapacityOffset,
+                                          executionPolicy.getNrOfThreads(), [this, &operation, &init](const T* pRow) {
+                                              return Matr::reduceElements(pRow, m_NrOfColumns, init, operation);
+                                          });
+    }
 
-template <MatrixElementType T> typename Matrix<T>::ConstReverseNIterator Matrix<T>::constReverseNEnd() const
-{
-    GET_REVERSE_END_NITERATOR(ConstReverseNIterator,
-                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                              m_NrOfColumns);
+    return result;
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseNIterator Matrix<T>::constReverseNColumnBegin(Matrix<T>::size_type columnNr) const
+template <typename Operation>
+std::vector<T> Matrix<T>::reduceColumns(const Operation& operation, const T& init,
+                                        const Matr::ExecutionPolicy& executionPolicy) const
 {
-    GET_REVERSE_COLUMN_BEGIN_NITERATOR(ConstReverseNIterator,
-                                       m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                       m_NrOfRows, m_NrOfColumns, columnNr);
+    std::vector<T> result;
+
+    if (!isEmpty())
+    {
+        result = Matr::runColumnReduction<T>(m_NrOfRows, m_NrOfColumns, m_pBaseArrayPtr + *m_RowCapacityOffset,
+                                             operation, init, executionPolicy.getNrOfThreads());
+    }
+
+    return result;
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseNIterator Matrix<T>::constReverseNColumnEnd(Matrix<T>::size_type columnNr) const
+std::vector<T> Matrix<T>::rowSums() const
+    requires ArithmeticElementType<T>
 {
-    GET_REVERSE_COLUMN_END_NITERATOR(ConstReverseNIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, columnNr);
+    return rowSums(Matr::ExecutionPolicy{1});
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseNIterator Matrix<T>::getConstReverseNIterator(Matrix<T>::size_type rowNr,
-                                                                              Matrix<T>::size_type columnNr) const
+std::vector<T> Matrix<T>::rowSums(const Matr::ExecutionPolicy& executionPolicy) const
+    requires ArithmeticElementType<T>
 {
-    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ConstReverseNIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    return _reduceRowsUnordered<T>(std::plus<T>{}, executionPolicy.getNrOfThreads());
 }
 
-template <MatrixElementType T> typename Matrix<T>::DIterator Matrix<T>::dBegin(Matrix<T>::diff_type diagonalNr)
+template <MatrixElementType T>
+std::vector<T> Matrix<T>::columnSums() const
+    requires ArithmeticElementType<T>
 {
-    GET_DIAG_BEGIN_ITERATOR(DIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                            m_NrOfRows, m_NrOfColumns, diagonalNr);
+    return columnSums(Matr::ExecutionPolicy{1});
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::DIterator Matrix<T>::dBegin(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+std::vector<T> Matrix<T>::columnSums(const Matr::ExecutionPolicy& executionPolicy) const
+    requires ArithmeticElementType<T>
 {
-    GET_BEGIN_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        DIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    return _reduceColumnsUnordered<T>(std::plus<T>{}, executionPolicy.getNrOfThreads());
 }
 
-template <MatrixElementType T> typename Matrix<T>::DIterator Matrix<T>::dEnd(Matrix<T>::diff_type diagonalNr)
+template <MatrixElementType T>
+std::vector<T> Matrix<T>::rowMin() const
+    requires ArithmeticElementType<T>
 {
-    GET_END_DITERATOR_BY_DIAG_NUMBER(DIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+    return rowMin(Matr::ExecutionPolicy{1});
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::DIterator Matrix<T>::dEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+std::vector<T> Matrix<T>::rowMin(const Matr::ExecutionPolicy& executionPolicy) const
+    requires ArithmeticElementType<T>
 {
-    GET_END_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        DIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    return _reduceRowsUnordered<T>(Matr::MinimumOperation{}, executionPolicy.getNrOfThreads());
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::DIterator Matrix<T>::getDIterator(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+std::vector<T> Matrix<T>::rowMax() const
+    requires ArithmeticElementType<T>
 {
-    GET_DIAG_RANDOM_ITERATOR(DIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                             m_NrOfRows, m_NrOfColumns, rowNr, columnNr);
+    return rowMax(Matr::ExecutionPolicy{1});
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::DIterator Matrix<T>::getDIterator(
-    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex)
+std::vector<T> Matrix<T>::rowMax(const Matr::ExecutionPolicy& executionPolicy) const
+    requires ArithmeticElementType<T>
 {
-    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
-    GET_RANDOM_DITERATOR_BY_DIAG_NUMBER_AND_INDEX(
-        DIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, diagonalNr, diagonalIndex);
+    return _reduceRowsUnordered<T>(Matr::MaximumOperation{}, executionPolicy.getNrOfThreads());
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstDIterator Matrix<T>::constDBegin(Matrix<T>::diff_type diagonalNr) const
+std::vector<Matr::MeanType<T>> Matrix<T>::rowMean() const
+    requires ArithmeticElementType<T>
 {
-    GET_DIAG_BEGIN_ITERATOR(ConstDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                            m_NrOfRows, m_NrOfColumns, diagonalNr);
+    return rowMean(Matr::ExecutionPolicy{1});
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstDIterator Matrix<T>::constDBegin(Matrix<T>::size_type rowNr,
-                                                          Matrix<T>::size_type columnNr) const
+std::vector<Matr::MeanType<T>> Matrix<T>::rowMean(const Matr::ExecutionPolicy& executionPolicy) const
+    requires ArithmeticElementType<T>
 {
-    GET_BEGIN_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ConstDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    using MeanType = Matr::MeanType<T>;
+
+    std::vector<MeanType> result{
+        _reduceRowsUnordered<MeanType>(std::plus<MeanType>{}, executionPolicy.getNrOfThreads())};
+
+    for (MeanType& mean : result)
+    {
+        mean /= m_NrOfColumns;
+    }
+
+    return result;
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstDIterator Matrix<T>::constDEnd(Matrix<T>::diff_type diagonalNr) const
+std::vector<T> Matrix<T>::columnMin() const
+    requires ArithmeticElementType<T>
 {
-    GET_END_DITERATOR_BY_DIAG_NUMBER(ConstDIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+    return columnMin(Matr::ExecutionPolicy{1});
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstDIterator Matrix<T>::constDEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
+std::vector<T> Matrix<T>::columnMin(const Matr::ExecutionPolicy& executionPolicy) const
+    requires ArithmeticElementType<T>
 {
-    GET_END_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ConstDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    return _reduceColumnsUnordered<T>(Matr::MinimumOperation{}, executionPolicy.getNrOfThreads());
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstDIterator Matrix<T>::getConstDIterator(Matrix<T>::size_type rowNr,
-                                                                Matrix<T>::size_type columnNr) const
+std::vector<T> Matrix<T>::columnMax() const
+    requires ArithmeticElementType<T>
 {
-    GET_DIAG_RANDOM_ITERATOR(ConstDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                             m_NrOfRows, m_NrOfColumns, rowNr, columnNr);
+    return columnMax(Matr::ExecutionPolicy{1});
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstDIterator Matrix<T>::getConstDIterator(
-    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex) const
+std::vector<T> Matrix<T>::columnMax(const Matr::ExecutionPolicy& executionPolicy) const
+    requires ArithmeticElementType<T>
 {
-    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
-    GET_RANDOM_DITERATOR_BY_DIAG_NUMBER_AND_INDEX(
-        ConstDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, diagonalNr, diagonalIndex);
+    return _reduceColumnsUnordered<T>(Matr::MaximumOperation{}, executionPolicy.getNrOfThreads());
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ReverseDIterator Matrix<T>::reverseDBegin(Matrix<T>::diff_type diagonalNr)
+std::vector<Matr::MeanType<T>> Matrix<T>::columnMean() const
+    requires ArithmeticElementType<T>
 {
-    GET_DIAG_BEGIN_ITERATOR(ReverseDIterator,
-                            m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                            m_NrOfColumns, diagonalNr);
+    return columnMean(Matr::ExecutionPolicy{1});
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ReverseDIterator Matrix<T>::reverseDBegin(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+std::vector<Matr::MeanType<T>> Matrix<T>::columnMean(const Matr::ExecutionPolicy& executionPolicy) const
+    requires ArithmeticElementType<T>
 {
-    GET_BEGIN_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ReverseDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    using MeanType = Matr::MeanType<T>;
+
+    std::vector<MeanType> result{
+        _reduceColumnsUnordered<MeanType>(std::plus<MeanType>{}, executionPolicy.getNrOfThreads())};
+
+    for (MeanType& mean : result)
+    {
+        mean /= m_NrOfRows;
+    }
+
+    return result;
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ReverseDIterator Matrix<T>::reverseDEnd(Matrix<T>::diff_type diagonalNr)
+T Matrix<T>::trace() const
+    requires ArithmeticElementType<T>
 {
-    GET_END_DITERATOR_BY_DIAG_NUMBER(ReverseDIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+    CHECK_ERROR_CONDITION(isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(m_NrOfRows != m_NrOfColumns, Matr::errorMessages[Matr::Errors::NON_SQUARE_MATRIX]);
+
+    T result{};
+
+    for (size_type rowNr{0}; rowNr < m_NrOfRows; ++rowNr)
+    {
+        result += m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr][rowNr];
+    }
+
+    return result;
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ReverseDIterator Matrix<T>::reverseDEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+std::vector<T> Matrix<T>::diagonalSums() const
+    requires ArithmeticElementType<T>
 {
-    GET_END_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ReverseDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    std::vector<T> result;
+
+    if (!isEmpty())
+    {
+        result = Matr::computeDiagonalSums(m_NrOfRows, m_NrOfColumns, m_pBaseArrayPtr + *m_RowCapacityOffset);
+    }
+
+    return result;
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ReverseDIterator Matrix<T>::getReverseDIterator(Matrix<T>::size_type rowNr,
-                                                                    Matrix<T>::size_type columnNr)
+std::vector<T> Matrix<T>::antiDiagonalSums() const
+    requires ArithmeticElementType<T>
 {
-    GET_DIAG_RANDOM_ITERATOR(ReverseDIterator,
-                             m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                             m_NrOfColumns, rowNr, columnNr);
+    std::vector<T> result;
+
+    if (!isEmpty())
+    {
+        result = Matr::computeAntiDiagonalSums(m_NrOfRows, m_NrOfColumns, m_pBaseArrayPtr + *m_RowCapacityOffset);
+    }
+
+    return result;
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ReverseDIterator Matrix<T>::getReverseDIterator(
-    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex)
+template <MatrixElementType T> std::vector<T> Matrix<T>::diagonal(Matrix<T>::diff_type diagonalNr) const
 {
-    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
-    GET_RANDOM_DITERATOR_BY_DIAG_NUMBER_AND_INDEX(
-        ReverseDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, diagonalNr, diagonalIndex);
+    CHECK_ERROR_CONDITION(diagonalNr < diff_type{1} - static_cast<diff_type>(m_NrOfRows) ||
+                              diagonalNr > static_cast<diff_type>(m_NrOfColumns) - diff_type{1},
+                          Matr::errorMessages[Matr::Errors::DIAGONAL_DOES_NOT_EXIST]);
+
+    const size_type c_FirstRowNr{diagonalNr < 0 ? static_cast<size_type>(-diagonalNr) : size_type{0}};
+    const size_type c_FirstColumnNr{diagonalNr > 0 ? static_cast<size_type>(diagonalNr) : size_type{0}};
+    const size_type c_DiagonalSize{std::min<size_type>(m_NrOfRows - c_FirstRowNr, m_NrOfColumns - c_FirstColumnNr)};
+
+    std::vector<T> result;
+    result.reserve(c_DiagonalSize);
+
+    for (size_type index{0}; index < c_DiagonalSize; ++index)
+    {
+        result.push_back(m_pBaseArrayPtr[*m_RowCapacityOffset + c_FirstRowNr + index][c_FirstColumnNr + index]);
+    }
+
+    return result;
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstReverseDIterator Matrix<T>::constReverseDBegin(Matrix<T>::diff_type diagonalNr) const
+template <MatrixElementType T> void Matrix<T>::clear()
 {
-    GET_DIAG_BEGIN_ITERATOR(ConstReverseDIterator,
-                            m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                            m_NrOfColumns, diagonalNr);
+    _deallocMemory();
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstReverseDIterator Matrix<T>::constReverseDBegin(Matrix<T>::size_type rowNr,
-                                                                        Matrix<T>::size_type columnNr) const
+template <MatrixElementType T> void Matrix<T>::resize(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
+{
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    CHECK_ERROR_CONDITION(0 == nrOfRows || 0 == nrOfColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
+    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension || nrOfColumns > c_MaxAllowedDimension,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+
+    const auto [c_NrOfRemainingRows,
+                c_NrOfRemainingColumns]{_resizeWithUninitializedNewElements(nrOfRows, nrOfColumns)};
+
+    // initialize new elements to the right side of the retained ones
+    if (m_NrOfColumns > c_NrOfRemainingColumns)
+    {
+        _defaultConstructInitItems(0, c_NrOfRemainingColumns, c_NrOfRemainingRows,
+                                   m_NrOfColumns - c_NrOfRemainingColumns);
+    }
+
+    // same for the ones below
+    if (m_NrOfRows > c_NrOfRemainingRows)
+    {
+        _defaultConstructInitItems(c_NrOfRemainingRows, 0, nrOfRows - c_NrOfRemainingRows, m_NrOfColumns);
+    }
+
+    _normalizeRowCapacity();
+}
+
+template <MatrixElementType T>
+void Matrix<T>::resize(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns, const T& value)
+{
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    CHECK_ERROR_CONDITION(0 == nrOfRows || 0 == nrOfColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
+    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension || nrOfColumns > c_MaxAllowedDimension,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+
+    const auto [c_NrOfRemainingRows,
+                c_NrOfRemainingColumns]{_resizeWithUninitializedNewElements(nrOfRows, nrOfColumns)};
+
+    // initialize new elements to the right side of the retained ones
+    if (m_NrOfColumns > c_NrOfRemainingColumns)
+    {
+        _fillInitItems(0, c_NrOfRemainingColumns, c_NrOfRemainingRows, m_NrOfColumns - c_NrOfRemainingColumns, value);
+    }
+
+    // same for the ones below
+    if (m_NrOfRows > c_NrOfRemainingRows)
+    {
+        _fillInitItems(c_NrOfRemainingRows, 0, nrOfRows - c_NrOfRemainingRows, m_NrOfColumns, value);
+    }
+
+    _normalizeRowCapacity();
+}
+
+template <MatrixElementType T>
+void Matrix<T>::resizeForOverwrite(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
+{
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    CHECK_ERROR_CONDITION(0 == nrOfRows || 0 == nrOfColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
+    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension || nrOfColumns > c_MaxAllowedDimension,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+
+    const size_type c_NewRowCapacity{std::max(m_RowCapacity, nrOfRows)};
+    const size_type c_NewColumnCapacity{std::max(m_ColumnCapacity, nrOfColumns)};
+
+    if (isEmpty() || c_NewRowCapacity != m_RowCapacity || c_NewColumnCapacity != m_ColumnCapacity)
+    {
+        // no need to move the existing elements as they are about to be overwritten anyway
+        _deallocMemory();
+        _allocMemory(nrOfRows, nrOfColumns, c_NewRowCapacity, c_NewColumnCapacity);
+    }
+    else
+    {
+        _remapMemory(nrOfRows, nrOfColumns);
+    }
+
+    if constexpr (!std::is_trivial_v<T>)
+    {
+        _defaultConstructInitItems(0, 0, nrOfRows, nrOfColumns);
+    }
+}
+
+template <MatrixElementType T>
+void Matrix<T>::reshape(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
+{
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    CHECK_ERROR_CONDITION(0 == nrOfRows || 0 == nrOfColumns, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
+    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension || nrOfColumns > c_MaxAllowedDimension,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+    CHECK_ERROR_CONDITION(static_cast<size_t>(nrOfRows) * nrOfColumns !=
+                              static_cast<size_t>(m_NrOfRows) * m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::ELEMENTS_COUNT_NOT_MATCHING_DIMENSIONS]);
+
+    if (!isEmpty() && (nrOfRows != m_NrOfRows || nrOfColumns != m_NrOfColumns))
+    {
+        T* const pFirstElement{m_pBaseArrayPtr[*m_RowCapacityOffset]};
+        bool isStorageContiguous{m_ColumnCapacity == m_NrOfColumns};
+
+        // rows might have been swapped/permuted (row pointers exchanged), so check their order within memory as well
+        for (size_type rowNr{1}; isStorageContiguous && rowNr < m_NrOfRows; ++rowNr)
+        {
+            isStorageContiguous = m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr] ==
+                                  pFirstElement + static_cast<size_t>(rowNr) * m_NrOfColumns;
+        }
+
+        const size_t c_FirstElementIndex{static_cast<size_t>(pFirstElement - m_pAllocPtr)};
+        const size_type c_NewRowCapacity{static_cast<size_type>(std::min<size_t>(
+            static_cast<size_t>(m_RowCapacity) * m_ColumnCapacity / nrOfColumns, c_MaxAllowedDimension))};
+
+        // the first element should be the first one of a new row and all new rows should fit into the allocated memory
+        if (isStorageContiguous && 0 == c_FirstElementIndex % nrOfColumns &&
+            c_FirstElementIndex / nrOfColumns + nrOfRows <= c_NewRowCapacity)
+        {
+            std::free(m_pBaseArrayPtr);
+            m_pBaseArrayPtr = static_cast<T**>(std::malloc(c_NewRowCapacity * sizeof(T*)));
+
+            m_NrOfRows = nrOfRows;
+            m_NrOfColumns = nrOfColumns;
+            m_RowCapacity = c_NewRowCapacity;
+            m_ColumnCapacity = nrOfColumns;
+            m_RowCapacityOffset = static_cast<size_type>(c_FirstElementIndex / nrOfColumns);
+            m_ColumnCapacityOffset = 0;
+
+            for (size_type rowNr{0}; rowNr < m_RowCapacity; ++rowNr)
+            {
+                m_pBaseArrayPtr[rowNr] = m_pAllocPtr + static_cast<size_t>(rowNr) * m_ColumnCapacity;
+            }
+        }
+        else
+        {
+            Matrix helperMatrix{std::move(*this)};
+
+            // no free capacity, so the matrix can subsequently be reshaped without moving elements
+            _deallocMemory(); // just for safety purposes, not actually needed
+            _allocMemory(nrOfRows, nrOfColumns);
+
+            size_type rowNr{0};
+            size_type columnNr{0};
+
+            for (size_type srcRowNr{0}; srcRowNr < helperMatrix.m_NrOfRows; ++srcRowNr)
+            {
+                T* const pSrcRow{helperMatrix.m_pBaseArrayPtr[*helperMatrix.m_RowCapacityOffset + srcRowNr]};
+
+                for (size_type srcColumnNr{0}; srcColumnNr < helperMatrix.m_NrOfColumns; ++srcColumnNr)
+                {
+                    std::construct_at(m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr] + columnNr,
+                                      std::move(pSrcRow[srcColumnNr]));
+
+                    if (++columnNr == m_NrOfColumns)
+                    {
+                        columnNr = 0;
+                        ++rowNr;
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <MatrixElementType T>
+void Matrix<T>::reserve(Matrix<T>::size_type rowCapacity, Matrix<T>::size_type columnCapacity)
+{
+    if (!isEmpty())
+    {
+        constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+        const size_type c_NewRowCapacity{std::clamp<size_type>(rowCapacity, m_NrOfRows, c_MaxAllowedDimension)};
+        const size_type c_NewColumnCapacity{
+            std::clamp<size_type>(columnCapacity, m_NrOfColumns, c_MaxAllowedDimension)};
+
+        if (m_RowCapacity != c_NewRowCapacity || m_ColumnCapacity != c_NewColumnCapacity)
+        {
+            Matrix matrix{std::move(*this)};
+
+            _deallocMemory(); // actually not required, just for safety purposes
+            _allocMemory(matrix.m_NrOfRows, matrix.m_NrOfColumns, c_NewRowCapacity, c_NewColumnCapacity);
+
+            // move the retained items back
+            _moveInitItems(matrix, 0, 0, 0, 0, matrix.m_NrOfRows, matrix.m_NrOfColumns);
+        }
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::shrinkToFit()
+{
+    if (m_RowCapacity != m_NrOfRows || m_ColumnCapacity != m_NrOfColumns)
+    {
+        Matrix helperMatrix{std::move(*this)};
+
+        _deallocMemory(); // just for safety purposes, not actually needed
+        _allocMemory(helperMatrix.m_NrOfRows, helperMatrix.m_NrOfColumns);
+        _moveInitItems(helperMatrix, 0, 0, 0, 0, m_NrOfRows, m_NrOfColumns);
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::insertRow(Matrix<T>::size_type rowNr)
+{
+    insertRows(rowNr, 1);
+}
+
+template <MatrixElementType T> void Matrix<T>::insertRow(Matrix<T>::size_type rowNr, const T& value)
+{
+    insertRows(rowNr, 1, value);
+}
+
+template <MatrixElementType T> void Matrix<T>::insertColumn(Matrix<T>::size_type columnNr)
+{
+    insertColumns(columnNr, 1);
+}
+
+template <MatrixElementType T> void Matrix<T>::insertColumn(Matrix<T>::size_type columnNr, const T& value)
+{
+    insertColumns(columnNr, 1, value);
+}
+
+template <MatrixElementType T>
+template <std::ranges::forward_range Range>
+    requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+void Matrix<T>::insertRow(Matrix<T>::size_type rowNr, Range&& elements)
+{
+    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(static_cast<size_t>(std::ranges::distance(elements)) != m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::ELEMENTS_COUNT_NOT_MATCHING_DIMENSIONS]);
+
+    insertRows(rowNr, std::forward<Range>(elements));
+}
+
+template <MatrixElementType T>
+template <std::ranges::forward_range Range>
+    requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+void Matrix<T>::insertColumn(Matrix<T>::size_type columnNr, Range&& elements)
+{
+    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(static_cast<size_t>(std::ranges::distance(elements)) != m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::ELEMENTS_COUNT_NOT_MATCHING_DIMENSIONS]);
+
+    insertColumns(columnNr, std::forward<Range>(elements));
+}
+
+template <MatrixElementType T>
+template <typename... Args>
+    requires std::constructible_from<T, Args&...>
+void Matrix<T>::emplaceRow(Matrix<T>::size_type rowNr, Args&&... args)
+{
+    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(maxAllowedDimension() == m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+    CHECK_ERROR_CONDITION(rowNr > m_NrOfRows, Matr::errorMessages[Matr::Errors::INSERT_ROW_NONCONTIGUOUS]);
+
+    _insertUninitializedRows(rowNr, 1);
+
+    T* const pRow{m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr]};
+
+    // arguments are used for constructing all row elements so they should not be forwarded (and possibly moved from)
+    for (size_type columnNr{0}; columnNr < m_NrOfColumns; ++columnNr)
+    {
+        std::construct_at(pRow + columnNr, args...);
+    }
+}
+
+template <MatrixElementType T>
+template <typename... Args>
+    requires std::constructible_from<T, Args&...>
+void Matrix<T>::emplaceColumn(Matrix<T>::size_type columnNr, Args&&... args)
+{
+    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(maxAllowedDimension() == m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+    CHECK_ERROR_CONDITION(columnNr > m_NrOfColumns, Matr::errorMessages[Matr::Errors::INSERT_COLUMN_NONCONTIGUOUS]);
+
+    _insertUninitializedColumns(columnNr, 1);
+
+    for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
+    {
+        std::construct_at(m_pBaseArrayPtr[absRowNr] + columnNr, args...);
+    }
+}
+
+template <MatrixElementType T>
+void Matrix<T>::insertRows(Matrix<T>::size_type rowNr, Matrix<T>::size_type nrOfRows)
+{
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension - m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+    CHECK_ERROR_CONDITION(rowNr > m_NrOfRows, Matr::errorMessages[Matr::Errors::INSERT_ROW_NONCONTIGUOUS]);
+
+    _insertUninitializedRows(rowNr, nrOfRows);
+    _defaultConstructInitItems(rowNr, 0, nrOfRows, m_NrOfColumns);
+}
+
+template <MatrixElementType T>
+void Matrix<T>::insertRows(Matrix<T>::size_type rowNr, Matrix<T>::size_type nrOfRows, const T& value)
+{
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(nrOfRows > c_MaxAllowedDimension - m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+    CHECK_ERROR_CONDITION(rowNr > m_NrOfRows, Matr::errorMessages[Matr::Errors::INSERT_ROW_NONCONTIGUOUS]);
+
+    _insertUninitializedRows(rowNr, nrOfRows);
+    _fillInitItems(rowNr, 0, nrOfRows, m_NrOfColumns, value);
+}
+
+template <MatrixElementType T>
+void Matrix<T>::insertColumns(Matrix<T>::size_type columnNr, Matrix<T>::size_type nrOfColumns)
+{
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(nrOfColumns > c_MaxAllowedDimension - m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+    CHECK_ERROR_CONDITION(columnNr > m_NrOfColumns, Matr::errorMessages[Matr::Errors::INSERT_COLUMN_NONCONTIGUOUS]);
+
+    _insertUninitializedColumns(columnNr, nrOfColumns);
+    _defaultConstructInitItems(0, columnNr, m_NrOfRows, nrOfColumns);
+}
+
+template <MatrixElementType T>
+void Matrix<T>::insertColumns(Matrix<T>::size_type columnNr, Matrix<T>::size_type nrOfColumns, const T& value)
+{
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(nrOfColumns > c_MaxAllowedDimension - m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+    CHECK_ERROR_CONDITION(columnNr > m_NrOfColumns, Matr::errorMessages[Matr::Errors::INSERT_COLUMN_NONCONTIGUOUS]);
+
+    _insertUninitializedColumns(columnNr, nrOfColumns);
+    _fillInitItems(0, columnNr, m_NrOfRows, nrOfColumns, value);
+}
+
+template <MatrixElementType T>
+template <std::ranges::forward_range Range>
+    requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+void Matrix<T>::insertRows(Matrix<T>::size_type rowNr, Range&& elements)
+{
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+
+    const auto c_NrOfElements{static_cast<size_t>(std::ranges::distance(elements))};
+    const size_t c_NrOfRows{c_NrOfElements / m_NrOfColumns};
+
+    CHECK_ERROR_CONDITION(c_NrOfElements % m_NrOfColumns != 0,
+                          Matr::errorMessages[Matr::Errors::ELEMENTS_COUNT_NOT_MATCHING_DIMENSIONS]);
+    CHECK_ERROR_CONDITION(c_NrOfRows > static_cast<size_t>(c_MaxAllowedDimension - m_NrOfRows),
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+    CHECK_ERROR_CONDITION(rowNr > m_NrOfRows, Matr::errorMessages[Matr::Errors::INSERT_ROW_NONCONTIGUOUS]);
+
+    _insertUninitializedRows(rowNr, static_cast<size_type>(c_NrOfRows));
+
+    auto elementIt{std::ranges::begin(elements)};
+
+    for (size_type absRowNr{static_cast<size_type>(*m_RowCapacityOffset + rowNr)};
+         absRowNr != *m_RowCapacityOffset + rowNr + c_NrOfRows; ++absRowNr)
+    {
+        T* const pRow{m_pBaseArrayPtr[absRowNr]};
+
+        for (size_type columnNr{0}; columnNr < m_NrOfColumns; ++columnNr, ++elementIt)
+        {
+            std::construct_at(pRow + columnNr, _getRangeElement<Range>(elementIt));
+        }
+    }
+}
+
+template <MatrixElementType T>
+template <std::ranges::forward_range Range>
+    requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+void Matrix<T>::insertColumns(Matrix<T>::size_type columnNr, Range&& elements)
+{
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    CHECK_ERROR_CONDITION(0 == m_NrOfRows, Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+
+    const auto c_NrOfElements{static_cast<size_t>(std::ranges::distance(elements))};
+    const size_t c_NrOfColumns{c_NrOfElements / m_NrOfRows};
+
+    CHECK_ERROR_CONDITION(c_NrOfElements % m_NrOfRows != 0,
+                          Matr::errorMessages[Matr::Errors::ELEMENTS_COUNT_NOT_MATCHING_DIMENSIONS]);
+    CHECK_ERROR_CONDITION(c_NrOfColumns > static_cast<size_t>(c_MaxAllowedDimension - m_NrOfColumns),
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+    CHECK_ERROR_CONDITION(columnNr > m_NrOfColumns, Matr::errorMessages[Matr::Errors::INSERT_COLUMN_NONCONTIGUOUS]);
+
+    _insertUninitializedColumns(columnNr, static_cast<size_type>(c_NrOfColumns));
+
+    auto elementIt{std::ranges::begin(elements)};
+    T** const pStartingRow{m_pBaseArrayPtr + *m_RowCapacityOffset};
+
+    for (size_t newColumnNr{columnNr}; newColumnNr != columnNr + c_NrOfColumns; ++newColumnNr)
+    {
+        for (size_type rowNr{0}; rowNr < m_NrOfRows; ++rowNr, ++elementIt)
+        {
+            std::construct_at(pStartingRow[rowNr] + newColumnNr, _getRangeElement<Range>(elementIt));
+        }
+    }
+}
+
+template <MatrixElementType T>
+template <std::ranges::forward_range Range>
+    requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+void Matrix<T>::assignRow(Matrix<T>::size_type rowNr, Range&& elements)
+{
+    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows, Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
+    CHECK_ERROR_CONDITION(static_cast<size_t>(std::ranges::distance(elements)) != m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::ELEMENTS_COUNT_NOT_MATCHING_DIMENSIONS]);
+
+    auto elementIt{std::ranges::begin(elements)};
+    T* const pRow{m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr]};
+
+    for (size_type columnNr{0}; columnNr < m_NrOfColumns; ++columnNr, ++elementIt)
+    {
+        pRow[columnNr] = _getRangeElement<Range>(elementIt);
+    }
+}
+
+template <MatrixElementType T>
+template <std::ranges::forward_range Range>
+    requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+void Matrix<T>::assignColumn(Matrix<T>::size_type columnNr, Range&& elements)
+{
+    CHECK_ERROR_CONDITION(columnNr >= m_NrOfColumns, Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
+    CHECK_ERROR_CONDITION(static_cast<size_t>(std::ranges::distance(elements)) != m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::ELEMENTS_COUNT_NOT_MATCHING_DIMENSIONS]);
+
+    auto elementIt{std::ranges::begin(elements)};
+
+    for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows;
+         ++absRowNr, ++elementIt)
+    {
+        m_pBaseArrayPtr[absRowNr][columnNr] = _getRangeElement<Range>(elementIt);
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::eraseRow(Matrix<T>::size_type rowNr)
+{
+    CHECK_ERROR_CONDITION(rowNr >= m_NrOfRows, Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
+
+    if (1 == m_NrOfRows)
+    {
+        _deallocMemory();
+    }
+    else if (const size_type c_RemainingNrOfRows{static_cast<size_type>(m_NrOfRows - 1)};
+             c_RemainingNrOfRows <= m_RowCapacity / 4)
+    {
+        _reallocEraseDimensionElement(rowNr, true);
+    }
+    else
+    {
+        _shiftEraseRow(rowNr);
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::eraseColumn(Matrix<T>::size_type columnNr)
+{
+    CHECK_ERROR_CONDITION(columnNr >= m_NrOfColumns, Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
+
+    if (1 == m_NrOfColumns)
+    {
+        _deallocMemory();
+    }
+    else if (const size_type c_RemainingNrOfColumns{static_cast<size_type>(m_NrOfColumns - 1)};
+             c_RemainingNrOfColumns <= m_ColumnCapacity / 4)
+    {
+        _reallocEraseDimensionElement(columnNr, false);
+    }
+    else
+    {
+        _shiftEraseColumn(columnNr);
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::eraseRows(std::span<const Matrix<T>::size_type> rowNrs)
+{
+    CHECK_ERROR_CONDITION(!_arePositionsStrictlyAscending(rowNrs),
+                          Matr::errorMessages[Matr::Errors::POSITIONS_NOT_STRICTLY_ASCENDING]);
+    CHECK_ERROR_CONDITION(!rowNrs.empty() && rowNrs.back() >= m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
+
+    if (!rowNrs.empty())
+    {
+        if (rowNrs.size() == m_NrOfRows)
+        {
+            _deallocMemory();
+        }
+        else if (const size_type c_RemainingNrOfRows{static_cast<size_type>(m_NrOfRows - rowNrs.size())};
+                 c_RemainingNrOfRows <= m_RowCapacity / 4)
+        {
+            _reallocEraseDimensionElements(rowNrs, true);
+        }
+        else
+        {
+            _shiftEraseRows(rowNrs);
+        }
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::eraseColumns(std::span<const Matrix<T>::size_type> columnNrs)
+{
+    CHECK_ERROR_CONDITION(!_arePositionsStrictlyAscending(columnNrs),
+                          Matr::errorMessages[Matr::Errors::POSITIONS_NOT_STRICTLY_ASCENDING]);
+    CHECK_ERROR_CONDITION(!columnNrs.empty() && columnNrs.back() >= m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
+
+    if (!columnNrs.empty())
+    {
+        if (columnNrs.size() == m_NrOfColumns)
+        {
+            _deallocMemory();
+        }
+        else if (const size_type c_RemainingNrOfColumns{static_cast<size_type>(m_NrOfColumns - columnNrs.size())};
+                 c_RemainingNrOfColumns <= m_ColumnCapacity / 4)
+        {
+            _reallocEraseDimensionElements(columnNrs, false);
+        }
+        else
+        {
+            _shiftEraseColumns(columnNrs);
+        }
+    }
+}
+
+template <MatrixElementType T>
+template <typename Predicate>
+    requires std::predicate<Predicate&, std::span<const T>>
+typename Matrix<T>::size_type Matrix<T>::eraseRowsIf(Predicate predicate)
+{
+    std::vector<size_type> rowNrsToErase;
+
+    for (size_type rowNr{0}; rowNr < m_NrOfRows; ++rowNr)
+    {
+        if (predicate(std::span<const T>{m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr], m_NrOfColumns}))
+        {
+            rowNrsToErase.push_back(rowNr);
+        }
+    }
+
+    eraseRows(rowNrsToErase);
+
+    return static_cast<size_type>(rowNrsToErase.size());
+}
+
+template <MatrixElementType T> void Matrix<T>::catByRow(Matrix<T>& matrix)
+{
+    if (&matrix != this)
+    {
+        CHECK_ERROR_CONDITION(m_NrOfColumns != matrix.m_NrOfColumns,
+                              Matr::errorMessages[Matr::Errors::MATRIXES_UNEQUAL_ROW_LENGTH]);
+    }
+
+    const size_type c_OldNrOfRows{m_NrOfRows};
+    const size_type c_NewNrOfRows{static_cast<size_type>(m_NrOfRows + matrix.m_NrOfRows)};
+
+    CHECK_ERROR_CONDITION(c_NewNrOfRows > maxAllowedDimension(),
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+
+    if (c_NewNrOfRows <= m_RowCapacity)
+    {
+        _alignToTop();
+        m_NrOfRows = c_NewNrOfRows;
+
+        if (&matrix != this)
+        {
+            _moveInitItems(matrix, 0, 0, c_OldNrOfRows, 0, matrix.m_NrOfRows, matrix.m_NrOfColumns);
+        }
+        else
+        {
+            _copyInitItems(*this, 0, 0, c_OldNrOfRows, 0, c_OldNrOfRows, m_NrOfColumns);
+        }
+
+        _normalizeRowCapacity();
+    }
+    else
+    {
+        const size_type c_OldColumnCapacity{m_ColumnCapacity};
+        Matrix helperMatrix{std::move(*this)};
+
+        _deallocMemory(); // actually not required, just for safety purposes
+        _allocMemory(c_NewNrOfRows, helperMatrix.m_NrOfColumns, c_NewNrOfRows, c_OldColumnCapacity);
+        _moveInitItems(helperMatrix, 0, 0, 0, 0, helperMatrix.m_NrOfRows, helperMatrix.m_NrOfColumns);
+
+        if (&matrix != this)
+        {
+            _moveInitItems(matrix, 0, 0, c_OldNrOfRows, 0, matrix.m_NrOfRows, matrix.m_NrOfColumns);
+        }
+        else
+        {
+            _copyInitItems(*this, 0, 0, c_OldNrOfRows, 0, c_OldNrOfRows, m_NrOfColumns);
+        }
+    }
+
+    // clear the source matrix as its content is no longer usable
+    if (&matrix != this)
+    {
+        matrix._deallocMemory();
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::catByColumn(Matrix& matrix)
+{
+    if (&matrix != this)
+    {
+        CHECK_ERROR_CONDITION(m_NrOfRows != matrix.m_NrOfRows,
+                              Matr::errorMessages[Matr::Errors::MATRIXES_UNEQUAL_COLUMN_LENGTH]);
+    }
+
+    const size_type c_OldNrOfColumns{m_NrOfColumns};
+    const size_type c_NewNrOfColumns{static_cast<size_type>(m_NrOfColumns + matrix.m_NrOfColumns)};
+
+    CHECK_ERROR_CONDITION(c_NewNrOfColumns > maxAllowedDimension(),
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+
+    if (!matrix.isEmpty())
+    {
+        if (c_NewNrOfColumns <= m_ColumnCapacity)
+        {
+            const size_type c_ColumnConcatenationSpace{
+                static_cast<size_type>(m_ColumnCapacity - *m_ColumnCapacityOffset)};
+
+            // if not enough available capacity on the right side, then the columns should be shifted left by the
+            // minimal count of positions that ensure the concatenated content fits
+            if (c_NewNrOfColumns > c_ColumnConcatenationSpace)
+            {
+                const size_type c_NrOfColumnsToShiftLeft{
+                    static_cast<size_type>(c_NewNrOfColumns - c_ColumnConcatenationSpace)};
+                _shiftColumnsLeft(c_NrOfColumnsToShiftLeft);
+            }
+
+            m_NrOfColumns = c_NewNrOfColumns;
+
+            if (&matrix != this)
+            {
+                _moveInitItems(matrix, 0, 0, 0, c_OldNrOfColumns, matrix.m_NrOfRows, matrix.m_NrOfColumns);
+            }
+            else
+            {
+                _copyInitItems(*this, 0, 0, 0, c_OldNrOfColumns, m_NrOfRows, c_OldNrOfColumns);
+            }
+        }
+        else
+        {
+            const size_type c_OldRowCapacity{m_RowCapacity};
+            const size_type c_NewColumnCapacity{std::max(m_ColumnCapacity, c_NewNrOfColumns)};
+
+            Matrix helperMatrix{std::move(*this)};
+
+            _deallocMemory(); // actually not required, just for safety purposes
+            _allocMemory(helperMatrix.m_NrOfRows, c_NewNrOfColumns, c_OldRowCapacity, c_NewColumnCapacity);
+
+            _moveInitItems(helperMatrix, 0, 0, 0, 0, helperMatrix.m_NrOfRows, helperMatrix.m_NrOfColumns);
+
+            if (&matrix != this)
+            {
+                _moveInitItems(matrix, 0, 0, 0, c_OldNrOfColumns, matrix.m_NrOfRows, matrix.m_NrOfColumns);
+            }
+            else
+            {
+                _copyInitItems(*this, 0, 0, 0, c_OldNrOfColumns, m_NrOfRows, c_OldNrOfColumns);
+            }
+        }
+
+        // clear the source matrix as its content is no longer usable
+        if (&matrix != this)
+        {
+            matrix._deallocMemory();
+        }
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::concatRows(std::span<Matrix<T>* const> matrixes)
+{
+    size_type nrOfColumns{m_NrOfColumns};
+    size_t totalNrOfRows{m_NrOfRows};
+
+    for (auto it{matrixes.begin()}; it != matrixes.end(); ++it)
+    {
+        const Matrix* pMatrix{*it};
+
+        CHECK_ERROR_CONDITION(nullptr == pMatrix, Matr::errorMessages[Matr::Errors::NULL_MATRIX_AS_ARGUMENT]);
+        CHECK_ERROR_CONDITION(pMatrix == this, Matr::errorMessages[Matr::Errors::CURRENT_MATRIX_AS_ARGUMENT]);
+        CHECK_ERROR_CONDITION(std::find(matrixes.begin(), it, pMatrix) != it,
+                              Matr::errorMessages[Matr::Errors::DUPLICATE_MATRIX_AS_ARGUMENT]);
+
+        if (!pMatrix->isEmpty())
+        {
+            nrOfColumns = 0 == nrOfColumns ? pMatrix->m_NrOfColumns : nrOfColumns;
+
+            CHECK_ERROR_CONDITION(pMatrix->m_NrOfColumns != nrOfColumns,
+                                  Matr::errorMessages[Matr::Errors::MATRIXES_UNEQUAL_ROW_LENGTH]);
+
+            totalNrOfRows += pMatrix->m_NrOfRows;
+        }
+    }
+
+    CHECK_ERROR_CONDITION(totalNrOfRows > maxAllowedDimension(),
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+
+    const size_type c_OldNrOfRows{m_NrOfRows};
+    const size_type c_NewNrOfRows{static_cast<size_type>(totalNrOfRows)};
+
+    if (c_NewNrOfRows > c_OldNrOfRows)
+    {
+        const bool c_IsReallocationRequired{c_NewNrOfRows > m_RowCapacity};
+
+        if (!c_IsReallocationRequired)
+        {
+            _alignToTop();
+            m_NrOfRows = c_NewNrOfRows;
+        }
+        else
+        {
+            const size_type c_OldColumnCapacity{m_ColumnCapacity};
+            Matrix helperMatrix{std::move(*this)};
+
+            _deallocMemory(); // actually not required, just for safety purposes
+            _allocMemory(c_NewNrOfRows, nrOfColumns, c_NewNrOfRows, c_OldColumnCapacity);
+
+            if (!helperMatrix.isEmpty())
+            {
+                _moveInitItems(helperMatrix, 0, 0, 0, 0, helperMatrix.m_NrOfRows, helperMatrix.m_NrOfColumns);
+            }
+        }
+
+        size_type destRowNr{c_OldNrOfRows};
+
+        for (Matrix* pMatrix : matrixes)
+        {
+            if (!pMatrix->isEmpty())
+            {
+                _moveInitItems(*pMatrix, 0, 0, destRowNr, 0, pMatrix->m_NrOfRows, pMatrix->m_NrOfColumns);
+                destRowNr += pMatrix->m_NrOfRows;
+            }
+        }
+
+        if (!c_IsReallocationRequired)
+        {
+            _normalizeRowCapacity();
+        }
+    }
+
+    // clear the source matrixes as their content is no longer usable
+    for (Matrix* pMatrix : matrixes)
+    {
+        pMatrix->_deallocMemory();
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::concatColumns(std::span<Matrix<T>* const> matrixes)
+{
+    size_type nrOfRows{m_NrOfRows};
+    size_t totalNrOfColumns{m_NrOfColumns};
+
+    for (auto it{matrixes.begin()}; it != matrixes.end(); ++it)
+    {
+        const Matrix* pMatrix{*it};
+
+        CHECK_ERROR_CONDITION(nullptr == pMatrix, Matr::errorMessages[Matr::Errors::NULL_MATRIX_AS_ARGUMENT]);
+        CHECK_ERROR_CONDITION(pMatrix == this, Matr::errorMessages[Matr::Errors::CURRENT_MATRIX_AS_ARGUMENT]);
+        CHECK_ERROR_CONDITION(std::find(matrixes.begin(), it, pMatrix) != it,
+                              Matr::errorMessages[Matr::Errors::DUPLICATE_MATRIX_AS_ARGUMENT]);
+
+        if (!pMatrix->isEmpty())
+        {
+            nrOfRows = 0 == nrOfRows ? pMatrix->m_NrOfRows : nrOfRows;
+
+            CHECK_ERROR_CONDITION(pMatrix->m_NrOfRows != nrOfRows,
+                                  Matr::errorMessages[Matr::Errors::MATRIXES_UNEQUAL_COLUMN_LENGTH]);
+
+            totalNrOfColumns += pMatrix->m_NrOfColumns;
+        }
+    }
+
+    CHECK_ERROR_CONDITION(totalNrOfColumns > maxAllowedDimension(),
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+
+    const size_type c_OldNrOfColumns{m_NrOfColumns};
+    const size_type c_NewNrOfColumns{static_cast<size_type>(totalNrOfColumns)};
+
+    if (c_NewNrOfColumns > c_OldNrOfColumns)
+    {
+        if (c_NewNrOfColumns <= m_ColumnCapacity)
+        {
+            const size_type c_ColumnConcatenationSpace{
+                static_cast<size_type>(m_ColumnCapacity - *m_ColumnCapacityOffset)};
+
+            // if not enough available capacity on the right side, then the columns should be shifted left by the
+            // minimal count of positions that ensure the concatenated content fits
+            if (c_NewNrOfColumns > c_ColumnConcatenationSpace)
+            {
+                _shiftColumnsLeft(static_cast<size_type>(c_NewNrOfColumns - c_ColumnConcatenationSpace));
+            }
+
+            m_NrOfColumns = c_NewNrOfColumns;
+        }
+        else
+        {
+            const size_type c_OldRowCapacity{m_RowCapacity};
+            const size_type c_NewColumnCapacity{std::max(m_ColumnCapacity, c_NewNrOfColumns)};
+            Matrix helperMatrix{std::move(*this)};
+
+            _deallocMemory(); // actually not required, just for safety purposes
+            _allocMemory(nrOfRows, c_NewNrOfColumns, c_OldRowCapacity, c_NewColumnCapacity);
+
+            if (!helperMatrix.isEmpty())
+            {
+                _moveInitItems(helperMatrix, 0, 0, 0, 0, helperMatrix.m_NrOfRows, helperMatrix.m_NrOfColumns);
+            }
+        }
+
+        size_type destColumnNr{c_OldNrOfColumns};
+
+        for (Matrix* pMatrix : matrixes)
+        {
+            if (!pMatrix->isEmpty())
+            {
+                _moveInitItems(*pMatrix, 0, 0, 0, destColumnNr, pMatrix->m_NrOfRows, pMatrix->m_NrOfColumns);
+                destColumnNr += pMatrix->m_NrOfColumns;
+            }
+        }
+    }
+
+    // clear the source matrixes as their content is no longer usable
+    for (Matrix* pMatrix : matrixes)
+    {
+        pMatrix->_deallocMemory();
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::splitByRow(Matrix& matrix, size_type splitRowNr)
+{
+    CHECK_ERROR_CONDITION(&matrix == this, Matr::errorMessages[Matr::Errors::CURRENT_MATRIX_AS_ARGUMENT]);
+    CHECK_ERROR_CONDITION(splitRowNr >= m_NrOfRows, Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
+    CHECK_ERROR_CONDITION(0 == splitRowNr, Matr::errorMessages[Matr::Errors::RESULT_NO_ROWS]);
+
+    const size_type c_NewDestNrOfRows{static_cast<size_type>(m_NrOfRows - splitRowNr)};
+    const size_type c_NewDestRowCapacity{std::max<size_type>(matrix.m_RowCapacity, c_NewDestNrOfRows)};
+    const size_type c_NewDestColumnCapacity{std::max<size_type>(matrix.m_ColumnCapacity, m_NrOfColumns)};
+
+    if (matrix.isEmpty() || c_NewDestRowCapacity > matrix.m_RowCapacity ||
+        c_NewDestColumnCapacity > matrix.m_ColumnCapacity)
+    {
+        matrix._deallocMemory();
+        matrix._allocMemory(c_NewDestNrOfRows, m_NrOfColumns, c_NewDestRowCapacity, c_NewDestColumnCapacity);
+    }
+    else
+    {
+        matrix._remapMemory(c_NewDestNrOfRows, m_NrOfColumns);
+    }
+
+    matrix._moveInitItems(*this, splitRowNr, 0, 0, 0, c_NewDestNrOfRows, m_NrOfColumns);
+
+    _destroyItems(splitRowNr, 0, c_NewDestNrOfRows, m_NrOfColumns);
+    m_NrOfRows = splitRowNr;
+    _normalizeRowCapacity();
+}
+
+template <MatrixElementType T> void Matrix<T>::splitByColumn(Matrix& matrix, size_type splitColumnNr)
+{
+    CHECK_ERROR_CONDITION(&matrix == this, Matr::errorMessages[Matr::Errors::CURRENT_MATRIX_AS_ARGUMENT]);
+    CHECK_ERROR_CONDITION(splitColumnNr >= m_NrOfColumns, Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
+    CHECK_ERROR_CONDITION(0 == splitColumnNr, Matr::errorMessages[Matr::Errors::RESULT_NO_COLUMNS]);
+
+    const size_type c_NewDestNrOfColumns{static_cast<size_type>(m_NrOfColumns - splitColumnNr)};
+    const size_type c_NewDestRowCapacity{std::max<size_type>(matrix.m_RowCapacity, m_NrOfRows)};
+    const size_type c_NewDestColumnCapacity{std::max<size_type>(matrix.m_ColumnCapacity, c_NewDestNrOfColumns)};
+
+    if (matrix.isEmpty() || c_NewDestRowCapacity > matrix.m_RowCapacity ||
+        c_NewDestColumnCapacity > matrix.m_ColumnCapacity)
+    {
+        matrix._deallocMemory();
+        matrix._allocMemory(m_NrOfRows, c_NewDestNrOfColumns, c_NewDestRowCapacity, c_NewDestColumnCapacity);
+    }
+    else
+    {
+        matrix._remapMemory(m_NrOfRows, c_NewDestNrOfColumns);
+    }
+
+    matrix._moveInitItems(*this, 0, splitColumnNr, 0, 0, m_NrOfRows, c_NewDestNrOfColumns);
+
+    _destroyItems(0, splitColumnNr, m_NrOfRows, c_NewDestNrOfColumns);
+    m_NrOfColumns = splitColumnNr;
+}
+
+template <MatrixElementType T>
+std::vector<Matrix<T>> Matrix<T>::splitRows(std::span<const Matrix<T>::size_type> splitRowNrs)
+{
+    _checkSplitPositions(splitRowNrs, true);
+
+    std::vector<Matrix> matrixes(splitRowNrs.size() + 1);
+
+    if (!isEmpty())
+    {
+        for (size_t blockNr{0}; blockNr < matrixes.size(); ++blockNr)
+        {
+            const size_type c_FirstRowNr{blockNr > 0 ? splitRowNrs[blockNr - 1] : size_type{0}};
+            const size_type c_EndRowNr{blockNr < splitRowNrs.size() ? splitRowNrs[blockNr] : m_NrOfRows};
+            const size_type c_NrOfRows{static_cast<size_type>(c_EndRowNr - c_FirstRowNr)};
+
+            matrixes[blockNr]._allocMemory(c_NrOfRows, m_NrOfColumns);
+            matrixes[blockNr]._moveInitItems(*this, c_FirstRowNr, 0, 0, 0, c_NrOfRows, m_NrOfColumns);
+        }
+    }
+
+    // clear the matrix as its content is no longer usable
+    _deallocMemory();
+
+    return matrixes;
+}
+
+template <MatrixElementType T>
+std::vector<Matrix<T>> Matrix<T>::splitColumns(std::span<const Matrix<T>::size_type> splitColumnNrs)
+{
+    _checkSplitPositions(splitColumnNrs, false);
+
+    std::vector<Matrix> matrixes(splitColumnNrs.size() + 1);
+
+    if (!isEmpty())
+    {
+        for (size_t blockNr{0}; blockNr < matrixes.size(); ++blockNr)
+        {
+            const size_type c_FirstColumnNr{blockNr > 0 ? splitColumnNrs[blockNr - 1] : size_type{0}};
+            const size_type c_EndColumnNr{blockNr < splitColumnNrs.size() ? splitColumnNrs[blockNr] : m_NrOfColumns};
+            const size_type c_NrOfColumns{static_cast<size_type>(c_EndColumnNr - c_FirstColumnNr)};
+
+            matrixes[blockNr]._allocMemory(m_NrOfRows, c_NrOfColumns);
+            matrixes[blockNr]._moveInitItems(*this, 0, c_FirstColumnNr, 0, 0, m_NrOfRows, c_NrOfColumns);
+        }
+    }
+
+    // clear the matrix as its content is no longer usable
+    _deallocMemory();
+
+    return matrixes;
+}
+
+template <MatrixElementType T>
+std::vector<typename Matrix<T>::BlockView> Matrix<T>::splitRowsIntoViews(
+    std::span<const Matrix<T>::size_type> splitRowNrs)
+{
+    _checkSplitPositions(splitRowNrs, true);
+
+    std::vector<BlockView> blockViews;
+    blockViews.reserve(splitRowNrs.size() + 1);
+
+    for (size_t blockNr{0}; blockNr <= splitRowNrs.size(); ++blockNr)
+    {
+        const size_type c_FirstRowNr{blockNr > 0 ? splitRowNrs[blockNr - 1] : size_type{0}};
+        const size_type c_EndRowNr{blockNr < splitRowNrs.size() ? splitRowNrs[blockNr] : m_NrOfRows};
+
+        blockViews.push_back(
+            BlockView{*this, c_FirstRowNr, 0, static_cast<size_type>(c_EndRowNr - c_FirstRowNr), m_NrOfColumns});
+    }
+
+    return blockViews;
+}
+
+template <MatrixElementType T>
+std::vector<typename Matrix<T>::ConstBlockView> Matrix<T>::splitRowsIntoViews(
+    std::span<const Matrix<T>::size_type> splitRowNrs) const
+{
+    _checkSplitPositions(splitRowNrs, true);
+
+    std::vector<ConstBlockView> blockViews;
+    blockViews.reserve(splitRowNrs.size() + 1);
+
+    for (size_t blockNr{0}; blockNr <= splitRowNrs.size(); ++blockNr)
+    {
+        const size_type c_FirstRowNr{blockNr > 0 ? splitRowNrs[blockNr - 1] : size_type{0}};
+        const size_type c_EndRowNr{blockNr < splitRowNrs.size() ? splitRowNrs[blockNr] : m_NrOfRows};
+
+        blockViews.push_back(
+            ConstBlockView{*this, c_FirstRowNr, 0, static_cast<size_type>(c_EndRowNr - c_FirstRowNr), m_NrOfColumns});
+    }
+
+    return blockViews;
+}
+
+template <MatrixElementType T>
+std::vector<typename Matrix<T>::BlockView> Matrix<T>::splitColumnsIntoViews(
+    std::span<const Matrix<T>::size_type> splitColumnNrs)
+{
+    _checkSplitPositions(splitColumnNrs, false);
+
+    std::vector<BlockView> blockViews;
+    blockViews.reserve(splitColumnNrs.size() + 1);
+
+    for (size_t blockNr{0}; blockNr <= splitColumnNrs.size(); ++blockNr)
+    {
+        const size_type c_FirstColumnNr{blockNr > 0 ? splitColumnNrs[blockNr - 1] : size_type{0}};
+        const size_type c_EndColumnNr{blockNr < splitColumnNrs.size() ? splitColumnNrs[blockNr] : m_NrOfColumns};
+
+        blockViews.push_back(
+            BlockView{*this, 0, c_FirstColumnNr, m_NrOfRows, static_cast<size_type>(c_EndColumnNr - c_FirstColumnNr)});
+    }
+
+    return blockViews;
+}
+
+template <MatrixElementType T>
+std::vector<typename Matrix<T>::ConstBlockView> Matrix<T>::splitColumnsIntoViews(
+    std::span<const Matrix<T>::size_type> splitColumnNrs) const
+{
+    _checkSplitPositions(splitColumnNrs, false);
+
+    std::vector<ConstBlockView> blockViews;
+    blockViews.reserve(splitColumnNrs.size() + 1);
+
+    for (size_t blockNr{0}; blockNr <= splitColumnNrs.size(); ++blockNr)
+    {
+        const size_type c_FirstColumnNr{blockNr > 0 ? splitColumnNrs[blockNr - 1] : size_type{0}};
+        const size_type c_EndColumnNr{blockNr < splitColumnNrs.size() ? splitColumnNrs[blockNr] : m_NrOfColumns};
+
+        blockViews.push_back(ConstBlockView{*this, 0, c_FirstColumnNr, m_NrOfRows,
+                                            static_cast<size_type>(c_EndColumnNr - c_FirstColumnNr)});
+    }
+
+    return blockViews;
+}
+
+template <MatrixElementType T>
+Matrix<T> Matrix<T>::extract(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr, Matrix<T>::size_type nrOfRows,
+                             Matrix<T>::size_type nrOfColumns) const
+{
+    CHECK_ERROR_CONDITION(!_isBlockWithinBounds(rowNr, columnNr, nrOfRows, nrOfColumns),
+                          Matr::errorMessages[Matr::Errors::BLOCK_OUT_OF_BOUNDS]);
+
+    Matrix matrix;
+
+    if (nrOfRows > 0 && nrOfColumns > 0)
+    {
+        matrix._allocMemory(nrOfRows, nrOfColumns);
+        matrix._copyInitItems(*this, rowNr, columnNr, 0, 0, nrOfRows, nrOfColumns);
+    }
+
+    return matrix;
+}
+
+template <MatrixElementType T>
+void Matrix<T>::assignBlock(const Matrix<T>& matrix, Matrix<T>::size_type matrixRowNr,
+                            Matrix<T>::size_type matrixColumnNr, Matrix<T>::size_type nrOfRows,
+                            Matrix<T>::size_type nrOfColumns, Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    CHECK_ERROR_CONDITION(&matrix == this, Matr::errorMessages[Matr::Errors::CURRENT_MATRIX_AS_ARGUMENT]);
+    CHECK_ERROR_CONDITION(!matrix._isBlockWithinBounds(matrixRowNr, matrixColumnNr, nrOfRows, nrOfColumns) ||
+                              !_isBlockWithinBounds(rowNr, columnNr, nrOfRows, nrOfColumns),
+                          Matr::errorMessages[Matr::Errors::BLOCK_OUT_OF_BOUNDS]);
+
+    _copyAssignItems(matrix, matrixRowNr, matrixColumnNr, rowNr, columnNr, nrOfRows, nrOfColumns);
+}
+
+template <MatrixElementType T>
+void Matrix<T>::assignBlock(Matrix<T>&& matrix, Matrix<T>::size_type matrixRowNr, Matrix<T>::size_type matrixColumnNr,
+                            Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns,
+                            Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    CHECK_ERROR_CONDITION(&matrix == this, Matr::errorMessages[Matr::Errors::CURRENT_MATRIX_AS_ARGUMENT]);
+    CHECK_ERROR_CONDITION(!matrix._isBlockWithinBounds(matrixRowNr, matrixColumnNr, nrOfRows, nrOfColumns) ||
+                              !_isBlockWithinBounds(rowNr, columnNr, nrOfRows, nrOfColumns),
+                          Matr::errorMessages[Matr::Errors::BLOCK_OUT_OF_BOUNDS]);
+
+    _moveAssignItems(matrix, matrixRowNr, matrixColumnNr, rowNr, columnNr, nrOfRows, nrOfColumns);
+}
+
+template <MatrixElementType T>
+void Matrix<T>::swapRows(Matrix<T>::size_type firstRowNr, Matrix<T>::size_type secondRowNr)
+{
+    CHECK_ERROR_CONDITION(firstRowNr >= m_NrOfRows || secondRowNr >= m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
+
+    const size_type c_FirstAbsRowNr{static_cast<size_type>(*m_RowCapacityOffset + firstRowNr)};
+    const size_type c_SecondAbsRowNr{static_cast<size_type>(*m_RowCapacityOffset + secondRowNr)};
+
+    if (c_FirstAbsRowNr != c_SecondAbsRowNr)
+    {
+        // exchanging row pointers is enough and greatly optimizes the speed of execution
+        std::swap(m_pBaseArrayPtr[c_FirstAbsRowNr], m_pBaseArrayPtr[c_SecondAbsRowNr]);
+    }
+}
+
+template <MatrixElementType T>
+void Matrix<T>::swapColumns(Matrix<T>::size_type firstColumnNr, Matrix<T>::size_type secondColumnNr)
+{
+    CHECK_ERROR_CONDITION(firstColumnNr >= m_NrOfColumns || secondColumnNr >= m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
+
+    if (firstColumnNr != secondColumnNr)
+    {
+        for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
+        {
+            std::swap(m_pBaseArrayPtr[absRowNr][firstColumnNr], m_pBaseArrayPtr[absRowNr][secondColumnNr]);
+        }
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::permuteRows(const std::vector<Matrix<T>::size_type>& permutation)
+{
+    CHECK_ERROR_CONDITION(!_isPermutation(permutation, m_NrOfRows),
+                          Matr::errorMessages[Matr::Errors::INVALID_PERMUTATION]);
+
+    if (!isEmpty())
+    {
+        T** pStartingRow{m_pBaseArrayPtr + *m_RowCapacityOffset};
+        const std::vector<T*> c_InitialRowPointers(pStartingRow, pStartingRow + m_NrOfRows);
+
+        for (size_type rowNr{0}; rowNr < m_NrOfRows; ++rowNr)
+        {
+            pStartingRow[rowNr] = c_InitialRowPointers[permutation[rowNr]];
+        }
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::permuteColumns(const std::vector<Matrix<T>::size_type>& permutation)
+{
+    CHECK_ERROR_CONDITION(!_isPermutation(permutation, m_NrOfColumns),
+                          Matr::errorMessages[Matr::Errors::INVALID_PERMUTATION]);
+
+    // the permutation is decomposed into cycles only once (fixed points excluded), the cycles are then applied row by
+    // row so each element is moved exactly once and all accesses stay within the (contiguous) row being permuted
+    std::vector<size_type> cycleElements;
+    std::vector<size_t> cycleEnds;
+    std::vector<bool> isVisited(m_NrOfColumns, false);
+
+    for (size_type columnNr{0}; columnNr < m_NrOfColumns; ++columnNr)
+    {
+        if (!isVisited[columnNr] && permutation[columnNr] != columnNr)
+        {
+            for (size_type cycleColumnNr{columnNr}; !isVisited[cycleColumnNr];
+                 cycleColumnNr = permutation[cycleColumnNr])
+            {
+                isVisited[cycleColumnNr] = true;
+                cycleElements.push_back(cycleColumnNr);
+            }
+
+            cycleEnds.push_back(cycleElements.size());
+        }
+    }
+
+    if (!cycleElements.empty())
+    {
+        for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
+        {
+            T* const pRow{m_pBaseArrayPtr[absRowNr]};
+            size_t cycleBegin{0};
+
+            for (const size_t cycleEnd : cycleEnds)
+            {
+                // each element takes over the value of its successor within the cycle (the last one the saved value)
+                T firstElement{std::move(pRow[cycleElements[cycleBegin]])};
+
+                for (size_t index{cycleBegin}; index + 1 < cycleEnd; ++index)
+                {
+                    pRow[cycleElements[index]] = std::move(pRow[cycleElements[index + 1]]);
+                }
+
+                pRow[cycleElements[cycleEnd - 1]] = std::move(firstElement);
+                cycleBegin = cycleEnd;
+            }
+        }
+    }
+}
+
+template <MatrixElementType T>
+std::vector<typename Matrix<T>::size_type>
+Matrix<T>::getInversePermutation(const std::vector<Matrix<T>::size_type>& permutation)
+{
+    CHECK_ERROR_CONDITION(!_isPermutation(permutation, permutation.size()),
+                          Matr::errorMessages[Matr::Errors::INVALID_PERMUTATION]);
+
+    std::vector<size_type> inversePermutation(permutation.size());
+
+    for (size_t position{0}; position < permutation.size(); ++position)
+    {
+        inversePermutation[permutation[position]] = static_cast<size_type>(position);
+    }
+
+    return inversePermutation;
+}
+
+template <MatrixElementType T> typename Matrix<T>::ColumnOrderView Matrix<T>::columnOrderView()
+{
+    return ColumnOrderView{*this};
+}
+
+template <MatrixElementType T> bool Matrix<T>::operator==(const Matrix<T>& matrix) const
+{
+    bool areEqual{true};
+
+    if (&matrix != this)
+    {
+        // matrix emptiness should be checked first in order to avoid accessing (std::optional) capacity offsets of
+        // empty matrixes (see second case: "else if")
+        if (const bool isCurrentMatrixEmpty{isEmpty()}, isOtherMatrixEmpty{matrix.isEmpty()};
+            isCurrentMatrixEmpty || isOtherMatrixEmpty)
+        {
+            areEqual = isCurrentMatrixEmpty && isOtherMatrixEmpty;
+        }
+        else if (m_NrOfRows == matrix.m_NrOfRows && m_NrOfColumns == matrix.m_NrOfColumns)
+        {
+            for (size_type absRowNr{*m_RowCapacityOffset}, matrixAbsRowNr{*matrix.m_RowCapacityOffset};
+                 absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr, ++matrixAbsRowNr)
+            {
+                areEqual = areEqual && std::equal(m_pBaseArrayPtr[absRowNr], m_pBaseArrayPtr[absRowNr] + m_NrOfColumns,
+                                                  matrix.m_pBaseArrayPtr[matrixAbsRowNr]);
+
+                if (!areEqual)
+                {
+                    break;
+                }
+            }
+        }
+        else
+        {
+            areEqual = false;
+        }
+    }
+
+    return areEqual;
+}
+
+template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::zBegin()
+{
+    GET_FORWARD_NON_DIAG_BEGIN_ITERATOR(ZIterator,
+                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                        m_NrOfRows, m_NrOfColumns);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::zEnd()
+{
+    GET_FORWARD_END_ZITERATOR(ZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                              m_NrOfRows, m_NrOfColumns);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::zRowBegin(Matrix<T>::size_type rowNr)
+{
+    GET_FORWARD_ROW_BEGIN_ZITERATOR(ZIterator,
+                                    m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                    m_NrOfRows, m_NrOfColumns, rowNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::zRowEnd(Matrix<T>::size_type rowNr)
+{
+    GET_FORWARD_ROW_END_ZITERATOR(ZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                  m_NrOfRows, m_NrOfColumns, rowNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ZIterator Matrix<T>::getZIterator(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ConstZIterator Matrix<T>::constZBegin() const
+{
+    GET_FORWARD_NON_DIAG_BEGIN_ITERATOR(ConstZIterator,
+                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                        m_NrOfRows, m_NrOfColumns);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ConstZIterator Matrix<T>::constZEnd() const
+{
+    GET_FORWARD_END_ZITERATOR(ConstZIterator,
+                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                              m_NrOfColumns);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstZIterator Matrix<T>::constZRowBegin(Matrix<T>::size_type rowNr) const
+{
+    GET_FORWARD_ROW_BEGIN_ZITERATOR(ConstZIterator,
+                                    m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                    m_NrOfRows, m_NrOfColumns, rowNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstZIterator Matrix<T>::constZRowEnd(Matrix<T>::size_type rowNr) const
+{
+    GET_FORWARD_ROW_END_ZITERATOR(ConstZIterator,
+                                  m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                  m_NrOfRows, m_NrOfColumns, rowNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstZIterator Matrix<T>::getConstZIterator(Matrix<T>::size_type rowNr,
+                                                                Matrix<T>::size_type columnNr) const
+{
+    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ConstZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ReverseZIterator Matrix<T>::reverseZBegin()
+{
+    GET_REVERSE_NON_DIAG_BEGIN_ITERATOR(ReverseZIterator,
+                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                        m_NrOfRows, m_NrOfColumns);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ReverseZIterator Matrix<T>::reverseZEnd()
+{
+    GET_REVERSE_END_ZITERATOR(ReverseZIterator,
+                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                              m_NrOfColumns);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseZIterator Matrix<T>::reverseZRowBegin(Matrix<T>::size_type rowNr)
+{
+    GET_REVERSE_ROW_BEGIN_ZITERATOR(ReverseZIterator,
+                                    m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                    m_NrOfRows, m_NrOfColumns, rowNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseZIterator Matrix<T>::reverseZRowEnd(Matrix<T>::size_type rowNr)
+{
+    GET_REVERSE_ROW_END_ZITERATOR(ReverseZIterator,
+                                  m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                  m_NrOfRows, m_NrOfColumns, rowNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseZIterator Matrix<T>::getReverseZIterator(Matrix<T>::size_type rowNr,
+                                                                    Matrix<T>::size_type columnNr)
+{
+    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ReverseZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ConstReverseZIterator Matrix<T>::constReverseZBegin() const
+{
+    GET_REVERSE_NON_DIAG_BEGIN_ITERATOR(ConstReverseZIterator,
+                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                        m_NrOfRows, m_NrOfColumns);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ConstReverseZIterator Matrix<T>::constReverseZEnd() const
+{
+    GET_REVERSE_END_ZITERATOR(ConstReverseZIterator,
+                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                              m_NrOfColumns);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseZIterator Matrix<T>::constReverseZRowBegin(Matrix<T>::size_type rowNr) const
+{
+    GET_REVERSE_ROW_BEGIN_ZITERATOR(ConstReverseZIterator,
+                                    m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                    m_NrOfRows, m_NrOfColumns, rowNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseZIterator Matrix<T>::constReverseZRowEnd(Matrix<T>::size_type rowNr) const
+{
+    GET_REVERSE_ROW_END_ZITERATOR(ConstReverseZIterator,
+                                  m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                  m_NrOfRows, m_NrOfColumns, rowNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseZIterator Matrix<T>::getConstReverseZIterator(Matrix<T>::size_type rowNr,
+                                                                              Matrix<T>::size_type columnNr) const
+{
+    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ConstReverseZIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::NIterator Matrix<T>::nBegin()
+{
+    GET_FORWARD_NON_DIAG_BEGIN_ITERATOR(NIterator,
+                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                        m_NrOfRows, m_NrOfColumns);
+}
+
+template <MatrixElementType T> typename Matrix<T>::NIterator Matrix<T>::nEnd()
+{
+    GET_FORWARD_END_NITERATOR(NIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                              m_NrOfRows, m_NrOfColumns);
+}
+
+template <MatrixElementType T> typename Matrix<T>::NIterator Matrix<T>::nColumnBegin(Matrix<T>::size_type columnNr)
+{
+    GET_FORWARD_COLUMN_BEGIN_NITERATOR(NIterator,
+                                       m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                       m_NrOfRows, m_NrOfColumns, columnNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::NIterator Matrix<T>::nColumnEnd(Matrix<T>::size_type columnNr)
+{
+    GET_FORWARD_COLUMN_END_NITERATOR(NIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::NIterator Matrix<T>::getNIterator(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        NIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ConstNIterator Matrix<T>::constNBegin() const
+{
+    GET_FORWARD_NON_DIAG_BEGIN_ITERATOR(ConstNIterator,
+                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                        m_NrOfRows, m_NrOfColumns);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ConstNIterator Matrix<T>::constNEnd() const
+{
+    GET_FORWARD_END_NITERATOR(ConstNIterator,
+                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                              m_NrOfColumns);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstNIterator Matrix<T>::constNColumnBegin(Matrix<T>::size_type columnNr) const
+{
+    GET_FORWARD_COLUMN_BEGIN_NITERATOR(ConstNIterator,
+                                       m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                       m_NrOfRows, m_NrOfColumns, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstNIterator Matrix<T>::constNColumnEnd(Matrix<T>::size_type columnNr) const
+{
+    GET_FORWARD_COLUMN_END_NITERATOR(ConstNIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstNIterator Matrix<T>::getConstNIterator(Matrix<T>::size_type rowNr,
+                                                                Matrix<T>::size_type columnNr) const
+{
+    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ConstNIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ReverseNIterator Matrix<T>::reverseNBegin()
+{
+    GET_REVERSE_NON_DIAG_BEGIN_ITERATOR(ReverseNIterator,
+                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                        m_NrOfRows, m_NrOfColumns);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ReverseNIterator Matrix<T>::reverseNEnd()
+{
+    GET_REVERSE_END_NITERATOR(ReverseNIterator,
+                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                              m_NrOfColumns);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseNIterator Matrix<T>::reverseNColumnBegin(Matrix<T>::size_type columnNr)
+{
+    GET_REVERSE_COLUMN_BEGIN_NITERATOR(ReverseNIterator,
+                                       m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                       m_NrOfRows, m_NrOfColumns, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseNIterator Matrix<T>::reverseNColumnEnd(Matrix<T>::size_type columnNr)
+{
+    GET_REVERSE_COLUMN_END_NITERATOR(ReverseNIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseNIterator Matrix<T>::getReverseNIterator(Matrix<T>::size_type rowNr,
+                                                                    Matrix<T>::size_type columnNr)
+{
+    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ReverseNIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ConstReverseNIterator Matrix<T>::constReverseNBegin() const
+{
+    GET_REVERSE_NON_DIAG_BEGIN_ITERATOR(ConstReverseNIterator,
+                                        m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                        m_NrOfRows, m_NrOfColumns);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ConstReverseNIterator Matrix<T>::constReverseNEnd() const
+{
+    GET_REVERSE_END_NITERATOR(ConstReverseNIterator,
+                              m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                              m_NrOfColumns);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseNIterator Matrix<T>::constReverseNColumnBegin(Matrix<T>::size_type columnNr) const
+{
+    GET_REVERSE_COLUMN_BEGIN_NITERATOR(ConstReverseNIterator,
+                                       m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                       m_NrOfRows, m_NrOfColumns, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseNIterator Matrix<T>::constReverseNColumnEnd(Matrix<T>::size_type columnNr) const
+{
+    GET_REVERSE_COLUMN_END_NITERATOR(ConstReverseNIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseNIterator Matrix<T>::getConstReverseNIterator(Matrix<T>::size_type rowNr,
+                                                                              Matrix<T>::size_type columnNr) const
+{
+    GET_NON_DIAG_ITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ConstReverseNIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::DIterator Matrix<T>::dBegin(Matrix<T>::diff_type diagonalNr)
+{
+    GET_DIAG_BEGIN_ITERATOR(DIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                            m_NrOfRows, m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::DIterator Matrix<T>::dBegin(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_BEGIN_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        DIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::DIterator Matrix<T>::dEnd(Matrix<T>::diff_type diagonalNr)
+{
+    GET_END_DITERATOR_BY_DIAG_NUMBER(DIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::DIterator Matrix<T>::dEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_END_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        DIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::DIterator Matrix<T>::getDIterator(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_DIAG_RANDOM_ITERATOR(DIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                             m_NrOfRows, m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::DIterator Matrix<T>::getDIterator(
+    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex)
+{
+    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
+    GET_RANDOM_DITERATOR_BY_DIAG_NUMBER_AND_INDEX(
+        DIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, diagonalNr, diagonalIndex);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstDIterator Matrix<T>::constDBegin(Matrix<T>::diff_type diagonalNr) const
+{
+    GET_DIAG_BEGIN_ITERATOR(ConstDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                            m_NrOfRows, m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstDIterator Matrix<T>::constDBegin(Matrix<T>::size_type rowNr,
+                                                          Matrix<T>::size_type columnNr) const
+{
+    GET_BEGIN_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ConstDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstDIterator Matrix<T>::constDEnd(Matrix<T>::diff_type diagonalNr) const
+{
+    GET_END_DITERATOR_BY_DIAG_NUMBER(ConstDIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstDIterator Matrix<T>::constDEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
+{
+    GET_END_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ConstDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstDIterator Matrix<T>::getConstDIterator(Matrix<T>::size_type rowNr,
+                                                                Matrix<T>::size_type columnNr) const
+{
+    GET_DIAG_RANDOM_ITERATOR(ConstDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                             m_NrOfRows, m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstDIterator Matrix<T>::getConstDIterator(
+    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex) const
+{
+    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
+    GET_RANDOM_DITERATOR_BY_DIAG_NUMBER_AND_INDEX(
+        ConstDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, diagonalNr, diagonalIndex);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseDIterator Matrix<T>::reverseDBegin(Matrix<T>::diff_type diagonalNr)
+{
+    GET_DIAG_BEGIN_ITERATOR(ReverseDIterator,
+                            m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                            m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseDIterator Matrix<T>::reverseDBegin(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_BEGIN_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ReverseDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseDIterator Matrix<T>::reverseDEnd(Matrix<T>::diff_type diagonalNr)
+{
+    GET_END_DITERATOR_BY_DIAG_NUMBER(ReverseDIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseDIterator Matrix<T>::reverseDEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_END_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ReverseDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseDIterator Matrix<T>::getReverseDIterator(Matrix<T>::size_type rowNr,
+                                                                    Matrix<T>::size_type columnNr)
+{
+    GET_DIAG_RANDOM_ITERATOR(ReverseDIterator,
+                             m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                             m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseDIterator Matrix<T>::getReverseDIterator(
+    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex)
+{
+    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
+    GET_RANDOM_DITERATOR_BY_DIAG_NUMBER_AND_INDEX(
+        ReverseDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, diagonalNr, diagonalIndex);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseDIterator Matrix<T>::constReverseDBegin(Matrix<T>::diff_type diagonalNr) const
+{
+    GET_DIAG_BEGIN_ITERATOR(ConstReverseDIterator,
+                            m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                            m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseDIterator Matrix<T>::constReverseDBegin(Matrix<T>::size_type rowNr,
+                                                                        Matrix<T>::size_type columnNr) const
 {
     GET_BEGIN_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
         ConstReverseDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
@@ -3892,918 +6155,2256 @@ typename Matrix<T>::ConstReverseDIterator Matrix<T>::constReverseDBegin(Matrix<T
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseDIterator Matrix<T>::constReverseDEnd(Matrix<T>::diff_type diagonalNr) const
+typename Matrix<T>::ConstReverseDIterator Matrix<T>::constReverseDEnd(Matrix<T>::diff_type diagonalNr) const
+{
+    GET_END_DITERATOR_BY_DIAG_NUMBER(ConstReverseDIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseDIterator Matrix<T>::constReverseDEnd(Matrix<T>::size_type rowNr,
+                                                                      Matrix<T>::size_type columnNr) const
+{
+    GET_END_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ConstReverseDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseDIterator Matrix<T>::getConstReverseDIterator(Matrix<T>::size_type rowNr,
+                                                                              Matrix<T>::size_type columnNr) const
+{
+    GET_DIAG_RANDOM_ITERATOR(ConstReverseDIterator,
+                             m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                             m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseDIterator Matrix<T>::getConstReverseDIterator(
+    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex) const
+{
+    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
+    GET_RANDOM_DITERATOR_BY_DIAG_NUMBER_AND_INDEX(
+        ConstReverseDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, diagonalNr, diagonalIndex);
+}
+
+template <MatrixElementType T> typename Matrix<T>::MIterator Matrix<T>::mBegin(Matrix<T>::diff_type diagonalNr)
+{
+    GET_DIAG_BEGIN_ITERATOR(MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                            m_NrOfRows, m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::MIterator Matrix<T>::mBegin(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_BEGIN_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T> typename Matrix<T>::MIterator Matrix<T>::mEnd(Matrix<T>::diff_type diagonalNr)
+{
+    GET_END_MITERATOR_BY_DIAG_NUMBER(MIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::MIterator Matrix<T>::mEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_END_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::MIterator Matrix<T>::getMIterator(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_DIAG_RANDOM_ITERATOR(MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                             m_NrOfRows, m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::MIterator Matrix<T>::getMIterator(
+    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex)
+{
+    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
+    GET_RANDOM_MITERATOR_BY_DIAG_NUMBER_AND_INDEX(
+        MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, diagonalNr, diagonalIndex);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstMIterator Matrix<T>::constMBegin(Matrix<T>::diff_type diagonalNr) const
+{
+    GET_DIAG_BEGIN_ITERATOR(ConstMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                            m_NrOfRows, m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstMIterator Matrix<T>::constMBegin(Matrix<T>::size_type rowNr,
+                                                          Matrix<T>::size_type columnNr) const
+{
+    GET_BEGIN_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ConstMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstMIterator Matrix<T>::constMEnd(Matrix<T>::diff_type diagonalNr) const
+{
+    GET_END_MITERATOR_BY_DIAG_NUMBER(ConstMIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstMIterator Matrix<T>::constMEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
+{
+    GET_END_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ConstMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstMIterator Matrix<T>::getConstMIterator(Matrix<T>::size_type rowNr,
+                                                                Matrix<T>::size_type columnNr) const
+{
+    GET_DIAG_RANDOM_ITERATOR(MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                             m_NrOfRows, m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstMIterator Matrix<T>::getConstMIterator(
+    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex) const
+{
+    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
+    GET_RANDOM_MITERATOR_BY_DIAG_NUMBER_AND_INDEX(
+        MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, diagonalNr, diagonalIndex);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseMIterator Matrix<T>::reverseMBegin(Matrix<T>::diff_type diagonalNr)
+{
+    GET_DIAG_BEGIN_ITERATOR(ReverseMIterator,
+                            m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                            m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseMIterator Matrix<T>::reverseMBegin(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_BEGIN_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseMIterator Matrix<T>::reverseMEnd(Matrix<T>::diff_type diagonalNr)
+{
+    GET_END_MITERATOR_BY_DIAG_NUMBER(ReverseMIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseMIterator Matrix<T>::reverseMEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+{
+    GET_END_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseMIterator Matrix<T>::getReverseMIterator(Matrix<T>::size_type rowNr,
+                                                                    Matrix<T>::size_type columnNr)
+{
+    GET_DIAG_RANDOM_ITERATOR(ReverseMIterator,
+                             m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                             m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ReverseMIterator Matrix<T>::getReverseMIterator(
+    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex)
+{
+    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
+    GET_RANDOM_MITERATOR_BY_DIAG_NUMBER_AND_INDEX(
+        ReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, diagonalNr, diagonalIndex);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseMIterator Matrix<T>::constReverseMBegin(Matrix<T>::diff_type diagonalNr) const
+{
+    GET_DIAG_BEGIN_ITERATOR(ConstReverseMIterator,
+                            m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                            m_NrOfColumns, diagonalNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseMIterator Matrix<T>::constReverseMBegin(Matrix<T>::size_type rowNr,
+                                                                        Matrix<T>::size_type columnNr) const
+{
+    GET_BEGIN_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ConstReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseMIterator Matrix<T>::constReverseMEnd(Matrix<T>::diff_type diagonaNr) const
+{
+    GET_END_MITERATOR_BY_DIAG_NUMBER(ConstReverseMIterator,
+                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
+                                     m_NrOfRows, m_NrOfColumns, diagonaNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseMIterator Matrix<T>::constReverseMEnd(Matrix<T>::size_type rowNr,
+                                                                      Matrix<T>::size_type columnNr) const
+{
+    GET_END_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
+        ConstReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseMIterator Matrix<T>::getConstReverseMIterator(Matrix<T>::size_type rowNr,
+                                                                              Matrix<T>::size_type columnNr) const
+{
+    GET_DIAG_RANDOM_ITERATOR(ConstReverseMIterator,
+                             m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+                             m_NrOfColumns, rowNr, columnNr);
+}
+
+template <MatrixElementType T>
+typename Matrix<T>::ConstReverseMIterator Matrix<T>::getConstReverseMIterator(
+    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex) const
+{
+    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
+    GET_RANDOM_MITERATOR_BY_DIAG_NUMBER_AND_INDEX(
+        ConstReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
+        m_NrOfColumns, diagonalNr, diagonalIndex);
+}
+
+template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::begin()
+{
+    return zBegin();
+}
+
+template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::end()
+{
+    return zEnd();
+}
+
+template <MatrixElementType T> typename Matrix<T>::ConstZIterator Matrix<T>::begin() const
+{
+    return constZBegin();
+}
+
+template <MatrixElementType T> typename Matrix<T>::ConstZIterator Matrix<T>::end() const
+{
+    return constZEnd();
+}
+
+template <MatrixElementType T>
+std::pair<typename Matrix<T>::size_type, typename Matrix<T>::size_type> Matrix<T>::_resizeWithUninitializedNewElements(
+    Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
+{
+    assert(nrOfRows <= maxAllowedDimension() && nrOfColumns <= maxAllowedDimension());
+
+    const size_type c_NewNrOfRows{(nrOfRows > size_type{0} && nrOfColumns > size_type{0}) ? nrOfRows : size_type{0}};
+    const size_type c_NewNrOfColumns{c_NewNrOfRows > size_type{0} ? nrOfColumns : size_type{0}};
+    const size_type c_NewRowCapacity{std::max(m_RowCapacity, c_NewNrOfRows)};
+    const size_type c_NewColumnCapacity{std::max(m_ColumnCapacity, c_NewNrOfColumns)};
+    const size_type c_NrOfRowsToKeep{std::min(m_NrOfRows, c_NewNrOfRows)};
+    const size_type c_NrOfColumnsToKeep{std::min(m_NrOfColumns, c_NewNrOfColumns)};
+    const std::optional<size_type> c_NewRowCapacityOffset{
+        c_NewNrOfRows > 0 ? std::optional((c_NewRowCapacity - c_NewNrOfRows) / 2) : std::nullopt};
+
+    if (!m_RowCapacityOffset.has_value() /* empty matrix, column capacity offset std::nullopt as well */ ||
+        !c_NewRowCapacityOffset.has_value() || c_NewRowCapacity != m_RowCapacity ||
+        c_NewColumnCapacity != m_ColumnCapacity)
+    {
+        Matrix matrix{std::move(*this)};
+        _deallocMemory(); // actually not required, just for safety purposes
+        _allocMemory(c_NewNrOfRows, c_NewNrOfColumns, c_NewRowCapacity, c_NewColumnCapacity);
+
+        // move the retained items back
+        _moveInitItems(matrix, 0, 0, 0, 0, c_NrOfRowsToKeep, c_NrOfColumnsToKeep);
+    }
+    else
+    {
+        const size_type c_ColumnsResizingSpace{static_cast<size_type>(m_ColumnCapacity - *m_ColumnCapacityOffset)};
+
+        // if not enough available capacity on the right side, then the columns should be shifted left by the minimal
+        // count of positions that ensure the resized content fits
+        if (c_NewNrOfColumns > c_ColumnsResizingSpace)
+        {
+            const size_type c_NrOfColumnsToShiftLeft{static_cast<size_type>(c_NewNrOfColumns - c_ColumnsResizingSpace)};
+            _shiftColumnsLeft(c_NrOfColumnsToShiftLeft);
+        }
+
+        // move unused top capacity to the bottom to avoid alignment issues (should be re-distributed once resize is
+        // complete)
+        _alignToTop();
+
+        // ensure the items from the right side of the retained items get properly destroyed
+        if (c_NewNrOfColumns < m_NrOfColumns)
+        {
+            _destroyItems(0, c_NrOfColumnsToKeep, c_NrOfRowsToKeep, m_NrOfColumns - c_NewNrOfColumns);
+        }
+
+        // same for the items below
+        if (c_NewNrOfRows < m_NrOfRows)
+        {
+            _destroyItems(c_NrOfRowsToKeep, 0, m_NrOfRows - c_NewNrOfRows, m_NrOfColumns);
+        }
+
+        m_NrOfRows = c_NewNrOfRows;
+        m_NrOfColumns = c_NewNrOfColumns;
+    }
+
+    return {c_NrOfRowsToKeep, c_NrOfColumnsToKeep};
+}
+
+template <MatrixElementType T>
+void Matrix<T>::_insertUninitializedRows(Matrix<T>::size_type rowNr, Matrix<T>::size_type nrOfRows)
+{
+    const size_type c_RowNr{std::clamp<size_type>(rowNr, 0u, m_NrOfRows)};
+
+    if (0 == nrOfRows)
+    {
+        // nothing to insert
+    }
+    else if (m_RowCapacity - m_NrOfRows < nrOfRows)
+    {
+        // at least double the row capacity (without exceeding the maximum allowed capacity) if not enough spare
+        // capacity left (to defer any resize when inserting further rows)
+        Matrix helperMatrix{std::move(*this)};
+        const size_type c_NewNrOfRows{static_cast<size_type>(helperMatrix.m_NrOfRows + nrOfRows)};
+        const size_type c_NewRowCapacity{std::clamp(static_cast<size_type>(size_type{2} * helperMatrix.m_NrOfRows),
+                                                    c_NewNrOfRows, maxAllowedDimension())};
+
+        _deallocMemory(); // not quite necessary, just for safety/consistency purposes
+        _allocMemory(c_NewNrOfRows, helperMatrix.m_NrOfColumns, c_NewRowCapacity, helperMatrix.m_ColumnCapacity);
+
+        // move everything back to the top/bottom of the inserted rows (these stay uninitialized - will be initialized
+        // in a separate step)
+        _moveInitItems(helperMatrix, 0, 0, 0, 0, c_RowNr, m_NrOfColumns);
+        _moveInitItems(helperMatrix, c_RowNr, 0, c_RowNr + nrOfRows, 0, m_NrOfRows - c_RowNr - nrOfRows,
+                       m_NrOfColumns);
+    }
+    else
+    {
+        // the rows are preferably taken from the capacity located on the same side as the insert position (fewer row
+        // pointers to rotate)
+        const size_type c_SpareRowsOnTop{*m_RowCapacityOffset};
+        const size_type c_SpareRowsAtBottom{static_cast<size_type>(m_RowCapacity - m_NrOfRows - c_SpareRowsOnTop)};
+        const size_type c_NrOfRowsFromTop{
+            c_RowNr <= m_NrOfRows / 2
+                ? std::min(nrOfRows, c_SpareRowsOnTop)
+                : static_cast<size_type>(nrOfRows - std::min(nrOfRows, c_SpareRowsAtBottom))};
+        const size_type c_PreviousNrOfRows{m_NrOfRows};
+
+        m_RowCapacityOffset = *m_RowCapacityOffset - c_NrOfRowsFromTop;
+        m_NrOfRows += nrOfRows;
+
+        T** pCurrentMatrixStartingRow{m_pBaseArrayPtr + *m_RowCapacityOffset};
+
+        // new rows taken from top are moved below the rows preceding the insert position, the ones taken from bottom
+        // are moved above the rows following it
+        std::rotate(pCurrentMatrixStartingRow, pCurrentMatrixStartingRow + c_NrOfRowsFromTop,
+                    pCurrentMatrixStartingRow + c_NrOfRowsFromTop + c_RowNr);
+        std::rotate(pCurrentMatrixStartingRow + c_NrOfRowsFromTop + c_RowNr,
+                    pCurrentMatrixStartingRow + c_NrOfRowsFromTop + c_PreviousNrOfRows,
+                    pCurrentMatrixStartingRow + m_NrOfRows);
+    }
+}
+
+template <MatrixElementType T>
+void Matrix<T>::_insertUninitializedColumns(Matrix<T>::size_type columnNr, Matrix<T>::size_type nrOfColumns)
+{
+    const size_type c_ColumnNr{std::clamp<size_type>(columnNr, 0u, m_NrOfColumns)};
+
+    if (0 == nrOfColumns)
+    {
+        // nothing to insert
+    }
+    else if (m_ColumnCapacity - m_NrOfColumns < nrOfColumns)
+    {
+        // at least double the column capacity (without exceeding the maximum allowed capacity) if not enough spare
+        // capacity left (to defer any resize when inserting further columns)
+        Matrix helperMatrix{std::move(*this)};
+        const size_type c_NewNrOfColumns{static_cast<size_type>(helperMatrix.m_NrOfColumns + nrOfColumns)};
+        const size_type c_NewColumnCapacity{
+            std::clamp(static_cast<size_type>(size_type{2} * helperMatrix.m_NrOfColumns), c_NewNrOfColumns,
+                       maxAllowedDimension())};
+
+        _deallocMemory(); // not quite necessary, just for safety/consistency purposes
+        _allocMemory(helperMatrix.m_NrOfRows, c_NewNrOfColumns, helperMatrix.m_RowCapacity, c_NewColumnCapacity);
+
+        // move everything back to the left/right of the inserted columns (these stay uninitialized - will be
+        // initialized in a separate step)
+        _moveInitItems(helperMatrix, 0, 0, 0, 0, m_NrOfRows, c_ColumnNr);
+        _moveInitItems(helperMatrix, 0, c_ColumnNr, 0, c_ColumnNr + nrOfColumns, m_NrOfRows,
+                       m_NrOfColumns - c_ColumnNr - nrOfColumns);
+    }
+    else
+    {
+        // the columns are preferably taken from the capacity located on the same side as the insert position (fewer
+        // elements to shift)
+        const size_type c_SpareColumnsToTheLeft{*m_ColumnCapacityOffset};
+        const size_type c_SpareColumnsToTheRight{
+            static_cast<size_type>(m_ColumnCapacity - m_NrOfColumns - c_SpareColumnsToTheLeft)};
+        const size_type c_NrOfColumnsFromLeft{
+            c_ColumnNr <= m_NrOfColumns / 2
+                ? std::min(nrOfColumns, c_SpareColumnsToTheLeft)
+                : static_cast<size_type>(nrOfColumns - std::min(nrOfColumns, c_SpareColumnsToTheRight))};
+        const size_type c_NrOfColumnsFromRight{static_cast<size_type>(nrOfColumns - c_NrOfColumnsFromLeft)};
+
+        if (c_NrOfColumnsFromLeft > 0)
+        {
+            m_ColumnCapacityOffset = *m_ColumnCapacityOffset - c_NrOfColumnsFromLeft;
+
+            // make the newly added columns visible
+            for (size_type rowNr{0}; rowNr < m_RowCapacity; ++rowNr)
+            {
+                m_pBaseArrayPtr[rowNr] -= c_NrOfColumnsFromLeft;
+            }
+        }
+
+        // each element is moved into either spare capacity or a previously vacated slot, the slots that remain vacant
+        // (uninitialized) are those of the inserted columns
+        for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
+        {
+            T* const pRow{m_pBaseArrayPtr[absRowNr]};
+
+            for (size_type columnNr{0}; c_NrOfColumnsFromLeft > 0 && columnNr < c_ColumnNr; ++columnNr)
+            {
+                std::construct_at(pRow + columnNr, std::move(pRow[columnNr + c_NrOfColumnsFromLeft]));
+                std::destroy_at(pRow + columnNr + c_NrOfColumnsFromLeft);
+            }
+
+            for (size_type columnNr{m_NrOfColumns}; c_NrOfColumnsFromRight > 0 && columnNr > c_ColumnNr; --columnNr)
+            {
+                T* const pElement{pRow + c_NrOfColumnsFromLeft + columnNr - 1};
+
+                std::construct_at(pElement + c_NrOfColumnsFromRight, std::move(*pElement));
+                std::destroy_at(pElement);
+            }
+        }
+
+        m_NrOfColumns += nrOfColumns;
+    }
+}
+
+template <MatrixElementType T>
+template <typename Range, typename Iterator>
+decltype(auto) Matrix<T>::_getRangeElement(const Iterator& elementIt)
+{
+    if constexpr (std::is_lvalue_reference_v<Range> || std::ranges::borrowed_range<Range>)
+    {
+        return *elementIt;
+    }
+    else
+    {
+        return std::ranges::iter_move(elementIt);
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::_swapTranspose(size_t nrOfThreads)
+{
+    if (!isEmpty())
+    {
+        assert(m_NrOfRows == m_NrOfColumns);
+
+        constexpr size_t c_TileSize{32};
+
+        const size_t c_NrOfTileRows{(m_NrOfRows + c_TileSize - 1) / c_TileSize};
+        T** const pStartingRow{m_pBaseArrayPtr + *m_RowCapacityOffset};
+
+        // only the tiles located on or above the main diagonal are traversed, each gets swapped with its mirrored tile
+        // (the upper rows of tiles contain more tiles so they are handled first)
+        Matr::runTasks(c_NrOfTileRows, nrOfThreads, [this, pStartingRow](size_t tileRowIndex) {
+            const size_t c_TileRowNr{tileRowIndex * c_TileSize};
+            const size_t c_TileRowsEnd{std::min<size_t>(c_TileRowNr + c_TileSize, m_NrOfRows)};
+
+            for (size_t tileColumnNr{c_TileRowNr}; tileColumnNr < m_NrOfColumns; tileColumnNr += c_TileSize)
+            {
+                const size_t c_TileColumnsEnd{std::min<size_t>(tileColumnNr + c_TileSize, m_NrOfColumns)};
+
+                for (size_t rowNr{c_TileRowNr}; rowNr < c_TileRowsEnd; ++rowNr)
+                {
+                    for (size_t columnNr{std::max(tileColumnNr, rowNr + 1)}; columnNr < c_TileColumnsEnd; ++columnNr)
+                    {
+                        std::swap(pStartingRow[rowNr][columnNr], pStartingRow[columnNr][rowNr]);
+                    }
+                }
+            }
+        });
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::_cycleTranspose(size_t nrOfThreads)
+{
+    if (!isEmpty())
+    {
+        assert(m_RowCapacity >= m_NrOfColumns && m_ColumnCapacity >= m_NrOfRows);
+
+        const size_type c_NewNrOfRows{m_NrOfColumns};
+        const size_type c_NewNrOfColumns{m_NrOfRows};
+        const size_type c_NewRowCapacityOffset{static_cast<size_type>((m_RowCapacity - c_NewNrOfRows) / 2)};
+        const size_type c_NewColumnCapacityOffset{static_cast<size_type>((m_ColumnCapacity - c_NewNrOfColumns) / 2)};
+
+        // rows might have been re-ordered by exchanging row pointers (e.g. swapRows()) so the logical row number of
+        // each physical row is required for finding out where each element should be moved (m_NrOfRows: unused row)
+        std::vector<size_type> logicalRowNrs(m_RowCapacity, m_NrOfRows);
+
+        for (size_type rowNr{0}; rowNr < m_NrOfRows; ++rowNr)
+        {
+            logicalRowNrs[(m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr] - m_pAllocPtr) / m_ColumnCapacity] = rowNr;
+        }
+
+        // positions are indexes within the allocated memory (m_pAllocPtr), the element located on a source position
+        // should be moved to the destination position obtained by transposing its row and column number
+        auto isSourcePosition = [this, &logicalRowNrs](size_t position) {
+            const size_t c_ColumnNr{position % m_ColumnCapacity};
+
+            return logicalRowNrs[position / m_ColumnCapacity] < m_NrOfRows && c_ColumnNr >= *m_ColumnCapacityOffset &&
+                   c_ColumnNr < *m_ColumnCapacityOffset + m_NrOfColumns;
+        };
+
+        auto isDestinationPosition = [=, this](size_t position) {
+            const size_t c_AbsRowNr{position / m_ColumnCapacity};
+            const size_t c_ColumnNr{position % m_ColumnCapacity};
+
+            return c_AbsRowNr >= c_NewRowCapacityOffset && c_AbsRowNr < c_NewRowCapacityOffset + c_NewNrOfRows &&
+                   c_ColumnNr >= c_NewColumnCapacityOffset &&
+                   c_ColumnNr < c_NewColumnCapacityOffset + c_NewNrOfColumns;
+        };
+
+        auto getDestinationPosition = [=, this, &logicalRowNrs](size_t sourcePosition) {
+            const size_t c_NewColumnNr{logicalRowNrs[sourcePosition / m_ColumnCapacity]};
+            const size_t c_NewRowNr{sourcePosition % m_ColumnCapacity - *m_ColumnCapacityOffset};
+
+            return (c_NewRowCapacityOffset + c_NewRowNr) * m_ColumnCapacity + c_NewColumnCapacityOffset + c_NewColumnNr;
+        };
+
+        // the chains and cycles are disjoint so they can be handled concurrently (the rows of the original matrix are
+        // distributed among threads): each chain is started from its (unique) first position, each cycle from its
+        // lowest position (leader); when running sequentially the visited positions are tracked instead as this is
+        // cheaper than checking whether a position is a cycle leader
+        const bool c_IsSequential{std::min<size_t>(nrOfThreads, m_NrOfRows) <= 1};
+        std::vector<bool> visitedPositions(c_IsSequential ? static_cast<size_t>(m_RowCapacity) * m_ColumnCapacity : 0,
+                                           false);
+
+        // chain positions are excluded (the chain end is not a source position), as well as the positions that don't
+        // change (cycles of length 1)
+        auto isCycleStart = [&](size_t position) {
+            bool isStart{false};
+
+            if (c_IsSequential)
+            {
+                isStart = !visitedPositions[position] && getDestinationPosition(position) != position;
+            }
+            else if (isDestinationPosition(position))
+            {
+                size_t currentPosition{getDestinationPosition(position)};
+
+                while (currentPosition > position && isSourcePosition(currentPosition))
+                {
+                    currentPosition = getDestinationPosition(currentPosition);
+                }
+
+                isStart = currentPosition == position && getDestinationPosition(position) != position;
+            }
+
+            return isStart;
+        };
+
+        // step 1: chains, each of them starts with a position that is not used by the transposed matrix and ends with
+        // an uninitialized position
+        Matr::runTasks(m_NrOfRows, nrOfThreads, [&](size_t rowNr) {
+            const size_t c_RowStartPosition{
+                static_cast<size_t>(m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr] - m_pAllocPtr)};
+
+            for (size_t position{c_RowStartPosition}; position < c_RowStartPosition + m_NrOfColumns; ++position)
+            {
+                if (!isDestinationPosition(position))
+                {
+                    T carriedElement{std::move(m_pAllocPtr[position])};
+                    std::destroy_at(m_pAllocPtr + position); // the memory outside matrix bounds should be uninitialized
+
+                    if (c_IsSequential)
+                    {
+                        visitedPositions[position] = true;
+                    }
+
+                    size_t currentPosition{getDestinationPosition(position)};
+
+                    for (; isSourcePosition(currentPosition); currentPosition = getDestinationPosition(currentPosition))
+                    {
+                        std::swap(carriedElement, m_pAllocPtr[currentPosition]);
+
+                        if (c_IsSequential)
+                        {
+                            visitedPositions[currentPosition] = true;
+                        }
+                    }
+
+                    std::construct_at(m_pAllocPtr + currentPosition, std::move(carriedElement));
+                }
+            }
+        });
+
+        // step 2: cycles, all of their positions are used both by the original and by the transposed matrix
+        Matr::runTasks(m_NrOfRows, nrOfThreads, [&](size_t rowNr) {
+            const size_t c_RowStartPosition{
+                static_cast<size_t>(m_pBaseArrayPtr[*m_RowCapacityOffset + rowNr] - m_pAllocPtr)};
+
+            for (size_t position{c_RowStartPosition}; position < c_RowStartPosition + m_NrOfColumns; ++position)
+            {
+                if (isCycleStart(position))
+                {
+                    T carriedElement{std::move(m_pAllocPtr[position])};
+
+                    for (size_t currentPosition{getDestinationPosition(position)}; currentPosition != position;
+                         currentPosition = getDestinationPosition(currentPosition))
+                    {
+                        std::swap(carriedElement, m_pAllocPtr[currentPosition]);
+
+                        if (c_IsSequential)
+                        {
+                            visitedPositions[currentPosition] = true;
+                        }
+                    }
+
+                    m_pAllocPtr[position] = std::move(carriedElement);
+                }
+            }
+        });
+
+        m_NrOfRows = c_NewNrOfRows;
+        m_NrOfColumns = c_NewNrOfColumns;
+        m_RowCapacityOffset = c_NewRowCapacityOffset;
+        m_ColumnCapacityOffset = c_NewColumnCapacityOffset;
+
+        // re-map the row pointers in physical order (any previous row re-ordering is resolved by the element moves)
+        for (size_type rowNr{0}; rowNr < m_RowCapacity; ++rowNr)
+        {
+            m_pBaseArrayPtr[rowNr] =
+                m_pAllocPtr + (static_cast<size_t>(rowNr) * m_ColumnCapacity) + *m_ColumnCapacityOffset;
+        }
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::_moveTranspose(size_t nrOfThreads)
+{
+    if (!isEmpty())
+    {
+        constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+        constexpr size_t c_TileSize{32};
+
+        const size_type c_NewNrOfRows{m_NrOfColumns};
+        const size_type c_NewNrOfColumns{m_NrOfRows};
+        const size_type c_NewRowCapacity{
+            m_RowCapacity < m_NrOfColumns
+                ? std::min(static_cast<size_type>(m_NrOfColumns + m_NrOfColumns / 4), c_MaxAllowedDimension)
+                : m_RowCapacity};
+        const size_type c_NewColumnCapacity{
+            m_ColumnCapacity < m_NrOfRows
+                ? std::min(static_cast<size_type>(m_NrOfRows + m_NrOfRows / 4), c_MaxAllowedDimension)
+                : m_ColumnCapacity};
+
+        Matrix helperMatrix{std::move(*this)};
+
+        _deallocMemory(); // not actually required, just for "safety" and consistency purposes
+        _allocMemory(helperMatrix.m_NrOfColumns, helperMatrix.m_NrOfRows, c_NewRowCapacity, c_NewColumnCapacity);
+
+        const size_t c_NrOfTileRows{(c_NewNrOfRows + c_TileSize - 1) / c_TileSize};
+        const size_t c_NrOfThreads{std::clamp<size_t>(nrOfThreads, 1, c_NrOfTileRows)};
+        T** const pSourceRows{helperMatrix.m_pBaseArrayPtr + *helperMatrix.m_RowCapacityOffset};
+        T** const pDestinationRows{m_pBaseArrayPtr + *m_RowCapacityOffset};
+
+        // a static assignment of the tile rows is used so each destination row is constructed by the thread that
+        // "owns" it (no use of _moveInitItems(), too much overhead)
+        Matr::runOnThreads(c_NrOfThreads, [=](size_t threadNr) {
+            const size_t c_RowsBegin{std::min<size_t>(c_NrOfTileRows * threadNr / c_NrOfThreads * c_TileSize,
+                                                      c_NewNrOfRows)};
+            const size_t c_RowsEnd{std::min<size_t>(c_NrOfTileRows * (threadNr + 1) / c_NrOfThreads * c_TileSize,
+                                                    c_NewNrOfRows)};
+
+            for (size_t tileRowNr{c_RowsBegin}; tileRowNr < c_RowsEnd; tileRowNr += c_TileSize)
+            {
+                const size_t c_TileRowsEnd{std::min(tileRowNr + c_TileSize, c_RowsEnd)};
+
+                for (size_t tileColumnNr{0}; tileColumnNr < c_NewNrOfColumns; tileColumnNr += c_TileSize)
+                {
+                    const size_t c_TileColumnsEnd{std::min<size_t>(tileColumnNr + c_TileSize, c_NewNrOfColumns)};
+
+                    for (size_t rowNr{tileRowNr}; rowNr < c_TileRowsEnd; ++rowNr)
+                    {
+                        for (size_t columnNr{tileColumnNr}; columnNr < c_TileColumnsEnd; ++columnNr)
+                        {
+                            std::construct_at(pDestinationRows[rowNr] + columnNr,
+                                              std::move(pSourceRows[columnNr][rowNr]));
+                        }
+                    }
+                }
+            }
+        });
+    }
+}
+
+template <MatrixElementType T>
+template <typename Result, typename Operation>
+std::vector<Result> Matrix<T>::_reduceRowsUnordered(const Operation& operation, size_t nrOfThreads) const
+{
+    std::vector<Result> result;
+
+    if (!isEmpty())
+    {
+        result = Matr::runRowReduction<Result>(m_NrOfRows, m_pBaseArrayPtr + *m_RowCapacityOffset, nrOfThreads,
+                                               [this, &operation](const T* pRow) {
+                                                   return Matr::reduceElementsUnordered<Result>(pRow, m_NrOfColumns,
+                                                                                                operation);
+                                               });
+    }
+
+    return result;
+}
+
+template <MatrixElementType T>
+template <typename Result, typename Operation>
+std::vector<Result> Matrix<T>::_reduceColumnsUnordered(const Operation& operation, size_t nrOfThreads) const
+{
+    std::vector<Result> result;
+
+    if (!isEmpty())
+    {
+        result = Matr::runColumnReduction<Result>(m_NrOfRows, m_NrOfColumns, m_pBaseArrayPtr + *m_RowCapacityOffset,
+                                                  operation, std::nullopt, nrOfThreads);
+    }
+
+    return result;
+}
+
+template <MatrixElementType T>
+void Matrix<T>::_reallocEraseDimensionElement(Matrix<T>::size_type dimensionElementNr, bool isRow)
+{
+    if (!isEmpty())
+    {
+        const size_type c_RequiredNrOfRows{isRow ? static_cast<size_type>(m_NrOfRows - 1) : m_NrOfRows};
+        const size_type c_RequiredNrOfColumns{isRow ? m_NrOfColumns : static_cast<size_type>(m_NrOfColumns - 1)};
+        const size_type c_RequiredRowCapacity{isRow ? static_cast<size_type>(size_type{2} * c_RequiredNrOfRows)
+                                                    : m_RowCapacity};
+        const size_type c_RequiredColumnCapacity{isRow ? m_ColumnCapacity
+                                                       : static_cast<size_type>(size_type{2} * c_RequiredNrOfColumns)};
+
+        // row or column nr depending on scenario (variable isRow)
+        const size_type c_DimensionElementNr{
+            std::clamp<size_type>(dimensionElementNr, 0u, isRow ? c_RequiredNrOfRows : c_RequiredNrOfColumns)};
+
+        // part one: top part (rows) / left part (columns) - relative to erased row/column
+        const size_type c_PartOneNrOfRows{isRow ? c_DimensionElementNr : c_RequiredNrOfRows};
+        const size_type c_PartOneNrOfColumns{isRow ? c_RequiredNrOfColumns : c_DimensionElementNr};
+
+        // part two: bottom part (rows) / right part (columns) - relative to erased row/column
+        const size_type c_PartTwoSrcStartingRowNr{isRow ? static_cast<size_type>(c_DimensionElementNr + 1)
+                                                        : size_type{0}};
+        const size_type c_PartTwoSrcColumnOffset{
+            static_cast<size_type>(c_DimensionElementNr + 1 - c_PartTwoSrcStartingRowNr)};
+        const size_type c_PartTwoStartingRowNr{isRow ? c_DimensionElementNr : size_type{0}};
+        const size_type c_PartTwoColumnOffset{static_cast<size_type>(c_DimensionElementNr - c_PartTwoStartingRowNr)};
+        const size_type c_PartTwoNrOfRows{static_cast<size_type>(c_RequiredNrOfRows - c_PartTwoStartingRowNr)};
+        const size_type c_PartTwoNrOfColumns{static_cast<size_type>(c_RequiredNrOfColumns - c_PartTwoColumnOffset)};
+
+        Matrix helperMatrix{std::move(*this)};
+
+        _deallocMemory(); // not really necessary, just for safety purposes
+        _allocMemory(c_RequiredNrOfRows, c_RequiredNrOfColumns, c_RequiredRowCapacity, c_RequiredColumnCapacity);
+        _moveInitItems(helperMatrix, 0, 0, 0, 0, c_PartOneNrOfRows, c_PartOneNrOfColumns);
+        _moveInitItems(helperMatrix, c_PartTwoSrcStartingRowNr, c_PartTwoSrcColumnOffset, c_PartTwoStartingRowNr,
+                       c_PartTwoColumnOffset, c_PartTwoNrOfRows, c_PartTwoNrOfColumns);
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::_shiftEraseRow(Matrix<T>::size_type rowNr)
+{
+    if (!isEmpty())
+    {
+        const size_type c_RowNr{std::clamp<size_type>(rowNr, 0u, m_NrOfRows - 1)};
+        T** pStartingRow{m_pBaseArrayPtr + *m_RowCapacityOffset};
+
+        if (c_RowNr < m_NrOfRows / 2)
+        {
+            std::rotate(pStartingRow, pStartingRow + c_RowNr, pStartingRow + c_RowNr + 1);
+            std::destroy_n(m_pBaseArrayPtr[*m_RowCapacityOffset],
+                           m_NrOfColumns); // the memory outside matrix bounds should be uninitialized
+            m_RowCapacityOffset = *m_RowCapacityOffset + 1;
+        }
+        else
+        {
+            std::rotate(pStartingRow + c_RowNr, pStartingRow + c_RowNr + 1, pStartingRow + m_NrOfRows);
+            std::destroy_n(m_pBaseArrayPtr[*m_RowCapacityOffset + m_NrOfRows - 1],
+                           m_NrOfColumns); // the memory outside matrix bounds should be uninitialized
+        }
+
+        --m_NrOfRows;
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::_shiftEraseColumn(Matrix<T>::size_type columnNr)
+{
+    if (!isEmpty())
+    {
+        const size_type c_ColumnNr{std::clamp<size_type>(columnNr, 0u, m_NrOfColumns - 1)};
+
+        if (c_ColumnNr < m_NrOfColumns / 2)
+        {
+            for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
+            {
+                std::rotate(m_pBaseArrayPtr[absRowNr], m_pBaseArrayPtr[absRowNr] + c_ColumnNr,
+                            m_pBaseArrayPtr[absRowNr] + c_ColumnNr + 1);
+                std::destroy_n(m_pBaseArrayPtr[absRowNr], 1);
+            }
+
+            for (size_type absRowNr{0}; absRowNr < m_RowCapacity; ++absRowNr)
+            {
+                ++m_pBaseArrayPtr[absRowNr];
+            }
+
+            m_ColumnCapacityOffset = *m_ColumnCapacityOffset + 1;
+        }
+        else
+        {
+            for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
+            {
+                std::rotate(m_pBaseArrayPtr[absRowNr] + c_ColumnNr, m_pBaseArrayPtr[absRowNr] + c_ColumnNr + 1,
+                            m_pBaseArrayPtr[absRowNr] + m_NrOfColumns);
+                std::destroy_n(m_pBaseArrayPtr[absRowNr] + m_NrOfColumns - 1,
+                               1); // the memory outside matrix bounds should be uninitialized
+            }
+        }
+
+        --m_NrOfColumns;
+    }
+}
+
+template <MatrixElementType T>
+void Matrix<T>::_reallocEraseDimensionElements(std::span<const Matrix<T>::size_type> dimensionElementNrs, bool isRow)
+{
+    if (!isEmpty() && !dimensionElementNrs.empty())
+    {
+        const size_type c_NrOfErasedElements{static_cast<size_type>(dimensionElementNrs.size())};
+        const size_type c_RequiredNrOfRows{isRow ? static_cast<size_type>(m_NrOfRows - c_NrOfErasedElements)
+                                                 : m_NrOfRows};
+        const size_type c_RequiredNrOfColumns{isRow ? m_NrOfColumns
+                                                    : static_cast<size_type>(m_NrOfColumns - c_NrOfErasedElements)};
+        const size_type c_RequiredRowCapacity{isRow ? static_cast<size_type>(size_type{2} * c_RequiredNrOfRows)
+                                                    : m_RowCapacity};
+        const size_type c_RequiredColumnCapacity{isRow ? m_ColumnCapacity
+                                                       : static_cast<size_type>(size_type{2} * c_RequiredNrOfColumns)};
+        const size_type c_InitialNrOfElements{isRow ? m_NrOfRows : m_NrOfColumns};
+
+        Matrix helperMatrix{std::move(*this)};
+
+        _deallocMemory(); // not really necessary, just for safety purposes
+        _allocMemory(c_RequiredNrOfRows, c_RequiredNrOfColumns, c_RequiredRowCapacity, c_RequiredColumnCapacity);
+
+        // move the blocks of rows/columns located between the erased ones (each block with a single call)
+        size_type srcElementNr{0};
+        size_type destElementNr{0};
+
+        for (size_t index{0}; index <= dimensionElementNrs.size(); ++index)
+        {
+            const size_type c_BlockEndNr{index < dimensionElementNrs.size() ? dimensionElementNrs[index]
+                                                                           : c_InitialNrOfElements};
+            const size_type c_BlockSize{static_cast<size_type>(c_BlockEndNr - srcElementNr)};
+
+            if (c_BlockSize > 0)
+            {
+                if (isRow)
+                {
+                    _moveInitItems(helperMatrix, srcElementNr, 0, destElementNr, 0, c_BlockSize, m_NrOfColumns);
+                }
+                else
+                {
+                    _moveInitItems(helperMatrix, 0, srcElementNr, 0, destElementNr, m_NrOfRows, c_BlockSize);
+                }
+            }
+
+            srcElementNr = static_cast<size_type>(c_BlockEndNr + 1);
+            destElementNr += c_BlockSize;
+        }
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::_shiftEraseRows(std::span<const Matrix<T>::size_type> rowNrs)
+{
+    if (!isEmpty() && !rowNrs.empty())
+    {
+        T** pStartingRow{m_pBaseArrayPtr + *m_RowCapacityOffset};
+        auto rowNrsIt{rowNrs.begin()};
+        size_type destRowNr{rowNrs.front()};
+
+        // the row pointers of the remaining rows are swapped towards top, the pointers of the erased rows end up below
+        // them (no elements are moved)
+        for (size_type rowNr{rowNrs.front()}; rowNr < m_NrOfRows; ++rowNr)
+        {
+            if (rowNrsIt != rowNrs.end() && *rowNrsIt == rowNr)
+            {
+                std::destroy_n(pStartingRow[rowNr], m_NrOfColumns);
+                ++rowNrsIt;
+            }
+            else
+            {
+                std::swap(pStartingRow[destRowNr], pStartingRow[rowNr]);
+                ++destRowNr;
+            }
+        }
+
+        m_NrOfRows = destRowNr;
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::_shiftEraseColumns(std::span<const Matrix<T>::size_type> columnNrs)
+{
+    if (!isEmpty() && !columnNrs.empty())
+    {
+        for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
+        {
+            T* const pRow{m_pBaseArrayPtr[absRowNr]};
+            auto columnNrsIt{columnNrs.begin()};
+            size_type destColumnNr{columnNrs.front()};
+
+            // each remaining element is moved at most once (to the left) within its row
+            for (size_type columnNr{columnNrs.front()}; columnNr < m_NrOfColumns; ++columnNr)
+            {
+                if (columnNrsIt != columnNrs.end() && *columnNrsIt == columnNr)
+                {
+                    ++columnNrsIt;
+                }
+                else
+                {
+                    std::construct_at(pRow + destColumnNr, std::move(pRow[columnNr]));
+                    ++destColumnNr;
+                }
+
+                std::destroy_at(pRow + columnNr); // the memory outside matrix bounds should be uninitialized
+            }
+        }
+
+        m_NrOfColumns = static_cast<size_type>(m_NrOfColumns - columnNrs.size());
+    }
+}
+
+template <MatrixElementType T>
+bool Matrix<T>::_arePositionsStrictlyAscending(std::span<const Matrix<T>::size_type> positions)
+{
+    return std::ranges::adjacent_find(positions, std::greater_equal<size_type>{}) == positions.end();
+}
+
+template <MatrixElementType T>
+bool Matrix<T>::_isBlockWithinBounds(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr,
+                                     Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns) const
+{
+    return size_t{rowNr} + nrOfRows <= m_NrOfRows && size_t{columnNr} + nrOfColumns <= m_NrOfColumns;
+}
+
+template <MatrixElementType T>
+void Matrix<T>::_checkSplitPositions(std::span<const Matrix<T>::size_type> splitPositions, bool areRowPositions) const
+{
+    CHECK_ERROR_CONDITION(!_arePositionsStrictlyAscending(splitPositions),
+                          Matr::errorMessages[Matr::Errors::POSITIONS_NOT_STRICTLY_ASCENDING]);
+
+    if (!splitPositions.empty())
+    {
+        if (areRowPositions)
+        {
+            CHECK_ERROR_CONDITION(splitPositions.back() >= m_NrOfRows,
+                                  Matr::errorMessages[Matr::Errors::ROW_DOES_NOT_EXIST]);
+            CHECK_ERROR_CONDITION(0 == splitPositions.front(), Matr::errorMessages[Matr::Errors::RESULT_NO_ROWS]);
+        }
+        else
+        {
+            CHECK_ERROR_CONDITION(splitPositions.back() >= m_NrOfColumns,
+                                  Matr::errorMessages[Matr::Errors::COLUMN_DOES_NOT_EXIST]);
+            CHECK_ERROR_CONDITION(0 == splitPositions.front(), Matr::errorMessages[Matr::Errors::RESULT_NO_COLUMNS]);
+        }
+    }
+}
+
+template <MatrixElementType T>
+bool Matrix<T>::_isPermutation(const std::vector<Matrix<T>::size_type>& permutation, size_t nrOfPositions)
+{
+    bool isPermutation{permutation.size() == nrOfPositions};
+
+    if (isPermutation)
+    {
+        std::vector<bool> isPositionFound(nrOfPositions, false);
+
+        for (const size_type position : permutation)
+        {
+            if (position >= nrOfPositions || isPositionFound[position])
+            {
+                isPermutation = false;
+                break;
+            }
+
+            isPositionFound[position] = true;
+        }
+    }
+
+    return isPermutation;
+}
+
+// if shifting of columns is involved, then this method should be called after the columns shifting function (e.g.
+// _shiftColumnsLeft(), see below)
+template <MatrixElementType T> void Matrix<T>::_alignToTop()
+{
+    if (m_RowCapacityOffset.has_value() && m_RowCapacityOffset > 0)
+    {
+        std::rotate(m_pBaseArrayPtr, m_pBaseArrayPtr + *m_RowCapacityOffset,
+                    m_pBaseArrayPtr + *m_RowCapacityOffset + m_NrOfRows);
+        m_RowCapacityOffset = 0;
+    }
+}
+
+// columns shifting should be performed before aligning to top (see above)
+template <MatrixElementType T> void Matrix<T>::_shiftColumnsLeft(Matrix<T>::size_type nrOfPositionsToShift)
+{
+    if (m_ColumnCapacityOffset.has_value())
+    {
+        nrOfPositionsToShift = std::clamp<size_type>(nrOfPositionsToShift, 0, *m_ColumnCapacityOffset);
+        m_ColumnCapacityOffset = *m_ColumnCapacityOffset - nrOfPositionsToShift;
+
+        const size_type c_OldNrOfColumns{m_NrOfColumns};
+
+        // Step 1: move row start to the left, get an additional count of uninitialized columns ("new" columns); the
+        // existing row pointers are shifted (not recomputed) in order to keep any row order set by swapping/permuting
+        for (size_type rowNr{0}; rowNr < m_RowCapacity; ++rowNr)
+        {
+            m_pBaseArrayPtr[rowNr] -= nrOfPositionsToShift;
+        }
+
+        m_NrOfColumns += nrOfPositionsToShift;
+
+        const size_type c_FirstOldColumnNr = nrOfPositionsToShift;
+        const size_type c_NrOfColumnsToInitialize{std::min(nrOfPositionsToShift, c_OldNrOfColumns)};
+
+        // Step 2: initialize as many new columns as possible by moving the content of the existing ("old") ones
+        _moveInitItems(*this, 0, c_FirstOldColumnNr, 0, 0, m_NrOfRows, c_NrOfColumnsToInitialize);
+
+        // Step 3: any old columns that were not consumed for initializing the additional ones should be moved near the
+        // new columns to complete shifting; consumed columns should be destroyed
+        if (c_NrOfColumnsToInitialize < c_OldNrOfColumns)
+        {
+            for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
+            {
+                std::rotate(m_pBaseArrayPtr[absRowNr] + nrOfPositionsToShift,
+                            m_pBaseArrayPtr[absRowNr] +
+                                static_cast<size_type>(nrOfPositionsToShift + c_NrOfColumnsToInitialize),
+                            m_pBaseArrayPtr[absRowNr] + nrOfPositionsToShift + c_OldNrOfColumns);
+            }
+
+            _destroyItems(0, c_OldNrOfColumns, m_NrOfRows, c_NrOfColumnsToInitialize);
+        }
+        else
+        {
+            _destroyItems(0, nrOfPositionsToShift, m_NrOfRows, c_OldNrOfColumns);
+        }
+
+        // at the end of the shifting operation the matrix should have the same number of columns as before
+        m_NrOfColumns = c_OldNrOfColumns;
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::_normalizeRowCapacity()
+{
+    const std::optional<size_type> c_NormalizedRowCapacityOffset{
+        m_NrOfRows > 0 ? std::optional((m_RowCapacity - m_NrOfRows) / 2) : std::nullopt};
+
+    if (m_RowCapacityOffset.has_value() &&
+        (c_NormalizedRowCapacityOffset.has_value() && c_NormalizedRowCapacityOffset > 0) &&
+        m_RowCapacityOffset < c_NormalizedRowCapacityOffset)
+    {
+        const size_type c_LastRowNr{static_cast<size_type>(m_NrOfRows - 1)};
+        T** const pStartingRow{m_pBaseArrayPtr + *m_RowCapacityOffset};
+        T** const pEndingRow{pStartingRow + c_LastRowNr};
+        T** const pStartingRowToReplace{m_pBaseArrayPtr + *c_NormalizedRowCapacityOffset};
+        T** const pEndingRowToReplace{pStartingRowToReplace + c_LastRowNr};
+
+        T** pRowToReplace{pEndingRowToReplace};
+
+        for (T** pCurrentRow{pEndingRow}; pCurrentRow >= pStartingRow; --pCurrentRow)
+        {
+            std::iter_swap(pCurrentRow, pRowToReplace);
+            --pRowToReplace;
+        }
+
+        m_RowCapacityOffset = c_NormalizedRowCapacityOffset;
+    }
+}
+
+template <MatrixElementType T>
+void Matrix<T>::_allocMemory(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns,
+                             Matrix<T>::size_type rowCapacity, Matrix<T>::size_type columnCapacity)
 {
-    GET_END_DITERATOR_BY_DIAG_NUMBER(ConstReverseDIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+    if (nrOfRows > 0 && nrOfColumns > 0)
+    {
+        m_RowCapacity = rowCapacity < nrOfRows ? nrOfRows : rowCapacity;
+        m_ColumnCapacity = columnCapacity < nrOfColumns ? nrOfColumns : columnCapacity;
+
+        m_RowCapacityOffset = (m_RowCapacity - nrOfRows) / 2;
+        m_ColumnCapacityOffset = (m_ColumnCapacity - nrOfColumns) / 2;
+
+        m_pBaseArrayPtr = static_cast<T**>(std::malloc(m_RowCapacity * sizeof(T*)));
+        m_pAllocPtr = static_cast<T*>(std::malloc(static_cast<size_t>(m_RowCapacity) * m_ColumnCapacity * sizeof(T)));
+
+        // map row pointers to allocated space, each pointer manages part of the memory array (no overlap allowed, left
+        // free column capacity excluded)
+        for (size_type rowNr{0}; rowNr < m_RowCapacity; ++rowNr)
+        {
+            m_pBaseArrayPtr[rowNr] =
+                m_pAllocPtr + (static_cast<size_t>(rowNr) * m_ColumnCapacity) + *m_ColumnCapacityOffset;
+        }
+
+        m_NrOfRows = nrOfRows;
+        m_NrOfColumns = nrOfColumns;
+    }
+    else
+    {
+        m_NrOfRows = 0;
+        m_NrOfColumns = 0;
+        m_RowCapacity = 0;
+        m_ColumnCapacity = 0;
+        m_RowCapacityOffset.reset();
+        m_ColumnCapacityOffset.reset();
+        m_pBaseArrayPtr = nullptr;
+        m_pAllocPtr = nullptr;
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::_deallocMemory()
+{
+    if (!isEmpty())
+    {
+        // ensure the objects contained within matrix are properly disposed (row number is relative to the row capacity
+        // offset, no column capacity offset provided as argument -> free left capacity excluded by m_pBaseArrayPtr
+        // pointer elements)
+        _destroyItems(0, 0, m_NrOfRows, m_NrOfColumns);
+
+        // cut access of row pointers to allocated memory
+        std::fill_n(m_pBaseArrayPtr, m_RowCapacity, nullptr);
+
+        std::free(m_pBaseArrayPtr);
+        m_pBaseArrayPtr = nullptr;
+
+        std::free(m_pAllocPtr);
+        m_pAllocPtr = nullptr;
+
+        m_NrOfRows = 0;
+        m_NrOfColumns = 0;
+        m_RowCapacity = 0;
+        m_ColumnCapacity = 0;
+        m_RowCapacityOffset.reset();
+        m_ColumnCapacityOffset.reset();
+    }
 }
 
+// This method should be executed only for already initialized memory; the memory should be subsequently re-initialized
+// by running another function
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseDIterator Matrix<T>::constReverseDEnd(Matrix<T>::size_type rowNr,
-                                                                      Matrix<T>::size_type columnNr) const
+void Matrix<T>::_remapMemory(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
 {
-    GET_END_DITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ConstReverseDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    if (!isEmpty())
+    {
+        nrOfRows = std::clamp<size_type>(nrOfRows, 1, m_RowCapacity);
+        nrOfColumns = std::clamp<size_type>(nrOfColumns, 1, m_ColumnCapacity);
+
+        _destroyItems(0, 0, m_NrOfRows, m_NrOfColumns);
+
+        m_NrOfRows = nrOfRows;
+        m_NrOfColumns = nrOfColumns;
+
+        // capacity gets distributed in an even manner as for new allocations (unused capacity equally distributed
+        // between left/right and top/bottom)
+        m_RowCapacityOffset = (m_RowCapacity - m_NrOfRows) / 2;
+        m_ColumnCapacityOffset = (m_ColumnCapacity - m_NrOfColumns) / 2;
+
+        // re-map row pointers to allocated space, each pointer manages part of the memory array (no overlap allowed,
+        // left free column capacity excluded)
+        for (size_type rowNr{0}; rowNr < m_RowCapacity; ++rowNr)
+        {
+            m_pBaseArrayPtr[rowNr] =
+                m_pAllocPtr + (static_cast<size_t>(rowNr) * m_ColumnCapacity) + *m_ColumnCapacityOffset;
+        }
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::_copyAssignMatrix(const Matrix<T>& matrix)
+{
+    if (&matrix != this)
+    {
+        constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+        const size_type c_RowCapacityToAlloc{
+            std::min(static_cast<size_type>(matrix.m_NrOfRows + matrix.m_NrOfRows / 4), c_MaxAllowedDimension)};
+        const size_type c_ColumnCapacityToAlloc{
+            std::min(static_cast<size_type>(matrix.m_NrOfColumns + matrix.m_NrOfColumns / 4), c_MaxAllowedDimension)};
+
+        if (matrix.isEmpty())
+        {
+            _deallocMemory();
+        }
+        else if (m_RowCapacity != c_RowCapacityToAlloc || m_ColumnCapacity != c_ColumnCapacityToAlloc)
+        {
+            _deallocMemory();
+            _allocMemory(matrix.m_NrOfRows, matrix.m_NrOfColumns, c_RowCapacityToAlloc, c_ColumnCapacityToAlloc);
+        }
+        else
+        {
+            _remapMemory(matrix.m_NrOfRows, matrix.m_NrOfColumns);
+        }
+
+        _copyInitItems(matrix, 0, 0, 0, 0, m_NrOfRows, m_NrOfColumns);
+    }
+}
+
+template <MatrixElementType T> void Matrix<T>::_moveAssignMatrix(Matrix<T>& matrix)
+{
+    if (&matrix != this)
+    {
+        _deallocMemory();
+
+        m_pAllocPtr = matrix.m_pAllocPtr;
+        m_pBaseArrayPtr = matrix.m_pBaseArrayPtr;
+        m_NrOfRows = matrix.m_NrOfRows;
+        m_NrOfColumns = matrix.m_NrOfColumns;
+        m_RowCapacity = matrix.m_RowCapacity;
+        m_ColumnCapacity = matrix.m_ColumnCapacity;
+        m_RowCapacityOffset = matrix.m_RowCapacityOffset;
+        m_ColumnCapacityOffset = matrix.m_ColumnCapacityOffset;
+
+        matrix._allocMemory(0, 0);
+    }
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseDIterator Matrix<T>::getConstReverseDIterator(Matrix<T>::size_type rowNr,
-                                                                              Matrix<T>::size_type columnNr) const
+void Matrix<T>::_copyInitItems(const Matrix<T>& matrix, Matrix<T>::size_type matrixStartingRowNr,
+                               Matrix<T>::size_type matrixColumnOffset, Matrix<T>::size_type startingRowNr,
+                               Matrix<T>::size_type columnOffset, Matrix<T>::size_type nrOfRows,
+                               Matrix<T>::size_type nrOfColumns)
 {
-    GET_DIAG_RANDOM_ITERATOR(ConstReverseDIterator,
-                             m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                             m_NrOfColumns, rowNr, columnNr);
+    if (m_RowCapacityOffset.has_value() && matrix.m_RowCapacityOffset.has_value())
+    {
+        _externalClampSubMatrixSelectionParameters(matrix, matrixStartingRowNr, matrixColumnOffset, startingRowNr,
+                                                   columnOffset, nrOfRows, nrOfColumns);
+
+        for (size_type absRowNr{static_cast<size_type>(*m_RowCapacityOffset + startingRowNr)},
+             srcAbsRowNr{static_cast<size_type>(*matrix.m_RowCapacityOffset + matrixStartingRowNr)};
+             absRowNr != *m_RowCapacityOffset + startingRowNr + nrOfRows; ++srcAbsRowNr, ++absRowNr)
+        {
+            std::uninitialized_copy_n(matrix.m_pBaseArrayPtr[srcAbsRowNr] + matrixColumnOffset, nrOfColumns,
+                                      m_pBaseArrayPtr[absRowNr] + columnOffset);
+        }
+    }
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseDIterator Matrix<T>::getConstReverseDIterator(
-    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex) const
+void Matrix<T>::_moveInitItems(Matrix<T>& matrix, Matrix<T>::size_type matrixStartingRowNr,
+                               Matrix<T>::size_type matrixColumnOffset, Matrix<T>::size_type startingRowNr,
+                               Matrix<T>::size_type columnOffset, Matrix<T>::size_type nrOfRows,
+                               Matrix<T>::size_type nrOfColumns)
 {
-    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
-    GET_RANDOM_DITERATOR_BY_DIAG_NUMBER_AND_INDEX(
-        ConstReverseDIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, diagonalNr, diagonalIndex);
+    if (m_RowCapacityOffset.has_value() && matrix.m_RowCapacityOffset.has_value())
+    {
+        _externalClampSubMatrixSelectionParameters(matrix, matrixStartingRowNr, matrixColumnOffset, startingRowNr,
+                                                   columnOffset, nrOfRows, nrOfColumns);
+
+        for (size_type absRowNr{static_cast<size_type>(*m_RowCapacityOffset + startingRowNr)},
+             srcAbsRowNr{static_cast<size_type>(*matrix.m_RowCapacityOffset + matrixStartingRowNr)};
+             absRowNr != *m_RowCapacityOffset + startingRowNr + nrOfRows; ++srcAbsRowNr, ++absRowNr)
+        {
+            std::uninitialized_move_n(matrix.m_pBaseArrayPtr[srcAbsRowNr] + matrixColumnOffset, nrOfColumns,
+                                      m_pBaseArrayPtr[absRowNr] + columnOffset);
+        }
+    }
 }
 
-template <MatrixElementType T> typename Matrix<T>::MIterator Matrix<T>::mBegin(Matrix<T>::diff_type diagonalNr)
+template <MatrixElementType T>
+void Matrix<T>::_copyAssignItems(const Matrix<T>& matrix, Matrix<T>::size_type matrixStartingRowNr,
+                                 Matrix<T>::size_type matrixColumnOffset, Matrix<T>::size_type startingRowNr,
+                                 Matrix<T>::size_type columnOffset, Matrix<T>::size_type nrOfRows,
+                                 Matrix<T>::size_type nrOfColumns)
 {
-    GET_DIAG_BEGIN_ITERATOR(MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                            m_NrOfRows, m_NrOfColumns, diagonalNr);
+    for (size_type rowIndex{0}; rowIndex < nrOfRows; ++rowIndex)
+    {
+        const T* const c_pSrcRow{matrix.m_pBaseArrayPtr[*matrix.m_RowCapacityOffset + matrixStartingRowNr + rowIndex] +
+                                 matrixColumnOffset};
+        T* const c_pDestRow{m_pBaseArrayPtr[*m_RowCapacityOffset + startingRowNr + rowIndex] + columnOffset};
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memcpy(c_pDestRow, c_pSrcRow, nrOfColumns * sizeof(T));
+        }
+        else
+        {
+            std::copy_n(c_pSrcRow, nrOfColumns, c_pDestRow);
+        }
+    }
+}
+
+template <MatrixElementType T>
+void Matrix<T>::_moveAssignItems(Matrix<T>& matrix, Matrix<T>::size_type matrixStartingRowNr,
+                                 Matrix<T>::size_type matrixColumnOffset, Matrix<T>::size_type startingRowNr,
+                                 Matrix<T>::size_type columnOffset, Matrix<T>::size_type nrOfRows,
+                                 Matrix<T>::size_type nrOfColumns)
+{
+    for (size_type rowIndex{0}; rowIndex < nrOfRows; ++rowIndex)
+    {
+        T* const c_pSrcRow{matrix.m_pBaseArrayPtr[*matrix.m_RowCapacityOffset + matrixStartingRowNr + rowIndex] +
+                           matrixColumnOffset};
+        T* const c_pDestRow{m_pBaseArrayPtr[*m_RowCapacityOffset + startingRowNr + rowIndex] + columnOffset};
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memcpy(c_pDestRow, c_pSrcRow, nrOfColumns * sizeof(T));
+        }
+        else
+        {
+            std::move(c_pSrcRow, c_pSrcRow + nrOfColumns, c_pDestRow);
+        }
+    }
+}
+
+template <MatrixElementType T>
+void Matrix<T>::_fillInitItems(Matrix<T>::size_type startingRowNr, Matrix<T>::size_type columnOffset,
+                               Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns, const T& value)
+{
+    if (m_RowCapacityOffset.has_value())
+    {
+        _clampSubMatrixSelectionParameters(startingRowNr, columnOffset, nrOfRows, nrOfColumns);
+
+        for (size_type absRowNr{static_cast<size_type>(*m_RowCapacityOffset + startingRowNr)};
+             absRowNr != *m_RowCapacityOffset + startingRowNr + nrOfRows; ++absRowNr)
+        {
+            std::uninitialized_fill_n(m_pBaseArrayPtr[absRowNr] + columnOffset, nrOfColumns, value);
+        }
+    }
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::MIterator Matrix<T>::mBegin(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+void Matrix<T>::_defaultConstructInitItems(Matrix<T>::size_type startingRowNr, Matrix<T>::size_type columnOffset,
+                                           Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
 {
-    GET_BEGIN_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
-}
+    if (m_RowCapacityOffset.has_value())
+    {
+        _clampSubMatrixSelectionParameters(startingRowNr, columnOffset, nrOfRows, nrOfColumns);
 
-template <MatrixElementType T> typename Matrix<T>::MIterator Matrix<T>::mEnd(Matrix<T>::diff_type diagonalNr)
-{
-    GET_END_MITERATOR_BY_DIAG_NUMBER(MIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+        for (size_type absRowNr{static_cast<size_type>(*m_RowCapacityOffset + startingRowNr)};
+             absRowNr != *m_RowCapacityOffset + startingRowNr + nrOfRows; ++absRowNr)
+        {
+            std::uninitialized_default_construct_n(m_pBaseArrayPtr[absRowNr] + columnOffset, nrOfColumns);
+        }
+    }
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::MIterator Matrix<T>::mEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+void Matrix<T>::_destroyItems(Matrix<T>::size_type startingRowNr, Matrix<T>::size_type columnOffset,
+                              Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
 {
-    GET_END_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    if (m_RowCapacityOffset.has_value())
+    {
+        _clampSubMatrixSelectionParameters(startingRowNr, columnOffset, nrOfRows, nrOfColumns);
+
+        for (size_type absRowNr{static_cast<size_type>(*m_RowCapacityOffset + startingRowNr)};
+             absRowNr != *m_RowCapacityOffset + startingRowNr + nrOfRows; ++absRowNr)
+        {
+            std::destroy_n(m_pBaseArrayPtr[absRowNr] + columnOffset, nrOfColumns);
+        }
+    }
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::MIterator Matrix<T>::getMIterator(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+void Matrix<T>::_clampSubMatrixSelectionParameters(Matrix<T>::size_type& startingRowNr,
+                                                   Matrix<T>::size_type& columnOffset, Matrix<T>::size_type& nrOfRows,
+                                                   Matrix<T>::size_type& nrOfColumns)
 {
-    GET_DIAG_RANDOM_ITERATOR(MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                             m_NrOfRows, m_NrOfColumns, rowNr, columnNr);
+    startingRowNr = std::clamp<size_type>(startingRowNr, 0u, m_NrOfRows);
+    columnOffset = std::clamp<size_type>(columnOffset, 0u, m_NrOfColumns);
+    nrOfRows = std::clamp<size_type>(nrOfRows, 0u, m_NrOfRows - startingRowNr);
+    nrOfColumns = std::clamp<size_type>(nrOfColumns, 0u, m_NrOfColumns - columnOffset);
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::MIterator Matrix<T>::getMIterator(
-    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex)
+void Matrix<T>::_externalClampSubMatrixSelectionParameters(
+    const Matrix<T>& srcMatrix, Matrix<T>::size_type& srcStartingRowNr, Matrix<T>::size_type& srcColumnOffset,
+    Matrix<T>::size_type& startingRowNr, Matrix<T>::size_type& columnOffset, Matrix<T>::size_type& nrOfRows,
+    Matrix<T>::size_type& nrOfColumns)
 {
-    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
-    GET_RANDOM_MITERATOR_BY_DIAG_NUMBER_AND_INDEX(
-        MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, diagonalNr, diagonalIndex);
+    srcStartingRowNr = std::clamp<size_type>(srcStartingRowNr, 0u, srcMatrix.m_NrOfRows);
+    srcColumnOffset = std::clamp<size_type>(srcColumnOffset, 0u, srcMatrix.m_NrOfColumns);
+    startingRowNr = std::clamp<size_type>(startingRowNr, 0u, m_NrOfRows);
+    columnOffset = std::clamp<size_type>(columnOffset, 0u, m_NrOfColumns);
+    nrOfRows = std::clamp<size_type>(nrOfRows, 0u,
+                                     std::min(srcMatrix.m_NrOfRows - srcStartingRowNr, m_NrOfRows - startingRowNr));
+    nrOfColumns = std::clamp<size_type>(
+        nrOfColumns, 0u, std::min(srcMatrix.m_NrOfColumns - srcColumnOffset, m_NrOfColumns - columnOffset));
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstMIterator Matrix<T>::constMBegin(Matrix<T>::diff_type diagonalNr) const
+template <MatrixElementType T> void* Matrix<T>::_convertToArray(Matrix<T>::size_type& nrOfElements)
 {
-    GET_DIAG_BEGIN_ITERATOR(ConstMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                            m_NrOfRows, m_NrOfColumns, diagonalNr);
+    // effective transfer of ownership (items - including uninitalized ones)
+    void* pAllocPtr{m_pAllocPtr};
+    nrOfElements = m_RowCapacity * m_ColumnCapacity;
+
+    // delete the matrix row pointers
+    std::free(m_pBaseArrayPtr);
+
+    // reset all internal variables to bring the matrix to empty state
+    m_pBaseArrayPtr = nullptr;
+    m_pAllocPtr = nullptr;
+    m_NrOfRows = 0;
+    m_NrOfColumns = 0;
+    m_RowCapacity = 0;
+    m_ColumnCapacity = 0;
+    m_RowCapacityOffset.reset();
+    m_ColumnCapacityOffset.reset();
+
+    return pAllocPtr;
 }
 
+// matrix builder
 template <MatrixElementType T>
-typename Matrix<T>::ConstMIterator Matrix<T>::constMBegin(Matrix<T>::size_type rowNr,
-                                                          Matrix<T>::size_type columnNr) const
+MatrixBuilder<T>::MatrixBuilder(MatrixBuilder<T>::size_type nrOfColumns, MatrixBuilder<T>::size_type rowCapacity)
+    : m_RequiredNrOfColumns{nrOfColumns}
+    , m_RequestedRowCapacity{rowCapacity}
 {
-    GET_BEGIN_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ConstMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    CHECK_ERROR_CONDITION(nrOfColumns > c_MaxAllowedDimension || rowCapacity > c_MaxAllowedDimension,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstMIterator Matrix<T>::constMEnd(Matrix<T>::diff_type diagonalNr) const
+template <std::ranges::forward_range Range>
+    requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+void MatrixBuilder<T>::appendRow(Range&& elements)
 {
-    GET_END_MITERATOR_BY_DIAG_NUMBER(ConstMIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+    constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+
+    const auto c_NrOfElements{static_cast<size_t>(std::ranges::distance(elements))};
+    const size_type c_NrOfColumns{getNrOfColumns()};
+
+    CHECK_ERROR_CONDITION(0 == c_NrOfElements, Matr::errorMessages[Matr::Errors::NULL_DIMENSION]);
+    CHECK_ERROR_CONDITION(c_NrOfColumns > 0 && c_NrOfElements != c_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::ELEMENTS_COUNT_NOT_MATCHING_DIMENSIONS]);
+    CHECK_ERROR_CONDITION(c_NrOfElements > c_MaxAllowedDimension || c_MaxAllowedDimension == m_Matrix.m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+
+    const bool c_IsFirstRow{m_Matrix.isEmpty()};
+
+    if (c_IsFirstRow)
+    {
+        // the allocated matrix already counts the (not yet constructed) first row
+        m_Matrix._allocMemory(1, static_cast<size_type>(c_NrOfElements), std::max<size_type>(m_RequestedRowCapacity, 1),
+                              static_cast<size_type>(c_NrOfElements));
+        m_Matrix.m_RowCapacityOffset = 0;
+    }
+    else if (m_Matrix.m_NrOfRows == m_Matrix.m_RowCapacity)
+    {
+        // at least double the row capacity (without exceeding the maximum allowed capacity)
+        _reallocRows(std::clamp(static_cast<size_type>(size_type{2} * m_Matrix.m_NrOfRows),
+                                static_cast<size_type>(m_Matrix.m_NrOfRows + 1), c_MaxAllowedDimension));
+    }
+
+    auto elementIt{std::ranges::begin(elements)};
+    T* const pRow{m_Matrix.m_pBaseArrayPtr[c_IsFirstRow ? size_type{0} : m_Matrix.m_NrOfRows]};
+    size_type nrOfConstructedElements{0};
+
+    // if an element cannot be obtained or constructed the builder should remain in its previous state (the partial row
+    // is not counted and its already constructed elements get destroyed)
+    try
+    {
+        for (; nrOfConstructedElements < m_Matrix.m_NrOfColumns; ++nrOfConstructedElements, ++elementIt)
+        {
+            std::construct_at(pRow + nrOfConstructedElements, Matrix<T>::template _getRangeElement<Range>(elementIt));
+        }
+    }
+    catch (...)
+    {
+        std::destroy_n(pRow, nrOfConstructedElements);
+
+        if (c_IsFirstRow)
+        {
+            // release the memory without destroying the (unconstructed) row elements
+            std::free(m_Matrix.m_pBaseArrayPtr);
+            std::free(m_Matrix.m_pAllocPtr);
+            m_Matrix._allocMemory(0, 0);
+        }
+
+        throw;
+    }
+
+    if (!c_IsFirstRow)
+    {
+        ++m_Matrix.m_NrOfRows;
+    }
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstMIterator Matrix<T>::constMEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr) const
+template <MatrixElementType T> void MatrixBuilder<T>::reserve(MatrixBuilder<T>::size_type rowCapacity)
 {
-    GET_END_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ConstMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    CHECK_ERROR_CONDITION(rowCapacity > maxAllowedDimension(),
+                          Matr::errorMessages[Matr::Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED]);
+
+    if (m_Matrix.isEmpty())
+    {
+        m_RequestedRowCapacity = std::max(m_RequestedRowCapacity, rowCapacity);
+    }
+    else if (rowCapacity > m_Matrix.m_RowCapacity)
+    {
+        _reallocRows(rowCapacity);
+    }
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstMIterator Matrix<T>::getConstMIterator(Matrix<T>::size_type rowNr,
-                                                                Matrix<T>::size_type columnNr) const
+template <MatrixElementType T> Matrix<T> MatrixBuilder<T>::finish()
 {
-    GET_DIAG_RANDOM_ITERATOR(MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                             m_NrOfRows, m_NrOfColumns, rowNr, columnNr);
+    Matrix<T> result{std::move(m_Matrix)};
+
+    m_RequestedRowCapacity = 0;
+
+    return result;
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstMIterator Matrix<T>::getConstMIterator(
-    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex) const
+template <MatrixElementType T> typename MatrixBuilder<T>::size_type MatrixBuilder<T>::getNrOfRows() const
 {
-    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
-    GET_RANDOM_MITERATOR_BY_DIAG_NUMBER_AND_INDEX(
-        MIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, diagonalNr, diagonalIndex);
+    return m_Matrix.m_NrOfRows;
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ReverseMIterator Matrix<T>::reverseMBegin(Matrix<T>::diff_type diagonalNr)
+template <MatrixElementType T> typename MatrixBuilder<T>::size_type MatrixBuilder<T>::getNrOfColumns() const
 {
-    GET_DIAG_BEGIN_ITERATOR(ReverseMIterator,
-                            m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                            m_NrOfColumns, diagonalNr);
+    return m_Matrix.isEmpty() ? m_RequiredNrOfColumns : m_Matrix.m_NrOfColumns;
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ReverseMIterator Matrix<T>::reverseMBegin(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+template <MatrixElementType T> typename MatrixBuilder<T>::size_type MatrixBuilder<T>::getRowCapacity() const
 {
-    GET_BEGIN_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    return m_Matrix.isEmpty() ? m_RequestedRowCapacity : m_Matrix.m_RowCapacity;
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ReverseMIterator Matrix<T>::reverseMEnd(Matrix<T>::diff_type diagonalNr)
+template <MatrixElementType T> void MatrixBuilder<T>::_reallocRows(MatrixBuilder<T>::size_type rowCapacity)
 {
-    GET_END_MITERATOR_BY_DIAG_NUMBER(ReverseMIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, diagonalNr);
+    Matrix<T> matrix;
+
+    matrix._allocMemory(m_Matrix.m_NrOfRows, m_Matrix.m_NrOfColumns, rowCapacity, m_Matrix.m_ColumnCapacity);
+    matrix.m_RowCapacityOffset = 0;
+    matrix._moveInitItems(m_Matrix, 0, 0, 0, 0, m_Matrix.m_NrOfRows, m_Matrix.m_NrOfColumns);
+
+    m_Matrix = std::move(matrix);
 }
 
+// matrix expressions
 template <MatrixElementType T>
-typename Matrix<T>::ReverseMIterator Matrix<T>::reverseMEnd(Matrix<T>::size_type rowNr, Matrix<T>::size_type columnNr)
+MatrixReferenceExpression<T>::MatrixReferenceExpression(const Matrix<T>& matrix)
+    : m_pRows{matrix.isEmpty() ? nullptr : matrix.m_pBaseArrayPtr + *matrix.m_RowCapacityOffset}
+    , m_NrOfRows{matrix.m_NrOfRows}
+    , m_NrOfColumns{matrix.m_NrOfColumns}
 {
-    GET_END_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ReverseMIterator Matrix<T>::getReverseMIterator(Matrix<T>::size_type rowNr,
-                                                                    Matrix<T>::size_type columnNr)
+typename MatrixReferenceExpression<T>::size_type MatrixReferenceExpression<T>::getNrOfRows() const
 {
-    GET_DIAG_RANDOM_ITERATOR(ReverseMIterator,
-                             m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                             m_NrOfColumns, rowNr, columnNr);
+    return m_NrOfRows;
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ReverseMIterator Matrix<T>::getReverseMIterator(
-    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex)
+typename MatrixReferenceExpression<T>::size_type MatrixReferenceExpression<T>::getNrOfColumns() const
 {
-    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
-    GET_RANDOM_MITERATOR_BY_DIAG_NUMBER_AND_INDEX(
-        ReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, diagonalNr, diagonalIndex);
+    return m_NrOfColumns;
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseMIterator Matrix<T>::constReverseMBegin(Matrix<T>::diff_type diagonalNr) const
+const T& MatrixReferenceExpression<T>::evaluate(MatrixReferenceExpression<T>::size_type rowNr,
+                                                MatrixReferenceExpression<T>::size_type columnNr) const
 {
-    GET_DIAG_BEGIN_ITERATOR(ConstReverseMIterator,
-                            m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                            m_NrOfColumns, diagonalNr);
+    return m_pRows[rowNr][columnNr];
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseMIterator Matrix<T>::constReverseMBegin(Matrix<T>::size_type rowNr,
-                                                                        Matrix<T>::size_type columnNr) const
+ScalarMatrixExpression<T>::ScalarMatrixExpression(const T& value, ScalarMatrixExpression<T>::size_type nrOfRows,
+                                                  ScalarMatrixExpression<T>::size_type nrOfColumns)
+    : m_Value{value}
+    , m_NrOfRows{nrOfRows}
+    , m_NrOfColumns{nrOfColumns}
 {
-    GET_BEGIN_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ConstReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseMIterator Matrix<T>::constReverseMEnd(Matrix<T>::diff_type diagonaNr) const
+typename ScalarMatrixExpression<T>::size_type ScalarMatrixExpression<T>::getNrOfRows() const
 {
-    GET_END_MITERATOR_BY_DIAG_NUMBER(ConstReverseMIterator,
-                                     m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr,
-                                     m_NrOfRows, m_NrOfColumns, diagonaNr);
+    return m_NrOfRows;
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseMIterator Matrix<T>::constReverseMEnd(Matrix<T>::size_type rowNr,
-                                                                      Matrix<T>::size_type columnNr) const
+typename ScalarMatrixExpression<T>::size_type ScalarMatrixExpression<T>::getNrOfColumns() const
 {
-    GET_END_MITERATOR_BY_ROW_AND_COLUMN_NUMBER(
-        ConstReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, rowNr, columnNr);
+    return m_NrOfColumns;
 }
 
 template <MatrixElementType T>
-typename Matrix<T>::ConstReverseMIterator Matrix<T>::getConstReverseMIterator(Matrix<T>::size_type rowNr,
-                                                                              Matrix<T>::size_type columnNr) const
+const T& ScalarMatrixExpression<T>::evaluate(ScalarMatrixExpression<T>::size_type,
+                                             ScalarMatrixExpression<T>::size_type) const
 {
-    GET_DIAG_RANDOM_ITERATOR(ConstReverseMIterator,
-                             m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-                             m_NrOfColumns, rowNr, columnNr);
+    return m_Value;
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::ConstReverseMIterator Matrix<T>::getConstReverseMIterator(
-    const std::pair<Matrix<T>::diff_type, Matrix<T>::size_type>& diagonalNrAndIndex) const
+template <typename Operation, MatrixExpression Operand>
+UnaryMatrixExpression<Operation, Operand>::UnaryMatrixExpression(const Operand& operand)
+    : m_Operand{operand}
 {
-    const auto& [diagonalNr, diagonalIndex] = diagonalNrAndIndex;
-    GET_RANDOM_MITERATOR_BY_DIAG_NUMBER_AND_INDEX(
-        ConstReverseMIterator, m_pBaseArrayPtr ? m_pBaseArrayPtr + *m_RowCapacityOffset : m_pBaseArrayPtr, m_NrOfRows,
-        m_NrOfColumns, diagonalNr, diagonalIndex);
 }
 
-template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::begin()
+template <typename Operation, MatrixExpression Operand>
+typename UnaryMatrixExpression<Operation, Operand>::size_type UnaryMatrixExpression<Operation, Operand>::getNrOfRows()
+    const
 {
-    return zBegin();
+    return m_Operand.getNrOfRows();
 }
 
-template <MatrixElementType T> typename Matrix<T>::ZIterator Matrix<T>::end()
+template <typename Operation, MatrixExpression Operand>
+typename UnaryMatrixExpression<Operation, Operand>::size_type
+UnaryMatrixExpression<Operation, Operand>::getNrOfColumns() const
 {
-    return zEnd();
+    return m_Operand.getNrOfColumns();
 }
 
-template <MatrixElementType T> typename Matrix<T>::ConstZIterator Matrix<T>::begin() const
+template <typename Operation, MatrixExpression Operand>
+decltype(auto) UnaryMatrixExpression<Operation, Operand>::evaluate(
+    UnaryMatrixExpression<Operation, Operand>::size_type rowNr,
+    UnaryMatrixExpression<Operation, Operand>::size_type columnNr) const
 {
-    return constZBegin();
+    return Operation{}(m_Operand.evaluate(rowNr, columnNr));
 }
 
-template <MatrixElementType T> typename Matrix<T>::ConstZIterator Matrix<T>::end() const
+template <typename Operation, MatrixExpression Lhs, MatrixExpression Rhs>
+    requires std::same_as<typename Lhs::value_type, typename Rhs::value_type>
+BinaryMatrixExpression<Operation, Lhs, Rhs>::BinaryMatrixExpression(const Lhs& lhs, const Rhs& rhs)
+    : m_Lhs{lhs}
+    , m_Rhs{rhs}
 {
-    return constZEnd();
+    CHECK_ERROR_CONDITION(lhs.getNrOfRows() != rhs.getNrOfRows(),
+                          Matr::errorMessages[Matr::Errors::MATRIXES_UNEQUAL_COLUMN_LENGTH]);
+    CHECK_ERROR_CONDITION(lhs.getNrOfColumns() != rhs.getNrOfColumns(),
+                          Matr::errorMessages[Matr::Errors::MATRIXES_UNEQUAL_ROW_LENGTH]);
 }
 
-template <MatrixElementType T>
-std::pair<typename Matrix<T>::size_type, typename Matrix<T>::size_type> Matrix<T>::_resizeWithUninitializedNewElements(
-    Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
+template <typename Operation, MatrixExpression Lhs, MatrixExpression Rhs>
+    requires std::same_as<typename Lhs::value_type, typename Rhs::value_type>
+typename BinaryMatrixExpression<Operation, Lhs, Rhs>::size_type
+BinaryMatrixExpression<Operation, Lhs, Rhs>::getNrOfRows() const
 {
-    assert(nrOfRows <= maxAllowedDimension() && nrOfColumns <= maxAllowedDimension());
-
-    const size_type c_NewNrOfRows{(nrOfRows > size_type{0} && nrOfColumns > size_type{0}) ? nrOfRows : size_type{0}};
-    const size_type c_NewNrOfColumns{c_NewNrOfRows > size_type{0} ? nrOfColumns : size_type{0}};
-    const size_type c_NewRowCapacity{std::max(m_RowCapacity, c_NewNrOfRows)};
-    const size_type c_NewColumnCapacity{std::max(m_ColumnCapacity, c_NewNrOfColumns)};
-    const size_type c_NrOfRowsToKeep{std::min(m_NrOfRows, c_NewNrOfRows)};
-    const size_type c_NrOfColumnsToKeep{std::min(m_NrOfColumns, c_NewNrOfColumns)};
-    const std::optional<size_type> c_NewRowCapacityOffset{
-        c_NewNrOfRows > 0 ? std::optional((c_NewRowCapacity - c_NewNrOfRows) / 2) : std::nullopt};
-
-    if (!m_RowCapacityOffset.has_value() /* empty matrix, column capacity offset std::nullopt as well */ ||
-        !c_NewRowCapacityOffset.has_value() || c_NewRowCapacity != m_RowCapacity ||
-        c_NewColumnCapacity != m_ColumnCapacity)
-    {
-        Matrix matrix{std::move(*this)};
-        _deallocMemory(); // actually not required, just for safety purposes
-        _allocMemory(c_NewNrOfRows, c_NewNrOfColumns, c_NewRowCapacity, c_NewColumnCapacity);
+    return m_Lhs.getNrOfRows();
+}
 
-        // move the retained items back
-        _moveInitItems(matrix, 0, 0, 0, 0, c_NrOfRowsToKeep, c_NrOfColumnsToKeep);
-    }
-    else
-    {
-        const size_type c_ColumnsResizingSpace{static_cast<size_type>(m_ColumnCapacity - *m_ColumnCapacityOffset)};
+template <typename Operation, MatrixExpression Lhs, MatrixExpression Rhs>
+    requires std::same_as<typename Lhs::value_type, typename Rhs::value_type>
+typename BinaryMatrixExpression<Operation, Lhs, Rhs>::size_type
+BinaryMatrixExpression<Operation, Lhs, Rhs>::getNrOfColumns() const
+{
+    return m_Lhs.getNrOfColumns();
+}
 
-        // if not enough available capacity on the right side, then the columns should be shifted left by the minimal
-        // count of positions that ensure the resized content fits
-        if (c_NewNrOfColumns > c_ColumnsResizingSpace)
-        {
-            const size_type c_NrOfColumnsToShiftLeft{static_cast<size_type>(c_NewNrOfColumns - c_ColumnsResizingSpace)};
-            _shiftColumnsLeft(c_NrOfColumnsToShiftLeft);
-        }
+template <typename Operation, MatrixExpression Lhs, MatrixExpression Rhs>
+    requires std::same_as<typename Lhs::value_type, typename Rhs::value_type>
+decltype(auto) BinaryMatrixExpression<Operation, Lhs, Rhs>::evaluate(
+    BinaryMatrixExpression<Operation, Lhs, Rhs>::size_type rowNr,
+    BinaryMatrixExpression<Operation, Lhs, Rhs>::size_type columnNr) const
+{
+    return Operation{}(m_Lhs.evaluate(rowNr, columnNr), m_Rhs.evaluate(rowNr, columnNr));
+}
 
-        // move unused top capacity to the bottom to avoid alignment issues (should be re-distributed once resize is
-        // complete)
-        _alignToTop();
+namespace Matr
+{
+// element-wise math operations, the function matching the element type is looked up in its namespace as well (custom
+// element types can provide their own implementation)
+struct Abs
+{
+    template <typename Value> auto operator()(const Value& value) const;
+};
 
-        // ensure the items from the right side of the retained items get properly destroyed
-        if (c_NewNrOfColumns < m_NrOfColumns)
-        {
-            _destroyItems(0, c_NrOfColumnsToKeep, c_NrOfRowsToKeep, m_NrOfColumns - c_NewNrOfColumns);
-        }
+struct Sqrt
+{
+    template <typename Value> auto operator()(const Value& value) const;
+};
 
-        // same for the items below
-        if (c_NewNrOfRows < m_NrOfRows)
-        {
-            _destroyItems(c_NrOfRowsToKeep, 0, m_NrOfRows - c_NewNrOfRows, m_NrOfColumns);
-        }
+struct Exp
+{
+    template <typename Value> auto operator()(const Value& value) const;
+};
 
-        m_NrOfRows = c_NewNrOfRows;
-        m_NrOfColumns = c_NewNrOfColumns;
-    }
+struct Log
+{
+    template <typename Value> auto operator()(const Value& value) const;
+};
 
-    return {c_NrOfRowsToKeep, c_NrOfColumnsToKeep};
+template <typename Value> auto Abs::operator()(const Value& value) const
+{
+    using std::abs;
+    return abs(value);
 }
 
-template <MatrixElementType T> void Matrix<T>::_insertUninitializedRow(Matrix<T>::size_type rowNr)
+template <typename Value> auto Sqrt::operator()(const Value& value) const
 {
-    const size_type c_RowNr{std::clamp<size_type>(rowNr, 0u, m_NrOfRows)};
+    using std::sqrt;
+    return sqrt(value);
+}
 
-    // double the row capacity (without exceeding the maximum allowed capacity) if no spare capacity left (to defer any
-    // resize when inserting further rows)
-    if (m_NrOfRows == m_RowCapacity)
-    {
-        Matrix helperMatrix{std::move(*this)};
-        const size_type c_NewRowCapacity{
-            std::min(static_cast<size_type>(size_type{2} * helperMatrix.m_NrOfRows), maxAllowedDimension())};
+template <typename Value> auto Exp::operator()(const Value& value) const
+{
+    using std::exp;
+    return exp(value);
+}
 
-        _deallocMemory(); // not quite necessary, just for safety/consistency purposes
-        _allocMemory(helperMatrix.m_NrOfRows + 1, helperMatrix.m_NrOfColumns, c_NewRowCapacity,
-                     helperMatrix.m_ColumnCapacity);
+template <typename Value> auto Log::operator()(const Value& value) const
+{
+    using std::log;
+    return log(value);
+}
 
-        // move everything back to the top/bottom of the inserted row (this one stays uninitialized - will be
-        // initialized in a separate step)
-        _moveInitItems(helperMatrix, 0, 0, 0, 0, c_RowNr, m_NrOfColumns);
-        _moveInitItems(helperMatrix, c_RowNr, 0, c_RowNr + 1, 0, m_NrOfRows - c_RowNr, m_NrOfColumns);
-    }
-    else
-    {
-        // row capacity offset cannot be std::nullopt as the matrix is not empty (rows count doesn't equal row capacity)
-        const bool c_ShouldAppendRow{c_RowNr <= m_NrOfRows / 2 ? (0 == *m_RowCapacityOffset)
-                                                               : (m_RowCapacity - *m_RowCapacityOffset > m_NrOfRows)};
-        ++m_NrOfRows;
+template <typename Type> struct IsMatrix : std::false_type
+{
+};
 
-        T** pCurrentMatrixStartingRow{m_pBaseArrayPtr + *m_RowCapacityOffset};
+template <MatrixElementType T> struct IsMatrix<Matrix<T>> : std::true_type
+{
+};
 
-        // new row is initially first/last row (depending on the insert position), move it into the insert position (all
-        // rows after the insert position moved one position downwards/upwards)
-        if (c_ShouldAppendRow)
-        {
-            std::rotate(pCurrentMatrixStartingRow + c_RowNr, pCurrentMatrixStartingRow + m_NrOfRows - 1,
-                        pCurrentMatrixStartingRow + m_NrOfRows);
-        }
-        else
-        {
-            m_RowCapacityOffset = *m_RowCapacityOffset - 1;
-            --pCurrentMatrixStartingRow;
-            std::rotate(pCurrentMatrixStartingRow, pCurrentMatrixStartingRow + 1,
-                        pCurrentMatrixStartingRow + c_RowNr + 1);
-        }
-    }
+template <typename Operand>
+concept ExpressionOperand = IsMatrix<Operand>::value || MatrixExpression<Operand>;
+
+template <MatrixElementType T> MatrixReferenceExpression<T> toExpression(const Matrix<T>& matrix)
+{
+    return MatrixReferenceExpression<T>{matrix};
 }
 
-template <MatrixElementType T>
-typename Matrix<T>::size_type Matrix<T>::_insertUninitializedColumn(Matrix<T>::size_type columnNr)
+template <MatrixExpression Expression> const Expression& toExpression(const Expression& expression)
 {
-    size_type resultingColumnNr{std::clamp<size_type>(columnNr, 0u, m_NrOfColumns)};
+    return expression;
+}
 
-    // double the column capacity (without exceeding the maximum allowed capacity) if no spare capacity left (to defer
-    // any resize when inserting further columns)
-    if (m_NrOfColumns == m_ColumnCapacity)
-    {
-        Matrix helperMatrix{std::move(*this)};
-        const size_type c_NewColumnCapacity{
-            std::min(static_cast<size_type>(size_type{2} * helperMatrix.m_NrOfColumns), maxAllowedDimension())};
+template <ExpressionOperand Operand>
+using ExpressionValueType =
+    typename std::remove_cvref_t<decltype(toExpression(std::declval<const Operand&>()))>::value_type;
 
-        _deallocMemory(); // not quite necessary, just for safety/consistency purposes
-        _allocMemory(helperMatrix.m_NrOfRows, helperMatrix.m_NrOfColumns + 1, helperMatrix.m_RowCapacity,
-                     c_NewColumnCapacity);
+// the result of the operation should be convertible back to the element type
+template <typename Operation, typename Value>
+concept UnaryElementOperation =
+    std::invocable<Operation, const Value&> &&
+    std::convertible_to<std::invoke_result_t<Operation, const Value&>, Value>;
 
-        // move everything back to the left/right of the inserted column (this one stays uninitialized - will be
-        // initialized in a separate step)
-        _moveInitItems(helperMatrix, 0, 0, 0, 0, m_NrOfRows, resultingColumnNr);
-        _moveInitItems(helperMatrix, 0, resultingColumnNr, 0, resultingColumnNr + 1, m_NrOfRows,
-                       m_NrOfColumns - resultingColumnNr);
-    }
-    else
-    {
-        // row capacity offset cannot be std::nullopt as the matrix is not empty (columns count doesn't equal column
-        // capacity)
-        const bool c_ShouldAppendColumn{resultingColumnNr <= m_NrOfColumns / 2
-                                            ? (0 == m_ColumnCapacityOffset)
-                                            : (m_ColumnCapacity - *m_ColumnCapacityOffset > m_NrOfColumns)};
+template <typename Operation, typename Value>
+concept BinaryElementOperation =
+    std::invocable<Operation, const Value&, const Value&> &&
+    std::convertible_to<std::invoke_result_t<Operation, const Value&, const Value&>, Value>;
 
-        if (c_ShouldAppendColumn)
-        {
-            resultingColumnNr = m_NrOfColumns;
-        }
-        else
-        {
-            resultingColumnNr = 0;
-            m_ColumnCapacityOffset = *m_ColumnCapacityOffset - 1;
+// the scalar should be convertible to the element type without narrowing (e.g. no int matrix times 2.5)
+template <typename Scalar, typename Operand>
+concept ScalarOperandFor = ExpressionOperand<Operand> && !ExpressionOperand<Scalar> &&
+                           requires(const Scalar& scalar) { ExpressionValueType<Operand>{scalar}; };
 
-            // make the newly added column visible
-            for (size_type rowNr{0}; rowNr < m_RowCapacity; ++rowNr)
-            {
-                --m_pBaseArrayPtr[rowNr];
-            }
-        }
+template <typename Operation, typename Operand>
+concept UnaryExpressionOperand =
+    ExpressionOperand<Operand> && UnaryElementOperation<Operation, ExpressionValueType<Operand>>;
 
-        ++m_NrOfColumns;
-    }
+// for integral elements the result of sqrt(), exp() or log() would be truncated when converted back to the element type
+template <typename Operation, typename Operand>
+concept FloatingPointExpressionOperand =
+    UnaryExpressionOperand<Operation, Operand> && DecomposableElementType<ExpressionValueType<Operand>>;
+
+// either both operands are matrixes (expressions) with the same element type or one of them is a scalar
+template <typename Operation, typename Lhs, typename Rhs>
+concept BinaryExpressionOperands =
+    (ExpressionOperand<Lhs> && ExpressionOperand<Rhs> &&
+     std::same_as<ExpressionValueType<Lhs>, ExpressionValueType<Rhs>> &&
+     BinaryElementOperation<Operation, ExpressionValueType<Lhs>>) ||
+    (ScalarOperandFor<Rhs, Lhs> && BinaryElementOperation<Operation, ExpressionValueType<Lhs>>) ||
+    (ScalarOperandFor<Lhs, Rhs> && BinaryElementOperation<Operation, ExpressionValueType<Rhs>>);
 
-    return resultingColumnNr;
+template <typename Operation, typename Operand>
+    requires UnaryExpressionOperand<Operation, Operand>
+auto makeUnaryExpression(const Operand& operand)
+{
+    const auto& expression{toExpression(operand)};
+
+    return UnaryMatrixExpression<Operation, std::remove_cvref_t<decltype(expression)>>{expression};
 }
 
-template <MatrixElementType T>
-void Matrix<T>::_reallocEraseDimensionElement(Matrix<T>::size_type dimensionElementNr, bool isRow)
+template <typename Operation, typename Lhs, typename Rhs>
+    requires BinaryExpressionOperands<Operation, Lhs, Rhs>
+auto makeBinaryExpression(const Lhs& lhs, const Rhs& rhs)
 {
-    if (!isEmpty())
+    if constexpr (!ExpressionOperand<Lhs>)
     {
-        const size_type c_RequiredNrOfRows{isRow ? static_cast<size_type>(m_NrOfRows - 1) : m_NrOfRows};
-        const size_type c_RequiredNrOfColumns{isRow ? m_NrOfColumns : static_cast<size_type>(m_NrOfColumns - 1)};
-        const size_type c_RequiredRowCapacity{isRow ? static_cast<size_type>(size_type{2} * c_RequiredNrOfRows)
-                                                    : m_RowCapacity};
-        const size_type c_RequiredColumnCapacity{isRow ? m_ColumnCapacity
-                                                       : static_cast<size_type>(size_type{2} * c_RequiredNrOfColumns)};
+        using Value = ExpressionValueType<Rhs>;
 
-        // row or column nr depending on scenario (variable isRow)
-        const size_type c_DimensionElementNr{
-            std::clamp<size_type>(dimensionElementNr, 0u, isRow ? c_RequiredNrOfRows : c_RequiredNrOfColumns)};
+        const auto& rhsExpression{toExpression(rhs)};
+        const ScalarMatrixExpression<Value> lhsExpression{lhs, rhsExpression.getNrOfRows(),
+                                                          rhsExpression.getNrOfColumns()};
 
-        // part one: top part (rows) / left part (columns) - relative to erased row/column
-        const size_type c_PartOneNrOfRows{isRow ? c_DimensionElementNr : c_RequiredNrOfRows};
-        const size_type c_PartOneNrOfColumns{isRow ? c_RequiredNrOfColumns : c_DimensionElementNr};
+        return BinaryMatrixExpression<Operation, ScalarMatrixExpression<Value>,
+                                      std::remove_cvref_t<decltype(rhsExpression)>>{lhsExpression, rhsExpression};
+    }
+    else if constexpr (!ExpressionOperand<Rhs>)
+    {
+        using Value = ExpressionValueType<Lhs>;
 
-        // part two: bottom part (rows) / right part (columns) - relative to erased row/column
-        const size_type c_PartTwoSrcStartingRowNr{isRow ? static_cast<size_type>(c_DimensionElementNr + 1)
-                                                        : size_type{0}};
-        const size_type c_PartTwoSrcColumnOffset{
-            static_cast<size_type>(c_DimensionElementNr + 1 - c_PartTwoSrcStartingRowNr)};
-        const size_type c_PartTwoStartingRowNr{isRow ? c_DimensionElementNr : size_type{0}};
-        const size_type c_PartTwoColumnOffset{static_cast<size_type>(c_DimensionElementNr - c_PartTwoStartingRowNr)};
-        const size_type c_PartTwoNrOfRows{static_cast<size_type>(c_RequiredNrOfRows - c_PartTwoStartingRowNr)};
-        const size_type c_PartTwoNrOfColumns{static_cast<size_type>(c_RequiredNrOfColumns - c_PartTwoColumnOffset)};
+        const auto& lhsExpression{toExpression(lhs)};
+        const ScalarMatrixExpression<Value> rhsExpression{rhs, lhsExpression.getNrOfRows(),
+                                                          lhsExpression.getNrOfColumns()};
 
-        Matrix helperMatrix{std::move(*this)};
+        return BinaryMatrixExpression<Operation, std::remove_cvref_t<decltype(lhsExpression)>,
+                                      ScalarMatrixExpression<Value>>{lhsExpression, rhsExpression};
+    }
+    else
+    {
+        const auto& lhsExpression{toExpression(lhs)};
+        const auto& rhsExpression{toExpression(rhs)};
 
-        _deallocMemory(); // not really necessary, just for safety purposes
-        _allocMemory(c_RequiredNrOfRows, c_RequiredNrOfColumns, c_RequiredRowCapacity, c_RequiredColumnCapacity);
-        _moveInitItems(helperMatrix, 0, 0, 0, 0, c_PartOneNrOfRows, c_PartOneNrOfColumns);
-        _moveInitItems(helperMatrix, c_PartTwoSrcStartingRowNr, c_PartTwoSrcColumnOffset, c_PartTwoStartingRowNr,
-                       c_PartTwoColumnOffset, c_PartTwoNrOfRows, c_PartTwoNrOfColumns);
+        return BinaryMatrixExpression<Operation, std::remove_cvref_t<decltype(lhsExpression)>,
+                                      std::remove_cvref_t<decltype(rhsExpression)>>{lhsExpression, rhsExpression};
     }
 }
+} // namespace Matr
 
-template <MatrixElementType T> void Matrix<T>::_shiftEraseRow(Matrix<T>::size_type rowNr)
+// free functions
+
+// vertical/horizontal stacking of multiple matrixes into a new matrix (single allocation, exact capacity), the
+// content of the matrixes is moved and they are cleared (null or duplicate entries are not allowed)
+template <MatrixElementType T> Matrix<T> vstack(const std::vector<Matrix<T>*>& matrixes)
 {
-    if (!isEmpty())
-    {
-        const size_type c_RowNr{std::clamp<size_type>(rowNr, 0u, m_NrOfRows - 1)};
-        T** pStartingRow{m_pBaseArrayPtr + *m_RowCapacityOffset};
+    Matrix<T> result;
+    result.concatRows(matrixes);
 
-        if (c_RowNr < m_NrOfRows / 2)
-        {
-            std::rotate(pStartingRow, pStartingRow + c_RowNr, pStartingRow + c_RowNr + 1);
-            std::destroy_n(m_pBaseArrayPtr[*m_RowCapacityOffset],
-                           m_NrOfColumns); // the memory outside matrix bounds should be uninitialized
-            m_RowCapacityOffset = *m_RowCapacityOffset + 1;
-        }
-        else
-        {
-            std::rotate(pStartingRow + c_RowNr, pStartingRow + c_RowNr + 1, pStartingRow + m_NrOfRows);
-            std::destroy_n(m_pBaseArrayPtr[*m_RowCapacityOffset + m_NrOfRows - 1],
-                           m_NrOfColumns); // the memory outside matrix bounds should be uninitialized
-        }
+    return result;
+}
 
-        --m_NrOfRows;
-    }
+template <MatrixElementType T> Matrix<T> hstack(const std::vector<Matrix<T>*>& matrixes)
+{
+    Matrix<T> result;
+    result.concatColumns(matrixes);
+
+    return result;
 }
 
-template <MatrixElementType T> void Matrix<T>::_shiftEraseColumn(Matrix<T>::size_type columnNr)
+// matrix product a * b (a cache-blocked kernel is used for arithmetic element types, see multiplicationutils.h)
+template <MultipliableElementType T> Matrix<T> multiply(const Matrix<T>& a, const Matrix<T>& b)
 {
-    if (!isEmpty())
-    {
-        const size_type c_ColumnNr{std::clamp<size_type>(columnNr, 0u, m_NrOfColumns - 1)};
+    return multiply(a, b, Matr::ExecutionPolicy{1});
+}
 
-        if (c_ColumnNr < m_NrOfColumns / 2)
-        {
-            for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
-            {
-                std::rotate(m_pBaseArrayPtr[absRowNr], m_pBaseArrayPtr[absRowNr] + c_ColumnNr,
-                            m_pBaseArrayPtr[absRowNr] + c_ColumnNr + 1);
-                std::destroy_n(m_pBaseArrayPtr[absRowNr], 1);
-            }
+template <MultipliableElementType T>
+Matrix<T> multiply(const Matrix<T>& a, const Matrix<T>& b, const Matr::ExecutionPolicy& executionPolicy)
+{
+    CHECK_ERROR_CONDITION(a.isEmpty() || b.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(a.m_NrOfColumns != b.m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::MATRIXES_INCOMPATIBLE_FOR_MULTIPLICATION]);
 
-            for (size_type absRowNr{0}; absRowNr < m_RowCapacity; ++absRowNr)
-            {
-                ++m_pBaseArrayPtr[absRowNr];
-            }
+    Matrix<T> result{{a.m_NrOfRows, b.m_NrOfColumns}, Matr::uninitialized};
 
-            m_ColumnCapacityOffset = *m_ColumnCapacityOffset + 1;
-        }
-        else
-        {
-            for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
-            {
-                std::rotate(m_pBaseArrayPtr[absRowNr] + c_ColumnNr, m_pBaseArrayPtr[absRowNr] + c_ColumnNr + 1,
-                            m_pBaseArrayPtr[absRowNr] + m_NrOfColumns);
-                std::destroy_n(m_pBaseArrayPtr[absRowNr] + m_NrOfColumns - 1,
-                               1); // the memory outside matrix bounds should be uninitialized
-            }
-        }
+    Matr::runGemm<T>(a.m_NrOfRows, b.m_NrOfColumns, a.m_NrOfColumns, std::nullopt,
+                     a.m_pBaseArrayPtr + *a.m_RowCapacityOffset, b.m_pBaseArrayPtr + *b.m_RowCapacityOffset,
+                     std::nullopt, result.m_pBaseArrayPtr + *result.m_RowCapacityOffset,
+                     executionPolicy.getNrOfThreads());
 
-        --m_NrOfColumns;
-    }
+    return result;
 }
 
-template <MatrixElementType T> void Matrix<T>::_rotateFirstColumn(size_type newColumnNr)
+// c = alpha * a * b + beta * c, c should already have the dimensions of the product and should be a different matrix
+// than a and b; when beta is 0 the initial content of c is not read
+template <MultipliableElementType T>
+void gemm(const T& alpha, const Matrix<T>& a, const Matrix<T>& b, const T& beta, Matrix<T>& c)
 {
-    if (!isEmpty())
-    {
-        const size_type c_NewColumnNr{std::clamp<size_type>(newColumnNr, 0u, m_NrOfColumns)};
-
-        for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
-        {
-            std::rotate(m_pBaseArrayPtr[absRowNr], m_pBaseArrayPtr[absRowNr] + 1,
-                        m_pBaseArrayPtr[absRowNr] + c_NewColumnNr + 1);
-        }
-    }
+    gemm(alpha, a, b, beta, c, Matr::ExecutionPolicy{1});
 }
 
-template <MatrixElementType T> void Matrix<T>::_rotateLastColumn(Matrix<T>::size_type newColumnNr)
+template <MultipliableElementType T>
+void gemm(const T& alpha, const Matrix<T>& a, const Matrix<T>& b, const T& beta, Matrix<T>& c,
+          const Matr::ExecutionPolicy& executionPolicy)
 {
-    if (!isEmpty())
-    {
-        const size_type c_LastColumnNr{static_cast<size_type>(m_NrOfColumns - 1)};
-        const size_type c_NewColumnNr{std::clamp<size_type>(newColumnNr, 0u, c_LastColumnNr)};
+    CHECK_ERROR_CONDITION(a.isEmpty() || b.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(a.m_NrOfColumns != b.m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::MATRIXES_INCOMPATIBLE_FOR_MULTIPLICATION]);
+    CHECK_ERROR_CONDITION(c.m_NrOfRows != a.m_NrOfRows || c.m_NrOfColumns != b.m_NrOfColumns,
+                          Matr::errorMessages[Matr::Errors::RESULT_DIMENSIONS_NOT_MATCHING]);
+    CHECK_ERROR_CONDITION(&c == &a || &c == &b, Matr::errorMessages[Matr::Errors::CURRENT_MATRIX_AS_ARGUMENT]);
 
-        for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
-        {
-            std::rotate(m_pBaseArrayPtr[absRowNr] + c_NewColumnNr, m_pBaseArrayPtr[absRowNr] + c_LastColumnNr,
-                        m_pBaseArrayPtr[absRowNr] + m_NrOfColumns);
-        }
-    }
+    Matr::runGemm<T>(a.m_NrOfRows, b.m_NrOfColumns, a.m_NrOfColumns, alpha,
+                     a.m_pBaseArrayPtr + *a.m_RowCapacityOffset, b.m_pBaseArrayPtr + *b.m_RowCapacityOffset,
+                     beta == T{} ? std::nullopt : std::optional<T>{beta},
+                     c.m_pBaseArrayPtr + *c.m_RowCapacityOffset, executionPolicy.getNrOfThreads());
 }
 
-// if shifting of columns is involved, then this method should be called after the columns shifting function (e.g.
-// _shiftColumnsLeft(), see below)
-template <MatrixElementType T> void Matrix<T>::_alignToTop()
+// matrix product a * b computed by the Strassen-Winograd algorithm (7 instead of 8 half-size products per recursion
+// level) for large matrixes: the recursion stops once a dimension of the (sub)product is not larger than threshold,
+// the remaining products being computed by the cache-blocked kernel; exact for integral element types (as long as the
+// intermediate sums don't overflow), floating point results might slightly differ from the ones of multiply()
+template <ArithmeticElementType T>
+Matrix<T> strassenMultiply(const Matrix<T>& a, const Matrix<T>& b, size_t threshold = Matr::c_DefaultStrassenThreshold)
 {
-    if (m_RowCapacityOffset.has_value() && m_RowCapacityOffset > 0)
-    {
-        std::rotate(m_pBaseArrayPtr, m_pBaseArrayPtr + *m_RowCapacityOffset,
-                    m_pBaseArrayPtr + *m_RowCapacityOffset + m_NrOfRows);
-        m_RowCapacityOffset = 0;
-    }
+    return strassenMultiply(a, b, threshold, Matr::ExecutionPolicy{1});
 }
 
-// columns shifting should be performed before aligning to top (see above)
-template <MatrixElementType T> void Matrix<T>::_shiftColumnsLeft(Matrix<T>::size_type nrOfPositionsToShift)
+template <ArithmeticElementType T>
+Matrix<T> strassenMultiply(const Matrix<T>& a, const Matrix<T>& b, size_t threshold,
+                           const Matr::ExecutionPolicy& executionPolicy)
 {
-    if (m_ColumnCapacityOffset.has_value())
-    {
-        nrOfPositionsToShift = std::clamp<size_type>(nrOfPositionsToShift, 0, *m_ColumnCapacityOffset);
-        m_ColumnCapacityOffset = *m_ColumnCapacityOffset - nrOfPositionsToShift;
-
-        const size_type c_OldNrOfColumns{m_NrOfColumns};
+    CHECK_ERROR_CONDITION(a.isEmpty() || b.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(a.m_NrOfColumns != b.m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::MATRIXES_INCOMPATIBLE_FOR_MULTIPLICATION]);
 
-        // Step 1: move row start to the left, get an additional count of uninitialized columns ("new" columns)
-        for (size_type rowNr{0}; rowNr < m_RowCapacity; ++rowNr)
-        {
-            m_pBaseArrayPtr[rowNr] = m_pAllocPtr + (rowNr * m_ColumnCapacity) + *m_ColumnCapacityOffset;
-        }
+    Matrix<T> result{{a.m_NrOfRows, b.m_NrOfColumns}, Matr::uninitialized};
 
-        m_NrOfColumns += nrOfPositionsToShift;
+    Matr::runStrassenGemm<T>(a.m_NrOfRows, b.m_NrOfColumns, a.m_NrOfColumns, a.m_pBaseArrayPtr + *a.m_RowCapacityOffset,
+                             b.m_pBaseArrayPtr + *b.m_RowCapacityOffset,
+                             result.m_pBaseArrayPtr + *result.m_RowCapacityOffset, threshold,
+                             executionPolicy.getNrOfThreads());
 
-        const size_type c_FirstOldColumnNr = nrOfPositionsToShift;
-        const size_type c_NrOfColumnsToInitialize{std::min(nrOfPositionsToShift, c_OldNrOfColumns)};
+    return result;
+}
 
-        // Step 2: initialize as many new columns as possible by moving the content of the existing ("old") ones
-        _moveInitItems(*this, 0, c_FirstOldColumnNr, 0, 0, m_NrOfRows, c_NrOfColumnsToInitialize);
+// matrix-vector product a * x (x is treated as column vector)
+template <MultipliableElementType T>
+std::vector<T> multiply(const Matrix<T>& a, std::type_identity_t<std::span<const T>> x)
+{
+    CHECK_ERROR_CONDITION(a.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(x.size() != a.m_NrOfColumns, Matr::errorMessages[Matr::Errors::VECTOR_SIZE_NOT_MATCHING]);
 
-        // Step 3: any old columns that were not consumed for initializing the additional ones should be moved near the
-        // new columns to complete shifting; consumed columns should be destroyed
-        if (c_NrOfColumnsToInitialize < c_OldNrOfColumns)
-        {
-            for (size_type absRowNr{*m_RowCapacityOffset}; absRowNr != *m_RowCapacityOffset + m_NrOfRows; ++absRowNr)
-            {
-                std::rotate(m_pBaseArrayPtr[absRowNr] + nrOfPositionsToShift,
-                            m_pBaseArrayPtr[absRowNr] +
-                                static_cast<size_type>(nrOfPositionsToShift + c_NrOfColumnsToInitialize),
-                            m_pBaseArrayPtr[absRowNr] + nrOfPositionsToShift + c_OldNrOfColumns);
-            }
+    std::vector<T> result(a.m_NrOfRows);
 
-            _destroyItems(0, c_OldNrOfColumns, m_NrOfRows, c_NrOfColumnsToInitialize);
-        }
-        else
-        {
-            _destroyItems(0, nrOfPositionsToShift, m_NrOfRows, c_OldNrOfColumns);
-        }
+    Matr::runMatrixVectorProduct<T>(a.m_NrOfRows, a.m_NrOfColumns, std::nullopt,
+                                    a.m_pBaseArrayPtr + *a.m_RowCapacityOffset, x.data(), std::nullopt, result.data());
 
-        // at the end of the shifting operation the matrix should have the same number of columns as before
-        m_NrOfColumns = c_OldNrOfColumns;
-    }
+    return result;
 }
 
-template <MatrixElementType T> void Matrix<T>::_normalizeRowCapacity()
+// vector-matrix product x * a (x is treated as row vector)
+template <MultipliableElementType T>
+std::vector<T> multiply(std::type_identity_t<std::span<const T>> x, const Matrix<T>& a)
 {
-    const std::optional<size_type> c_NormalizedRowCapacityOffset{
-        m_NrOfRows > 0 ? std::optional((m_RowCapacity - m_NrOfRows) / 2) : std::nullopt};
+    CHECK_ERROR_CONDITION(a.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(x.size() != a.m_NrOfRows, Matr::errorMessages[Matr::Errors::VECTOR_SIZE_NOT_MATCHING]);
 
-    if (m_RowCapacityOffset.has_value() &&
-        (c_NormalizedRowCapacityOffset.has_value() && c_NormalizedRowCapacityOffset > 0) &&
-        m_RowCapacityOffset < c_NormalizedRowCapacityOffset)
-    {
-        const size_type c_LastRowNr{static_cast<size_type>(m_NrOfRows - 1)};
-        T** const pStartingRow{m_pBaseArrayPtr + *m_RowCapacityOffset};
-        T** const pEndingRow{pStartingRow + c_LastRowNr};
-        T** const pStartingRowToReplace{m_pBaseArrayPtr + *c_NormalizedRowCapacityOffset};
-        T** const pEndingRowToReplace{pStartingRowToReplace + c_LastRowNr};
+    std::vector<T> result(a.m_NrOfColumns);
 
-        T** pRowToReplace{pEndingRowToReplace};
+    Matr::runVectorMatrixProduct<T>(a.m_NrOfRows, a.m_NrOfColumns, x.data(),
+                                    a.m_pBaseArrayPtr + *a.m_RowCapacityOffset, result.data());
 
-        for (T** pCurrentRow{pEndingRow}; pCurrentRow >= pStartingRow; --pCurrentRow)
-        {
-            std::iter_swap(pCurrentRow, pRowToReplace);
-            --pRowToReplace;
-        }
+    return result;
+}
 
-        m_RowCapacityOffset = c_NormalizedRowCapacityOffset;
-    }
+// y = alpha * a * x + beta * y without allocating; y should not overlap x and when beta is 0 its initial content is not
+// read
+template <MultipliableElementType T>
+void gemv(const T& alpha, const Matrix<T>& a, std::type_identity_t<std::span<const T>> x, const T& beta,
+          std::type_identity_t<std::span<T>> y)
+{
+    CHECK_ERROR_CONDITION(a.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(x.size() != a.m_NrOfColumns, Matr::errorMessages[Matr::Errors::VECTOR_SIZE_NOT_MATCHING]);
+    CHECK_ERROR_CONDITION(y.size() != a.m_NrOfRows, Matr::errorMessages[Matr::Errors::RESULT_DIMENSIONS_NOT_MATCHING]);
+
+    Matr::runMatrixVectorProduct<T>(a.m_NrOfRows, a.m_NrOfColumns, alpha, a.m_pBaseArrayPtr + *a.m_RowCapacityOffset,
+                                    x.data(), beta == T{} ? std::nullopt : std::optional<T>{beta}, y.data());
 }
 
-template <MatrixElementType T>
-void Matrix<T>::_allocMemory(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns,
-                             Matrix<T>::size_type rowCapacity, Matrix<T>::size_type columnCapacity)
+// LU decomposition with partial pivoting of a square matrix: returns L (unit lower triangular), U (upper triangular)
+// and the row permutation, so that a.permuteRows(permutation) equals L * U (for a singular matrix U has a zero on its
+// diagonal)
+template <DecomposableElementType T>
+std::tuple<Matrix<T>, Matrix<T>, std::vector<matrix_size_t>> luDecompose(const Matrix<T>& a)
 {
-    if (nrOfRows > 0 && nrOfColumns > 0)
-    {
-        m_RowCapacity = rowCapacity < nrOfRows ? nrOfRows : rowCapacity;
-        m_ColumnCapacity = columnCapacity < nrOfColumns ? nrOfColumns : columnCapacity;
+    CHECK_ERROR_CONDITION(a.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(a.m_NrOfRows != a.m_NrOfColumns, Matr::errorMessages[Matr::Errors::NON_SQUARE_MATRIX]);
 
-        m_RowCapacityOffset = (m_RowCapacity - nrOfRows) / 2;
-        m_ColumnCapacityOffset = (m_ColumnCapacity - nrOfColumns) / 2;
+    const matrix_size_t c_Size{a.m_NrOfRows};
 
-        m_pBaseArrayPtr = static_cast<T**>(std::malloc(m_RowCapacity * sizeof(T*)));
-        m_pAllocPtr = static_cast<T*>(std::malloc(m_RowCapacity * m_ColumnCapacity * sizeof(T)));
+    Matrix<T> upperMatrix{a};
+    Matrix<T> lowerMatrix{c_Size, {T{}, T{1}}};
+    std::vector<matrix_size_t> permutation(c_Size);
+    std::iota(permutation.begin(), permutation.end(), 0);
 
-        // map row pointers to allocated space, each pointer manages part of the memory array (no overlap allowed, left
-        // free column capacity excluded)
-        for (size_type rowNr{0}; rowNr < m_RowCapacity; ++rowNr)
-        {
-            m_pBaseArrayPtr[rowNr] = m_pAllocPtr + (rowNr * m_ColumnCapacity) + *m_ColumnCapacityOffset;
-        }
+    T** const pUpperRows{upperMatrix.m_pBaseArrayPtr + *upperMatrix.m_RowCapacityOffset};
+    T** const pLowerRows{lowerMatrix.m_pBaseArrayPtr + *lowerMatrix.m_RowCapacityOffset};
 
-        m_NrOfRows = nrOfRows;
-        m_NrOfColumns = nrOfColumns;
-    }
-    else
+    Matr::runLUDecomposition(c_Size, pUpperRows, permutation.data());
+
+    // the factors are stored together, split them
+    for (matrix_size_t rowNr{1}; rowNr < c_Size; ++rowNr)
     {
-        m_NrOfRows = 0;
-        m_NrOfColumns = 0;
-        m_RowCapacity = 0;
-        m_ColumnCapacity = 0;
-        m_RowCapacityOffset.reset();
-        m_ColumnCapacityOffset.reset();
-        m_pBaseArrayPtr = nullptr;
-        m_pAllocPtr = nullptr;
+        std::copy_n(pUpperRows[rowNr], rowNr, pLowerRows[rowNr]);
+        std::fill_n(pUpperRows[rowNr], rowNr, T{});
     }
+
+    return {std::move(lowerMatrix), std::move(upperMatrix), std::move(permutation)};
 }
 
-template <MatrixElementType T> void Matrix<T>::_deallocMemory()
+// solves a * x = b for a square non-singular matrix a, each column of b is a right-hand side (LU decomposition is used)
+template <DecomposableElementType T> Matrix<T> solve(const Matrix<T>& a, const Matrix<T>& b)
 {
-    if (!isEmpty())
-    {
-        // ensure the objects contained within matrix are properly disposed (no column capacity offset provided as
-        // argument -> free left capacity excluded by m_pBaseArrayPtr pointer elements)
-        _destroyItems(*m_RowCapacityOffset, 0, m_NrOfRows, m_NrOfColumns);
+    CHECK_ERROR_CONDITION(a.isEmpty() || b.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(a.m_NrOfRows != a.m_NrOfColumns, Matr::errorMessages[Matr::Errors::NON_SQUARE_MATRIX]);
+    CHECK_ERROR_CONDITION(a.m_NrOfColumns != b.m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::MATRIXES_INCOMPATIBLE_FOR_MULTIPLICATION]);
 
-        // cut access of row pointers to allocated memory
-        std::fill_n(m_pBaseArrayPtr, m_RowCapacity, nullptr);
+    const matrix_size_t c_Size{a.m_NrOfRows};
 
-        std::free(m_pBaseArrayPtr);
-        m_pBaseArrayPtr = nullptr;
+    Matrix<T> luMatrix{a};
+    std::vector<matrix_size_t> permutation(c_Size);
+    std::iota(permutation.begin(), permutation.end(), 0);
 
-        std::free(m_pAllocPtr);
-        m_pAllocPtr = nullptr;
+    T** const pLURows{luMatrix.m_pBaseArrayPtr + *luMatrix.m_RowCapacityOffset};
 
-        m_NrOfRows = 0;
-        m_NrOfColumns = 0;
-        m_RowCapacity = 0;
-        m_ColumnCapacity = 0;
-        m_RowCapacityOffset.reset();
-        m_ColumnCapacityOffset.reset();
-    }
-}
+    Matr::runLUDecomposition(c_Size, pLURows, permutation.data());
 
-// This method should be executed only for already initialized memory; the memory should be subsequently re-initialized
-// by running another function
-template <MatrixElementType T>
-void Matrix<T>::_remapMemory(Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
-{
-    if (!isEmpty())
-    {
-        nrOfRows = std::clamp<size_type>(nrOfRows, 1, m_RowCapacity);
-        nrOfColumns = std::clamp<size_type>(nrOfColumns, 1, m_ColumnCapacity);
+    CHECK_ERROR_CONDITION(Matr::hasZeroDiagonalElement<T>(c_Size, pLURows),
+                          Matr::errorMessages[Matr::Errors::SINGULAR_MATRIX]);
 
-        _destroyItems(0, 0, m_NrOfRows, m_NrOfColumns);
+    // L * U * x = P * b (the row permutation is done by exchanging row pointers)
+    Matrix<T> result{b};
+    result.permuteRows(permutation);
 
-        m_NrOfRows = nrOfRows;
-        m_NrOfColumns = nrOfColumns;
+    T* const* const pResultRows{result.m_pBaseArrayPtr + *result.m_RowCapacityOffset};
 
-        // capacity gets distributed in an even manner as for new allocations (unused capacity equally distributed
-        // between left/right and top/bottom)
-        m_RowCapacityOffset = (m_RowCapacity - m_NrOfRows) / 2;
-        m_ColumnCapacityOffset = (m_ColumnCapacity - m_NrOfColumns) / 2;
+    Matr::runLowerTriangularSolve<T>(c_Size, result.m_NrOfColumns, pLURows, true, pResultRows);
+    Matr::runUpperTriangularSolve<T>(c_Size, result.m_NrOfColumns, pLURows, pResultRows);
 
-        // re-map row pointers to allocated space, each pointer manages part of the memory array (no overlap allowed,
-        // left free column capacity excluded)
-        for (size_type rowNr{0}; rowNr < m_RowCapacity; ++rowNr)
-        {
-            m_pBaseArrayPtr[rowNr] = m_pAllocPtr + (rowNr * m_ColumnCapacity) + *m_ColumnCapacityOffset;
-        }
-    }
+    return result;
 }
 
-template <MatrixElementType T> void Matrix<T>::_copyAssignMatrix(const Matrix<T>& matrix)
+// determinant of a square matrix (computed by LU decomposition)
+template <DecomposableElementType T> T determinant(const Matrix<T>& a)
 {
-    if (&matrix != this)
-    {
-        constexpr size_type c_MaxAllowedDimension{maxAllowedDimension()};
+    CHECK_ERROR_CONDITION(a.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(a.m_NrOfRows != a.m_NrOfColumns, Matr::errorMessages[Matr::Errors::NON_SQUARE_MATRIX]);
 
-        const size_type c_RowCapacityToAlloc{
-            std::min(static_cast<size_type>(matrix.m_NrOfRows + matrix.m_NrOfRows / 4), c_MaxAllowedDimension)};
-        const size_type c_ColumnCapacityToAlloc{
-            std::min(static_cast<size_type>(matrix.m_NrOfColumns + matrix.m_NrOfColumns / 4), c_MaxAllowedDimension)};
+    Matrix<T> luMatrix{a};
+    std::vector<matrix_size_t> permutation(a.m_NrOfRows);
+    std::iota(permutation.begin(), permutation.end(), 0);
 
-        if (matrix.isEmpty())
-        {
-            _deallocMemory();
-        }
-        else if (m_RowCapacity != c_RowCapacityToAlloc || m_ColumnCapacity != c_ColumnCapacityToAlloc)
-        {
-            _deallocMemory();
-            _allocMemory(matrix.m_NrOfRows, matrix.m_NrOfColumns, c_RowCapacityToAlloc, c_ColumnCapacityToAlloc);
-        }
-        else
-        {
-            _remapMemory(matrix.m_NrOfRows, matrix.m_NrOfColumns);
-        }
+    T** const pLURows{luMatrix.m_pBaseArrayPtr + *luMatrix.m_RowCapacityOffset};
 
-        _copyInitItems(matrix, 0, 0, 0, 0, m_NrOfRows, m_NrOfColumns);
+    const size_t c_NrOfRowSwaps{Matr::runLUDecomposition(a.m_NrOfRows, pLURows, permutation.data())};
+
+    T result{c_NrOfRowSwaps % 2 == 0 ? T{1} : T{-1}};
+
+    for (matrix_size_t rowNr{0}; rowNr < a.m_NrOfRows; ++rowNr)
+    {
+        result *= pLURows[rowNr][rowNr];
     }
+
+    return result;
 }
 
-template <MatrixElementType T> void Matrix<T>::_moveAssignMatrix(Matrix<T>& matrix)
+// inverse of a square non-singular matrix (obtained by solving a * x = I)
+template <DecomposableElementType T> Matrix<T> inverse(const Matrix<T>& a)
 {
-    if (&matrix != this)
-    {
-        _deallocMemory();
+    CHECK_ERROR_CONDITION(a.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
 
-        m_pAllocPtr = matrix.m_pAllocPtr;
-        m_pBaseArrayPtr = matrix.m_pBaseArrayPtr;
-        m_NrOfRows = matrix.m_NrOfRows;
-        m_NrOfColumns = matrix.m_NrOfColumns;
-        m_RowCapacity = matrix.m_RowCapacity;
-        m_ColumnCapacity = matrix.m_ColumnCapacity;
-        m_RowCapacityOffset = matrix.m_RowCapacityOffset;
-        m_ColumnCapacityOffset = matrix.m_ColumnCapacityOffset;
+    return solve(a, Matrix<T>{a.getNrOfRows(), {T{}, T{1}}});
+}
 
-        matrix._allocMemory(0, 0);
-    }
+// Cholesky decomposition in place: the symmetric positive definite matrix a (only its lower triangle is read) gets
+// replaced by the lower triangular matrix L, so that the initial matrix equals L * transpose(L)
+template <DecomposableElementType T> void cholesky(Matrix<T>& a)
+{
+    cholesky(a, Matr::ExecutionPolicy{1});
 }
 
-template <MatrixElementType T>
-void Matrix<T>::_copyInitItems(const Matrix<T>& matrix, Matrix<T>::size_type matrixStartingRowNr,
-                               Matrix<T>::size_type matrixColumnOffset, Matrix<T>::size_type startingRowNr,
-                               Matrix<T>::size_type columnOffset, Matrix<T>::size_type nrOfRows,
-                               Matrix<T>::size_type nrOfColumns)
+// the trailing matrix updates (the bulk of the operations) are distributed among threads
+template <DecomposableElementType T> void cholesky(Matrix<T>& a, const Matr::ExecutionPolicy& executionPolicy)
 {
-    if (m_RowCapacityOffset.has_value() && matrix.m_RowCapacityOffset.has_value())
-    {
-        _externalClampSubMatrixSelectionParameters(matrix, matrixStartingRowNr, matrixColumnOffset, startingRowNr,
-                                                   columnOffset, nrOfRows, nrOfColumns);
+    CHECK_ERROR_CONDITION(a.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(a.m_NrOfRows != a.m_NrOfColumns, Matr::errorMessages[Matr::Errors::NON_SQUARE_MATRIX]);
 
-        for (size_type absRowNr{static_cast<size_type>(*m_RowCapacityOffset + startingRowNr)},
-             srcAbsRowNr{static_cast<size_type>(*matrix.m_RowCapacityOffset + matrixStartingRowNr)};
-             absRowNr != *m_RowCapacityOffset + startingRowNr + nrOfRows; ++srcAbsRowNr, ++absRowNr)
-        {
-            std::uninitialized_copy_n(matrix.m_pBaseArrayPtr[srcAbsRowNr] + matrixColumnOffset, nrOfColumns,
-                                      m_pBaseArrayPtr[absRowNr] + columnOffset);
-        }
+    T* const* const pRows{a.m_pBaseArrayPtr + *a.m_RowCapacityOffset};
+
+    [[maybe_unused]] const bool c_IsPositiveDefinite{
+        Matr::runCholeskyDecomposition(a.m_NrOfRows, pRows, executionPolicy.getNrOfThreads())};
+
+    // the content of the matrix is unspecified in this case
+    CHECK_ERROR_CONDITION(!c_IsPositiveDefinite, Matr::errorMessages[Matr::Errors::NOT_POSITIVE_DEFINITE_MATRIX]);
+
+    for (matrix_size_t rowNr{0}; rowNr < a.m_NrOfRows; ++rowNr)
+    {
+        std::fill(pRows[rowNr] + rowNr + 1, pRows[rowNr] + a.m_NrOfColumns, T{});
     }
 }
 
-template <MatrixElementType T>
-void Matrix<T>::_moveInitItems(Matrix<T>& matrix, Matrix<T>::size_type matrixStartingRowNr,
-                               Matrix<T>::size_type matrixColumnOffset, Matrix<T>::size_type startingRowNr,
-                               Matrix<T>::size_type columnOffset, Matrix<T>::size_type nrOfRows,
-                               Matrix<T>::size_type nrOfColumns)
+// solves L * transpose(L) * x = b, where l is the lower triangular matrix obtained by Cholesky decomposition (the
+// decomposition can be reused for any number of right-hand sides, each column of b being one of them)
+template <DecomposableElementType T> Matrix<T> choleskySolve(const Matrix<T>& l, const Matrix<T>& b)
 {
-    if (m_RowCapacityOffset.has_value() && matrix.m_RowCapacityOffset.has_value())
-    {
-        _externalClampSubMatrixSelectionParameters(matrix, matrixStartingRowNr, matrixColumnOffset, startingRowNr,
-                                                   columnOffset, nrOfRows, nrOfColumns);
+    CHECK_ERROR_CONDITION(l.isEmpty() || b.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(l.m_NrOfRows != l.m_NrOfColumns, Matr::errorMessages[Matr::Errors::NON_SQUARE_MATRIX]);
+    CHECK_ERROR_CONDITION(l.m_NrOfColumns != b.m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::MATRIXES_INCOMPATIBLE_FOR_MULTIPLICATION]);
 
-        for (size_type absRowNr{static_cast<size_type>(*m_RowCapacityOffset + startingRowNr)},
-             srcAbsRowNr{static_cast<size_type>(*matrix.m_RowCapacityOffset + matrixStartingRowNr)};
-             absRowNr != *m_RowCapacityOffset + startingRowNr + nrOfRows; ++srcAbsRowNr, ++absRowNr)
-        {
-            std::uninitialized_move_n(matrix.m_pBaseArrayPtr[srcAbsRowNr] + matrixColumnOffset, nrOfColumns,
-                                      m_pBaseArrayPtr[absRowNr] + columnOffset);
-        }
-    }
+    const T* const* const pLowerRows{l.m_pBaseArrayPtr + *l.m_RowCapacityOffset};
+
+    CHECK_ERROR_CONDITION(Matr::hasZeroDiagonalElement(l.m_NrOfRows, pLowerRows),
+                          Matr::errorMessages[Matr::Errors::SINGULAR_MATRIX]);
+
+    Matrix<T> result{b};
+    T* const* const pResultRows{result.m_pBaseArrayPtr + *result.m_RowCapacityOffset};
+
+    Matr::runLowerTriangularSolve(l.m_NrOfRows, result.m_NrOfColumns, pLowerRows, false, pResultRows);
+    Matr::runTransposedLowerTriangularSolve(l.m_NrOfRows, result.m_NrOfColumns, pLowerRows, pResultRows);
+
+    return result;
 }
 
-template <MatrixElementType T>
-void Matrix<T>::_fillInitItems(Matrix<T>::size_type startingRowNr, Matrix<T>::size_type columnOffset,
-                               Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns, const T& value)
+// QR decomposition (economy size) of a matrix having at least as many rows as columns: returns Q (same dimensions as a,
+// orthonormal columns) and R (square, upper triangular), so that a equals Q * R
+template <DecomposableElementType T> std::pair<Matrix<T>, Matrix<T>> qr(const Matrix<T>& a)
 {
-    if (m_RowCapacityOffset.has_value())
-    {
-        _clampSubMatrixSelectionParameters(startingRowNr, columnOffset, nrOfRows, nrOfColumns);
+    CHECK_ERROR_CONDITION(a.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(a.m_NrOfRows < a.m_NrOfColumns, Matr::errorMessages[Matr::Errors::INSUFFICIENT_NR_OF_ROWS]);
 
-        for (size_type absRowNr{static_cast<size_type>(*m_RowCapacityOffset + startingRowNr)};
-             absRowNr != *m_RowCapacityOffset + startingRowNr + nrOfRows; ++absRowNr)
-        {
-            std::uninitialized_fill_n(m_pBaseArrayPtr[absRowNr] + columnOffset, nrOfColumns, value);
-        }
+    const matrix_size_t c_NrOfRows{a.m_NrOfRows};
+    const matrix_size_t c_NrOfColumns{a.m_NrOfColumns};
+
+    Matrix<T> factorsMatrix{a};
+    std::vector<T> triangularFactors;
+
+    T* const* const pFactorsRows{factorsMatrix.m_pBaseArrayPtr + *factorsMatrix.m_RowCapacityOffset};
+
+    Matr::runQRDecomposition(c_NrOfRows, c_NrOfColumns, pFactorsRows, triangularFactors);
+
+    Matrix<T> orthogonalMatrix{{c_NrOfRows, c_NrOfColumns}, Matr::uninitialized};
+    Matrix<T> upperMatrix{{c_NrOfColumns, c_NrOfColumns}, T{}};
+
+    T* const* const pOrthogonalRows{orthogonalMatrix.m_pBaseArrayPtr + *orthogonalMatrix.m_RowCapacityOffset};
+    T* const* const pUpperRows{upperMatrix.m_pBaseArrayPtr + *upperMatrix.m_RowCapacityOffset};
+
+    for (matrix_size_t rowNr{0}; rowNr < c_NrOfColumns; ++rowNr)
+    {
+        std::copy(pFactorsRows[rowNr] + rowNr, pFactorsRows[rowNr] + c_NrOfColumns, pUpperRows[rowNr] + rowNr);
     }
+
+    Matr::runQFormation<T>(c_NrOfRows, c_NrOfColumns, pFactorsRows, triangularFactors, pOrthogonalRows);
+
+    return {std::move(orthogonalMatrix), std::move(upperMatrix)};
 }
 
-template <MatrixElementType T>
-void Matrix<T>::_defaultConstructInitItems(Matrix<T>::size_type startingRowNr, Matrix<T>::size_type columnOffset,
-                                           Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
+// least squares solution of the (overdetermined) system a * x = b, where a has full column rank: x minimizes the norm
+// of a * x - b for each column of b; obtained by QR decomposition (R * x = transpose(Q) * b) without forming Q
+template <DecomposableElementType T> Matrix<T> leastSquares(const Matrix<T>& a, const Matrix<T>& b)
 {
-    if (m_RowCapacityOffset.has_value())
-    {
-        _clampSubMatrixSelectionParameters(startingRowNr, columnOffset, nrOfRows, nrOfColumns);
+    CHECK_ERROR_CONDITION(a.isEmpty() || b.isEmpty(), Matr::errorMessages[Matr::Errors::EMPTY_MATRIX]);
+    CHECK_ERROR_CONDITION(a.m_NrOfRows < a.m_NrOfColumns, Matr::errorMessages[Matr::Errors::INSUFFICIENT_NR_OF_ROWS]);
+    CHECK_ERROR_CONDITION(a.m_NrOfRows != b.m_NrOfRows,
+                          Matr::errorMessages[Matr::Errors::MATRIXES_UNEQUAL_COLUMN_LENGTH]);
 
-        for (size_type absRowNr{static_cast<size_type>(*m_RowCapacityOffset + startingRowNr)};
-             absRowNr != *m_RowCapacityOffset + startingRowNr + nrOfRows; ++absRowNr)
-        {
-            std::uninitialized_default_construct_n(m_pBaseArrayPtr[absRowNr] + columnOffset, nrOfColumns);
-        }
+    const matrix_size_t c_NrOfRows{a.m_NrOfRows};
+    const matrix_size_t c_NrOfColumns{a.m_NrOfColumns};
+
+    Matrix<T> factorsMatrix{a};
+    std::vector<T> triangularFactors;
+
+    T* const* const pFactorsRows{factorsMatrix.m_pBaseArrayPtr + *factorsMatrix.m_RowCapacityOffset};
+
+    Matr::runQRDecomposition(c_NrOfRows, c_NrOfColumns, pFactorsRows, triangularFactors);
+
+    CHECK_ERROR_CONDITION(Matr::hasZeroDiagonalElement<T>(c_NrOfColumns, pFactorsRows),
+                          Matr::errorMessages[Matr::Errors::SINGULAR_MATRIX]);
+
+    Matrix<T> transformedMatrix{b};
+    T* const* const pTransformedRows{transformedMatrix.m_pBaseArrayPtr + *transformedMatrix.m_RowCapacityOffset};
+
+    Matr::runQTransposedApplication<T>(c_NrOfRows, c_NrOfColumns, pFactorsRows, triangularFactors,
+                                       transformedMatrix.m_NrOfColumns, pTransformedRows);
+    Matr::runUpperTriangularSolve<T>(c_NrOfColumns, transformedMatrix.m_NrOfColumns, pFactorsRows, pTransformedRows);
+
+    // only the first rows are part of the solution (the other ones contain the residuals)
+    Matrix<T> result{{c_NrOfColumns, transformedMatrix.m_NrOfColumns}, Matr::uninitialized};
+    T* const* const pResultRows{result.m_pBaseArrayPtr + *result.m_RowCapacityOffset};
+
+    for (matrix_size_t rowNr{0}; rowNr < c_NrOfColumns; ++rowNr)
+    {
+        std::copy_n(pTransformedRows[rowNr], result.m_NrOfColumns, pResultRows[rowNr]);
     }
+
+    return result;
 }
 
-template <MatrixElementType T>
-void Matrix<T>::_destroyItems(Matrix<T>::size_type startingRowNr, Matrix<T>::size_type columnOffset,
-                              Matrix<T>::size_type nrOfRows, Matrix<T>::size_type nrOfColumns)
+// element-wise arithmetic: the operands are matrixes, expressions (e.g. A * 2 + B) or scalars (one per operation);
+// nothing gets computed until the resulting expression is assigned to a matrix, which happens in a single pass
+template <typename Lhs, typename Rhs>
+    requires Matr::BinaryExpressionOperands<std::plus<>, Lhs, Rhs>
+auto operator+(const Lhs& lhs, const Rhs& rhs)
 {
-    if (m_RowCapacityOffset.has_value())
-    {
-        _clampSubMatrixSelectionParameters(startingRowNr, columnOffset, nrOfRows, nrOfColumns);
+    return Matr::makeBinaryExpression<std::plus<>>(lhs, rhs);
+}
 
-        for (size_type absRowNr{static_cast<size_type>(*m_RowCapacityOffset + startingRowNr)};
-             absRowNr != *m_RowCapacityOffset + startingRowNr + nrOfRows; ++absRowNr)
-        {
-            std::destroy_n(m_pBaseArrayPtr[absRowNr] + columnOffset, nrOfColumns);
-        }
-    }
+template <typename Lhs, typename Rhs>
+    requires Matr::BinaryExpressionOperands<std::minus<>, Lhs, Rhs>
+auto operator-(const Lhs& lhs, const Rhs& rhs)
+{
+    return Matr::makeBinaryExpression<std::minus<>>(lhs, rhs);
 }
 
-template <MatrixElementType T>
-void Matrix<T>::_clampSubMatrixSelectionParameters(Matrix<T>::size_type& startingRowNr,
-                                                   Matrix<T>::size_type& columnOffset, Matrix<T>::size_type& nrOfRows,
-                                                   Matrix<T>::size_type& nrOfColumns)
+template <typename Lhs, typename Rhs>
+    requires Matr::BinaryExpressionOperands<std::multiplies<>, Lhs, Rhs>
+auto operator*(const Lhs& lhs, const Rhs& rhs)
 {
-    startingRowNr = std::clamp<size_type>(startingRowNr, 0u, m_NrOfRows);
-    columnOffset = std::clamp<size_type>(columnOffset, 0u, m_NrOfColumns);
-    nrOfRows = std::clamp<size_type>(nrOfRows, 0u, m_NrOfRows - startingRowNr);
-    nrOfColumns = std::clamp<size_type>(nrOfColumns, 0u, m_NrOfColumns - columnOffset);
+    return Matr::makeBinaryExpression<std::multiplies<>>(lhs, rhs);
 }
 
-template <MatrixElementType T>
-void Matrix<T>::_externalClampSubMatrixSelectionParameters(
-    const Matrix<T>& srcMatrix, Matrix<T>::size_type& srcStartingRowNr, Matrix<T>::size_type& srcColumnOffset,
-    Matrix<T>::size_type& startingRowNr, Matrix<T>::size_type& columnOffset, Matrix<T>::size_type& nrOfRows,
-    Matrix<T>::size_type& nrOfColumns)
+template <typename Lhs, typename Rhs>
+    requires Matr::BinaryExpressionOperands<std::divides<>, Lhs, Rhs>
+auto operator/(const Lhs& lhs, const Rhs& rhs)
 {
-    srcStartingRowNr = std::clamp<size_type>(srcStartingRowNr, 0u, srcMatrix.m_NrOfRows);
-    srcColumnOffset = std::clamp<size_type>(srcColumnOffset, 0u, srcMatrix.m_NrOfColumns);
-    startingRowNr = std::clamp<size_type>(startingRowNr, 0u, m_NrOfRows);
-    columnOffset = std::clamp<size_type>(columnOffset, 0u, m_NrOfColumns);
-    nrOfRows = std::clamp<size_type>(nrOfRows, 0u,
-                                     std::min(srcMatrix.m_NrOfRows - srcStartingRowNr, m_NrOfRows - startingRowNr));
-    nrOfColumns = std::clamp<size_type>(
-        nrOfColumns, 0u, std::min(srcMatrix.m_NrOfColumns - srcColumnOffset, m_NrOfColumns - columnOffset));
+    return Matr::makeBinaryExpression<std::divides<>>(lhs, rhs);
 }
 
-template <MatrixElementType T> void* Matrix<T>::_convertToArray(Matrix<T>::size_type& nrOfElements)
+template <typename Operand>
+    requires Matr::UnaryExpressionOperand<std::negate<>, Operand>
+auto operator-(const Operand& operand)
 {
-    // effective transfer of ownership (items - including uninitalized ones)
-    void* pAllocPtr{m_pAllocPtr};
-    nrOfElements = m_RowCapacity * m_ColumnCapacity;
+    return Matr::makeUnaryExpression<std::negate<>>(operand);
+}
 
-    // delete the matrix row pointers
-    std::free(m_pBaseArrayPtr);
+template <typename Operand>
+    requires Matr::UnaryExpressionOperand<Matr::Abs, Operand>
+auto abs(const Operand& operand)
+{
+    return Matr::makeUnaryExpression<Matr::Abs>(operand);
+}
 
-    // reset all internal variables to bring the matrix to empty state
-    m_pBaseArrayPtr = nullptr;
-    m_pAllocPtr = nullptr;
-    m_NrOfRows = 0;
-    m_NrOfColumns = 0;
-    m_RowCapacity = 0;
-    m_ColumnCapacity = 0;
-    m_RowCapacityOffset.reset();
-    m_ColumnCapacityOffset.reset();
+template <typename Operand>
+    requires Matr::FloatingPointExpressionOperand<Matr::Sqrt, Operand>
+auto sqrt(const Operand& operand)
+{
+    return Matr::makeUnaryExpression<Matr::Sqrt>(operand);
+}
 
-    return pAllocPtr;
+template <typename Operand>
+    requires Matr::FloatingPointExpressionOperand<Matr::Exp, Operand>
+auto exp(const Operand& operand)
+{
+    return Matr::makeUnaryExpression<Matr::Exp>(operand);
+}
+
+template <typename Operand>
+    requires Matr::FloatingPointExpressionOperand<Matr::Log, Operand>
+auto log(const Operand& operand)
+{
+    return Matr::makeUnaryExpression<Matr::Log>(operand);
 }
 
 #undef CHECK_ERROR_CONDITION
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace Matr
+{
+// determines how many threads are used by the matrix operations that support parallel execution
+class ExecutionPolicy
+{
+public:
+    // 0 threads: use all available hardware threads
+    explicit ExecutionPolicy(size_t nrOfThreads = 0);
+
+    size_t getNrOfThreads() const;
+
+private:
+    size_t m_NrOfThreads;
+};
+
+inline ExecutionPolicy::ExecutionPolicy(size_t nrOfThreads)
+    : m_NrOfThreads{nrOfThreads > 0 ? nrOfThreads : std::max<size_t>(std::thread::hardware_concurrency(), 1)}
+{
+}
+
+inline size_t ExecutionPolicy::getNrOfThreads() const
+{
+    return m_NrOfThreads;
+}
+
+// executes job(threadNr) once on each thread, the calling thread takes over job 0; it returns when all jobs are done
+// (if any job throws, the exception is rethrown on the calling thread once all threads are joined; the exception of the
+// job with the lowest thread number is picked if several of them throw)
+template <typename Job> void runOnThreads(size_t nrOfThreads, const Job& job)
+{
+    std::vector<std::exception_ptr> jobExceptions(std::max<size_t>(nrOfThreads, 1));
+
+    auto runJob = [&job, &jobExceptions](size_t threadNr) {
+        try
+        {
+            job(threadNr);
+        }
+        catch (...)
+        {
+            jobExceptions[threadNr] = std::current_exception();
+        }
+    };
+
+    {
+        std::vector<std::jthread> helperThreads;
+
+        if (nrOfThreads > 1)
+        {
+            helperThreads.reserve(nrOfThreads - 1);
+        }
+
+        for (size_t threadNr{1}; threadNr < nrOfThreads; ++threadNr)
+        {
+            helperThreads.emplace_back(runJob, threadNr);
+        }
+
+        runJob(0);
+    } // the helper threads are joined when going out of scope
+
+    for (const std::exception_ptr& jobException : jobExceptions)
+    {
+        if (jobException)
+        {
+            std::rethrow_exception(jobException);
+        }
+    }
+}
+
+// executes task(taskNr) for each task number within [0, nrOfTasks), the tasks are dynamically distributed among the
+// threads (each thread picks the next unprocessed task once it finished the previous one)
+template <typename Task> void runTasks(size_t nrOfTasks, size_t nrOfThreads, const Task& task)
+{
+    std::atomic<size_t> nextTaskNr{0};
+
+    runOnThreads(std::min(nrOfThreads, nrOfTasks), [&nextTaskNr, nrOfTasks, &task](size_t) {
+        for (size_t taskNr{nextTaskNr++}; taskNr < nrOfTasks; taskNr = nextTaskNr++)
+        {
+            task(taskNr);
+        }
+    });
+}
+} // namespace Matr
@@ -0,0 +1,707 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "multiplicationutils.h"
+
+namespace Matr
+{
+// number of columns factorized at once (panel) before the trailing matrix is updated by a matrix product
+inline constexpr size_t c_DecompositionBlockSize{48};
+
+// number of columns of a QR panel: the panel takes a pass over its rows for each column, so a narrower panel means less
+// memory traffic for tall matrixes while a wider one leaves more work to the (blocked) matrix products
+inline constexpr size_t c_QRPanelWidth{16};
+
+// row pointers of a sub-block (the block starts at column columnOffset of the provided rows)
+template <typename T> std::vector<T*> getShiftedRows(T* const* rows, size_t nrOfRows, size_t columnOffset)
+{
+    std::vector<T*> shiftedRows(nrOfRows);
+
+    for (size_t rowNr{0}; rowNr < nrOfRows; ++rowNr)
+    {
+        shiftedRows[rowNr] = rows[rowNr] + columnOffset;
+    }
+
+    return shiftedRows;
+}
+
+// true if the (square) matrix has a null element on its main diagonal
+template <typename T> bool hasZeroDiagonalElement(size_t n, const T* const* rows)
+{
+    bool hasZeroElement{false};
+
+    for (size_t rowNr{0}; rowNr < n && !hasZeroElement; ++rowNr)
+    {
+        hasZeroElement = rows[rowNr][rowNr] == T{};
+    }
+
+    return hasZeroElement;
+}
+
+// factorizes the panel consisting of the columns [firstColumnNr, firstColumnNr + nrOfColumns) (rows located from
+// firstColumnNr downwards) by partial pivoting; the pivot rows are exchanged by swapping the row pointers, so the
+// whole rows are exchanged in O(1) (including the previously computed part of l and the not yet updated columns)
+template <typename T, typename Index>
+size_t runLUPanelDecomposition(size_t n, size_t firstColumnNr, size_t nrOfColumns, T** rows, Index* permutation)
+{
+    using std::abs;
+
+    size_t nrOfRowSwaps{0};
+    const size_t c_PanelEnd{firstColumnNr + nrOfColumns};
+
+    for (size_t columnNr{firstColumnNr}; columnNr < c_PanelEnd; ++columnNr)
+    {
+        size_t pivotRowNr{columnNr};
+
+        for (size_t rowNr{columnNr + 1}; rowNr < n; ++rowNr)
+        {
+            if (abs(rows[rowNr][columnNr]) > abs(rows[pivotRowNr][columnNr]))
+            {
+                pivotRowNr = rowNr;
+            }
+        }
+
+        if (pivotRowNr != columnNr)
+        {
+            std::swap(rows[columnNr], rows[pivotRowNr]);
+            std::swap(permutation[columnNr], permutation[pivotRowNr]);
+            ++nrOfRowSwaps;
+        }
+
+        const T c_Pivot{rows[columnNr][columnNr]};
+
+        // singular matrix: the column is already eliminated, nothing to do
+        if (c_Pivot != T{})
+        {
+            const T* const pPivotRow{rows[columnNr]};
+
+            for (size_t rowNr{columnNr + 1}; rowNr < n; ++rowNr)
+            {
+                T* const pRow{rows[rowNr]};
+                const T c_Multiplier{pRow[columnNr] / c_Pivot};
+
+                pRow[columnNr] = c_Multiplier;
+
+                for (size_t panelColumnNr{columnNr + 1}; panelColumnNr < c_PanelEnd; ++panelColumnNr)
+                {
+                    pRow[panelColumnNr] -= c_Multiplier * pPivotRow[panelColumnNr];
+                }
+            }
+        }
+    }
+
+    return nrOfRowSwaps;
+}
+
+/* LU decomposition with partial pivoting of the n x n matrix provided as row pointers: P * A = L * U, where L is unit
+   lower triangular and U upper triangular. Both are stored in place (the unit diagonal of L is not stored) and the row
+   pointers are reordered as required by the pivoting. The permutation gets the original number of each row (it should
+   be initialized with the identity permutation). Returns the number of row swaps (required for the determinant sign).
+
+   The right-looking blocked algorithm is used: after factorizing a panel of columns the matching rows of U are computed
+   by a triangular solve and the trailing matrix is updated by a matrix product (GEMM), which performs the bulk of the
+   operations in a cache-friendly way.
+*/
+template <typename T, typename Index> size_t runLUDecomposition(size_t n, T** rows, Index* permutation)
+{
+    size_t nrOfRowSwaps{0};
+
+    for (size_t blockOffset{0}; blockOffset < n; blockOffset += c_DecompositionBlockSize)
+    {
+        const size_t c_BlockSize{std::min(c_DecompositionBlockSize, n - blockOffset)};
+        const size_t c_TrailingOffset{blockOffset + c_BlockSize};
+        const size_t c_TrailingSize{n - c_TrailingOffset};
+
+        nrOfRowSwaps += runLUPanelDecomposition(n, blockOffset, c_BlockSize, rows, permutation);
+
+        if (c_TrailingSize > 0)
+        {
+            // U12 = L11^-1 * A12 (row oriented forward substitution, L11 has a unit diagonal)
+            for (size_t rowNr{blockOffset + 1}; rowNr < c_TrailingOffset; ++rowNr)
+            {
+                T* const pRow{rows[rowNr]};
+
+                for (size_t index{blockOffset}; index < rowNr; ++index)
+                {
+                    const T c_Multiplier{pRow[index]};
+                    const T* const pUpperRow{rows[index]};
+
+                    for (size_t columnNr{c_TrailingOffset}; columnNr < n; ++columnNr)
+                    {
+                        pRow[columnNr] -= c_Multiplier * pUpperRow[columnNr];
+                    }
+                }
+            }
+
+            // A22 = A22 - L21 * U12
+            const std::vector<T*> c_LowerRows{getShiftedRows(rows + c_TrailingOffset, c_TrailingSize, blockOffset)};
+            const std::vector<T*> c_UpperRows{getShiftedRows(rows + blockOffset, c_BlockSize, c_TrailingOffset)};
+            const std::vector<T*> c_TrailingRows{
+                getShiftedRows(rows + c_TrailingOffset, c_TrailingSize, c_TrailingOffset)};
+
+            runGemm<T>(c_TrailingSize, c_TrailingSize, c_BlockSize, T{-1}, c_LowerRows.data(), c_UpperRows.data(),
+                       T{1}, c_TrailingRows.data());
+        }
+    }
+
+    return nrOfRowSwaps;
+}
+
+// solves L * X = B in place (B is overwritten by X, it has n rows and nrOfColumns columns); l is lower triangular (its
+// upper part is not read) with a non-zero diagonal, which is not read either if it is a unit diagonal
+template <typename T>
+void runLowerTriangularSolve(size_t n, size_t nrOfColumns, const T* const* lRows, bool hasUnitDiagonal, T* const* xRows)
+{
+    for (size_t blockOffset{0}; blockOffset < n; blockOffset += c_DecompositionBlockSize)
+    {
+        const size_t c_BlockSize{std::min(c_DecompositionBlockSize, n - blockOffset)};
+        const size_t c_TrailingOffset{blockOffset + c_BlockSize};
+
+        for (size_t rowNr{blockOffset}; rowNr < c_TrailingOffset; ++rowNr)
+        {
+            T* const pRow{xRows[rowNr]};
+
+            for (size_t index{blockOffset}; index < rowNr; ++index)
+            {
+                const T c_Multiplier{lRows[rowNr][index]};
+                const T* const pSolvedRow{xRows[index]};
+
+                for (size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+                {
+                    pRow[columnNr] -= c_Multiplier * pSolvedRow[columnNr];
+                }
+            }
+
+            if (!hasUnitDiagonal)
+            {
+                const T c_Diagonal{lRows[rowNr][rowNr]};
+
+                for (size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+                {
+                    pRow[columnNr] /= c_Diagonal;
+                }
+            }
+        }
+
+        // the solved block is eliminated from the remaining rows
+        if (c_TrailingOffset < n)
+        {
+            const std::vector<const T*> c_LowerRows{
+                getShiftedRows(lRows + c_TrailingOffset, n - c_TrailingOffset, blockOffset)};
+
+            runGemm<T>(n - c_TrailingOffset, nrOfColumns, c_BlockSize, T{-1}, c_LowerRows.data(), xRows + blockOffset,
+                       T{1}, xRows + c_TrailingOffset);
+        }
+    }
+}
+
+// solves U * X = B in place (B is overwritten by X, it has n rows and nrOfColumns columns); u is upper triangular with
+// a non-zero diagonal (its lower part is not read)
+template <typename T>
+void runUpperTriangularSolve(size_t n, size_t nrOfColumns, const T* const* uRows, T* const* xRows)
+{
+    for (size_t blockEnd{n}; blockEnd > 0;)
+    {
+        const size_t c_BlockSize{std::min(c_DecompositionBlockSize, blockEnd)};
+        const size_t c_BlockOffset{blockEnd - c_BlockSize};
+
+        for (size_t rowNr{blockEnd}; rowNr-- > c_BlockOffset;)
+        {
+            T* const pRow{xRows[rowNr]};
+
+            for (size_t index{rowNr + 1}; index < blockEnd; ++index)
+            {
+                const T c_Multiplier{uRows[rowNr][index]};
+                const T* const pSolvedRow{xRows[index]};
+
+                for (size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+                {
+                    pRow[columnNr] -= c_Multiplier * pSolvedRow[columnNr];
+                }
+            }
+
+            const T c_Diagonal{uRows[rowNr][rowNr]};
+
+            for (size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+            {
+                pRow[columnNr] /= c_Diagonal;
+            }
+        }
+
+        // the solved block is eliminated from the rows located above it
+        if (c_BlockOffset > 0)
+        {
+            const std::vector<const T*> c_UpperRows{getShiftedRows(uRows, c_BlockOffset, c_BlockOffset)};
+
+            runGemm<T>(c_BlockOffset, nrOfColumns, c_BlockSize, T{-1}, c_UpperRows.data(), xRows + c_BlockOffset,
+                       T{1}, xRows);
+        }
+
+        blockEnd = c_BlockOffset;
+    }
+}
+
+// solves transpose(L) * X = B in place (B is overwritten by X, it has n rows and nrOfColumns columns), l being lower
+// triangular with a non-zero diagonal; once a row of x is solved it is eliminated from the rows above by using the
+// matching row of l, so l is only accessed row by row (no strided column access)
+template <typename T>
+void runTransposedLowerTriangularSolve(size_t n, size_t nrOfColumns, const T* const* lRows, T* const* xRows)
+{
+    for (size_t rowNr{n}; rowNr-- > 0;)
+    {
+        T* const pSolvedRow{xRows[rowNr]};
+        const T* const pLowerRow{lRows[rowNr]};
+        const T c_Diagonal{pLowerRow[rowNr]};
+
+        for (size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+        {
+            pSolvedRow[columnNr] /= c_Diagonal;
+        }
+
+        for (size_t index{0}; index < rowNr; ++index)
+        {
+            const T c_Multiplier{pLowerRow[index]};
+            T* const pRow{xRows[index]};
+
+            for (size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+            {
+                pRow[columnNr] -= c_Multiplier * pSolvedRow[columnNr];
+            }
+        }
+    }
+}
+
+// unblocked Cholesky decomposition of the diagonal block of size nrOfColumns starting at [blockOffset][blockOffset]
+// (only its lower part is read/written); returns false if the block is not positive definite
+template <typename T> bool runCholeskyBlockDecomposition(size_t blockOffset, size_t nrOfColumns, T* const* rows)
+{
+    using std::sqrt;
+
+    bool isPositiveDefinite{true};
+    const size_t c_BlockEnd{blockOffset + nrOfColumns};
+
+    for (size_t columnNr{blockOffset}; columnNr < c_BlockEnd && isPositiveDefinite; ++columnNr)
+    {
+        const T c_DiagonalSquare{rows[columnNr][columnNr]};
+
+        // NaN values fail the comparison as well
+        isPositiveDefinite = c_DiagonalSquare > T{};
+
+        if (isPositiveDefinite)
+        {
+            const T c_Diagonal{sqrt(c_DiagonalSquare)};
+
+            rows[columnNr][columnNr] = c_Diagonal;
+
+            for (size_t rowNr{columnNr + 1}; rowNr < c_BlockEnd; ++rowNr)
+            {
+                T* const pRow{rows[rowNr]};
+
+                pRow[columnNr] /= c_Diagonal;
+
+                for (size_t index{columnNr + 1}; index <= rowNr; ++index)
+                {
+                    pRow[index] -= pRow[columnNr] * rows[index][columnNr];
+                }
+            }
+        }
+    }
+
+    return isPositiveDefinite;
+}
+
+/* Cholesky decomposition A = L * transpose(L) of the symmetric positive definite n x n matrix provided as row pointers.
+   Only the lower triangle of A is read and it gets overwritten by L (the upper triangle content is unspecified
+   afterwards). Returns false if the matrix is not positive definite (the content of the matrix is unspecified too).
+
+   The right-looking blocked algorithm is used: the diagonal block is decomposed, then the block column below it is
+   computed by using dot products of rows (L21 = A21 * transpose(L11)^-1) and finally the lower part of the trailing
+   matrix is updated by matrix products (A22 = A22 - L21 * transpose(L21)). For this purpose L21 is transposed into a
+   buffer so the products can use the GEMM kernel. The trailing matrix is split into groups of rows that can be updated
+   by multiple threads.
+*/
+template <typename T> bool runCholeskyDecomposition(size_t n, T* const* rows, size_t nrOfThreads)
+{
+    bool isPositiveDefinite{true};
+
+    std::vector<T> transposedPanel;
+    std::vector<const T*> transposedPanelRows;
+
+    for (size_t blockOffset{0}; blockOffset < n && isPositiveDefinite; blockOffset += c_DecompositionBlockSize)
+    {
+        const size_t c_BlockSize{std::min(c_DecompositionBlockSize, n - blockOffset)};
+        const size_t c_TrailingOffset{blockOffset + c_BlockSize};
+        const size_t c_TrailingSize{n - c_TrailingOffset};
+
+        isPositiveDefinite = runCholeskyBlockDecomposition(blockOffset, c_BlockSize, rows);
+
+        if (isPositiveDefinite && c_TrailingSize > 0)
+        {
+            transposedPanel.resize(c_BlockSize * c_TrailingSize);
+            transposedPanelRows.resize(c_BlockSize);
+
+            for (size_t index{0}; index < c_BlockSize; ++index)
+            {
+                transposedPanelRows[index] = transposedPanel.data() + index * c_TrailingSize;
+            }
+
+            // L21 = A21 * transpose(L11)^-1 (each element of a row depends on the previous ones)
+            for (size_t rowNr{c_TrailingOffset}; rowNr < n; ++rowNr)
+            {
+                T* const pRow{rows[rowNr]};
+
+                for (size_t columnNr{blockOffset}; columnNr < c_TrailingOffset; ++columnNr)
+                {
+                    const T* const pBlockRow{rows[columnNr]};
+
+                    const T c_DotProduct{
+                        computeDotProduct(pRow + blockOffset, pBlockRow + blockOffset, columnNr - blockOffset)};
+
+                    pRow[columnNr] = (pRow[columnNr] - c_DotProduct) / pBlockRow[columnNr];
+
+                    transposedPanel[(columnNr - blockOffset) * c_TrailingSize + rowNr - c_TrailingOffset] =
+                        pRow[columnNr];
+                }
+            }
+
+            // A22 = A22 - L21 * transpose(L21), lower part only: each group of rows is updated up to its last column
+            // (the lower groups are larger so they are handled first)
+            const size_t c_NrOfRowGroups{(c_TrailingSize + c_DecompositionBlockSize - 1) / c_DecompositionBlockSize};
+
+            runTasks(c_NrOfRowGroups, nrOfThreads, [&](size_t taskNr) {
+                const size_t c_GroupOffset{(c_NrOfRowGroups - 1 - taskNr) * c_DecompositionBlockSize};
+                const size_t c_GroupSize{std::min(c_DecompositionBlockSize, c_TrailingSize - c_GroupOffset)};
+
+                const std::vector<T*> c_LowerRows{
+                    getShiftedRows(rows + c_TrailingOffset + c_GroupOffset, c_GroupSize, blockOffset)};
+                const std::vector<T*> c_TrailingRows{
+                    getShiftedRows(rows + c_TrailingOffset + c_GroupOffset, c_GroupSize, c_TrailingOffset)};
+
+                runGemm<T>(c_GroupSize, c_GroupOffset + c_GroupSize, c_BlockSize, T{-1}, c_LowerRows.data(),
+                           transposedPanelRows.data(), T{1}, c_TrailingRows.data());
+            });
+        }
+    }
+
+    return isPositiveDefinite;
+}
+
+/* Householder QR factorization of the panel consisting of the columns [firstColumnNr, firstColumnNr + nrOfColumns) of
+   the m x n matrix (rows located from firstColumnNr downwards). For each column a reflector H = I - tau * v *
+   transpose(v) is computed that annihilates the elements below the diagonal; v has a unit first element (not stored)
+   and its other elements replace the annihilated ones, the diagonal element becomes the matching element of R.
+
+   Applying a reflector requires w = transpose(v) * A for the remaining panel columns, v being known only after the
+   column norm is computed. However w can be obtained from the product of the not yet scaled column with the remaining
+   columns, which is accumulated while the previous reflector gets applied. So each column takes a single pass over the
+   rows (scale v, update the row, accumulate the norm and the product required by the next column), the elements of a
+   row being accessed together (no column-wise traversal).
+
+   The same pass computes the products of v with the previous reflectors, from which the upper triangular
+   nrOfColumns x nrOfColumns matrix T (compact WY representation: H1 * H2 * ... = I - V * T * transpose(V)) is built.
+*/
+template <typename T>
+void runQRPanelDecomposition(size_t m, size_t firstColumnNr, size_t nrOfColumns, T* const* rows, T* triangularFactor)
+{
+    using std::sqrt;
+
+    const size_t c_PanelEnd{firstColumnNr + nrOfColumns};
+
+    // squared norm of the column elements located below the diagonal and their product with the next columns
+    T squaredNorm{};
+    std::vector<T> product(nrOfColumns);
+    std::vector<T> nextProduct(nrOfColumns);
+    std::vector<T> w(nrOfColumns);
+
+    // transpose(V) * v (previous reflectors)
+    std::vector<T> reflectorProducts(nrOfColumns);
+
+    auto accumulateColumn = [&squaredNorm, &nextProduct, c_PanelEnd](const T* pRow, size_t columnNr) {
+        const T c_Element{pRow[columnNr]};
+
+        squaredNorm += c_Element * c_Element;
+
+        for (size_t index{0}; index < c_PanelEnd - columnNr - 1; ++index)
+        {
+            nextProduct[index] += c_Element * pRow[columnNr + 1 + index];
+        }
+    };
+
+    std::fill_n(triangularFactor, nrOfColumns * nrOfColumns, T{});
+
+    for (size_t rowNr{firstColumnNr + 1}; rowNr < m; ++rowNr)
+    {
+        accumulateColumn(rows[rowNr], firstColumnNr);
+    }
+
+    for (size_t columnNr{firstColumnNr}; columnNr < c_PanelEnd; ++columnNr)
+    {
+        const size_t c_NextColumnNr{columnNr + 1};
+        const size_t c_NrOfRemainingColumns{c_PanelEnd - c_NextColumnNr};
+        const size_t c_NrOfPreviousColumns{columnNr - firstColumnNr};
+        const T c_Alpha{rows[columnNr][columnNr]};
+        const T c_SquaredNorm{squaredNorm};
+
+        product.swap(nextProduct);
+        std::fill(nextProduct.begin(), nextProduct.end(), T{});
+        squaredNorm = T{};
+
+        // the unit element of v
+        std::copy_n(rows[columnNr] + firstColumnNr, c_NrOfPreviousColumns, reflectorProducts.begin());
+
+        // null elements below the diagonal: no reflection required (H = I)
+        T tau{};
+
+        if (c_SquaredNorm > T{})
+        {
+            const T c_Beta{-std::copysign(sqrt(c_Alpha * c_Alpha + c_SquaredNorm), c_Alpha)};
+            const T c_Scale{T{1} / (c_Alpha - c_Beta)};
+
+            tau = (c_Beta - c_Alpha) / c_Beta;
+            rows[columnNr][columnNr] = c_Beta;
+
+            T* const pDiagonalRow{rows[columnNr] + c_NextColumnNr};
+
+            for (size_t index{0}; index < c_NrOfRemainingColumns; ++index)
+            {
+                w[index] = tau * (pDiagonalRow[index] + c_Scale * product[index]);
+                pDiagonalRow[index] -= w[index];
+            }
+
+            for (size_t rowNr{c_NextColumnNr}; rowNr < m; ++rowNr)
+            {
+                T* const pRow{rows[rowNr]};
+
+                pRow[columnNr] *= c_Scale;
+
+                const T c_VElement{pRow[columnNr]};
+
+                for (size_t index{0}; index < c_NrOfPreviousColumns; ++index)
+                {
+                    reflectorProducts[index] += pRow[firstColumnNr + index] * c_VElement;
+                }
+
+                for (size_t index{0}; index < c_NrOfRemainingColumns; ++index)
+                {
+                    pRow[c_NextColumnNr + index] -= c_VElement * w[index];
+                }
+
+                if (rowNr > c_NextColumnNr && c_NrOfRemainingColumns > 0)
+                {
+                    accumulateColumn(pRow, c_NextColumnNr);
+                }
+            }
+        }
+        else
+        {
+            for (size_t rowNr{c_NextColumnNr + 1}; rowNr < m && c_NrOfRemainingColumns > 0; ++rowNr)
+            {
+                accumulateColumn(rows[rowNr], c_NextColumnNr);
+            }
+        }
+
+        // T[0:i][i] = -tau * T[0:i][0:i] * transpose(V[0:i]) * v
+        for (size_t rowNr{0}; rowNr < c_NrOfPreviousColumns; ++rowNr)
+        {
+            const T* const pFactorRow{triangularFactor + rowNr * nrOfColumns};
+            T sum{};
+
+            for (size_t index{rowNr}; index < c_NrOfPreviousColumns; ++index)
+            {
+                sum += pFactorRow[index] * reflectorProducts[index];
+            }
+
+            triangularFactor[rowNr * nrOfColumns + c_NrOfPreviousColumns] = -tau * sum;
+        }
+
+        triangularFactor[c_NrOfPreviousColumns * nrOfColumns + c_NrOfPreviousColumns] = tau;
+    }
+}
+
+// row pointers of the reflectors matrix V of the panel starting at column firstColumnNr; its upper part (unit lower
+// triangular) shares the storage with R so it is copied into the provided buffer, the remaining rows are used in place
+template <typename T>
+std::vector<const T*> getReflectorRows(size_t m, size_t firstColumnNr, size_t nrOfColumns, const T* const* rows,
+                                       std::vector<T>& upperRowsBuffer)
+{
+    std::vector<const T*> reflectorRows(m - firstColumnNr);
+
+    upperRowsBuffer.assign(nrOfColumns * nrOfColumns, T{});
+
+    for (size_t rowNr{0}; rowNr < reflectorRows.size(); ++rowNr)
+    {
+        const T* const pRow{rows[firstColumnNr + rowNr] + firstColumnNr};
+
+        if (rowNr < nrOfColumns)
+        {
+            T* const pUpperRow{upperRowsBuffer.data() + rowNr * nrOfColumns};
+
+            std::copy_n(pRow, rowNr, pUpperRow);
+            pUpperRow[rowNr] = T{1};
+            reflectorRows[rowNr] = pUpperRow;
+        }
+        else
+        {
+            reflectorRows[rowNr] = pRow;
+        }
+    }
+
+    return reflectorRows;
+}
+
+// applies the block reflector I - V * T * transpose(V) (or its transpose) to the nrOfRows x nrOfColumns matrix c:
+// c = c - V * (T or transpose(T)) * (transpose(V) * c)
+template <typename T>
+void runBlockReflectorApplication(size_t nrOfRows, size_t nrOfReflectors, const T* const* reflectorRows,
+                                  const T* triangularFactor, bool isTransposed, size_t nrOfColumns, T* const* cRows)
+{
+    std::vector<T> work(nrOfReflectors * nrOfColumns);
+    std::vector<T*> workRows(nrOfReflectors);
+
+    for (size_t rowNr{0}; rowNr < nrOfReflectors; ++rowNr)
+    {
+        workRows[rowNr] = work.data() + rowNr * nrOfColumns;
+    }
+
+    runTransposedGemm<T>(nrOfReflectors, nrOfColumns, nrOfRows, reflectorRows, cRows, workRows.data());
+
+    // the triangular product is done in place, each row of the result only depends on rows not yet overwritten
+    auto addScaledRow = [nrOfColumns](T* pRow, const T& factor, const T* pAddedRow) {
+        for (size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+        {
+            pRow[columnNr] += factor * pAddedRow[columnNr];
+        }
+    };
+
+    auto scaleRow = [nrOfColumns](T* pRow, const T& factor) {
+        for (size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+        {
+            pRow[columnNr] *= factor;
+        }
+    };
+
+    if (isTransposed)
+    {
+        for (size_t rowNr{nrOfReflectors}; rowNr-- > 0;)
+        {
+            scaleRow(workRows[rowNr], triangularFactor[rowNr * nrOfReflectors + rowNr]);
+
+            for (size_t index{0}; index < rowNr; ++index)
+            {
+                addScaledRow(workRows[rowNr], triangularFactor[index * nrOfReflectors + rowNr], workRows[index]);
+            }
+        }
+    }
+    else
+    {
+        for (size_t rowNr{0}; rowNr < nrOfReflectors; ++rowNr)
+        {
+            scaleRow(workRows[rowNr], triangularFactor[rowNr * nrOfReflectors + rowNr]);
+
+            for (size_t index{rowNr + 1}; index < nrOfReflectors; ++index)
+            {
+                addScaledRow(workRows[rowNr], triangularFactor[rowNr * nrOfReflectors + index], workRows[index]);
+            }
+        }
+    }
+
+    runGemm<T>(nrOfRows, nrOfColumns, nrOfReflectors, T{-1}, reflectorRows, workRows.data(), T{1}, cRows);
+}
+
+/* Householder QR decomposition of the m x n (m >= n) matrix provided as row pointers: A = Q * R. R is stored in the
+   upper triangle and the reflectors defining Q in the lower one (see runQRPanelDecomposition()). The T matrixes of the
+   compact WY representation are stored within triangularFactors (one c_QRPanelWidth x c_QRPanelWidth block per
+   panel, the last one might be smaller), as they are required for applying Q afterwards.
+
+   After factorizing a panel the trailing columns are updated by the whole block reflector, which consists of two matrix
+   products (GEMM) instead of a pass over the rows for each reflector.
+*/
+template <typename T>
+void runQRDecomposition(size_t m, size_t n, T* const* rows, std::vector<T>& triangularFactors)
+{
+    const size_t c_NrOfPanels{(n + c_QRPanelWidth - 1) / c_QRPanelWidth};
+
+    std::vector<T> upperRowsBuffer;
+
+    triangularFactors.assign(c_NrOfPanels * c_QRPanelWidth * c_QRPanelWidth, T{});
+
+    for (size_t panelNr{0}; panelNr < c_NrOfPanels; ++panelNr)
+    {
+        const size_t c_FirstColumnNr{panelNr * c_QRPanelWidth};
+        const size_t c_PanelWidth{std::min(c_QRPanelWidth, n - c_FirstColumnNr)};
+        const size_t c_TrailingOffset{c_FirstColumnNr + c_PanelWidth};
+
+        T* const pTriangularFactor{triangularFactors.data() + panelNr * c_QRPanelWidth * c_QRPanelWidth};
+
+        runQRPanelDecomposition(m, c_FirstColumnNr, c_PanelWidth, rows, pTriangularFactor);
+
+        if (c_TrailingOffset < n)
+        {
+            const std::vector<const T*> c_ReflectorRows{
+                getReflectorRows<T>(m, c_FirstColumnNr, c_PanelWidth, rows, upperRowsBuffer)};
+            const std::vector<T*> c_TrailingRows{
+                getShiftedRows(rows + c_FirstColumnNr, m - c_FirstColumnNr, c_TrailingOffset)};
+
+            runBlockReflectorApplication(m - c_FirstColumnNr, c_PanelWidth, c_ReflectorRows.data(), pTriangularFactor,
+                                         true, n - c_TrailingOffset, c_TrailingRows.data());
+        }
+    }
+}
+
+// c = transpose(Q) * c, where c has m rows and nrOfColumns columns and Q is provided as the output of
+// runQRDecomposition()
+template <typename T>
+void runQTransposedApplication(size_t m, size_t n, const T* const* rows, const std::vector<T>& triangularFactors,
+                               size_t nrOfColumns, T* const* cRows)
+{
+    std::vector<T> upperRowsBuffer;
+
+    for (size_t firstColumnNr{0}; firstColumnNr < n; firstColumnNr += c_QRPanelWidth)
+    {
+        const size_t c_PanelWidth{std::min(c_QRPanelWidth, n - firstColumnNr)};
+        const std::vector<const T*> c_ReflectorRows{
+            getReflectorRows(m, firstColumnNr, c_PanelWidth, rows, upperRowsBuffer)};
+
+        runBlockReflectorApplication(m - firstColumnNr, c_PanelWidth, c_ReflectorRows.data(),
+                                     triangularFactors.data() + firstColumnNr * c_QRPanelWidth, true, nrOfColumns,
+                                     cRows + firstColumnNr);
+    }
+}
+
+// computes the first n columns of Q (economy size) into qRows (m x n), provided as the output of runQRDecomposition();
+// the reflectors are applied in reverse order to the first n columns of the identity matrix, each one only affecting
+// the columns starting with its own one
+template <typename T>
+void runQFormation(size_t m, size_t n, const T* const* rows, const std::vector<T>& triangularFactors, T* const* qRows)
+{
+    std::vector<T> upperRowsBuffer;
+
+    for (size_t rowNr{0}; rowNr < m; ++rowNr)
+    {
+        std::fill_n(qRows[rowNr], n, T{});
+
+        if (rowNr < n)
+        {
+            qRows[rowNr][rowNr] = T{1};
+        }
+    }
+
+    for (size_t panelNr{(n + c_QRPanelWidth - 1) / c_QRPanelWidth}; panelNr-- > 0;)
+    {
+        const size_t c_FirstColumnNr{panelNr * c_QRPanelWidth};
+        const size_t c_PanelWidth{std::min(c_QRPanelWidth, n - c_FirstColumnNr)};
+        const std::vector<const T*> c_ReflectorRows{
+            getReflectorRows(m, c_FirstColumnNr, c_PanelWidth, rows, upperRowsBuffer)};
+        const std::vector<T*> c_QRows{getShiftedRows(qRows + c_FirstColumnNr, m - c_FirstColumnNr, c_FirstColumnNr)};
+
+        runBlockReflectorApplication(m - c_FirstColumnNr, c_PanelWidth, c_ReflectorRows.data(),
+                                     triangularFactors.data() + panelNr * c_QRPanelWidth * c_QRPanelWidth, false,
+                                     n - c_FirstColumnNr, c_QRows.data());
+    }
+}
+} // namespace Matr
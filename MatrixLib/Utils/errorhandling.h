@@ -46,12 +46,25 @@ enum class Errors
     RESULT_NO_ROWS,
     RESULT_NO_COLUMNS,
     CURRENT_MATRIX_AS_ARGUMENT,
+    NULL_MATRIX_AS_ARGUMENT,
+    DUPLICATE_MATRIX_AS_ARGUMENT,
     EMPTY_MATRIX,
     DEREFERENCE_END_ITERATOR,
     INCOMPATIBLE_ITERATORS,
     DIAGONAL_INDEX_OUT_OF_BOUNDS,
     ITERATOR_INDEX_OUT_OF_BOUNDS,
-    MAX_ALLOWED_DIMENSIONS_EXCEEDED
+    MAX_ALLOWED_DIMENSIONS_EXCEEDED,
+    ELEMENTS_COUNT_NOT_MATCHING_DIMENSIONS,
+    POSITIONS_NOT_STRICTLY_ASCENDING,
+    INVALID_PERMUTATION,
+    BLOCK_OUT_OF_BOUNDS,
+    MATRIXES_INCOMPATIBLE_FOR_MULTIPLICATION,
+    RESULT_DIMENSIONS_NOT_MATCHING,
+    VECTOR_SIZE_NOT_MATCHING,
+    NON_SQUARE_MATRIX,
+    SINGULAR_MATRIX,
+    NOT_POSITIVE_DEFINITE_MATRIX,
+    INSUFFICIENT_NR_OF_ROWS
 };
 
 static std::map<Errors, std::string> errorMessages{
@@ -72,6 +85,9 @@ static std::map<Errors, std::string> errorMessages{
     {Errors::RESULT_NO_COLUMNS, std::string{"The resulting matrix has 0 columns"}},
     {Errors::CURRENT_MATRIX_AS_ARGUMENT,
      std::string{"The current matrix has been provided as argument. This is not allowed for this method."}},
+    {Errors::NULL_MATRIX_AS_ARGUMENT, std::string{"A null matrix has been provided as argument"}},
+    {Errors::DUPLICATE_MATRIX_AS_ARGUMENT,
+     std::string{"The same matrix has been provided more than once as argument. This is not allowed for this method."}},
     {Errors::EMPTY_MATRIX, std::string{"Illegal operation on empty matrix"}},
     {Errors::DEREFERENCE_END_ITERATOR, std::string{"Attempt to dereference an end iterator"}},
     {Errors::INCOMPATIBLE_ITERATORS, std::string{"The two iterators are incompatible, their matrix parameters differ"}},
@@ -79,6 +95,23 @@ static std::map<Errors, std::string> errorMessages{
      std::string{"The diagonal index used for obtaining the iterator is out of bounds"}},
     {Errors::ITERATOR_INDEX_OUT_OF_BOUNDS,
      std::string{"The index used for dereferencing the iterator is out of bounds"}},
-    {Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED, std::string{"The maximum allowed dimensions have been exceeded."}}};
+    {Errors::MAX_ALLOWED_DIMENSIONS_EXCEEDED, std::string{"The maximum allowed dimensions have been exceeded."}},
+    {Errors::ELEMENTS_COUNT_NOT_MATCHING_DIMENSIONS,
+     std::string{"The number of provided elements doesn't match the dimensions of the matrix"}},
+    {Errors::POSITIONS_NOT_STRICTLY_ASCENDING,
+     std::string{"The provided row/column positions are not in strictly ascending order"}},
+    {Errors::INVALID_PERMUTATION,
+     std::string{"The permutation should contain each row/column position of the matrix exactly once"}},
+    {Errors::BLOCK_OUT_OF_BOUNDS, std::string{"The referenced block exceeds the matrix bounds"}},
+    {Errors::MATRIXES_INCOMPATIBLE_FOR_MULTIPLICATION,
+     std::string{"The number of columns of the first matrix differs from the number of rows of the second matrix"}},
+    {Errors::RESULT_DIMENSIONS_NOT_MATCHING,
+     std::string{"The dimensions of the matrix receiving the result differ from the ones of the result"}},
+    {Errors::VECTOR_SIZE_NOT_MATCHING,
+     std::string{"The size of the vector differs from the matching dimension of the matrix"}},
+    {Errors::NON_SQUARE_MATRIX, std::string{"The operation requires a square matrix"}},
+    {Errors::SINGULAR_MATRIX, std::string{"The matrix is singular (not invertible)"}},
+    {Errors::NOT_POSITIVE_DEFINITE_MATRIX, std::string{"The matrix is not (symmetric) positive definite"}},
+    {Errors::INSUFFICIENT_NR_OF_ROWS, std::string{"The matrix should have at least as many rows as columns"}}};
 } // namespace Matr
 #endif
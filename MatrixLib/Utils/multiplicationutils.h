@@ -0,0 +1,726 @@
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "concurrencyutils.h"
+
+namespace Matr
+{
+template <typename T> struct GemmBlockSizes
+{
+    // micro-tile (register block): c_MR rows x c_NR columns of c
+    static constexpr size_t c_MR{4};
+    static constexpr size_t c_NR{8};
+
+    // packed block of a (c_MC x c_KC) should fit into the L2 cache, a packed micro-panel of b (c_KC x c_NR) into L1
+    static constexpr size_t c_KC{256};
+    static constexpr size_t c_MC{96};
+    static constexpr size_t c_NC{2048};
+
+    // below this number of multiply-add operations packing is not worth it
+    static constexpr size_t c_MinPackedOperationsCount{32 * 32 * 32};
+
+    // parallel execution: c is split into macro-tiles of (at most) c_MC rows x c_TaskNC columns, each one being
+    // computed by a single thread; below c_MinParallelOperationsCount starting the threads costs more than it saves
+    static constexpr size_t c_TaskNC{512};
+    static constexpr size_t c_MinParallelOperationsCount{64 * 64 * 64};
+};
+
+// scratch buffers for the packed a block and b panel (each thread needs its own ones), the sizes are rounded up to
+// whole micro-panels
+template <typename T> struct GemmPackingBuffers
+{
+    GemmPackingBuffers(size_t maxNrOfRows, size_t maxNrOfColumns, size_t maxNrOfIndexes);
+
+    std::vector<T> m_PackedA;
+    std::vector<T> m_PackedB;
+};
+
+// c rows are scaled by beta (or overwritten when there is no beta), then the alpha-scaled products are accumulated
+template <typename T>
+void runUnpackedGemm(size_t m, size_t n, size_t k, const std::optional<T>& alpha, const T* const* aRows,
+                     const T* const* bRows, const std::optional<T>& beta, T* const* cRows)
+{
+    for (size_t rowNr{0}; rowNr < m; ++rowNr)
+    {
+        T* const pCRow{cRows[rowNr]};
+
+        if (beta.has_value())
+        {
+            for (size_t columnNr{0}; columnNr < n; ++columnNr)
+            {
+                pCRow[columnNr] = *beta * pCRow[columnNr];
+            }
+        }
+        else
+        {
+            std::fill_n(pCRow, n, T{});
+        }
+
+        for (size_t index{0}; index < k; ++index)
+        {
+            const T c_AElement{alpha.has_value() ? static_cast<T>(*alpha * aRows[rowNr][index]) : aRows[rowNr][index]};
+            const T* const pBRow{bRows[index]};
+
+            for (size_t columnNr{0}; columnNr < n; ++columnNr)
+            {
+                pCRow[columnNr] += c_AElement * pBRow[columnNr];
+            }
+        }
+    }
+}
+
+// packs the a block starting at [rowOffset][indexOffset] as consecutive micro-panels of c_MR rows stored column by
+// column, the rows exceeding m are padded with zeros
+template <typename T>
+void packGemmA(size_t rowOffset, size_t indexOffset, size_t nrOfRows, size_t nrOfIndexes, const T* const* aRows,
+               T* pPacked)
+{
+    constexpr size_t c_MR{GemmBlockSizes<T>::c_MR};
+
+    for (size_t panelRowNr{0}; panelRowNr < nrOfRows; panelRowNr += c_MR)
+    {
+        const size_t c_PanelRowsCount{std::min(c_MR, nrOfRows - panelRowNr)};
+
+        for (size_t index{0}; index < nrOfIndexes; ++index)
+        {
+            size_t rowNr{0};
+
+            for (; rowNr < c_PanelRowsCount; ++rowNr)
+            {
+                pPacked[rowNr] = aRows[rowOffset + panelRowNr + rowNr][indexOffset + index];
+            }
+
+            for (; rowNr < c_MR; ++rowNr)
+            {
+                pPacked[rowNr] = T{};
+            }
+
+            pPacked += c_MR;
+        }
+    }
+}
+
+// packs the b panel starting at [indexOffset][columnOffset] as consecutive micro-panels of c_NR columns stored row by
+// row, the columns exceeding n are padded with zeros
+template <typename T>
+void packGemmB(size_t indexOffset, size_t columnOffset, size_t nrOfIndexes, size_t nrOfColumns, const T* const* bRows,
+               T* pPacked)
+{
+    constexpr size_t c_NR{GemmBlockSizes<T>::c_NR};
+
+    for (size_t panelColumnNr{0}; panelColumnNr < nrOfColumns; panelColumnNr += c_NR)
+    {
+        const size_t c_PanelColumnsCount{std::min(c_NR, nrOfColumns - panelColumnNr)};
+
+        for (size_t index{0}; index < nrOfIndexes; ++index)
+        {
+            const T* const pBRow{bRows[indexOffset + index] + columnOffset + panelColumnNr};
+
+            std::copy_n(pBRow, c_PanelColumnsCount, pPacked);
+            std::fill(pPacked + c_PanelColumnsCount, pPacked + c_NR, T{});
+
+            pPacked += c_NR;
+        }
+    }
+}
+
+// computes a c_MR x c_NR tile of the product out of a packed a micro-panel and a packed b micro-panel and adds it to c
+// (alpha-scaled); when isFirstBlock is true the tile is first scaled by beta or overwritten (no beta)
+template <typename T>
+void runGemmMicroKernel(size_t nrOfIndexes, const T* pPackedA, const T* pPackedB, size_t nrOfRows, size_t nrOfColumns,
+                        const std::optional<T>& alpha, const std::optional<T>& beta, bool isFirstBlock,
+                        T* const* cRows, size_t columnOffset)
+{
+    constexpr size_t c_MR{GemmBlockSizes<T>::c_MR};
+    constexpr size_t c_NR{GemmBlockSizes<T>::c_NR};
+
+    T accumulators[c_MR][c_NR]{};
+
+    for (size_t index{0}; index < nrOfIndexes; ++index)
+    {
+        for (size_t rowNr{0}; rowNr < c_MR; ++rowNr)
+        {
+            const T c_AElement{pPackedA[rowNr]};
+
+            for (size_t columnNr{0}; columnNr < c_NR; ++columnNr)
+            {
+                accumulators[rowNr][columnNr] += c_AElement * pPackedB[columnNr];
+            }
+        }
+
+        pPackedA += c_MR;
+        pPackedB += c_NR;
+    }
+
+    // only the part of the tile located within c is written back
+    for (size_t rowNr{0}; rowNr < nrOfRows; ++rowNr)
+    {
+        T* const pCRow{cRows[rowNr] + columnOffset};
+
+        for (size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+        {
+            const T c_Product{alpha.has_value() ? static_cast<T>(*alpha * accumulators[rowNr][columnNr])
+                                                : accumulators[rowNr][columnNr]};
+
+            if (!isFirstBlock)
+            {
+                pCRow[columnNr] += c_Product;
+            }
+            else if (beta.has_value())
+            {
+                pCRow[columnNr] = *beta * pCRow[columnNr] + c_Product;
+            }
+            else
+            {
+                pCRow[columnNr] = c_Product;
+            }
+        }
+    }
+}
+
+template <typename T>
+GemmPackingBuffers<T>::GemmPackingBuffers(size_t maxNrOfRows, size_t maxNrOfColumns, size_t maxNrOfIndexes)
+    : m_PackedA((maxNrOfRows + GemmBlockSizes<T>::c_MR - 1) / GemmBlockSizes<T>::c_MR * GemmBlockSizes<T>::c_MR *
+                maxNrOfIndexes)
+    , m_PackedB((maxNrOfColumns + GemmBlockSizes<T>::c_NR - 1) / GemmBlockSizes<T>::c_NR * GemmBlockSizes<T>::c_NR *
+                maxNrOfIndexes)
+{
+}
+
+// computes the c block of nrOfRows x nrOfColumns (at most c_NC) located at [rowOffset][columnOffset]
+template <typename T>
+void runPackedGemmBlock(size_t rowOffset, size_t nrOfRows, size_t columnOffset, size_t nrOfColumns, size_t k,
+                        const std::optional<T>& alpha, const T* const* aRows, const T* const* bRows,
+                        const std::optional<T>& beta, T* const* cRows, GemmPackingBuffers<T>& buffers)
+{
+    using BlockSizes = GemmBlockSizes<T>;
+
+    constexpr size_t c_MR{BlockSizes::c_MR};
+    constexpr size_t c_NR{BlockSizes::c_NR};
+    constexpr size_t c_MC{BlockSizes::c_MC};
+    constexpr size_t c_KC{BlockSizes::c_KC};
+
+    for (size_t indexOffset{0}; indexOffset < k; indexOffset += c_KC)
+    {
+        const size_t c_NrOfIndexes{std::min(c_KC, k - indexOffset)};
+        const bool c_IsFirstBlock{0 == indexOffset};
+
+        packGemmB(indexOffset, columnOffset, c_NrOfIndexes, nrOfColumns, bRows, buffers.m_PackedB.data());
+
+        for (size_t blockRowNr{0}; blockRowNr < nrOfRows; blockRowNr += c_MC)
+        {
+            const size_t c_NrOfBlockRows{std::min(c_MC, nrOfRows - blockRowNr)};
+
+            packGemmA(rowOffset + blockRowNr, indexOffset, c_NrOfBlockRows, c_NrOfIndexes, aRows,
+                      buffers.m_PackedA.data());
+
+            for (size_t tileColumnNr{0}; tileColumnNr < nrOfColumns; tileColumnNr += c_NR)
+            {
+                const T* const pPackedB{buffers.m_PackedB.data() + tileColumnNr * c_NrOfIndexes};
+
+                for (size_t tileRowNr{0}; tileRowNr < c_NrOfBlockRows; tileRowNr += c_MR)
+                {
+                    runGemmMicroKernel(c_NrOfIndexes, buffers.m_PackedA.data() + tileRowNr * c_NrOfIndexes, pPackedB,
+                                       std::min(c_MR, c_NrOfBlockRows - tileRowNr),
+                                       std::min(c_NR, nrOfColumns - tileColumnNr), alpha, beta, c_IsFirstBlock,
+                                       cRows + rowOffset + blockRowNr + tileRowNr, columnOffset + tileColumnNr);
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void runPackedGemm(size_t m, size_t n, size_t k, const std::optional<T>& alpha, const T* const* aRows,
+                   const T* const* bRows, const std::optional<T>& beta, T* const* cRows)
+{
+    using BlockSizes = GemmBlockSizes<T>;
+
+    const size_t c_NC{std::min(BlockSizes::c_NC, n)};
+    GemmPackingBuffers<T> buffers{std::min(BlockSizes::c_MC, m), c_NC, std::min(BlockSizes::c_KC, k)};
+
+    for (size_t columnOffset{0}; columnOffset < n; columnOffset += c_NC)
+    {
+        runPackedGemmBlock(0, m, columnOffset, std::min(c_NC, n - columnOffset), k, alpha, aRows, bRows, beta, cRows,
+                           buffers);
+    }
+}
+
+// the macro-tiles of c are handed out dynamically to the threads (a thread picks the next unprocessed tile once it
+// finished the previous one); consecutive tiles share the same b columns so they are likely to be found in the
+// shared cache
+template <typename T>
+void runParallelPackedGemm(size_t m, size_t n, size_t k, const std::optional<T>& alpha, const T* const* aRows,
+                           const T* const* bRows, const std::optional<T>& beta, T* const* cRows, size_t nrOfThreads)
+{
+    using BlockSizes = GemmBlockSizes<T>;
+
+    constexpr size_t c_TileRowsCount{BlockSizes::c_MC};
+    constexpr size_t c_MinTileColumnsCount{4 * BlockSizes::c_NR};
+
+    const size_t c_NrOfTileRows{(m + c_TileRowsCount - 1) / c_TileRowsCount};
+    size_t tileColumnsCount{BlockSizes::c_TaskNC};
+
+    // narrower tiles for smaller products so each thread gets a few of them (better load balancing)
+    while (tileColumnsCount > c_MinTileColumnsCount &&
+           c_NrOfTileRows * ((n + tileColumnsCount - 1) / tileColumnsCount) < 4 * nrOfThreads)
+    {
+        tileColumnsCount /= 2;
+    }
+
+    const size_t c_NrOfTileColumns{(n + tileColumnsCount - 1) / tileColumnsCount};
+    const size_t c_NrOfTiles{c_NrOfTileRows * c_NrOfTileColumns};
+
+    std::atomic<size_t> nextTileNr{0};
+
+    runOnThreads(std::min(nrOfThreads, c_NrOfTiles), [&, tileColumnsCount](size_t) {
+        GemmPackingBuffers<T> buffers{std::min(c_TileRowsCount, m), std::min(tileColumnsCount, n),
+                                      std::min(BlockSizes::c_KC, k)};
+
+        for (size_t tileNr{nextTileNr++}; tileNr < c_NrOfTiles; tileNr = nextTileNr++)
+        {
+            const size_t c_RowOffset{(tileNr % c_NrOfTileRows) * c_TileRowsCount};
+            const size_t c_ColumnOffset{(tileNr / c_NrOfTileRows) * tileColumnsCount};
+
+            runPackedGemmBlock(c_RowOffset, std::min(c_TileRowsCount, m - c_RowOffset), c_ColumnOffset,
+                               std::min(tileColumnsCount, n - c_ColumnOffset), k, alpha, aRows, bRows, beta, cRows,
+                               buffers);
+        }
+    });
+}
+
+// the rows of c are split into groups that are computed by the unpacked algorithm, each group by a single thread
+template <typename T>
+void runParallelUnpackedGemm(size_t m, size_t n, size_t k, const std::optional<T>& alpha, const T* const* aRows,
+                             const T* const* bRows, const std::optional<T>& beta, T* const* cRows, size_t nrOfThreads)
+{
+    const size_t c_RowsPerTask{std::max<size_t>(m / (4 * nrOfThreads), 1)};
+    const size_t c_NrOfTasks{(m + c_RowsPerTask - 1) / c_RowsPerTask};
+
+    runTasks(c_NrOfTasks, nrOfThreads, [=](size_t taskNr) {
+        const size_t c_RowOffset{taskNr * c_RowsPerTask};
+
+        runUnpackedGemm(std::min(c_RowsPerTask, m - c_RowOffset), n, k, alpha, aRows + c_RowOffset, bRows, beta,
+                        cRows + c_RowOffset);
+    });
+}
+
+// dot product of two arrays: for arithmetic types several independent partial sums are used, so the loop can be
+// vectorized (the compiler is not allowed to reorder a single floating point accumulation chain by itself)
+template <typename T> T computeDotProduct(const T* pFirst, const T* pSecond, size_t count)
+{
+    T result{};
+    size_t index{0};
+
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    {
+        constexpr size_t c_NrOfPartialSums{8};
+
+        T partialSums[c_NrOfPartialSums]{};
+
+        for (; index + c_NrOfPartialSums <= count; index += c_NrOfPartialSums)
+        {
+            for (size_t sumNr{0}; sumNr < c_NrOfPartialSums; ++sumNr)
+            {
+                partialSums[sumNr] += pFirst[index + sumNr] * pSecond[index + sumNr];
+            }
+        }
+
+        for (size_t sumNr{0}; sumNr < c_NrOfPartialSums; ++sumNr)
+        {
+            result += partialSums[sumNr];
+        }
+    }
+
+    for (; index < count; ++index)
+    {
+        result += pFirst[index] * pSecond[index];
+    }
+
+    return result;
+}
+
+// y = alpha * a * x + beta * y (a is m x n, each row is streamed once); no alpha/beta has the same meaning as for GEMM
+template <typename T>
+void runMatrixVectorProduct(size_t m, size_t n, const std::optional<T>& alpha, const T* const* aRows, const T* x,
+                            const std::optional<T>& beta, T* y)
+{
+    for (size_t rowNr{0}; rowNr < m; ++rowNr)
+    {
+        const T c_DotProduct{computeDotProduct(aRows[rowNr], x, n)};
+        T result{alpha.has_value() ? static_cast<T>(*alpha * c_DotProduct) : c_DotProduct};
+
+        if (beta.has_value())
+        {
+            result += *beta * y[rowNr];
+        }
+
+        y[rowNr] = std::move(result);
+    }
+}
+
+// y = x * a (a is m x n): the scaled rows of a are accumulated into y, so a is traversed row by row (no strided column
+// access); for arithmetic types four rows are accumulated at once to reduce the number of y loads/stores
+template <typename T> void runVectorMatrixProduct(size_t m, size_t n, const T* x, const T* const* aRows, T* y)
+{
+    std::fill_n(y, n, T{});
+
+    size_t rowNr{0};
+
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    {
+        for (; rowNr + 4 <= m; rowNr += 4)
+        {
+            const T* const pFirstRow{aRows[rowNr]};
+            const T* const pSecondRow{aRows[rowNr + 1]};
+            const T* const pThirdRow{aRows[rowNr + 2]};
+            const T* const pFourthRow{aRows[rowNr + 3]};
+
+            for (size_t columnNr{0}; columnNr < n; ++columnNr)
+            {
+                y[columnNr] += x[rowNr] * pFirstRow[columnNr] + x[rowNr + 1] * pSecondRow[columnNr] +
+                               x[rowNr + 2] * pThirdRow[columnNr] + x[rowNr + 3] * pFourthRow[columnNr];
+            }
+        }
+    }
+
+    for (; rowNr < m; ++rowNr)
+    {
+        const T* const pRow{aRows[rowNr]};
+
+        for (size_t columnNr{0}; columnNr < n; ++columnNr)
+        {
+            y[columnNr] += x[rowNr] * pRow[columnNr];
+        }
+    }
+}
+
+/* Matrix multiplication (GEMM): c = alpha * a * b + beta * c, where a is m x k, b is k x n and c is m x n. Each matrix
+   is provided as an array of row pointers (as stored within the Matrix class). No alpha means no scaling of the
+   product and no beta means that c is overwritten without reading its initial content.
+
+   For arithmetic types the product is computed blockwise (BLIS-style): a k x n panel of b and a m x k block of a are
+   packed into contiguous buffers that fit into the caches and a register-blocked micro-kernel computes the c tiles from
+   them. The micro-kernel loops have compile-time trip counts so the compiler can keep the accumulators in (vector)
+   registers. For the other types (or for very small matrixes) a cache-friendly row-oriented loop is used instead.
+
+   With more than one thread c is partitioned into disjoint parts (macro-tiles or groups of rows) which are computed
+   independently, so no synchronization is required except for picking the next part.
+*/
+template <typename T>
+void runGemm(size_t m, size_t n, size_t k, const std::optional<T>& alpha, const T* const* aRows, const T* const* bRows,
+             const std::optional<T>& beta, T* const* cRows, size_t nrOfThreads = 1)
+{
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    {
+        const size_t c_OperationsCount{m * n * k};
+
+        if (nrOfThreads > 1 && c_OperationsCount >= GemmBlockSizes<T>::c_MinParallelOperationsCount)
+        {
+            runParallelPackedGemm(m, n, k, alpha, aRows, bRows, beta, cRows, nrOfThreads);
+        }
+        else if (c_OperationsCount >= GemmBlockSizes<T>::c_MinPackedOperationsCount)
+        {
+            runPackedGemm(m, n, k, alpha, aRows, bRows, beta, cRows);
+        }
+        else
+        {
+            runUnpackedGemm(m, n, k, alpha, aRows, bRows, beta, cRows);
+        }
+    }
+    else if (nrOfThreads > 1 && m > 1)
+    {
+        runParallelUnpackedGemm(m, n, k, alpha, aRows, bRows, beta, cRows, nrOfThreads);
+    }
+    else
+    {
+        runUnpackedGemm(m, n, k, alpha, aRows, bRows, beta, cRows);
+    }
+}
+
+// c = transpose(a) * b, where a is k x m and b is k x n (c is m x n and gets overwritten); the rows of a are
+// transposed chunk by chunk into a buffer, so the GEMM kernel can be used without transposing a as a whole
+template <typename T>
+void runTransposedGemm(size_t m, size_t n, size_t k, const T* const* aRows, const T* const* bRows, T* const* cRows)
+{
+    const size_t c_ChunkSize{std::min(GemmBlockSizes<T>::c_KC, k)};
+
+    std::vector<T> transposedChunk(m * c_ChunkSize);
+    std::vector<const T*> transposedChunkRows(m);
+
+    for (size_t indexOffset{0}; indexOffset < k; indexOffset += c_ChunkSize)
+    {
+        const size_t c_NrOfIndexes{std::min(c_ChunkSize, k - indexOffset)};
+
+        for (size_t rowNr{0}; rowNr < m; ++rowNr)
+        {
+            T* const pTransposedRow{transposedChunk.data() + rowNr * c_NrOfIndexes};
+
+            for (size_t index{0}; index < c_NrOfIndexes; ++index)
+            {
+                pTransposedRow[index] = aRows[indexOffset + index][rowNr];
+            }
+
+            transposedChunkRows[rowNr] = pTransposedRow;
+        }
+
+        runGemm<T>(m, n, c_NrOfIndexes, std::nullopt, transposedChunkRows.data(), bRows + indexOffset,
+                   0 == indexOffset ? std::nullopt : std::optional<T>{T{1}}, cRows);
+    }
+}
+
+// Strassen-Winograd multiplication: the recursion stops once one of the dimensions of the (sub)product is not larger
+// than the threshold, the remaining products being computed by the GEMM kernel
+constexpr size_t c_DefaultStrassenThreshold{512};
+
+// block of a matrix provided as row pointers, element [rowNr][columnNr] of the block being located at
+// rows[rowNr][columnOffset + columnNr] (no data is owned, the blocks of a block are obtained by shifting the pointers)
+template <typename T> struct StrassenBlock
+{
+    StrassenBlock getSubBlock(size_t rowOffset, size_t columnOffset) const;
+    T* getRow(size_t rowNr) const;
+
+    T* const* m_Rows;
+    size_t m_ColumnOffset;
+};
+
+/* Scratch memory for the whole recursion, allocated once before starting it: each recursion level needs two
+   temporaries, X (m / 2 x max(k / 2, n / 2)) for the sums of a blocks and for a product, respectively Y (k / 2 x n / 2)
+   for the sums of b blocks, where m x k and k x n are the dimensions of the factors at the given level. The levels are
+   executed one after the other so the temporaries of a level are re-used by all its sub-products.
+
+   The GEMM kernel expects rows without column offset, so the row pointers of the blocks passed to it are stored into
+   the three arrays reserved for this purpose (big enough for the top-level product).
+*/
+template <typename T> struct StrassenScratchArena
+{
+    StrassenScratchArena(size_t m, size_t n, size_t k, size_t threshold);
+
+    std::vector<T> m_Elements;
+    std::vector<T*> m_Rows;
+    std::vector<StrassenBlock<T>> m_Temporaries; // [2 * levelNr]: X, [2 * levelNr + 1]: Y
+
+    std::vector<const T*> m_GemmARows;
+    std::vector<const T*> m_GemmBRows;
+    std::vector<T*> m_GemmCRows;
+};
+
+inline bool isStrassenRecursionRequired(size_t m, size_t n, size_t k, size_t threshold)
+{
+    const size_t c_Threshold{std::max<size_t>(threshold, 1)};
+
+    return m > c_Threshold && n > c_Threshold && k > c_Threshold;
+}
+
+template <typename T>
+StrassenBlock<T> StrassenBlock<T>::getSubBlock(size_t rowOffset, size_t columnOffset) const
+{
+    return {m_Rows + rowOffset, m_ColumnOffset + columnOffset};
+}
+
+template <typename T> T* StrassenBlock<T>::getRow(size_t rowNr) const
+{
+    return m_Rows[rowNr] + m_ColumnOffset;
+}
+
+template <typename T>
+StrassenScratchArena<T>::StrassenScratchArena(size_t m, size_t n, size_t k, size_t threshold)
+    : m_GemmARows(m)
+    , m_GemmBRows(k)
+    , m_GemmCRows(m)
+{
+    std::vector<size_t> temporaryDimensions; // (rows, columns) for each temporary
+    size_t nrOfElements{0};
+    size_t nrOfRows{0};
+
+    for (; isStrassenRecursionRequired(m, n, k, threshold); m /= 2, n /= 2, k /= 2)
+    {
+        temporaryDimensions.insert(temporaryDimensions.end(), {m / 2, std::max(k / 2, n / 2), k / 2, n / 2});
+        nrOfElements += m / 2 * std::max(k / 2, n / 2) + k / 2 * n / 2;
+        nrOfRows += m / 2 + k / 2;
+    }
+
+    m_Elements.resize(nrOfElements);
+    m_Rows.resize(nrOfRows);
+    m_Temporaries.reserve(temporaryDimensions.size() / 2);
+
+    T* pElement{m_Elements.data()};
+    T** pRow{m_Rows.data()};
+
+    for (size_t temporaryNr{0}; temporaryNr < temporaryDimensions.size() / 2; ++temporaryNr)
+    {
+        const size_t c_NrOfRows{temporaryDimensions[2 * temporaryNr]};
+        const size_t c_NrOfColumns{temporaryDimensions[2 * temporaryNr + 1]};
+
+        m_Temporaries.push_back({pRow, 0});
+
+        for (size_t rowNr{0}; rowNr < c_NrOfRows; ++rowNr)
+        {
+            *pRow++ = pElement;
+            pElement += c_NrOfColumns;
+        }
+    }
+}
+
+// result = first + second respectively first - second (m x n blocks), result might be one of the operands
+template <typename T, typename First, typename Second>
+void addStrassenBlocks(size_t m, size_t n, const First& first, const Second& second, bool isSubtraction,
+                       const StrassenBlock<T>& result)
+{
+    for (size_t rowNr{0}; rowNr < m; ++rowNr)
+    {
+        const T* const pFirstRow{first.getRow(rowNr)};
+        const T* const pSecondRow{second.getRow(rowNr)};
+        T* const pResultRow{result.getRow(rowNr)};
+
+        if (isSubtraction)
+        {
+            for (size_t columnNr{0}; columnNr < n; ++columnNr)
+            {
+                pResultRow[columnNr] = pFirstRow[columnNr] - pSecondRow[columnNr];
+            }
+        }
+        else
+        {
+            for (size_t columnNr{0}; columnNr < n; ++columnNr)
+            {
+                pResultRow[columnNr] = pFirstRow[columnNr] + pSecondRow[columnNr];
+            }
+        }
+    }
+}
+
+// c = a * b + beta * c computed by the GEMM kernel (no beta: c is overwritten)
+template <typename T>
+void runStrassenLeafGemm(size_t m, size_t n, size_t k, const StrassenBlock<const T>& a, const StrassenBlock<const T>& b,
+                         const std::optional<T>& beta, const StrassenBlock<T>& c, StrassenScratchArena<T>& arena,
+                         size_t nrOfThreads)
+{
+    for (size_t rowNr{0}; rowNr < m; ++rowNr)
+    {
+        arena.m_GemmARows[rowNr] = a.getRow(rowNr);
+        arena.m_GemmCRows[rowNr] = c.getRow(rowNr);
+    }
+
+    for (size_t index{0}; index < k; ++index)
+    {
+        arena.m_GemmBRows[index] = b.getRow(index);
+    }
+
+    runGemm<T>(m, n, k, std::nullopt, arena.m_GemmARows.data(), arena.m_GemmBRows.data(), beta,
+               arena.m_GemmCRows.data(), nrOfThreads);
+}
+
+/* c = a * b (c is overwritten), where a is m x k and b is k x n. The even part of the product is split into 2 x 2
+   blocks and computed by the Winograd variant of the Strassen algorithm (7 block products and 15 block additions
+   instead of 8 block products). The schedule keeps all intermediate results within the c blocks and the two
+   temporaries of the recursion level:
+
+   S1 = A21 + A22, S2 = S1 - A11, S3 = A11 - A21, S4 = A12 - S2 (in X)
+   T1 = B12 - B11, T2 = B22 - T1, T3 = B22 - B12, T4 = T2 - B21 (in Y)
+   P1 = A11 * B11 (in X), P2 = A12 * B21, P3 = S4 * B22, P4 = A22 * T4, P5 = S1 * T1, P6 = S2 * T2, P7 = S3 * T3
+   C11 = P1 + P2, C12 = P1 + P6 + P5 + P3, C21 = P1 + P6 + P7 - P4, C22 = P1 + P6 + P7 + P5
+
+   When a dimension is odd, the last row/column/index is handled separately by the GEMM kernel (dynamic peeling).
+*/
+template <typename T>
+void runStrassenProduct(size_t m, size_t n, size_t k, const StrassenBlock<const T>& a, const StrassenBlock<const T>& b,
+                        const StrassenBlock<T>& c, size_t levelNr, StrassenScratchArena<T>& arena, size_t threshold,
+                        size_t nrOfThreads)
+{
+    if (!isStrassenRecursionRequired(m, n, k, threshold))
+    {
+        runStrassenLeafGemm<T>(m, n, k, a, b, std::nullopt, c, arena, nrOfThreads);
+        return;
+    }
+
+    const size_t c_M{m / 2};
+    const size_t c_N{n / 2};
+    const size_t c_K{k / 2};
+
+    const StrassenBlock<const T> c_A11{a};
+    const StrassenBlock<const T> c_A12{a.getSubBlock(0, c_K)};
+    const StrassenBlock<const T> c_A21{a.getSubBlock(c_M, 0)};
+    const StrassenBlock<const T> c_A22{a.getSubBlock(c_M, c_K)};
+
+    const StrassenBlock<const T> c_B11{b};
+    const StrassenBlock<const T> c_B12{b.getSubBlock(0, c_N)};
+    const StrassenBlock<const T> c_B21{b.getSubBlock(c_K, 0)};
+    const StrassenBlock<const T> c_B22{b.getSubBlock(c_K, c_N)};
+
+    const StrassenBlock<T> c_C11{c};
+    const StrassenBlock<T> c_C12{c.getSubBlock(0, c_N)};
+    const StrassenBlock<T> c_C21{c.getSubBlock(c_M, 0)};
+    const StrassenBlock<T> c_C22{c.getSubBlock(c_M, c_N)};
+
+    const StrassenBlock<T> c_X{arena.m_Temporaries[2 * levelNr]};
+    const StrassenBlock<T> c_Y{arena.m_Temporaries[2 * levelNr + 1]};
+    const StrassenBlock<const T> c_ConstX{c_X.m_Rows, c_X.m_ColumnOffset};
+    const StrassenBlock<const T> c_ConstY{c_Y.m_Rows, c_Y.m_ColumnOffset};
+
+    auto multiplyBlocks = [c_M, c_N, c_K, levelNr, &arena, threshold, nrOfThreads](
+                              const StrassenBlock<const T>& first, const StrassenBlock<const T>& second,
+                              const StrassenBlock<T>& result) {
+        runStrassenProduct<T>(c_M, c_N, c_K, first, second, result, levelNr + 1, arena, threshold, nrOfThreads);
+    };
+
+    addStrassenBlocks<T>(c_M, c_K, c_A11, c_A21, true, c_X);    // S3
+    addStrassenBlocks<T>(c_K, c_N, c_B22, c_B12, true, c_Y);    // T3
+    multiplyBlocks(c_ConstX, c_ConstY, c_C21);                  // P7
+    addStrassenBlocks<T>(c_M, c_K, c_A21, c_A22, false, c_X);   // S1
+    addStrassenBlocks<T>(c_K, c_N, c_B12, c_B11, true, c_Y);    // T1
+    multiplyBlocks(c_ConstX, c_ConstY, c_C22);                  // P5
+    addStrassenBlocks<T>(c_M, c_K, c_X, c_A11, true, c_X);      // S2
+    addStrassenBlocks<T>(c_K, c_N, c_B22, c_Y, true, c_Y);      // T2
+    multiplyBlocks(c_ConstX, c_ConstY, c_C12);                  // P6
+    addStrassenBlocks<T>(c_M, c_K, c_A12, c_X, true, c_X);      // S4
+    multiplyBlocks(c_ConstX, c_B22, c_C11);                     // P3
+    multiplyBlocks(c_A11, c_B11, c_X);                          // P1
+    addStrassenBlocks<T>(c_M, c_N, c_X, c_C12, false, c_C12);   // P1 + P6
+    addStrassenBlocks<T>(c_M, c_N, c_C12, c_C21, false, c_C21); // P1 + P6 + P7
+    addStrassenBlocks<T>(c_M, c_N, c_C12, c_C22, false, c_C12); // P1 + P6 + P5
+    addStrassenBlocks<T>(c_M, c_N, c_C21, c_C22, false, c_C22); // C22
+    addStrassenBlocks<T>(c_M, c_N, c_C12, c_C11, false, c_C12); // C12
+    addStrassenBlocks<T>(c_K, c_N, c_Y, c_B21, true, c_Y);      // T4
+    multiplyBlocks(c_A22, c_ConstY, c_C11);                     // P4
+    addStrassenBlocks<T>(c_M, c_N, c_C21, c_C11, true, c_C21);  // C21
+    multiplyBlocks(c_A12, c_B21, c_C11);                        // P2
+    addStrassenBlocks<T>(c_M, c_N, c_X, c_C11, false, c_C11);   // C11
+
+    const size_t c_EvenM{2 * c_M};
+    const size_t c_EvenN{2 * c_N};
+    const size_t c_EvenK{2 * c_K};
+
+    if (k > c_EvenK)
+    {
+        runStrassenLeafGemm<T>(c_EvenM, c_EvenN, 1, a.getSubBlock(0, c_EvenK), b.getSubBlock(c_EvenK, 0), T{1}, c,
+                               arena, nrOfThreads);
+    }
+
+    if (n > c_EvenN)
+    {
+        runStrassenLeafGemm<T>(c_EvenM, 1, k, a, b.getSubBlock(0, c_EvenN), std::nullopt, c.getSubBlock(0, c_EvenN),
+                               arena, nrOfThreads);
+    }
+
+    if (m > c_EvenM)
+    {
+        runStrassenLeafGemm<T>(1, n, k, a.getSubBlock(c_EvenM, 0), b, std::nullopt, c.getSubBlock(c_EvenM, 0), arena,
+                               nrOfThreads);
+    }
+}
+
+// c = a * b (c is overwritten) computed by the Strassen-Winograd algorithm, see above
+template <typename T>
+void runStrassenGemm(size_t m, size_t n, size_t k, const T* const* aRows, const T* const* bRows, T* const* cRows,
+                     size_t threshold, size_t nrOfThreads = 1)
+{
+    StrassenScratchArena<T> arena{m, n, k, threshold};
+
+    runStrassenProduct<T>(m, n, k, {aRows, 0}, {bRows, 0}, {cRows, 0}, 0, arena, threshold, nrOfThreads);
+}
+} // namespace Matr
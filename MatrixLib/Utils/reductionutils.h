@@ -0,0 +1,249 @@
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "concurrencyutils.h"
+
+namespace Matr
+{
+// type of the mean values: integral elements are averaged as double
+template <typename T> using MeanType = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+// operations used by the predefined reductions
+struct MinimumOperation
+{
+    template <typename T> T operator()(const T& first, const T& second) const
+    {
+        return second < first ? second : first;
+    }
+};
+
+struct MaximumOperation
+{
+    template <typename T> T operator()(const T& first, const T& second) const
+    {
+        return first < second ? second : first;
+    }
+};
+
+// result = operation(...operation(operation(init, element0), element1)..., lastElement), same order as the elements
+template <typename Result, typename T, typename Operation>
+Result reduceElements(const T* pFirst, size_t count, Result init, const Operation& operation)
+{
+    for (size_t index{0}; index < count; ++index)
+    {
+        init = operation(std::move(init), pFirst[index]);
+    }
+
+    return init;
+}
+
+// reduction of (at least one) contiguous elements by an associative and commutative operation (sum, minimum, maximum):
+// for arithmetic types several independent partial results are used, so the loop can be vectorized (the compiler is
+// not allowed to reorder a single floating point chain by itself)
+template <typename Result, typename T, typename Operation>
+Result reduceElementsUnordered(const T* pFirst, size_t count, const Operation& operation)
+{
+    constexpr size_t c_NrOfPartialResults{8};
+
+    Result result{static_cast<Result>(pFirst[0])};
+    size_t index{1};
+
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        if (count >= 2 * c_NrOfPartialResults)
+        {
+            Result partialResults[c_NrOfPartialResults];
+
+            for (size_t resultNr{0}; resultNr < c_NrOfPartialResults; ++resultNr)
+            {
+                partialResults[resultNr] = static_cast<Result>(pFirst[resultNr]);
+            }
+
+            for (index = c_NrOfPartialResults; index + c_NrOfPartialResults <= count; index += c_NrOfPartialResults)
+            {
+                for (size_t resultNr{0}; resultNr < c_NrOfPartialResults; ++resultNr)
+                {
+                    partialResults[resultNr] =
+                        operation(partialResults[resultNr], static_cast<Result>(pFirst[index + resultNr]));
+                }
+            }
+
+            result = partialResults[0];
+
+            for (size_t resultNr{1}; resultNr < c_NrOfPartialResults; ++resultNr)
+            {
+                result = operation(result, partialResults[resultNr]);
+            }
+        }
+    }
+
+    for (; index < count; ++index)
+    {
+        result = operation(result, static_cast<Result>(pFirst[index]));
+    }
+
+    return result;
+}
+
+// executes job(threadNr, firstRowNr, endRowNr) on each thread for a contiguous range of rows (the ranges have almost
+// equal sizes and follow the order of the thread numbers)
+template <typename Job> void runOnRowRanges(size_t m, size_t nrOfThreads, const Job& job)
+{
+    const size_t c_NrOfThreads{std::max<size_t>(std::min(nrOfThreads, m), 1)};
+
+    runOnThreads(c_NrOfThreads, [m, c_NrOfThreads, &job](size_t threadNr) {
+        job(threadNr, threadNr * m / c_NrOfThreads, (threadNr + 1) * m / c_NrOfThreads);
+    });
+}
+
+// result[rowNr] = rowReduction(rows[rowNr]) for each of the m rows, the rows being distributed among threads
+template <typename Result, typename T, typename RowReduction>
+std::vector<Result> runRowReduction(size_t m, const T* const* rows, size_t nrOfThreads,
+                                    const RowReduction& rowReduction)
+{
+    std::vector<Result> result(m);
+
+    runOnRowRanges(m, nrOfThreads, [rows, &result, &rowReduction](size_t, size_t firstRowNr, size_t endRowNr) {
+        for (size_t rowNr{firstRowNr}; rowNr < endRowNr; ++rowNr)
+        {
+            result[rowNr] = rowReduction(rows[rowNr]);
+        }
+    });
+
+    return result;
+}
+
+// result[columnNr] = operation(result[columnNr], row[columnNr]) for each of the nrOfRows rows, so the elements are
+// accessed in storage order (no strided column traversal); for arithmetic types four rows are accumulated at once to
+// reduce the number of result loads/stores
+template <typename Result, typename T, typename Operation>
+void accumulateRows(size_t n, const T* const* rows, size_t nrOfRows, const Operation& operation, Result* result)
+{
+    size_t rowNr{0};
+
+    if constexpr (std::is_arithmetic_v<T> && std::is_arithmetic_v<Result>)
+    {
+        for (; rowNr + 4 <= nrOfRows; rowNr += 4)
+        {
+            const T* const pFirstRow{rows[rowNr]};
+            const T* const pSecondRow{rows[rowNr + 1]};
+            const T* const pThirdRow{rows[rowNr + 2]};
+            const T* const pFourthRow{rows[rowNr + 3]};
+
+            for (size_t columnNr{0}; columnNr < n; ++columnNr)
+            {
+                result[columnNr] = operation(
+                    operation(operation(operation(result[columnNr], static_cast<Result>(pFirstRow[columnNr])),
+                                        static_cast<Result>(pSecondRow[columnNr])),
+                              static_cast<Result>(pThirdRow[columnNr])),
+                    static_cast<Result>(pFourthRow[columnNr]));
+            }
+        }
+    }
+
+    for (; rowNr < nrOfRows; ++rowNr)
+    {
+        const T* const pRow{rows[rowNr]};
+
+        for (size_t columnNr{0}; columnNr < n; ++columnNr)
+        {
+            result[columnNr] = operation(std::move(result[columnNr]), static_cast<Result>(pRow[columnNr]));
+        }
+    }
+}
+
+/* Reduction of each column of the m x n matrix (m > 0) provided as row pointers: the columns are reduced together
+   while walking the rows, the (partial) results being accumulated into a vector. The first reduced value of each column
+   is init (when provided) or else the element on the first row.
+
+   For parallel execution each thread reduces a contiguous range of rows into its own vector, then the vectors are
+   combined in the order of the rows, so the operation should be associative. Only the first range starts with init.
+*/
+template <typename Result, typename T, typename Operation>
+std::vector<Result> runColumnReduction(size_t m, size_t n, const T* const* rows, const Operation& operation,
+                                       const std::optional<Result>& init, size_t nrOfThreads)
+{
+    const size_t c_NrOfThreads{std::max<size_t>(std::min(nrOfThreads, m), 1)};
+
+    std::vector<std::vector<Result>> partialResults(c_NrOfThreads);
+
+    runOnRowRanges(m, c_NrOfThreads, [&](size_t threadNr, size_t firstRowNr, size_t endRowNr) {
+        std::vector<Result>& partialResult{partialResults[threadNr]};
+
+        if (0 == threadNr && init.has_value())
+        {
+            partialResult.assign(n, *init);
+        }
+        else
+        {
+            partialResult.reserve(n);
+
+            for (size_t columnNr{0}; columnNr < n; ++columnNr)
+            {
+                partialResult.push_back(static_cast<Result>(rows[firstRowNr][columnNr]));
+            }
+
+            ++firstRowNr;
+        }
+
+        accumulateRows(n, rows + firstRowNr, endRowNr - firstRowNr, operation, partialResult.data());
+    });
+
+    std::vector<Result> result{std::move(partialResults[0])};
+
+    for (size_t threadNr{1}; threadNr < c_NrOfThreads; ++threadNr)
+    {
+        for (size_t columnNr{0}; columnNr < n; ++columnNr)
+        {
+            result[columnNr] = operation(std::move(result[columnNr]), partialResults[threadNr][columnNr]);
+        }
+    }
+
+    return result;
+}
+
+// sums of all m + n - 1 diagonals (numbered as for D-Iterators, the sum of diagonal diagonalNr being located at index
+// diagonalNr + m - 1) within a single row-major pass: the elements of row rowNr belong to consecutive diagonals,
+// starting with diagonal -rowNr, so each row is added as a whole to a contiguous range of sums (vectorizable)
+template <typename T> std::vector<T> computeDiagonalSums(size_t m, size_t n, const T* const* rows)
+{
+    std::vector<T> result(m + n - 1);
+
+    for (size_t rowNr{0}; rowNr < m; ++rowNr)
+    {
+        const T* const pRow{rows[rowNr]};
+        T* const pSums{result.data() + (m - 1 - rowNr)};
+
+        for (size_t columnNr{0}; columnNr < n; ++columnNr)
+        {
+            pSums[columnNr] += pRow[columnNr];
+        }
+    }
+
+    return result;
+}
+
+// same for the anti-diagonals, numbered as for M-Iterators (element [rowNr][columnNr] belongs to diagonal
+// n - 1 - columnNr - rowNr): each row is added in reverse order to a contiguous range of sums
+template <typename T> std::vector<T> computeAntiDiagonalSums(size_t m, size_t n, const T* const* rows)
+{
+    std::vector<T> result(m + n - 1);
+
+    for (size_t rowNr{0}; rowNr < m; ++rowNr)
+    {
+        const T* const pRow{rows[rowNr]};
+        T* const pSums{result.data() + (m - 1 - rowNr)};
+
+        for (size_t columnNr{0}; columnNr < n; ++columnNr)
+        {
+            pSums[n - 1 - columnNr] += pRow[columnNr];
+        }
+    }
+
+    return result;
+}
+} // namespace Matr
@@ -0,0 +1,820 @@
+// clang-format off
+#include <QTest>
+
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "matrix.h"
+
+using IntMatrix = Matrix<int>;
+using DoubleMatrix = Matrix<double>;
+using ShortMatrix = Matrix<short>;
+using StringMatrix = Matrix<std::string>;
+
+Q_DECLARE_METATYPE(IntMatrix)
+Q_DECLARE_METATYPE(StringMatrix)
+
+// used for checking which scalars are accepted as operands (the ones narrowed to the element type are rejected)
+template <typename Lhs, typename Rhs>
+concept AddableOperands = requires(const Lhs& lhs, const Rhs& rhs) { lhs + rhs; };
+
+template <typename Lhs, typename Rhs>
+concept MultipliableOperands = requires(const Lhs& lhs, const Rhs& rhs) { lhs * rhs; };
+
+// used for checking that sqrt(), exp() and log() are only available for floating point elements
+template <typename Operand>
+concept SqrtOperand = requires(const Operand& operand) { sqrt(operand); };
+
+template <typename Operand>
+concept ExpOperand = requires(const Operand& operand) { exp(operand); };
+
+template <typename Operand>
+concept LogOperand = requires(const Operand& operand) { log(operand); };
+
+class ArithmeticTests : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // test functions
+    void testIntMatrixAddAndSubtract();
+    void testIntMatrixMultiplyAndDivide();
+    void testIntMatrixScalarOperations();
+    void testIntMatrixUnaryOperations();
+    void testIntMatrixCombinedExpression();
+    void testIntMatrixAssignExpression();
+    void testDoubleMatrixMathFunctions();
+    void testStringMatrixConcatenation();
+    void testIntMatrixMultiply();
+    void testIntMatrixGemm();
+    void testMultiplyLargeMatrixes();
+    void testShortMatrixMultiply();
+    void testMultiplyWithExecutionPolicy();
+    void testStrassenMultiply();
+    void testIntMatrixVectorMultiply();
+    void testIntVectorMatrixMultiply();
+    void testIntMatrixGemv();
+    void testIntMatrixRowReductions();
+    void testIntMatrixColumnReductions();
+    void testStringMatrixReductions();
+    void testReductionsWithExecutionPolicy();
+    void testIntMatrixDiagonalReductions();
+    void testDiagonalExtraction();
+
+    // test data
+    void testIntMatrixAddAndSubtract_data();
+    void testIntMatrixMultiplyAndDivide_data();
+    void testIntMatrixScalarOperations_data();
+    void testIntMatrixUnaryOperations_data();
+    void testIntMatrixCombinedExpression_data();
+    void testStringMatrixConcatenation_data();
+    void testIntMatrixMultiply_data();
+    void testIntMatrixGemm_data();
+    void testIntMatrixVectorMultiply_data();
+    void testIntVectorMatrixMultiply_data();
+    void testIntMatrixGemv_data();
+    void testIntMatrixRowReductions_data();
+    void testIntMatrixColumnReductions_data();
+    void testIntMatrixDiagonalReductions_data();
+};
+
+void ArithmeticTests::testIntMatrixAddAndSubtract()
+{
+    QFETCH(IntMatrix, firstMatrix);
+    QFETCH(IntMatrix, secondMatrix);
+    QFETCH(IntMatrix, expectedSumMatrix);
+    QFETCH(IntMatrix, expectedDifferenceMatrix);
+
+    const IntMatrix c_SumMatrix{firstMatrix + secondMatrix};
+    const IntMatrix c_DifferenceMatrix{firstMatrix - secondMatrix};
+
+    QVERIFY2(c_SumMatrix == expectedSumMatrix, "Element-wise addition failed, the resulting matrix is not correct!");
+    QVERIFY2(c_DifferenceMatrix == expectedDifferenceMatrix, "Element-wise subtraction failed, the resulting matrix is not correct!");
+}
+
+void ArithmeticTests::testIntMatrixMultiplyAndDivide()
+{
+    QFETCH(IntMatrix, firstMatrix);
+    QFETCH(IntMatrix, secondMatrix);
+    QFETCH(IntMatrix, expectedProductMatrix);
+    QFETCH(IntMatrix, expectedQuotientMatrix);
+
+    const IntMatrix c_ProductMatrix{firstMatrix * secondMatrix};
+    const IntMatrix c_QuotientMatrix{firstMatrix / secondMatrix};
+
+    QVERIFY2(c_ProductMatrix == expectedProductMatrix, "Element-wise multiplication failed, the resulting matrix is not correct!");
+    QVERIFY2(c_QuotientMatrix == expectedQuotientMatrix, "Element-wise division failed, the resulting matrix is not correct!");
+}
+
+void ArithmeticTests::testIntMatrixScalarOperations()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(int, scalar);
+    QFETCH(IntMatrix, expectedMatrixPlusScalar);
+    QFETCH(IntMatrix, expectedScalarMinusMatrix);
+    QFETCH(IntMatrix, expectedMatrixTimesScalar);
+    QFETCH(IntMatrix, expectedMatrixDividedByScalar);
+
+    const IntMatrix c_MatrixPlusScalar{matrix + scalar};
+    const IntMatrix c_ScalarMinusMatrix{scalar - matrix};
+    const IntMatrix c_MatrixTimesScalar{matrix * scalar};
+    const IntMatrix c_ScalarTimesMatrix{scalar * matrix};
+    const IntMatrix c_MatrixDividedByScalar{matrix / scalar};
+
+    QVERIFY2(c_MatrixPlusScalar == expectedMatrixPlusScalar, "Adding the scalar failed, the resulting matrix is not correct!");
+    QVERIFY2(c_ScalarMinusMatrix == expectedScalarMinusMatrix, "Subtracting from scalar failed, the resulting matrix is not correct!");
+    QVERIFY2(c_MatrixTimesScalar == expectedMatrixTimesScalar && c_ScalarTimesMatrix == expectedMatrixTimesScalar, "Multiplying by scalar failed, the resulting matrix is not correct!");
+    QVERIFY2(c_MatrixDividedByScalar == expectedMatrixDividedByScalar, "Dividing by scalar failed, the resulting matrix is not correct!");
+
+    // no silent truncation of scalars (e.g. IntMatrix * 2.5)
+    static_assert(!MultipliableOperands<IntMatrix, double> && !MultipliableOperands<double, IntMatrix>);
+    static_assert(!AddableOperands<IntMatrix, double> && !AddableOperands<double, IntMatrix>);
+    static_assert(!AddableOperands<IntMatrix, long long> && !MultipliableOperands<Matrix<short>, int>);
+    static_assert(MultipliableOperands<IntMatrix, int> && AddableOperands<int, IntMatrix>);
+    static_assert(MultipliableOperands<DoubleMatrix, float> && AddableOperands<StringMatrix, const char*>);
+}
+
+void ArithmeticTests::testIntMatrixUnaryOperations()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(IntMatrix, expectedNegatedMatrix);
+    QFETCH(IntMatrix, expectedAbsMatrix);
+
+    const IntMatrix c_NegatedMatrix{-matrix};
+    const IntMatrix c_AbsMatrix{abs(matrix)};
+
+    QVERIFY2(c_NegatedMatrix == expectedNegatedMatrix, "Negation failed, the resulting matrix is not correct!");
+    QVERIFY2(c_AbsMatrix == expectedAbsMatrix, "Absolute value computation failed, the resulting matrix is not correct!");
+
+    // no silent truncation of the results (e.g. sqrt(2) for an int matrix)
+    static_assert(!SqrtOperand<IntMatrix> && !ExpOperand<IntMatrix> && !LogOperand<IntMatrix>);
+    static_assert(!SqrtOperand<decltype(-std::declval<const IntMatrix&>())> && !ExpOperand<ShortMatrix>);
+    static_assert(SqrtOperand<DoubleMatrix> && ExpOperand<DoubleMatrix> && LogOperand<decltype(-std::declval<const DoubleMatrix&>())>);
+}
+
+void ArithmeticTests::testIntMatrixCombinedExpression()
+{
+    QFETCH(IntMatrix, firstMatrix);
+    QFETCH(IntMatrix, secondMatrix);
+    QFETCH(IntMatrix, thirdMatrix);
+    QFETCH(IntMatrix, expectedMatrix);
+
+    const IntMatrix c_ResultingMatrix{firstMatrix * 2 + secondMatrix - thirdMatrix};
+
+    QVERIFY2(c_ResultingMatrix == expectedMatrix, "Evaluating the expression failed, the resulting matrix is not correct!");
+    QVERIFY2(c_ResultingMatrix.getRowCapacity() == expectedMatrix.getRowCapacity() && c_ResultingMatrix.getColumnCapacity() == expectedMatrix.getColumnCapacity(), "Evaluating the expression failed, the resulting matrix does not have the correct capacity!");
+
+    // the expression can only be converted to a matrix explicitly
+    static_assert(!std::is_convertible_v<decltype(firstMatrix * 2 + secondMatrix), IntMatrix>);
+    static_assert(std::is_constructible_v<IntMatrix, decltype(firstMatrix * 2 + secondMatrix)>);
+
+    // the matrix is also an operand
+    firstMatrix = firstMatrix * 2 + secondMatrix - thirdMatrix;
+
+    QVERIFY2(firstMatrix == expectedMatrix, "Evaluating the expression failed, the resulting matrix is not correct!");
+}
+
+void ArithmeticTests::testIntMatrixAssignExpression()
+{
+    const IntMatrix c_FirstMatrix{2, 3, {1, -2, 3, -4, 5, -6}};
+    const IntMatrix c_SecondMatrix{2, 3, {7, 8, 9, 10, 11, 12}};
+
+    // same dimensions: elements overwritten in place, capacity is retained
+    {
+        IntMatrix matrix{{2, 3}, 0};
+        matrix.reserve(4, 5);
+        matrix = c_FirstMatrix + c_SecondMatrix;
+
+        QVERIFY(matrix == IntMatrix(2, 3, {8, 6, 12, 6, 16, 6}));
+        QVERIFY(matrix.getRowCapacity() == 4 && matrix.getColumnCapacity() == 5);
+    }
+
+    // different dimensions: matrix is re-allocated
+    {
+        IntMatrix matrix{{3, 2}, 0};
+        matrix = c_FirstMatrix - c_SecondMatrix;
+
+        QVERIFY(matrix == IntMatrix(2, 3, {-6, -10, -6, -14, -6, -18}));
+        QVERIFY(matrix.getRowCapacity() == 2 && matrix.getColumnCapacity() == 3);
+    }
+
+    // empty matrixes
+    {
+        IntMatrix matrix{{3, 2}, 0};
+        matrix = IntMatrix{} * 2;
+
+        QVERIFY(matrix.isEmpty());
+    }
+}
+
+void ArithmeticTests::testDoubleMatrixMathFunctions()
+{
+    const DoubleMatrix c_Matrix{2, 2, {1.0, 4.0, 9.0, 16.0}};
+
+    const DoubleMatrix c_SqrtMatrix{sqrt(c_Matrix)};
+    const DoubleMatrix c_ExpLogMatrix{exp(log(c_Matrix))};
+
+    QCOMPARE(c_SqrtMatrix.at(0, 0), 1.0);
+    QCOMPARE(c_SqrtMatrix.at(0, 1), 2.0);
+    QCOMPARE(c_SqrtMatrix.at(1, 0), 3.0);
+    QCOMPARE(c_SqrtMatrix.at(1, 1), 4.0);
+
+    QCOMPARE(c_ExpLogMatrix.at(0, 0), 1.0);
+    QCOMPARE(c_ExpLogMatrix.at(0, 1), 4.0);
+    QCOMPARE(c_ExpLogMatrix.at(1, 0), 9.0);
+    QCOMPARE(c_ExpLogMatrix.at(1, 1), 16.0);
+}
+
+void ArithmeticTests::testStringMatrixConcatenation()
+{
+    QFETCH(StringMatrix, firstMatrix);
+    QFETCH(StringMatrix, secondMatrix);
+    QFETCH(std::string, suffix);
+    QFETCH(StringMatrix, expectedMatrix);
+
+    const StringMatrix c_ResultingMatrix{firstMatrix + secondMatrix + suffix};
+
+    QVERIFY2(c_ResultingMatrix == expectedMatrix, "Element-wise concatenation failed, the resulting matrix is not correct!");
+}
+
+void ArithmeticTests::testIntMatrixMultiply()
+{
+    QFETCH(IntMatrix, firstMatrix);
+    QFETCH(IntMatrix, secondMatrix);
+    QFETCH(IntMatrix, expectedMatrix);
+
+    const IntMatrix c_ProductMatrix{multiply(firstMatrix, secondMatrix)};
+
+    QVERIFY2(c_ProductMatrix == expectedMatrix, "Matrix multiplication failed, the resulting matrix is not correct!");
+    QVERIFY2(strassenMultiply(firstMatrix, secondMatrix, 1) == expectedMatrix, "Strassen matrix multiplication failed, the resulting matrix is not correct!");
+}
+
+void ArithmeticTests::testIntMatrixGemm()
+{
+    QFETCH(int, alpha);
+    QFETCH(IntMatrix, firstMatrix);
+    QFETCH(IntMatrix, secondMatrix);
+    QFETCH(int, beta);
+    QFETCH(IntMatrix, matrix);
+    QFETCH(IntMatrix, expectedMatrix);
+
+    gemm(alpha, firstMatrix, secondMatrix, beta, matrix);
+
+    QVERIFY2(matrix == expectedMatrix, "General matrix multiplication failed, the resulting matrix is not correct!");
+}
+
+// the matrixes are large enough for using the cache-blocked kernel (including partial blocks and tiles)
+void ArithmeticTests::testMultiplyLargeMatrixes()
+{
+    const matrix_size_t c_NrOfRows{101};
+    const matrix_size_t c_NrOfIndexes{90};
+    const matrix_size_t c_NrOfColumns{117};
+
+    IntMatrix firstIntMatrix{{c_NrOfRows, c_NrOfIndexes}, 0};
+    IntMatrix secondIntMatrix{{c_NrOfIndexes, c_NrOfColumns}, 0};
+    DoubleMatrix firstDoubleMatrix{{c_NrOfRows, c_NrOfIndexes}, 0.0};
+    DoubleMatrix secondDoubleMatrix{{c_NrOfIndexes, c_NrOfColumns}, 0.0};
+
+    for (matrix_size_t rowNr{0}; rowNr < c_NrOfRows; ++rowNr)
+    {
+        for (matrix_size_t index{0}; index < c_NrOfIndexes; ++index)
+        {
+            firstIntMatrix.at(rowNr, index) = (rowNr * 3 + index) % 7 - 3;
+            firstDoubleMatrix.at(rowNr, index) = firstIntMatrix.at(rowNr, index) * 0.5;
+        }
+    }
+
+    for (matrix_size_t index{0}; index < c_NrOfIndexes; ++index)
+    {
+        for (matrix_size_t columnNr{0}; columnNr < c_NrOfColumns; ++columnNr)
+        {
+            secondIntMatrix.at(index, columnNr) = (index + columnNr * 5) % 11 - 5;
+            secondDoubleMatrix.at(index, columnNr) = secondIntMatrix.at(index, columnNr) * 0.25;
+        }
+    }
+
+    IntMatrix expectedIntMatrix{{c_NrOfRows, c_NrOfColumns}, 0};
+    DoubleMatrix expectedDoubleMatrix{{c_NrOfRows, c_NrOfColumns}, 0.0};
+
+    for (matrix_size_t rowNr{0}; rowNr < c_NrOfRows; ++rowNr)
+    {
+        for (matrix_size_t columnNr{0}; columnNr < c_NrOfColumns; ++columnNr)
+        {
+            for (matrix_size_t index{0}; index < c_NrOfIndexes; ++index)
+            {
+                expectedIntMatrix.at(rowNr, columnNr) += firstIntMatrix.at(rowNr, index) * secondIntMatrix.at(index, columnNr);
+            }
+
+            expectedDoubleMatrix.at(rowNr, columnNr) = expectedIntMatrix.at(rowNr, columnNr) * 0.125;
+        }
+    }
+
+    QVERIFY2(multiply(firstIntMatrix, secondIntMatrix) == expectedIntMatrix, "Matrix multiplication failed, the resulting matrix is not correct!");
+    QVERIFY2(multiply(firstDoubleMatrix, secondDoubleMatrix) == expectedDoubleMatrix, "Matrix multiplication failed, the resulting matrix is not correct!");
+
+    gemm(2, firstIntMatrix, secondIntMatrix, -1, expectedIntMatrix);
+
+    QVERIFY2(multiply(firstIntMatrix, secondIntMatrix) == expectedIntMatrix, "General matrix multiplication failed, the resulting matrix is not correct!");
+}
+
+// element type narrower than int (the products are promoted to int and converted back), large enough for the cache-blocked kernel
+void ArithmeticTests::testShortMatrixMultiply()
+{
+    const matrix_size_t c_NrOfRows{40};
+    const matrix_size_t c_NrOfIndexes{33};
+    const matrix_size_t c_NrOfColumns{50};
+
+    ShortMatrix firstMatrix{{c_NrOfRows, c_NrOfIndexes}, 0};
+    ShortMatrix secondMatrix{{c_NrOfIndexes, c_NrOfColumns}, 0};
+    ShortMatrix matrix{{c_NrOfRows, c_NrOfColumns}, 0};
+
+    for (matrix_size_t rowNr{0}; rowNr < c_NrOfRows; ++rowNr)
+    {
+        for (matrix_size_t index{0}; index < c_NrOfIndexes; ++index)
+        {
+            firstMatrix.at(rowNr, index) = static_cast<short>((rowNr * 3 + index) % 7 - 3);
+        }
+
+        for (matrix_size_t columnNr{0}; columnNr < c_NrOfColumns; ++columnNr)
+        {
+            matrix.at(rowNr, columnNr) = static_cast<short>((rowNr + columnNr) % 5 - 2);
+        }
+    }
+
+    for (matrix_size_t index{0}; index < c_NrOfIndexes; ++index)
+    {
+        for (matrix_size_t columnNr{0}; columnNr < c_NrOfColumns; ++columnNr)
+        {
+            secondMatrix.at(index, columnNr) = static_cast<short>((index + columnNr * 5) % 11 - 5);
+        }
+    }
+
+    ShortMatrix expectedProductMatrix{{c_NrOfRows, c_NrOfColumns}, 0};
+    ShortMatrix expectedGemmMatrix{{c_NrOfRows, c_NrOfColumns}, 0};
+
+    for (matrix_size_t rowNr{0}; rowNr < c_NrOfRows; ++rowNr)
+    {
+        for (matrix_size_t columnNr{0}; columnNr < c_NrOfColumns; ++columnNr)
+        {
+            int product{0};
+
+            for (matrix_size_t index{0}; index < c_NrOfIndexes; ++index)
+            {
+                product += firstMatrix.at(rowNr, index) * secondMatrix.at(index, columnNr);
+            }
+
+            expectedProductMatrix.at(rowNr, columnNr) = static_cast<short>(product);
+            expectedGemmMatrix.at(rowNr, columnNr) = static_cast<short>(2 * product - 3 * matrix.at(rowNr, columnNr));
+        }
+    }
+
+    QVERIFY2(multiply(firstMatrix, secondMatrix) == expectedProductMatrix, "Matrix multiplication failed, the resulting matrix is not correct!");
+    QVERIFY2(multiply(firstMatrix, secondMatrix, Matr::ExecutionPolicy{2}) == expectedProductMatrix, "Matrix multiplication failed, the resulting matrix is not correct!");
+
+    gemm(short{2}, firstMatrix, secondMatrix, short{-3}, matrix);
+
+    QVERIFY2(matrix == expectedGemmMatrix, "General matrix multiplication failed, the resulting matrix is not correct!");
+
+    // small product (computed without packing)
+    ShortMatrix smallMatrix{2, 2, {1, 2, 3, 4}};
+    gemm(short{2}, ShortMatrix{2, 2, {1, 0, 0, 1}}, ShortMatrix{2, 2, {5, 6, 7, 8}}, short{1}, smallMatrix);
+
+    QVERIFY2(smallMatrix == ShortMatrix(2, 2, {11, 14, 17, 20}), "General matrix multiplication failed, the resulting matrix is not correct!");
+
+    const std::vector<short> c_Vector{1, -1};
+    std::vector<short> resultingVector{3, 4};
+    gemv(short{2}, smallMatrix, c_Vector, short{-1}, resultingVector);
+
+    QVERIFY2(resultingVector == std::vector<short>({-9, -10}), "General matrix-vector multiplication failed, the resulting vector is not correct!");
+}
+
+void ArithmeticTests::testMultiplyWithExecutionPolicy()
+{
+    // (number of rows of first matrix, number of columns of first matrix/rows of second matrix, number of columns of second matrix) for small (sequentially computed) and large (partitioned) products
+    const std::vector<std::tuple<matrix_size_t, matrix_size_t, matrix_size_t>> c_Setups{{3, 4, 5}, {100, 100, 100}, {97, 120, 65}, {1, 127, 127}, {127, 127, 1}, {127, 1, 127}};
+
+    for (const auto& [nrOfRows, nrOfIndexes, nrOfColumns] : c_Setups)
+    {
+        IntMatrix firstMatrix{{nrOfRows, nrOfIndexes}, 0};
+        IntMatrix secondMatrix{{nrOfIndexes, nrOfColumns}, 0};
+        IntMatrix initialMatrix{{nrOfRows, nrOfColumns}, 0};
+
+        for (matrix_size_t rowNr{0}; rowNr < nrOfRows; ++rowNr)
+        {
+            for (matrix_size_t index{0}; index < nrOfIndexes; ++index)
+            {
+                firstMatrix.at(rowNr, index) = (rowNr * 5 + index) % 9 - 4;
+            }
+
+            for (matrix_size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+            {
+                initialMatrix.at(rowNr, columnNr) = (rowNr + columnNr) % 3 - 1;
+            }
+        }
+
+        for (matrix_size_t index{0}; index < nrOfIndexes; ++index)
+        {
+            for (matrix_size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+            {
+                secondMatrix.at(index, columnNr) = (index * 2 + columnNr * 3) % 7 - 3;
+            }
+        }
+
+        const IntMatrix c_ExpectedProductMatrix{multiply(firstMatrix, secondMatrix)};
+
+        IntMatrix expectedGemmMatrix{initialMatrix};
+        gemm(3, firstMatrix, secondMatrix, -2, expectedGemmMatrix);
+
+        for (size_t nrOfThreads : {1u, 2u, 3u, 8u})
+        {
+            IntMatrix gemmMatrix{initialMatrix};
+            gemm(3, firstMatrix, secondMatrix, -2, gemmMatrix, Matr::ExecutionPolicy{nrOfThreads});
+
+            QVERIFY(multiply(firstMatrix, secondMatrix, Matr::ExecutionPolicy{nrOfThreads}) == c_ExpectedProductMatrix);
+            QVERIFY(gemmMatrix == expectedGemmMatrix);
+        }
+    }
+}
+
+void ArithmeticTests::testStrassenMultiply()
+{
+    // (number of rows of first matrix, number of columns of first matrix/rows of second matrix, number of columns of second matrix), including odd dimensions (peeled rows, columns and indexes)
+    const std::vector<std::tuple<matrix_size_t, matrix_size_t, matrix_size_t>> c_Setups{{3, 4, 5}, {64, 64, 64}, {127, 127, 127}, {101, 90, 117}, {33, 65, 17}, {1, 127, 127}, {127, 1, 127}, {127, 127, 1}};
+
+    for (const auto& [nrOfRows, nrOfIndexes, nrOfColumns] : c_Setups)
+    {
+        IntMatrix firstMatrix{{nrOfRows, nrOfIndexes}, 0};
+        IntMatrix secondMatrix{{nrOfIndexes, nrOfColumns}, 0};
+
+        for (matrix_size_t rowNr{0}; rowNr < nrOfRows; ++rowNr)
+        {
+            for (matrix_size_t index{0}; index < nrOfIndexes; ++index)
+            {
+                firstMatrix.at(rowNr, index) = (rowNr * 5 + index * 3) % 17 - 8;
+            }
+        }
+
+        for (matrix_size_t index{0}; index < nrOfIndexes; ++index)
+        {
+            for (matrix_size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+            {
+                secondMatrix.at(index, columnNr) = (index * 7 + columnNr) % 13 - 6;
+            }
+        }
+
+        const IntMatrix c_ExpectedProductMatrix{multiply(firstMatrix, secondMatrix)};
+
+        // the lower the threshold, the more recursion levels
+        for (size_t threshold : {1u, 7u, 16u, 50u})
+        {
+            QVERIFY(strassenMultiply(firstMatrix, secondMatrix, threshold) == c_ExpectedProductMatrix);
+            QVERIFY(strassenMultiply(firstMatrix, secondMatrix, threshold, Matr::ExecutionPolicy{3}) == c_ExpectedProductMatrix);
+        }
+
+        QVERIFY(strassenMultiply(firstMatrix, secondMatrix) == c_ExpectedProductMatrix);
+    }
+
+    // all intermediate values are exactly representable, so no rounding errors occur
+    const DoubleMatrix c_FirstMatrix{{100, 60}, 0.5};
+    const DoubleMatrix c_SecondMatrix{{60, 80}, -0.25};
+
+    QVERIFY2(strassenMultiply(c_FirstMatrix, c_SecondMatrix, 8) == DoubleMatrix({100, 80}, -7.5), "Strassen matrix multiplication failed, the resulting matrix is not correct!");
+}
+
+void ArithmeticTests::testIntMatrixVectorMultiply()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(std::vector<int>, vector);
+    QFETCH(std::vector<int>, expectedVector);
+
+    QVERIFY2(multiply(matrix, vector) == expectedVector, "Matrix-vector multiplication failed, the resulting vector is not correct!");
+}
+
+void ArithmeticTests::testIntVectorMatrixMultiply()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(std::vector<int>, vector);
+    QFETCH(std::vector<int>, expectedVector);
+
+    QVERIFY2(multiply(vector, matrix) == expectedVector, "Vector-matrix multiplication failed, the resulting vector is not correct!");
+}
+
+void ArithmeticTests::testIntMatrixGemv()
+{
+    QFETCH(int, alpha);
+    QFETCH(IntMatrix, matrix);
+    QFETCH(std::vector<int>, vector);
+    QFETCH(int, beta);
+    QFETCH(std::vector<int>, resultingVector);
+    QFETCH(std::vector<int>, expectedVector);
+
+    gemv(alpha, matrix, vector, beta, resultingVector);
+
+    QVERIFY2(resultingVector == expectedVector, "General matrix-vector multiplication failed, the resulting vector is not correct!");
+}
+
+void ArithmeticTests::testIntMatrixRowReductions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(std::vector<int>, expectedSums);
+    QFETCH(std::vector<int>, expectedMinValues);
+    QFETCH(std::vector<int>, expectedMaxValues);
+    QFETCH(std::vector<double>, expectedMeanValues);
+
+    QVERIFY2(matrix.rowSums() == expectedSums, "Row reduction failed, the resulting sums are not correct!");
+    QVERIFY2(matrix.rowMin() == expectedMinValues, "Row reduction failed, the resulting minimum values are not correct!");
+    QVERIFY2(matrix.rowMax() == expectedMaxValues, "Row reduction failed, the resulting maximum values are not correct!");
+    QVERIFY2(matrix.rowMean() == expectedMeanValues, "Row reduction failed, the resulting mean values are not correct!");
+    QVERIFY2(matrix.reduceRows(std::plus<int>{}, 0) == expectedSums, "Row reduction failed, the resulting sums are not correct!");
+}
+
+void ArithmeticTests::testIntMatrixColumnReductions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(std::vector<int>, expectedSums);
+    QFETCH(std::vector<int>, expectedMinValues);
+    QFETCH(std::vector<int>, expectedMaxValues);
+    QFETCH(std::vector<double>, expectedMeanValues);
+
+    QVERIFY2(matrix.columnSums() == expectedSums, "Column reduction failed, the resulting sums are not correct!");
+    QVERIFY2(matrix.columnMin() == expectedMinValues, "Column reduction failed, the resulting minimum values are not correct!");
+    QVERIFY2(matrix.columnMax() == expectedMaxValues, "Column reduction failed, the resulting maximum values are not correct!");
+    QVERIFY2(matrix.columnMean() == expectedMeanValues, "Column reduction failed, the resulting mean values are not correct!");
+    QVERIFY2(matrix.reduceColumns(std::plus<int>{}, 0) == expectedSums, "Column reduction failed, the resulting sums are not correct!");
+}
+
+void ArithmeticTests::testStringMatrixReductions()
+{
+    const StringMatrix c_Matrix{3, 2, {"a", "b", "c", "d", "e", "f"}};
+
+    // the elements are reduced in the order of their positions, starting with the initial value
+    QVERIFY2(c_Matrix.reduceRows(std::plus<std::string>{}, std::string{"x"}) == std::vector<std::string>({"xab", "xcd", "xef"}), "Row reduction failed, the resulting values are not correct!");
+    QVERIFY2(c_Matrix.reduceColumns(std::plus<std::string>{}, std::string{"x"}) == std::vector<std::string>({"xace", "xbdf"}), "Column reduction failed, the resulting values are not correct!");
+    QVERIFY2(c_Matrix.reduceColumns(std::plus<std::string>{}, std::string{"x"}, Matr::ExecutionPolicy{2}) == std::vector<std::string>({"xace", "xbdf"}), "Column reduction failed, the resulting values are not correct!");
+    QVERIFY2(StringMatrix{}.reduceRows(std::plus<std::string>{}, std::string{"x"}).empty(), "Row reduction failed, the empty matrix has no results!");
+}
+
+void ArithmeticTests::testReductionsWithExecutionPolicy()
+{
+    for (const auto& [nrOfRows, nrOfColumns] : std::vector<std::pair<matrix_size_t, matrix_size_t>>{{1, 127}, {127, 1}, {5, 3}, {127, 127}, {100, 37}})
+    {
+        IntMatrix matrix{{nrOfRows, nrOfColumns}, 0};
+
+        for (matrix_size_t rowNr{0}; rowNr < nrOfRows; ++rowNr)
+        {
+            for (matrix_size_t columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+            {
+                matrix.at(rowNr, columnNr) = (rowNr * 7 + columnNr * 3) % 23 - 11;
+            }
+        }
+
+        for (size_t nrOfThreads : {1u, 2u, 3u, 8u})
+        {
+            const Matr::ExecutionPolicy c_ExecutionPolicy{nrOfThreads};
+
+            QVERIFY(matrix.rowSums(c_ExecutionPolicy) == matrix.reduceRows(std::plus<int>{}, 0));
+            QVERIFY(matrix.columnSums(c_ExecutionPolicy) == matrix.reduceColumns(std::plus<int>{}, 0));
+            QVERIFY(matrix.rowMin(c_ExecutionPolicy) == matrix.reduceRows([](int first, int second) {return std::min(first, second);}, 11));
+            QVERIFY(matrix.columnMax(c_ExecutionPolicy) == matrix.reduceColumns([](int first, int second) {return std::max(first, second);}, -11));
+            QVERIFY(matrix.rowMax(c_ExecutionPolicy) == matrix.rowMax() && matrix.columnMin(c_ExecutionPolicy) == matrix.columnMin());
+            QVERIFY(matrix.rowMean(c_ExecutionPolicy) == matrix.rowMean() && matrix.columnMean(c_ExecutionPolicy) == matrix.columnMean());
+            QVERIFY(matrix.reduceRows(std::plus<int>{}, 5, c_ExecutionPolicy) == matrix.reduceRows(std::plus<int>{}, 5));
+            QVERIFY(matrix.reduceColumns(std::plus<int>{}, 5, c_ExecutionPolicy) == matrix.reduceColumns(std::plus<int>{}, 5));
+        }
+    }
+}
+
+void ArithmeticTests::testIntMatrixDiagonalReductions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(std::vector<int>, expectedDiagonalSums);
+    QFETCH(std::vector<int>, expectedAntiDiagonalSums);
+
+    QVERIFY2(matrix.diagonalSums() == expectedDiagonalSums, "Diagonal reduction failed, the resulting sums are not correct!");
+    QVERIFY2(matrix.antiDiagonalSums() == expectedAntiDiagonalSums, "Anti-diagonal reduction failed, the resulting sums are not correct!");
+
+    // each sum should match the one obtained by iterating through the diagonal
+    const matrix_diff_t c_NrOfRows{static_cast<matrix_diff_t>(matrix.getNrOfRows())};
+    const matrix_diff_t c_NrOfColumns{static_cast<matrix_diff_t>(matrix.getNrOfColumns())};
+
+    for (matrix_diff_t diagonalNr{static_cast<matrix_diff_t>(1 - c_NrOfRows)}; diagonalNr < c_NrOfColumns; ++diagonalNr)
+    {
+        const size_t c_Index{static_cast<size_t>(diagonalNr + c_NrOfRows - 1)};
+
+        QVERIFY(std::accumulate(matrix.dBegin(diagonalNr), matrix.dEnd(diagonalNr), 0) == expectedDiagonalSums[c_Index]);
+        QVERIFY(std::accumulate(matrix.mBegin(diagonalNr), matrix.mEnd(diagonalNr), 0) == expectedAntiDiagonalSums[c_Index]);
+    }
+}
+
+void ArithmeticTests::testDiagonalExtraction()
+{
+    IntMatrix matrix{3, 4, {1, -2, 3, -4, 5, -6, 7, -8, 9, -10, 11, -12}};
+
+    QVERIFY2(matrix.diagonal(-2) == std::vector<int>({9}), "Diagonal extraction failed, the resulting elements are not correct!");
+    QVERIFY2(matrix.diagonal(-1) == std::vector<int>({5, -10}), "Diagonal extraction failed, the resulting elements are not correct!");
+    QVERIFY2(matrix.diagonal(0) == std::vector<int>({1, -6, 11}), "Diagonal extraction failed, the resulting elements are not correct!");
+    QVERIFY2(matrix.diagonal(1) == std::vector<int>({-2, 7, -12}), "Diagonal extraction failed, the resulting elements are not correct!");
+    QVERIFY2(matrix.diagonal(3) == std::vector<int>({-4}), "Diagonal extraction failed, the resulting elements are not correct!");
+
+    // the extracted elements are copies
+    std::vector<int> diagonal{matrix.diagonal(0)};
+    diagonal[0] = 100;
+    QVERIFY2(matrix.at(0, 0) == 1, "Diagonal extraction failed, the matrix has been modified!");
+
+    matrix.resize(3, 3);
+    QVERIFY2(matrix.trace() == 6, "Trace computation failed, the resulting value is not correct!");
+    QVERIFY2((IntMatrix{1, 1, {-7}}.trace() == -7), "Trace computation failed, the resulting value is not correct!");
+    QVERIFY2((DoubleMatrix{2, 2, {0.5, 1.0, 2.0, 0.25}}.trace() == 0.75), "Trace computation failed, the resulting value is not correct!");
+
+    const StringMatrix c_StringMatrix{2, 3, {"a", "b", "c", "d", "e", "f"}};
+
+    QVERIFY2(c_StringMatrix.diagonal(0) == std::vector<std::string>({"a", "e"}), "Diagonal extraction failed, the resulting elements are not correct!");
+    QVERIFY2(c_StringMatrix.diagonal(-1) == std::vector<std::string>({"d"}), "Diagonal extraction failed, the resulting elements are not correct!");
+    QVERIFY2(IntMatrix{}.diagonalSums().empty() && IntMatrix{}.antiDiagonalSums().empty(), "Diagonal reduction failed, the empty matrix has no diagonals!");
+}
+
+void ArithmeticTests::testIntMatrixAddAndSubtract_data()
+{
+    QTest::addColumn<IntMatrix>("firstMatrix");
+    QTest::addColumn<IntMatrix>("secondMatrix");
+    QTest::addColumn<IntMatrix>("expectedSumMatrix");
+    QTest::addColumn<IntMatrix>("expectedDifferenceMatrix");
+
+    QTest::newRow("1: single element") << IntMatrix{1, 1, {5}} << IntMatrix{1, 1, {-3}} << IntMatrix{1, 1, {2}} << IntMatrix{1, 1, {8}};
+    QTest::newRow("2: multiple rows and columns") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{2, 3, {-6, 5, -4, 3, -2, 1}} << IntMatrix{2, 3, {-5, 7, -1, 7, 3, 7}} << IntMatrix{2, 3, {7, -3, 7, 1, 7, 5}};
+    QTest::newRow("3: empty matrixes") << IntMatrix{} << IntMatrix{} << IntMatrix{} << IntMatrix{};
+}
+
+void ArithmeticTests::testIntMatrixMultiplyAndDivide_data()
+{
+    QTest::addColumn<IntMatrix>("firstMatrix");
+    QTest::addColumn<IntMatrix>("secondMatrix");
+    QTest::addColumn<IntMatrix>("expectedProductMatrix");
+    QTest::addColumn<IntMatrix>("expectedQuotientMatrix");
+
+    QTest::newRow("1: single element") << IntMatrix{1, 1, {-12}} << IntMatrix{1, 1, {4}} << IntMatrix{1, 1, {-48}} << IntMatrix{1, 1, {-3}};
+    QTest::newRow("2: multiple rows and columns") << IntMatrix{3, 2, {10, 20, -30, 40, 50, 60}} << IntMatrix{3, 2, {2, -3, 4, 5, -6, 7}} << IntMatrix{3, 2, {20, -60, -120, 200, -300, 420}} << IntMatrix{3, 2, {5, -6, -7, 8, -8, 8}};
+    QTest::newRow("3: empty matrixes") << IntMatrix{} << IntMatrix{} << IntMatrix{} << IntMatrix{};
+}
+
+void ArithmeticTests::testIntMatrixScalarOperations_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<int>("scalar");
+    QTest::addColumn<IntMatrix>("expectedMatrixPlusScalar");
+    QTest::addColumn<IntMatrix>("expectedScalarMinusMatrix");
+    QTest::addColumn<IntMatrix>("expectedMatrixTimesScalar");
+    QTest::addColumn<IntMatrix>("expectedMatrixDividedByScalar");
+
+    QTest::newRow("1: positive scalar") << IntMatrix{2, 2, {2, 4, -6, 8}} << 2 << IntMatrix{2, 2, {4, 6, -4, 10}} << IntMatrix{2, 2, {0, -2, 8, -6}} << IntMatrix{2, 2, {4, 8, -12, 16}} << IntMatrix{2, 2, {1, 2, -3, 4}};
+    QTest::newRow("2: negative scalar") << IntMatrix{2, 3, {3, 6, 9, -12, 15, 18}} << -3 << IntMatrix{2, 3, {0, 3, 6, -15, 12, 15}} << IntMatrix{2, 3, {-6, -9, -12, 9, -18, -21}} << IntMatrix{2, 3, {-9, -18, -27, 36, -45, -54}} << IntMatrix{2, 3, {-1, -2, -3, 4, -5, -6}};
+}
+
+void ArithmeticTests::testIntMatrixUnaryOperations_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<IntMatrix>("expectedNegatedMatrix");
+    QTest::addColumn<IntMatrix>("expectedAbsMatrix");
+
+    QTest::newRow("1: single element") << IntMatrix{1, 1, {-7}} << IntMatrix{1, 1, {7}} << IntMatrix{1, 1, {7}};
+    QTest::newRow("2: multiple rows and columns") << IntMatrix{2, 3, {1, -2, 3, 0, -5, 6}} << IntMatrix{2, 3, {-1, 2, -3, 0, 5, -6}} << IntMatrix{2, 3, {1, 2, 3, 0, 5, 6}};
+}
+
+void ArithmeticTests::testIntMatrixCombinedExpression_data()
+{
+    QTest::addColumn<IntMatrix>("firstMatrix");
+    QTest::addColumn<IntMatrix>("secondMatrix");
+    QTest::addColumn<IntMatrix>("thirdMatrix");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single element") << IntMatrix{1, 1, {3}} << IntMatrix{1, 1, {-4}} << IntMatrix{1, 1, {5}} << IntMatrix{1, 1, {-3}};
+    QTest::newRow("2: multiple rows and columns") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{2, 3, {7, 8, 9, 10, 11, 12}} << IntMatrix{2, 3, {-1, 2, -3, 4, -5, 6}} << IntMatrix{2, 3, {10, 10, 18, 14, 26, 18}};
+    QTest::newRow("3: multiple rows and columns") << IntMatrix{4, 5, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20}} << IntMatrix{4, 5, {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16, -17, -18, -19, -20}} << IntMatrix{4, 5, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}} << IntMatrix{4, 5, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19}};
+}
+
+void ArithmeticTests::testStringMatrixConcatenation_data()
+{
+    QTest::addColumn<StringMatrix>("firstMatrix");
+    QTest::addColumn<StringMatrix>("secondMatrix");
+    QTest::addColumn<std::string>("suffix");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single element") << StringMatrix{1, 1, {"First"}} << StringMatrix{1, 1, {"Second"}} << std::string{"/NEW_VALUE/"} << StringMatrix{1, 1, {"FirstSecond/NEW_VALUE/"}};
+    QTest::newRow("2: multiple rows and columns") << StringMatrix{2, 2, {"First", "Second", "Third", "Fourth"}} << StringMatrix{2, 2, {"1st", "2nd", "3rd", "4th"}} << std::string{"/NEW_VALUE/"} << StringMatrix{2, 2, {"First1st/NEW_VALUE/", "Second2nd/NEW_VALUE/", "Third3rd/NEW_VALUE/", "Fourth4th/NEW_VALUE/"}};
+}
+
+void ArithmeticTests::testIntMatrixMultiply_data()
+{
+    QTest::addColumn<IntMatrix>("firstMatrix");
+    QTest::addColumn<IntMatrix>("secondMatrix");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single element") << IntMatrix{1, 1, {-3}} << IntMatrix{1, 1, {4}} << IntMatrix{1, 1, {-12}};
+    QTest::newRow("2: multiple rows and columns") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 2, {7, 8, 9, 10, 11, 12}} << IntMatrix{2, 2, {58, 64, 139, 154}};
+    QTest::newRow("3: row by column") << IntMatrix{1, 4, {1, -2, 3, -4}} << IntMatrix{4, 1, {5, 6, 7, 8}} << IntMatrix{1, 1, {-18}};
+    QTest::newRow("4: column by row") << IntMatrix{3, 1, {1, -2, 3}} << IntMatrix{1, 2, {4, 5}} << IntMatrix{3, 2, {4, 5, -8, -10, 12, 15}};
+    QTest::newRow("5: identity matrix") << IntMatrix{3, {0, 1}} << IntMatrix{3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9}} << IntMatrix{3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9}};
+}
+
+void ArithmeticTests::testIntMatrixGemm_data()
+{
+    QTest::addColumn<int>("alpha");
+    QTest::addColumn<IntMatrix>("firstMatrix");
+    QTest::addColumn<IntMatrix>("secondMatrix");
+    QTest::addColumn<int>("beta");
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: null beta") << 1 << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 2, {7, 8, 9, 10, 11, 12}} << 0 << IntMatrix{2, 2, {-1, -2, -3, -4}} << IntMatrix{2, 2, {58, 64, 139, 154}};
+    QTest::newRow("2: unit alpha and beta") << 1 << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 2, {7, 8, 9, 10, 11, 12}} << 1 << IntMatrix{2, 2, {-1, -2, -3, -4}} << IntMatrix{2, 2, {57, 62, 136, 150}};
+    QTest::newRow("3: other alpha and beta") << -2 << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 2, {7, 8, 9, 10, 11, 12}} << 3 << IntMatrix{2, 2, {-1, -2, -3, -4}} << IntMatrix{2, 2, {-119, -134, -287, -320}};
+    QTest::newRow("4: null alpha") << 0 << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 2, {7, 8, 9, 10, 11, 12}} << 2 << IntMatrix{2, 2, {-1, -2, -3, -4}} << IntMatrix{2, 2, {-2, -4, -6, -8}};
+}
+
+void ArithmeticTests::testIntMatrixVectorMultiply_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<int>>("vector");
+    QTest::addColumn<std::vector<int>>("expectedVector");
+
+    QTest::newRow("1: single element") << IntMatrix{1, 1, {-3}} << std::vector<int>{4} << std::vector<int>{-12};
+    QTest::newRow("2: multiple rows and columns") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<int>{7, -8, 9} << std::vector<int>{18, 42};
+    QTest::newRow("3: single row") << IntMatrix{1, 4, {1, -2, 3, -4}} << std::vector<int>{5, 6, 7, 8} << std::vector<int>{-18};
+    QTest::newRow("4: single column") << IntMatrix{3, 1, {1, -2, 3}} << std::vector<int>{4} << std::vector<int>{4, -8, 12};
+    QTest::newRow("5: more than eight columns") << IntMatrix{2, 10, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}} << std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10} << std::vector<int>{55, 385};
+}
+
+void ArithmeticTests::testIntVectorMatrixMultiply_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<int>>("vector");
+    QTest::addColumn<std::vector<int>>("expectedVector");
+
+    QTest::newRow("1: single element") << IntMatrix{1, 1, {-3}} << std::vector<int>{4} << std::vector<int>{-12};
+    QTest::newRow("2: multiple rows and columns") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<int>{-1, 2} << std::vector<int>{7, 8, 9};
+    QTest::newRow("3: single row") << IntMatrix{1, 4, {1, -2, 3, -4}} << std::vector<int>{5} << std::vector<int>{5, -10, 15, -20};
+    QTest::newRow("4: single column") << IntMatrix{3, 1, {1, -2, 3}} << std::vector<int>{4, 5, 6} << std::vector<int>{12};
+    QTest::newRow("5: more than four rows") << IntMatrix{5, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}} << std::vector<int>{1, -1, 1, -1, 1} << std::vector<int>{5, 6};
+}
+
+void ArithmeticTests::testIntMatrixGemv_data()
+{
+    QTest::addColumn<int>("alpha");
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<int>>("vector");
+    QTest::addColumn<int>("beta");
+    QTest::addColumn<std::vector<int>>("resultingVector");
+    QTest::addColumn<std::vector<int>>("expectedVector");
+
+    QTest::newRow("1: null beta") << 1 << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<int>{7, -8, 9} << 0 << std::vector<int>{-1, -2} << std::vector<int>{18, 42};
+    QTest::newRow("2: unit alpha and beta") << 1 << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<int>{7, -8, 9} << 1 << std::vector<int>{-1, -2} << std::vector<int>{17, 40};
+    QTest::newRow("3: arbitrary alpha and beta") << -2 << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<int>{7, -8, 9} << 3 << std::vector<int>{-1, -2} << std::vector<int>{-39, -90};
+    QTest::newRow("4: null alpha") << 0 << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<int>{7, -8, 9} << 2 << std::vector<int>{-1, -2} << std::vector<int>{-2, -4};
+}
+
+void ArithmeticTests::testIntMatrixRowReductions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<int>>("expectedSums");
+    QTest::addColumn<std::vector<int>>("expectedMinValues");
+    QTest::addColumn<std::vector<int>>("expectedMaxValues");
+    QTest::addColumn<std::vector<double>>("expectedMeanValues");
+
+    QTest::newRow("1: single element") << IntMatrix{1, 1, {-3}} << std::vector<int>{-3} << std::vector<int>{-3} << std::vector<int>{-3} << std::vector<double>{-3.0};
+    QTest::newRow("2: multiple rows and columns") << IntMatrix{2, 3, {1, -2, 3, 4, 5, -6}} << std::vector<int>{2, 3} << std::vector<int>{-2, -6} << std::vector<int>{3, 5} << std::vector<double>{2.0 / 3.0, 1.0};
+    QTest::newRow("3: more than sixteen columns") << IntMatrix{1, 20, {-3, -2, -1, 0, 1, 2, 3, -3, -2, -1, 0, 1, 2, 3, -3, -2, -1, 0, 1, 2}} << std::vector<int>{-3} << std::vector<int>{-3} << std::vector<int>{3} << std::vector<double>{-0.15};
+    QTest::newRow("4: more than four rows") << IntMatrix{6, 2, {-5, 0, -2, 3, 1, -5, 4, -2, -4, 1, -1, 4}} << std::vector<int>{-5, 1, -4, 2, -3, 3} << std::vector<int>{-5, -2, -5, -2, -4, -1} << std::vector<int>{0, 3, 1, 4, 1, 4} << std::vector<double>{-2.5, 0.5, -2.0, 1.0, -1.5, 1.5};
+}
+
+void ArithmeticTests::testIntMatrixColumnReductions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<int>>("expectedSums");
+    QTest::addColumn<std::vector<int>>("expectedMinValues");
+    QTest::addColumn<std::vector<int>>("expectedMaxValues");
+    QTest::addColumn<std::vector<double>>("expectedMeanValues");
+
+    QTest::newRow("1: single element") << IntMatrix{1, 1, {-3}} << std::vector<int>{-3} << std::vector<int>{-3} << std::vector<int>{-3} << std::vector<double>{-3.0};
+    QTest::newRow("2: multiple rows and columns") << IntMatrix{2, 3, {1, -2, 3, 4, 5, -6}} << std::vector<int>{5, 3, -3} << std::vector<int>{1, -2, -6} << std::vector<int>{4, 5, 3} << std::vector<double>{2.5, 1.5, -1.5};
+    QTest::newRow("3: single row") << IntMatrix{1, 4, {1, -2, 3, -4}} << std::vector<int>{1, -2, 3, -4} << std::vector<int>{1, -2, 3, -4} << std::vector<int>{1, -2, 3, -4} << std::vector<double>{1.0, -2.0, 3.0, -4.0};
+    QTest::newRow("4: more than four rows") << IntMatrix{6, 2, {-5, 0, -2, 3, 1, -5, 4, -2, -4, 1, -1, 4}} << std::vector<int>{-7, 1} << std::vector<int>{-5, -5} << std::vector<int>{4, 4} << std::vector<double>{-7.0 / 6.0, 1.0 / 6.0};
+}
+
+void ArithmeticTests::testIntMatrixDiagonalReductions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<int>>("expectedDiagonalSums");
+    QTest::addColumn<std::vector<int>>("expectedAntiDiagonalSums");
+
+    QTest::newRow("1: single element") << IntMatrix{1, 1, {-3}} << std::vector<int>{-3} << std::vector<int>{-3};
+    QTest::newRow("2: more columns than rows") << IntMatrix{2, 3, {1, -2, 3, 4, 5, -6}} << std::vector<int>{4, 6, -8, 3} << std::vector<int>{-6, 8, 2, 1};
+    QTest::newRow("3: more rows than columns") << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}} << std::vector<int>{5, 9, 5, 2} << std::vector<int>{6, 9, 5, 1};
+    QTest::newRow("4: square matrix") << IntMatrix{3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9}} << std::vector<int>{7, 12, 15, 8, 3} << std::vector<int>{9, 14, 15, 6, 1};
+    QTest::newRow("5: single row") << IntMatrix{1, 4, {1, -2, 3, -4}} << std::vector<int>{1, -2, 3, -4} << std::vector<int>{-4, 3, -2, 1};
+}
+
+QTEST_APPLESS_MAIN(ArithmeticTests)
+
+#include "tst_arithmetictests.moc"
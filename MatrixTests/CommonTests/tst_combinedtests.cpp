@@ -2,6 +2,8 @@
 #include <QTest>
 
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include "matrix.h"
 
@@ -19,6 +21,12 @@ private slots:
     // test functions
     void testIntMatrixCatByColumnWithModifiedColumnCapacityOffset();
     void testStringMatrixCatByColumnWithModifiedColumnCapacityOffset();
+    void testIntMatrixColumnsShiftingWithReorderedRows();
+    void testStringMatrixColumnsShiftingWithReorderedRows();
+    void testIntMatrixTransposeWithModifiedCapacityOffset();
+    void testStringMatrixTransposeWithModifiedCapacityOffset();
+    void testIntMatrixTransposeWithExecutionPolicy();
+    void testStringMatrixTransposeWithExecutionPolicy();
 };
 
 void CombinedTests::testIntMatrixCatByColumnWithModifiedColumnCapacityOffset()
@@ -277,6 +285,352 @@ void CombinedTests::testStringMatrixCatByColumnWithModifiedColumnCapacityOffset(
     }
 }
 
+void CombinedTests::testIntMatrixColumnsShiftingWithReorderedRows()
+{
+    // case 1: multi-way concatenation within capacity after flipping vertically, the columns are shifted to the left
+    {
+        IntMatrix destMatrix{3, 2, {1, 2, 3, 4, 5, 6}};
+        IntMatrix firstSrcMatrix{3, 1, {7, 8, 9}};
+        IntMatrix secondSrcMatrix{3, 1, {10, 11, 12}};
+        const IntMatrix c_ResultingMatrix{3, 4, {5, 6, 7, 10, 3, 4, 8, 11, 1, 2, 9, 12}};
+
+        destMatrix.reserve(3, 4);
+        destMatrix.flipVertical();
+
+        QVERIFY(destMatrix.getColumnCapacity() == 4 && destMatrix.getColumnCapacityOffset() == 1);
+
+        destMatrix.concatColumns(std::vector<IntMatrix*>{&firstSrcMatrix, &secondSrcMatrix});
+
+        QVERIFY(destMatrix == c_ResultingMatrix);
+        QVERIFY(destMatrix.getColumnCapacity() == 4 && destMatrix.getColumnCapacityOffset() == 0);
+        QVERIFY(firstSrcMatrix.isEmpty() && secondSrcMatrix.isEmpty());
+    }
+
+    // case 2: concatenation within capacity after permuting the rows, the columns are shifted to the left
+    {
+        IntMatrix destMatrix{3, 2, {1, 2, 3, 4, 5, 6}};
+        IntMatrix srcMatrix{3, 2, {7, 8, 9, 10, 11, 12}};
+        const IntMatrix c_ResultingMatrix{3, 4, {5, 6, 7, 8, 1, 2, 9, 10, 3, 4, 11, 12}};
+
+        destMatrix.reserve(3, 4);
+        destMatrix.permuteRows({2, 0, 1});
+
+        QVERIFY(destMatrix.getColumnCapacity() == 4 && destMatrix.getColumnCapacityOffset() == 1);
+
+        destMatrix.catByColumn(srcMatrix);
+
+        QVERIFY(destMatrix == c_ResultingMatrix);
+        QVERIFY(destMatrix.getColumnCapacity() == 4 && destMatrix.getColumnCapacityOffset() == 0);
+        QVERIFY(srcMatrix.isEmpty());
+    }
+
+    // case 3: resizing within capacity after swapping rows, the columns are shifted to the left
+    {
+        IntMatrix matrix{3, 2, {1, 2, 3, 4, 5, 6}};
+        const IntMatrix c_ResultingMatrix{3, 4, {5, 6, 0, 0, 3, 4, 0, 0, 1, 2, 0, 0}};
+
+        matrix.reserve(3, 4);
+        matrix.swapRows(0, 2);
+
+        QVERIFY(matrix.getColumnCapacity() == 4 && matrix.getColumnCapacityOffset() == 1);
+
+        matrix.resize(3, 4, 0);
+
+        QVERIFY(matrix == c_ResultingMatrix);
+        QVERIFY(matrix.getColumnCapacity() == 4 && matrix.getColumnCapacityOffset() == 0);
+    }
+}
+
+void CombinedTests::testStringMatrixColumnsShiftingWithReorderedRows()
+{
+    // case 1: multi-way concatenation within capacity after flipping vertically, the columns are shifted to the left
+    {
+        StringMatrix destMatrix{3, 2, {"1", "2", "3", "4", "5", "6"}};
+        StringMatrix firstSrcMatrix{3, 1, {"7", "8", "9"}};
+        StringMatrix secondSrcMatrix{3, 1, {"10", "11", "12"}};
+        const StringMatrix c_ResultingMatrix{3, 4, {"5", "6", "7", "10", "3", "4", "8", "11", "1", "2", "9", "12"}};
+
+        destMatrix.reserve(3, 4);
+        destMatrix.flipVertical();
+
+        QVERIFY(destMatrix.getColumnCapacity() == 4 && destMatrix.getColumnCapacityOffset() == 1);
+
+        destMatrix.concatColumns(std::vector<StringMatrix*>{&firstSrcMatrix, &secondSrcMatrix});
+
+        QVERIFY(destMatrix == c_ResultingMatrix);
+        QVERIFY(destMatrix.getColumnCapacity() == 4 && destMatrix.getColumnCapacityOffset() == 0);
+        QVERIFY(firstSrcMatrix.isEmpty() && secondSrcMatrix.isEmpty());
+    }
+
+    // case 2: concatenation within capacity after permuting the rows, the columns are shifted to the left
+    {
+        StringMatrix destMatrix{3, 2, {"1", "2", "3", "4", "5", "6"}};
+        StringMatrix srcMatrix{3, 2, {"7", "8", "9", "10", "11", "12"}};
+        const StringMatrix c_ResultingMatrix{3, 4, {"5", "6", "7", "8", "1", "2", "9", "10", "3", "4", "11", "12"}};
+
+        destMatrix.reserve(3, 4);
+        destMatrix.permuteRows({2, 0, 1});
+
+        QVERIFY(destMatrix.getColumnCapacity() == 4 && destMatrix.getColumnCapacityOffset() == 1);
+
+        destMatrix.catByColumn(srcMatrix);
+
+        QVERIFY(destMatrix == c_ResultingMatrix);
+        QVERIFY(destMatrix.getColumnCapacity() == 4 && destMatrix.getColumnCapacityOffset() == 0);
+        QVERIFY(srcMatrix.isEmpty());
+    }
+
+    // case 3: resizing within capacity after swapping rows, the columns are shifted to the left
+    {
+        StringMatrix matrix{3, 2, {"1", "2", "3", "4", "5", "6"}};
+        const StringMatrix c_ResultingMatrix{3, 4, {"5", "6", "0", "0", "3", "4", "0", "0", "1", "2", "0", "0"}};
+
+        matrix.reserve(3, 4);
+        matrix.swapRows(0, 2);
+
+        QVERIFY(matrix.getColumnCapacity() == 4 && matrix.getColumnCapacityOffset() == 1);
+
+        matrix.resize(3, 4, "0");
+
+        QVERIFY(matrix == c_ResultingMatrix);
+        QVERIFY(matrix.getColumnCapacity() == 4 && matrix.getColumnCapacityOffset() == 0);
+    }
+}
+
+void CombinedTests::testIntMatrixTransposeWithModifiedCapacityOffset()
+{
+    // case 1: square matrix, centered capacity offsets, swapped rows
+    {
+        IntMatrix matrix{3, 3, {1, -2, 3, -4, 5, -6, 7, -8, 9}};
+        const IntMatrix c_ResultingMatrix{3, 3, {7, -4, 1, -8, 5, -2, 9, -6, 3}};
+
+        matrix.reserve(5, 5);
+        matrix.swapRows(0, 2);
+
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 1);
+
+        matrix.transpose();
+
+        QVERIFY(matrix == c_ResultingMatrix);
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 1);
+    }
+
+    // case 2: square matrix, modified row capacity offset
+    {
+        IntMatrix matrix{3, 3, {1, -2, 3, -4, 5, -6, 7, -8, 9}};
+        const IntMatrix c_ResultingMatrix{3, 3, {-4, 7, -10, 5, -8, -10, -6, 9, -10}};
+
+        matrix.reserve(5, 5);
+        matrix.insertRow(3, -10);
+        matrix.eraseRow(0);
+
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 2);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 1);
+
+        matrix.transpose();
+
+        QVERIFY(matrix == c_ResultingMatrix);
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 1);
+    }
+
+    // case 3: rectangular matrix, modified column capacity offset
+    {
+        IntMatrix matrix{2, 3, {1, -2, 3, -4, 5, -6}};
+        const IntMatrix c_ResultingMatrix{4, 2, {7, 7, 1, -4, -2, 5, 3, -6}};
+
+        matrix.reserve(4, 5);
+        matrix.insertColumn(0, 7);
+
+        QVERIFY(matrix.getRowCapacity() == 4 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 0);
+
+        matrix.transpose();
+
+        QVERIFY(matrix == c_ResultingMatrix);
+        QVERIFY(matrix.getRowCapacity() == 4 && matrix.getRowCapacityOffset() == 0);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 1);
+    }
+
+    // case 4: rectangular matrix, swapped rows
+    {
+        IntMatrix matrix{2, 3, {1, -2, 3, -4, 5, -6}};
+        const IntMatrix c_ResultingMatrix{3, 2, {-4, 1, 5, -2, -6, 3}};
+
+        matrix.reserve(5, 3);
+        matrix.swapRows(0, 1);
+
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 3 && matrix.getColumnCapacityOffset() == 0);
+
+        matrix.transpose();
+
+        QVERIFY(matrix == c_ResultingMatrix);
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 3 && matrix.getColumnCapacityOffset() == 0);
+    }
+}
+
+void CombinedTests::testStringMatrixTransposeWithModifiedCapacityOffset()
+{
+    // case 1: square matrix, centered capacity offsets, swapped rows
+    {
+        StringMatrix matrix{3, 3, {"1a", "-2B", "3c", "-4D", "5e", "-6F", "7g", "-8H", "9i"}};
+        const StringMatrix c_ResultingMatrix{3, 3, {"7g", "-4D", "1a", "-8H", "5e", "-2B", "9i", "-6F", "3c"}};
+
+        matrix.reserve(5, 5);
+        matrix.swapRows(0, 2);
+
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 1);
+
+        matrix.transpose();
+
+        QVERIFY(matrix == c_ResultingMatrix);
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 1);
+    }
+
+    // case 2: square matrix, modified row capacity offset
+    {
+        StringMatrix matrix{3, 3, {"1a", "-2B", "3c", "-4D", "5e", "-6F", "7g", "-8H", "9i"}};
+        const StringMatrix c_ResultingMatrix{3, 3, {"-4D", "7g", "-10J", "5e", "-8H", "-10J", "-6F", "9i", "-10J"}};
+
+        matrix.reserve(5, 5);
+        matrix.insertRow(3, "-10J");
+        matrix.eraseRow(0);
+
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 2);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 1);
+
+        matrix.transpose();
+
+        QVERIFY(matrix == c_ResultingMatrix);
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 1);
+    }
+
+    // case 3: rectangular matrix, modified column capacity offset
+    {
+        StringMatrix matrix{2, 3, {"1a", "-2B", "3c", "-4D", "5e", "-6F"}};
+        const StringMatrix c_ResultingMatrix{4, 2, {"7g", "7g", "1a", "-4D", "-2B", "5e", "3c", "-6F"}};
+
+        matrix.reserve(4, 5);
+        matrix.insertColumn(0, "7g");
+
+        QVERIFY(matrix.getRowCapacity() == 4 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 0);
+
+        matrix.transpose();
+
+        QVERIFY(matrix == c_ResultingMatrix);
+        QVERIFY(matrix.getRowCapacity() == 4 && matrix.getRowCapacityOffset() == 0);
+        QVERIFY(matrix.getColumnCapacity() == 5 && matrix.getColumnCapacityOffset() == 1);
+    }
+
+    // case 4: rectangular matrix, swapped rows
+    {
+        StringMatrix matrix{2, 3, {"1a", "-2B", "3c", "-4D", "5e", "-6F"}};
+        const StringMatrix c_ResultingMatrix{3, 2, {"-4D", "1a", "5e", "-2B", "-6F", "3c"}};
+
+        matrix.reserve(5, 3);
+        matrix.swapRows(0, 1);
+
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 3 && matrix.getColumnCapacityOffset() == 0);
+
+        matrix.transpose();
+
+        QVERIFY(matrix == c_ResultingMatrix);
+        QVERIFY(matrix.getRowCapacity() == 5 && matrix.getRowCapacityOffset() == 1);
+        QVERIFY(matrix.getColumnCapacity() == 3 && matrix.getColumnCapacityOffset() == 0);
+    }
+}
+
+void CombinedTests::testIntMatrixTransposeWithExecutionPolicy()
+{
+    // (number of rows, number of columns, reserved row capacity, reserved column capacity) for square (parallel, in place) and rectangular (in place or re-allocated) transposition
+    const std::vector<std::tuple<IntMatrix::size_type, IntMatrix::size_type, IntMatrix::size_type, IntMatrix::size_type>> c_Setups{{100, 100, 100, 100}, {100, 100, 120, 120}, {70, 45, 90, 90}, {45, 70, 45, 70}, {1, 80, 1, 80}, {80, 1, 80, 1}};
+
+    for (const auto& [nrOfRows, nrOfColumns, rowCapacity, columnCapacity] : c_Setups)
+    {
+        for (size_t nrOfThreads : {1u, 2u, 3u, 8u})
+        {
+            IntMatrix matrix{{nrOfRows, nrOfColumns}, 0};
+
+            for (IntMatrix::size_type rowNr{0}; rowNr < nrOfRows; ++rowNr)
+            {
+                for (IntMatrix::size_type columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+                {
+                    matrix.at(rowNr, columnNr) = static_cast<int>(rowNr * 1000 + columnNr);
+                }
+            }
+
+            matrix.reserve(rowCapacity, columnCapacity);
+            matrix.swapRows(0, nrOfRows - 1);
+
+            IntMatrix expectedMatrix{matrix};
+            expectedMatrix.reserve(rowCapacity, columnCapacity);
+            expectedMatrix.transpose();
+
+            matrix.transpose(Matr::ExecutionPolicy{nrOfThreads});
+
+            QVERIFY(matrix == expectedMatrix);
+            QVERIFY(matrix.getRowCapacity() == expectedMatrix.getRowCapacity() && matrix.getRowCapacityOffset() == expectedMatrix.getRowCapacityOffset());
+            QVERIFY(matrix.getColumnCapacity() == expectedMatrix.getColumnCapacity() && matrix.getColumnCapacityOffset() == expectedMatrix.getColumnCapacityOffset());
+            QVERIFY(matrix.at(0, nrOfRows - 1) == 0 && matrix.at(nrOfColumns - 1, 0) == static_cast<int>((nrOfRows - 1) * 1000 + nrOfColumns - 1));
+        }
+    }
+
+    // rectangular matrix with enough capacity: transposed within the allocated memory (no matter how many threads are requested)
+    IntMatrix matrix{{40, 60}, 1};
+    matrix.reserve(60, 60);
+
+    const int* const c_pAllocationBegin{&matrix.at(0, 0) - (*matrix.getRowCapacityOffset() * matrix.getColumnCapacity() + *matrix.getColumnCapacityOffset())};
+    matrix.transpose(Matr::ExecutionPolicy{4});
+
+    QVERIFY(&matrix.at(0, 0) >= c_pAllocationBegin && &matrix.at(0, 0) < c_pAllocationBegin + 60 * 60);
+    QVERIFY(matrix == IntMatrix({60, 40}, 1));
+}
+
+void CombinedTests::testStringMatrixTransposeWithExecutionPolicy()
+{
+    // (number of rows, number of columns, reserved row capacity, reserved column capacity) for square (parallel, in place) and rectangular (in place or re-allocated) transposition
+    const std::vector<std::tuple<StringMatrix::size_type, StringMatrix::size_type, StringMatrix::size_type, StringMatrix::size_type>> c_Setups{{100, 100, 100, 100}, {100, 100, 120, 120}, {70, 45, 90, 90}, {45, 70, 45, 70}, {1, 80, 1, 80}, {80, 1, 80, 1}};
+
+    for (const auto& [nrOfRows, nrOfColumns, rowCapacity, columnCapacity] : c_Setups)
+    {
+        for (size_t nrOfThreads : {1u, 2u, 3u, 8u})
+        {
+            StringMatrix matrix{{nrOfRows, nrOfColumns}, std::to_string(0)};
+
+            for (StringMatrix::size_type rowNr{0}; rowNr < nrOfRows; ++rowNr)
+            {
+                for (StringMatrix::size_type columnNr{0}; columnNr < nrOfColumns; ++columnNr)
+                {
+                    matrix.at(rowNr, columnNr) = std::to_string(rowNr * 1000 + columnNr);
+                }
+            }
+
+            matrix.reserve(rowCapacity, columnCapacity);
+            matrix.swapRows(0, nrOfRows - 1);
+
+            StringMatrix expectedMatrix{matrix};
+            expectedMatrix.reserve(rowCapacity, columnCapacity);
+            expectedMatrix.transpose();
+
+            matrix.transpose(Matr::ExecutionPolicy{nrOfThreads});
+
+            QVERIFY(matrix == expectedMatrix);
+            QVERIFY(matrix.getRowCapacity() == expectedMatrix.getRowCapacity() && matrix.getRowCapacityOffset() == expectedMatrix.getRowCapacityOffset());
+            QVERIFY(matrix.getColumnCapacity() == expectedMatrix.getColumnCapacity() && matrix.getColumnCapacityOffset() == expectedMatrix.getColumnCapacityOffset());
+            QVERIFY(matrix.at(0, nrOfRows - 1) == std::to_string(0) && matrix.at(nrOfColumns - 1, 0) == std::to_string((nrOfRows - 1) * 1000 + nrOfColumns - 1));
+        }
+    }
+}
+
 QTEST_APPLESS_MAIN(CombinedTests)
 
 #include "tst_combinedtests.moc"
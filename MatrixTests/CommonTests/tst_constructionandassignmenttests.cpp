@@ -22,38 +22,47 @@ private slots:
     void testIntMatrixDefaultConstructor();
     void testIntMatrixVectorConstructor();
     void testIntMatrixIdenticalElementsConstructor();
+    void testIntMatrixUninitializedConstructor();
     void testIntMatrixDiagonalMatrixConstructor();
     void testIntMatrixCopyConstructor();
     void testIntMatrixMoveConstructor();
     void testIntMatrixCopyAssignmentOperator();
     void testIntMatrixMoveAssignmentOperator();
+    void testIntMatrixBuilder();
     void testIntMatrixAdditionalAssignmentOperatorTests();
 
     void testStringMatrixDefaultConstructor();
     void testStringMatrixVectorConstructor();
     void testStringMatrixIdenticalElementsConstructor();
+    void testStringMatrixUninitializedConstructor();
     void testStringMatrixDiagonalMatrixConstructor();
     void testStringMatrixCopyConstructor();
     void testStringMatrixMoveConstructor();
     void testStringMatrixCopyAssignmentOperator();
     void testStringMatrixMoveAssignmentOperator();
+    void testStringMatrixBuilder();
+    void testStringMatrixBuilderAssignment();
     void testStringMatrixAdditionalAssignmentOperatorTests();
 
     void testIntMatrixVectorConstructor_data();
     void testIntMatrixIdenticalElementsConstructor_data();
+    void testIntMatrixUninitializedConstructor_data();
     void testIntMatrixDiagonalMatrixConstructor_data();
     void testIntMatrixCopyConstructor_data();
     void testIntMatrixMoveConstructor_data();
     void testIntMatrixCopyAssignmentOperator_data();
     void testIntMatrixMoveAssignmentOperator_data();
+    void testIntMatrixBuilder_data();
 
     void testStringMatrixVectorConstructor_data();
     void testStringMatrixIdenticalElementsConstructor_data();
+    void testStringMatrixUninitializedConstructor_data();
     void testStringMatrixDiagonalMatrixConstructor_data();
     void testStringMatrixCopyConstructor_data();
     void testStringMatrixMoveConstructor_data();
     void testStringMatrixCopyAssignmentOperator_data();
     void testStringMatrixMoveAssignmentOperator_data();
+    void testStringMatrixBuilder_data();
 
 
 private:
@@ -108,6 +117,21 @@ void ConstructionAndAssignmentTests::testIntMatrixIdenticalElementsConstructor()
     CHECK_ELEMENTS_ARE_IDENTICAL_AND_HAVE_CORRECT_VALUE(matrix, elementValue, "Matrix elements have not been correctly initialized by the identical elements constructor");
 }
 
+void ConstructionAndAssignmentTests::testIntMatrixUninitializedConstructor()
+{
+    QFETCH(matrix_size_t, rowsCount);
+    QFETCH(matrix_size_t, columnsCount);
+    QFETCH(matrix_size_t, expectedRowCapacity);
+    QFETCH(matrix_size_t, expectedColumnCapacity);
+    QFETCH(matrix_opt_size_t, expectedRowCapacityOffset);
+    QFETCH(matrix_opt_size_t, expectedColumnCapacityOffset);
+
+    IntMatrix matrix{{rowsCount, columnsCount}, Matr::uninitialized};
+
+    // int elements are not initialized so only the size and capacity can be checked
+    TEST_UNINITIALIZED_CONSTRUCTOR_CHECK_MATRIX_SIZE_AND_CAPACITY(matrix, rowsCount, columnsCount, expectedRowCapacity, expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);
+}
+
 void ConstructionAndAssignmentTests::testIntMatrixDiagonalMatrixConstructor()
 {
     QFETCH(matrix_size_t, rowsColumnsCount);
@@ -212,6 +236,11 @@ void ConstructionAndAssignmentTests::testIntMatrixMoveAssignmentOperator()
     TEST_MOVE_ASSIGNMENT_OPERATOR(int, srcRowsCount, srcColumnsCount, srcInitList, destRowsCount, destColumnsCount, destInitList, expectedRowCapacity, expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset, isSelfAssigned);
 }
 
+void ConstructionAndAssignmentTests::testIntMatrixBuilder()
+{
+    TEST_MATRIX_BUILDER(int);
+}
+
 void ConstructionAndAssignmentTests::testIntMatrixAdditionalAssignmentOperatorTests()
 {
     {
@@ -315,6 +344,21 @@ void ConstructionAndAssignmentTests::testStringMatrixIdenticalElementsConstructo
     CHECK_ELEMENTS_ARE_IDENTICAL_AND_HAVE_CORRECT_VALUE(matrix, elementValue, "Matrix elements have not been correctly initialized by the identical elements constructor");
 }
 
+void ConstructionAndAssignmentTests::testStringMatrixUninitializedConstructor()
+{
+    QFETCH(matrix_size_t, rowsCount);
+    QFETCH(matrix_size_t, columnsCount);
+    QFETCH(matrix_size_t, expectedRowCapacity);
+    QFETCH(matrix_size_t, expectedColumnCapacity);
+    QFETCH(matrix_opt_size_t, expectedRowCapacityOffset);
+    QFETCH(matrix_opt_size_t, expectedColumnCapacityOffset);
+
+    StringMatrix matrix{{rowsCount, columnsCount}, Matr::uninitialized};
+
+    TEST_UNINITIALIZED_CONSTRUCTOR_CHECK_MATRIX_SIZE_AND_CAPACITY(matrix, rowsCount, columnsCount, expectedRowCapacity, expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);
+    CHECK_ELEMENTS_ARE_IDENTICAL_AND_HAVE_CORRECT_VALUE(matrix, std::string{}, "Matrix elements have not been default constructed by the uninitialized constructor");
+}
+
 void ConstructionAndAssignmentTests::testStringMatrixDiagonalMatrixConstructor()
 {
     QFETCH(matrix_size_t, rowsColumnsCount);
@@ -419,6 +463,27 @@ void ConstructionAndAssignmentTests::testStringMatrixMoveAssignmentOperator()
     TEST_MOVE_ASSIGNMENT_OPERATOR(std::string, srcRowsCount, srcColumnsCount, srcInitList, destRowsCount, destColumnsCount, destInitList, expectedRowCapacity, expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset, isSelfAssigned);
 }
 
+void ConstructionAndAssignmentTests::testStringMatrixBuilder()
+{
+    TEST_MATRIX_BUILDER(std::string);
+}
+
+void ConstructionAndAssignmentTests::testStringMatrixBuilderAssignment()
+{
+    MatrixBuilder<std::string> firstBuilder{2};
+    MatrixBuilder<std::string> secondBuilder{3};
+
+    secondBuilder.appendRow(std::vector<std::string>{"a", "b", "c"});
+    firstBuilder = secondBuilder;
+    firstBuilder.appendRow(std::vector<std::string>{"d", "e", "f"});
+
+    QVERIFY2(firstBuilder.getNrOfColumns() == 3 && firstBuilder.finish() == StringMatrix(2, 3, {"a", "b", "c", "d", "e", "f"}), "Copy assignment of matrix builder failed, the resulting matrix is not correct!");
+
+    firstBuilder = std::move(secondBuilder);
+
+    QVERIFY2(firstBuilder.getNrOfColumns() == 3 && firstBuilder.finish() == StringMatrix(1, 3, {"a", "b", "c"}), "Move assignment of matrix builder failed, the resulting matrix is not correct!");
+}
+
 void ConstructionAndAssignmentTests::testStringMatrixAdditionalAssignmentOperatorTests()
 {
     {
@@ -518,6 +583,19 @@ void ConstructionAndAssignmentTests::testIntMatrixIdenticalElementsConstructor_d
     QTest::newRow("2: large size matrix") << matrix_size_t{10u} << matrix_size_t{8u} << -5 << matrix_size_t{12u} << matrix_size_t{10u} << matrix_opt_size_t{1u} << matrix_opt_size_t{1u};
 }
 
+void ConstructionAndAssignmentTests::testIntMatrixUninitializedConstructor_data()
+{
+    QTest::addColumn<matrix_size_t>("rowsCount");
+    QTest::addColumn<matrix_size_t>("columnsCount");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+
+    QTest::newRow("1: small size matrix") << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("2: large size matrix") << matrix_size_t{10u} << matrix_size_t{8u} << matrix_size_t{12u} << matrix_size_t{10u} << matrix_opt_size_t{1u} << matrix_opt_size_t{1u};
+}
+
 void ConstructionAndAssignmentTests::testIntMatrixDiagonalMatrixConstructor_data()
 {
     QTest::addColumn<matrix_size_t>("rowsColumnsCount");
@@ -550,6 +628,21 @@ void ConstructionAndAssignmentTests::testIntMatrixMoveAssignmentOperator_data()
     _buildIntMatrixMoveCopyAssignmentOperatorsTestingTable();
 }
 
+void ConstructionAndAssignmentTests::testIntMatrixBuilder_data()
+{
+    QTest::addColumn<matrix_size_t>("nrOfColumns");
+    QTest::addColumn<matrix_size_t>("rowCapacity");
+    QTest::addColumn<std::vector<std::vector<int>>>("rows");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: columns count determined by first row") << matrix_size_t{0u} << matrix_size_t{0u} << std::vector<std::vector<int>>{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}, {10, 11, 12}, {13, 14, 15}} << matrix_size_t{8u} << IntMatrix{5, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}};
+    QTest::newRow("2: columns count provided") << matrix_size_t{3u} << matrix_size_t{0u} << std::vector<std::vector<int>>{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}, {10, 11, 12}} << matrix_size_t{4u} << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("3: row capacity reserved") << matrix_size_t{2u} << matrix_size_t{6u} << std::vector<std::vector<int>>{{1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}} << matrix_size_t{6u} << IntMatrix{5, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}};
+    QTest::newRow("4: reserved row capacity exceeded") << matrix_size_t{2u} << matrix_size_t{3u} << std::vector<std::vector<int>>{{1, 2}, {3, 4}, {5, 6}, {7, 8}} << matrix_size_t{6u} << IntMatrix{4, 2, {1, 2, 3, 4, 5, 6, 7, 8}};
+    QTest::newRow("5: single row") << matrix_size_t{0u} << matrix_size_t{0u} << std::vector<std::vector<int>>{{1, 2, 3, 4}} << matrix_size_t{1u} << IntMatrix{1, 4, {1, 2, 3, 4}};
+}
+
 void ConstructionAndAssignmentTests::testStringMatrixVectorConstructor_data()
 {
     QTest::addColumn<matrix_size_t>("rowsCount");
@@ -589,6 +682,19 @@ void ConstructionAndAssignmentTests::testStringMatrixIdenticalElementsConstructo
     QTest::newRow("2: large size matrix") << matrix_size_t{10u} << matrix_size_t{8u} << std::string{"_Fifth"} << matrix_size_t{12u} << matrix_size_t{10u} << matrix_opt_size_t{1u} << matrix_opt_size_t{1u};
 }
 
+void ConstructionAndAssignmentTests::testStringMatrixUninitializedConstructor_data()
+{
+    QTest::addColumn<matrix_size_t>("rowsCount");
+    QTest::addColumn<matrix_size_t>("columnsCount");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+
+    QTest::newRow("1: small size matrix") << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("2: large size matrix") << matrix_size_t{10u} << matrix_size_t{8u} << matrix_size_t{12u} << matrix_size_t{10u} << matrix_opt_size_t{1u} << matrix_opt_size_t{1u};
+}
+
 void ConstructionAndAssignmentTests::testStringMatrixDiagonalMatrixConstructor_data()
 {
     QTest::addColumn<matrix_size_t>("rowsColumnsCount");
@@ -621,6 +727,21 @@ void ConstructionAndAssignmentTests::testStringMatrixMoveAssignmentOperator_data
     _buildStringMatrixMoveCopyAssignmentOperatorsTestingTable();
 }
 
+void ConstructionAndAssignmentTests::testStringMatrixBuilder_data()
+{
+    QTest::addColumn<matrix_size_t>("nrOfColumns");
+    QTest::addColumn<matrix_size_t>("rowCapacity");
+    QTest::addColumn<std::vector<std::vector<std::string>>>("rows");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: columns count determined by first row") << matrix_size_t{0u} << matrix_size_t{0u} << std::vector<std::vector<std::string>>{{"First", "Second", "Third"}, {"Fourth", "Fifth", "Sixth"}, {"Seventh", "Eighth", "Ninth"}, {"Tenth", "Eleventh", "Twelfth"}, {"Thirteenth", "Fourteenth", "Fifteenth"}} << matrix_size_t{8u} << StringMatrix{5, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth"}};
+    QTest::newRow("2: columns count provided") << matrix_size_t{3u} << matrix_size_t{0u} << std::vector<std::vector<std::string>>{{"First", "Second", "Third"}, {"Fourth", "Fifth", "Sixth"}, {"Seventh", "Eighth", "Ninth"}, {"Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{4u} << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("3: row capacity reserved") << matrix_size_t{2u} << matrix_size_t{6u} << std::vector<std::vector<std::string>>{{"First", "Second"}, {"Third", "Fourth"}, {"Fifth", "Sixth"}, {"Seventh", "Eighth"}, {"Ninth", "Tenth"}} << matrix_size_t{6u} << StringMatrix{5, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth"}};
+    QTest::newRow("4: reserved row capacity exceeded") << matrix_size_t{2u} << matrix_size_t{3u} << std::vector<std::vector<std::string>>{{"First", "Second"}, {"Third", "Fourth"}, {"Fifth", "Sixth"}, {"Seventh", "Eighth"}} << matrix_size_t{6u} << StringMatrix{4, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth"}};
+    QTest::newRow("5: single row") << matrix_size_t{0u} << matrix_size_t{0u} << std::vector<std::vector<std::string>>{{"First", "Second", "Third", "Fourth"}} << matrix_size_t{1u} << StringMatrix{1, 4, {"First", "Second", "Third", "Fourth"}};
+}
+
 void ConstructionAndAssignmentTests::_buildIntMatrixMoveCopyConstructorsTestingTable()
 {
     QTest::addColumn<matrix_size_t>("rowsCount");
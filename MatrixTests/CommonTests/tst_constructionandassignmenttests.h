@@ -27,6 +27,16 @@
         "Identical matrix constructor initialized matrix with wrong capacity!",                                        \
         "Identical matrix constructor initialized matrix with wrong capacity offset!")
 
+#define TEST_UNINITIALIZED_CONSTRUCTOR_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                 \
+    matrix, requiredNrOfRows, requiredNrOfColumns, requiredRowCapacity, requiredColumnCapacity,                        \
+    requiredRowCapacityOffset, requiredColumnCapacityOffset)                                                           \
+    CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                                    \
+        matrix, requiredNrOfRows, requiredNrOfColumns, requiredRowCapacity, requiredColumnCapacity,                    \
+        requiredRowCapacityOffset, requiredColumnCapacityOffset,                                                       \
+        "Uninitialized constructor initialized matrix with wrong number of rows and columns!",                         \
+        "Uninitialized constructor initialized matrix with wrong capacity!",                                           \
+        "Uninitialized constructor initialized matrix with wrong capacity offset!")
+
 #define TEST_DIAGONAL_MATRIX_CONSTRUCTOR_CHECK_MATRIX_SIZE_AND_CAPACITY(                                               \
     matrix, requiredNrOfRows, requiredNrOfColumns, requiredRowCapacity, requiredColumnCapacity,                        \
     requiredRowCapacityOffset, requiredColumnCapacityOffset)                                                           \
@@ -220,3 +230,39 @@
                                                                                                                        \
         QVERIFY(destMatrix.isEmpty());                                                                                 \
     }
+
+#define TEST_MATRIX_BUILDER(matrixType)                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, nrOfColumns);                                                                \
+    QFETCH(Matrix<matrixType>::size_type, rowCapacity);                                                                \
+    QFETCH(std::vector<std::vector<matrixType>>, rows);                                                                \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    MatrixBuilder<matrixType> builder{nrOfColumns, rowCapacity};                                                       \
+    MatrixBuilder<matrixType> moveBuilder{nrOfColumns, rowCapacity};                                                   \
+                                                                                                                       \
+    for (std::vector<matrixType>& row : rows)                                                                          \
+    {                                                                                                                  \
+        builder.appendRow(row);                                                                                        \
+        moveBuilder.appendRow(std::move(row));                                                                         \
+    }                                                                                                                  \
+                                                                                                                       \
+    QVERIFY2(builder.getNrOfRows() == expectedMatrix.getNrOfRows() &&                                                  \
+                 builder.getNrOfColumns() == expectedMatrix.getNrOfColumns() &&                                        \
+                 builder.getRowCapacity() == expectedRowCapacity,                                                      \
+             "Matrix builder has wrong number of rows, columns or wrong row capacity!");                               \
+                                                                                                                       \
+    Matrix<matrixType> matrix{builder.finish()};                                                                       \
+                                                                                                                       \
+    CHECK_MATRIX_SIZE_AND_CAPACITY(matrix, expectedMatrix.getNrOfRows(), expectedMatrix.getNrOfColumns(),              \
+                                   expectedRowCapacity, expectedMatrix.getNrOfColumns(), std::optional{0u},            \
+                                   std::optional{0u},                                                                  \
+                                   "Matrix builder created matrix with wrong number of rows and columns!",             \
+                                   "Matrix builder created matrix with wrong capacity!",                               \
+                                   "Matrix builder created matrix with wrong capacity offset!");                       \
+                                                                                                                       \
+    QVERIFY2(matrix == expectedMatrix, "Matrix builder created matrix with wrong element values!");                    \
+    QVERIFY2(builder.getNrOfRows() == 0 && builder.getNrOfColumns() == nrOfColumns && builder.getRowCapacity() == 0,   \
+             "Matrix builder has not been reset after finishing the matrix!");                                         \
+    QVERIFY2(moveBuilder.finish() == expectedMatrix,                                                                   \
+             "Matrix builder created matrix with wrong element values when moving the rows!");
@@ -0,0 +1,387 @@
+// clang-format off
+#include <QTest>
+
+#include <cmath>
+#include <vector>
+
+#include "matrix.h"
+
+using DoubleMatrix = Matrix<double>;
+
+Q_DECLARE_METATYPE(DoubleMatrix)
+
+class LinearAlgebraTests : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // test functions
+    void testLUDecomposition();
+    void testDeterminant();
+    void testSolve();
+    void testInverse();
+    void testSolveLargeSystem();
+    void testCholesky();
+    void testCholeskySolve();
+    void testCholeskyWithExecutionPolicy();
+    void testQRDecomposition();
+    void testLeastSquares();
+    void testTallMatrixLeastSquares();
+
+    // test data
+    void testLUDecomposition_data();
+    void testDeterminant_data();
+    void testSolve_data();
+    void testInverse_data();
+    void testCholesky_data();
+    void testCholeskySolve_data();
+    void testQRDecomposition_data();
+    void testLeastSquares_data();
+
+private:
+    // the floating point results might slightly differ from the exact ones
+    bool _areNearlyEqual(const DoubleMatrix& firstMatrix, const DoubleMatrix& secondMatrix);
+
+    // checks that Q has orthonormal columns, R is upper triangular and their product is the decomposed matrix
+    bool _isValidQRDecomposition(const DoubleMatrix& matrix, const DoubleMatrix& orthogonalMatrix, const DoubleMatrix& upperMatrix);
+};
+
+void LinearAlgebraTests::testLUDecomposition()
+{
+    QFETCH(DoubleMatrix, matrix);
+    QFETCH(std::vector<matrix_size_t>, expectedPermutation);
+
+    const auto [c_LowerMatrix, c_UpperMatrix, c_Permutation]{luDecompose(matrix)};
+
+    QVERIFY2(c_Permutation == expectedPermutation, "LU decomposition failed, the row permutation is not correct!");
+
+    for (matrix_size_t rowNr{0}; rowNr < matrix.getNrOfRows(); ++rowNr)
+    {
+        QVERIFY2(c_LowerMatrix.at(rowNr, rowNr) == 1.0, "LU decomposition failed, the lower matrix doesn't have a unit diagonal!");
+
+        for (matrix_size_t columnNr{static_cast<matrix_size_t>(rowNr + 1)}; columnNr < matrix.getNrOfColumns(); ++columnNr)
+        {
+            QVERIFY2(c_LowerMatrix.at(rowNr, columnNr) == 0.0, "LU decomposition failed, the lower matrix is not lower triangular!");
+            QVERIFY2(c_UpperMatrix.at(columnNr, rowNr) == 0.0, "LU decomposition failed, the upper matrix is not upper triangular!");
+        }
+    }
+
+    DoubleMatrix permutedMatrix{matrix};
+    permutedMatrix.permuteRows(c_Permutation);
+
+    QVERIFY2(_areNearlyEqual(multiply(c_LowerMatrix, c_UpperMatrix), permutedMatrix), "LU decomposition failed, the product of the factors differs from the permuted matrix!");
+}
+
+void LinearAlgebraTests::testDeterminant()
+{
+    QFETCH(DoubleMatrix, matrix);
+    QFETCH(double, expectedDeterminant);
+
+    QCOMPARE(determinant(matrix), expectedDeterminant);
+}
+
+void LinearAlgebraTests::testSolve()
+{
+    QFETCH(DoubleMatrix, firstMatrix);
+    QFETCH(DoubleMatrix, secondMatrix);
+    QFETCH(DoubleMatrix, expectedMatrix);
+
+    QVERIFY2(_areNearlyEqual(solve(firstMatrix, secondMatrix), expectedMatrix), "Solving the linear system failed, the resulting matrix is not correct!");
+}
+
+void LinearAlgebraTests::testInverse()
+{
+    QFETCH(DoubleMatrix, matrix);
+    QFETCH(DoubleMatrix, expectedMatrix);
+
+    QVERIFY2(_areNearlyEqual(inverse(matrix), expectedMatrix), "Matrix inversion failed, the resulting matrix is not correct!");
+}
+
+void LinearAlgebraTests::testSolveLargeSystem()
+{
+    const matrix_size_t c_Size{120};
+    const matrix_size_t c_NrOfRightHandSides{7};
+
+    DoubleMatrix matrix{{c_Size, c_Size}, 0.0};
+    DoubleMatrix expectedMatrix{{c_Size, c_NrOfRightHandSides}, 0.0};
+
+    for (matrix_size_t rowNr{0}; rowNr < c_Size; ++rowNr)
+    {
+        for (matrix_size_t columnNr{0}; columnNr < c_Size; ++columnNr)
+        {
+            matrix.at(rowNr, columnNr) = (rowNr * 7 + columnNr * 3) % 11 - 5 + (rowNr == columnNr ? 60 : 0);
+        }
+
+        for (matrix_size_t columnNr{0}; columnNr < c_NrOfRightHandSides; ++columnNr)
+        {
+            expectedMatrix.at(rowNr, columnNr) = (rowNr + columnNr * 5) % 9 - 4;
+        }
+    }
+
+    // swapping the first rows forces pivoting
+    matrix.swapRows(0, 1);
+
+    const DoubleMatrix c_RightHandSides{multiply(matrix, expectedMatrix)};
+
+    QVERIFY2(_areNearlyEqual(solve(matrix, c_RightHandSides), expectedMatrix), "Solving the linear system failed, the resulting matrix is not correct!");
+    QVERIFY2(_areNearlyEqual(multiply(matrix, inverse(matrix)), DoubleMatrix{c_Size, {0.0, 1.0}}), "Matrix inversion failed, the resulting matrix is not correct!");
+}
+
+void LinearAlgebraTests::testCholesky()
+{
+    QFETCH(DoubleMatrix, matrix);
+    QFETCH(DoubleMatrix, expectedMatrix);
+
+    cholesky(matrix);
+
+    QVERIFY2(_areNearlyEqual(matrix, expectedMatrix), "Cholesky decomposition failed, the resulting matrix is not correct!");
+}
+
+void LinearAlgebraTests::testCholeskySolve()
+{
+    QFETCH(DoubleMatrix, firstMatrix);
+    QFETCH(DoubleMatrix, secondMatrix);
+    QFETCH(DoubleMatrix, expectedMatrix);
+
+    cholesky(firstMatrix);
+
+    QVERIFY2(_areNearlyEqual(choleskySolve(firstMatrix, secondMatrix), expectedMatrix), "Solving the linear system failed, the resulting matrix is not correct!");
+}
+
+void LinearAlgebraTests::testCholeskyWithExecutionPolicy()
+{
+    for (matrix_size_t size : {5, 48, 100, 127})
+    {
+        DoubleMatrix factorMatrix{{size, size}, 0.0};
+
+        // a (random-like) lower triangular matrix with positive diagonal is the Cholesky factor of the product with its transpose
+        for (matrix_size_t rowNr{0}; rowNr < size; ++rowNr)
+        {
+            for (matrix_size_t columnNr{0}; columnNr < rowNr; ++columnNr)
+            {
+                factorMatrix.at(rowNr, columnNr) = (rowNr * 5 + columnNr * 3) % 7 - 3;
+            }
+
+            factorMatrix.at(rowNr, rowNr) = rowNr % 4 + 1;
+        }
+
+        DoubleMatrix transposedFactorMatrix{factorMatrix};
+        transposedFactorMatrix.transpose();
+
+        const DoubleMatrix c_Matrix{multiply(factorMatrix, transposedFactorMatrix)};
+
+        for (size_t nrOfThreads : {1u, 2u, 3u, 8u})
+        {
+            DoubleMatrix matrix{c_Matrix};
+            cholesky(matrix, Matr::ExecutionPolicy{nrOfThreads});
+
+            QVERIFY2(_areNearlyEqual(matrix, factorMatrix), "Cholesky decomposition failed, the resulting matrix is not correct!");
+        }
+    }
+}
+
+void LinearAlgebraTests::testQRDecomposition()
+{
+    QFETCH(DoubleMatrix, matrix);
+    QFETCH(std::vector<double>, expectedAbsoluteDiagonal);
+
+    const auto [c_OrthogonalMatrix, c_UpperMatrix]{qr(matrix)};
+
+    QVERIFY2(_isValidQRDecomposition(matrix, c_OrthogonalMatrix, c_UpperMatrix), "QR decomposition failed, the resulting matrixes are not correct!");
+
+    for (matrix_size_t rowNr{0}; rowNr < c_UpperMatrix.getNrOfRows(); ++rowNr)
+    {
+        QVERIFY2(_areNearlyEqual(DoubleMatrix{1, 1, {std::abs(c_UpperMatrix.at(rowNr, rowNr))}}, DoubleMatrix{1, 1, {expectedAbsoluteDiagonal[rowNr]}}), "QR decomposition failed, the diagonal of the upper matrix is not correct!");
+    }
+}
+
+void LinearAlgebraTests::testLeastSquares()
+{
+    QFETCH(DoubleMatrix, firstMatrix);
+    QFETCH(DoubleMatrix, secondMatrix);
+    QFETCH(DoubleMatrix, expectedMatrix);
+
+    QVERIFY2(_areNearlyEqual(leastSquares(firstMatrix, secondMatrix), expectedMatrix), "Solving the least squares problem failed, the resulting matrix is not correct!");
+}
+
+void LinearAlgebraTests::testTallMatrixLeastSquares()
+{
+    // multiple panels (including a partial one), one of the columns having null elements below the diagonal
+    const matrix_size_t c_NrOfRows{127};
+    const matrix_size_t c_NrOfColumns{37};
+    const matrix_size_t c_NrOfRightHandSides{3};
+
+    DoubleMatrix matrix{{c_NrOfRows, c_NrOfColumns}, 0.0};
+    DoubleMatrix rightHandSides{{c_NrOfRows, c_NrOfRightHandSides}, 0.0};
+
+    for (matrix_size_t rowNr{0}; rowNr < c_NrOfRows; ++rowNr)
+    {
+        for (matrix_size_t columnNr{0}; columnNr < c_NrOfColumns; ++columnNr)
+        {
+            matrix.at(rowNr, columnNr) = columnNr == 20 && rowNr > 20 ? 0.0 : std::sin(rowNr * 0.7 + columnNr * 1.3) + (rowNr == columnNr ? 2.0 : 0.0);
+        }
+
+        for (matrix_size_t columnNr{0}; columnNr < c_NrOfRightHandSides; ++columnNr)
+        {
+            rightHandSides.at(rowNr, columnNr) = std::cos(rowNr * 0.3 + columnNr);
+        }
+    }
+
+    const auto [c_OrthogonalMatrix, c_UpperMatrix]{qr(matrix)};
+
+    QVERIFY2(_isValidQRDecomposition(matrix, c_OrthogonalMatrix, c_UpperMatrix), "QR decomposition failed, the resulting matrixes are not correct!");
+
+    // the residuals should be orthogonal to the columns of the matrix (normal equations)
+    DoubleMatrix transposedMatrix{matrix};
+    transposedMatrix.transpose();
+
+    const DoubleMatrix c_Solution{leastSquares(matrix, rightHandSides)};
+    const DoubleMatrix c_Residuals{multiply(matrix, c_Solution) - rightHandSides};
+
+    QVERIFY2(_areNearlyEqual(multiply(transposedMatrix, c_Residuals), DoubleMatrix{{c_NrOfColumns, c_NrOfRightHandSides}, 0.0}), "Solving the least squares problem failed, the resulting matrix is not correct!");
+}
+
+void LinearAlgebraTests::testLUDecomposition_data()
+{
+    QTest::addColumn<DoubleMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("expectedPermutation");
+
+    QTest::newRow("1: single element") << DoubleMatrix{1, 1, {5.0}} << std::vector<matrix_size_t>{0};
+    QTest::newRow("2: two rows, pivoting") << DoubleMatrix{2, 2, {1.0, 2.0, 3.0, 4.0}} << std::vector<matrix_size_t>{1, 0};
+    QTest::newRow("3: three rows, no pivoting") << DoubleMatrix{3, 3, {2.0, -1.0, 0.0, -1.0, 2.0, -1.0, 0.0, -1.0, 2.0}} << std::vector<matrix_size_t>{0, 1, 2};
+    QTest::newRow("4: three rows, pivoting") << DoubleMatrix{3, 3, {0.0, 1.0, 2.0, 1.0, 0.0, 3.0, 4.0, -3.0, 8.0}} << std::vector<matrix_size_t>{2, 0, 1};
+    QTest::newRow("5: singular matrix") << DoubleMatrix{3, 3, {1.0, 2.0, 3.0, 2.0, 4.0, 6.0, 1.0, 1.0, 1.0}} << std::vector<matrix_size_t>{1, 2, 0};
+}
+
+void LinearAlgebraTests::testDeterminant_data()
+{
+    QTest::addColumn<DoubleMatrix>("matrix");
+    QTest::addColumn<double>("expectedDeterminant");
+
+    QTest::newRow("1: single element") << DoubleMatrix{1, 1, {-5.0}} << -5.0;
+    QTest::newRow("2: two rows") << DoubleMatrix{2, 2, {1.0, 2.0, 3.0, 4.0}} << -2.0;
+    QTest::newRow("3: diagonal matrix") << DoubleMatrix{3, 3, {2.0, 0.0, 0.0, 0.0, 3.0, 0.0, 0.0, 0.0, 4.0}} << 24.0;
+    QTest::newRow("4: permutation matrix") << DoubleMatrix{3, 3, {0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0}} << -1.0;
+    QTest::newRow("5: tridiagonal matrix") << DoubleMatrix{3, 3, {2.0, -1.0, 0.0, -1.0, 2.0, -1.0, 0.0, -1.0, 2.0}} << 4.0;
+    QTest::newRow("6: singular matrix") << DoubleMatrix{3, 3, {1.0, 2.0, 3.0, 2.0, 4.0, 6.0, 1.0, 1.0, 1.0}} << 0.0;
+}
+
+void LinearAlgebraTests::testSolve_data()
+{
+    QTest::addColumn<DoubleMatrix>("firstMatrix");
+    QTest::addColumn<DoubleMatrix>("secondMatrix");
+    QTest::addColumn<DoubleMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single element") << DoubleMatrix{1, 1, {2.0}} << DoubleMatrix{1, 1, {6.0}} << DoubleMatrix{1, 1, {3.0}};
+    QTest::newRow("2: single right-hand side") << DoubleMatrix{2, 2, {2.0, 1.0, 1.0, 3.0}} << DoubleMatrix{2, 1, {4.0, 7.0}} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("3: multiple right-hand sides") << DoubleMatrix{3, 3, {0.0, 1.0, 2.0, 1.0, 0.0, 3.0, 4.0, -3.0, 8.0}} << DoubleMatrix{3, 2, {5.0, 2.0, 10.0, 5.0, 31.0, 16.0}} << DoubleMatrix{3, 2, {1.0, 2.0, -1.0, 0.0, 3.0, 1.0}};
+}
+
+void LinearAlgebraTests::testInverse_data()
+{
+    QTest::addColumn<DoubleMatrix>("matrix");
+    QTest::addColumn<DoubleMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single element") << DoubleMatrix{1, 1, {2.0}} << DoubleMatrix{1, 1, {0.5}};
+    QTest::newRow("2: two rows") << DoubleMatrix{2, 2, {4.0, 7.0, 2.0, 6.0}} << DoubleMatrix{2, 2, {0.6, -0.7, -0.2, 0.4}};
+    QTest::newRow("3: diagonal matrix") << DoubleMatrix{3, 3, {2.0, 0.0, 0.0, 0.0, 4.0, 0.0, 0.0, 0.0, 8.0}} << DoubleMatrix{3, 3, {0.5, 0.0, 0.0, 0.0, 0.25, 0.0, 0.0, 0.0, 0.125}};
+    QTest::newRow("4: three rows") << DoubleMatrix{3, 3, {1.0, 2.0, 3.0, 0.0, 1.0, 4.0, 5.0, 6.0, 0.0}} << DoubleMatrix{3, 3, {-24.0, 18.0, 5.0, 20.0, -15.0, -4.0, -5.0, 4.0, 1.0}};
+}
+
+void LinearAlgebraTests::testCholesky_data()
+{
+    QTest::addColumn<DoubleMatrix>("matrix");
+    QTest::addColumn<DoubleMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single element") << DoubleMatrix{1, 1, {9.0}} << DoubleMatrix{1, 1, {3.0}};
+    QTest::newRow("2: diagonal matrix") << DoubleMatrix{2, 2, {4.0, 0.0, 0.0, 16.0}} << DoubleMatrix{2, 2, {2.0, 0.0, 0.0, 4.0}};
+    QTest::newRow("3: three rows") << DoubleMatrix{3, 3, {4.0, 12.0, -16.0, 12.0, 37.0, -43.0, -16.0, -43.0, 98.0}} << DoubleMatrix{3, 3, {2.0, 0.0, 0.0, 6.0, 1.0, 0.0, -8.0, 5.0, 3.0}};
+    QTest::newRow("4: upper triangle not read") << DoubleMatrix{3, 3, {4.0, -1.0, -1.0, 12.0, 37.0, -1.0, -16.0, -43.0, 98.0}} << DoubleMatrix{3, 3, {2.0, 0.0, 0.0, 6.0, 1.0, 0.0, -8.0, 5.0, 3.0}};
+}
+
+void LinearAlgebraTests::testCholeskySolve_data()
+{
+    QTest::addColumn<DoubleMatrix>("firstMatrix");
+    QTest::addColumn<DoubleMatrix>("secondMatrix");
+    QTest::addColumn<DoubleMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single element") << DoubleMatrix{1, 1, {4.0}} << DoubleMatrix{1, 1, {6.0}} << DoubleMatrix{1, 1, {1.5}};
+    QTest::newRow("2: single right-hand side") << DoubleMatrix{2, 2, {2.0, 1.0, 1.0, 3.0}} << DoubleMatrix{2, 1, {4.0, 7.0}} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("3: multiple right-hand sides") << DoubleMatrix{3, 3, {4.0, 12.0, -16.0, 12.0, 37.0, -43.0, -16.0, -43.0, 98.0}} << DoubleMatrix{3, 2, {-56.0, 4.0, -154.0, 18.0, 321.0, 23.0}} << DoubleMatrix{3, 2, {1.0, 2.0, -1.0, 1.0, 3.0, 1.0}};
+}
+
+void LinearAlgebraTests::testQRDecomposition_data()
+{
+    QTest::addColumn<DoubleMatrix>("matrix");
+    QTest::addColumn<std::vector<double>>("expectedAbsoluteDiagonal");
+
+    QTest::newRow("1: single element") << DoubleMatrix{1, 1, {-3.0}} << std::vector<double>{3.0};
+    QTest::newRow("2: single column") << DoubleMatrix{3, 1, {2.0, -1.0, 2.0}} << std::vector<double>{3.0};
+    QTest::newRow("3: square matrix") << DoubleMatrix{2, 2, {3.0, 1.0, 4.0, 2.0}} << std::vector<double>{5.0, 0.4};
+    QTest::newRow("4: tall matrix") << DoubleMatrix{3, 2, {3.0, 0.0, 4.0, 0.0, 0.0, 5.0}} << std::vector<double>{5.0, 5.0};
+    QTest::newRow("5: upper triangular matrix") << DoubleMatrix{3, 3, {1.0, 2.0, 3.0, 0.0, 4.0, 5.0, 0.0, 0.0, 6.0}} << std::vector<double>{1.0, 4.0, 6.0};
+    QTest::newRow("6: rank deficient matrix") << DoubleMatrix{3, 2, {1.0, 2.0, 2.0, 4.0, 2.0, 4.0}} << std::vector<double>{3.0, 0.0};
+}
+
+void LinearAlgebraTests::testLeastSquares_data()
+{
+    QTest::addColumn<DoubleMatrix>("firstMatrix");
+    QTest::addColumn<DoubleMatrix>("secondMatrix");
+    QTest::addColumn<DoubleMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single element") << DoubleMatrix{1, 1, {2.0}} << DoubleMatrix{1, 1, {6.0}} << DoubleMatrix{1, 1, {3.0}};
+    QTest::newRow("2: square matrix") << DoubleMatrix{2, 2, {2.0, 1.0, 1.0, 3.0}} << DoubleMatrix{2, 1, {4.0, 7.0}} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("3: exact line fit") << DoubleMatrix{4, 2, {1.0, 0.0, 1.0, 1.0, 1.0, 2.0, 1.0, 3.0}} << DoubleMatrix{4, 1, {1.0, 3.0, 5.0, 7.0}} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("4: line fit with residuals") << DoubleMatrix{3, 2, {1.0, 0.0, 1.0, 1.0, 1.0, 2.0}} << DoubleMatrix{3, 1, {1.0, 2.0, 2.0}} << DoubleMatrix{2, 1, {7.0 / 6.0, 0.5}};
+    QTest::newRow("5: multiple right-hand sides") << DoubleMatrix{3, 2, {1.0, 0.0, 1.0, 1.0, 1.0, 2.0}} << DoubleMatrix{3, 2, {1.0, 1.0, 3.0, 2.0, 5.0, 2.0}} << DoubleMatrix{2, 2, {1.0, 7.0 / 6.0, 2.0, 0.5}};
+}
+
+bool LinearAlgebraTests::_areNearlyEqual(const DoubleMatrix& firstMatrix, const DoubleMatrix& secondMatrix)
+{
+    bool areNearlyEqual{firstMatrix.getNrOfRows() == secondMatrix.getNrOfRows() && firstMatrix.getNrOfColumns() == secondMatrix.getNrOfColumns()};
+
+    for (matrix_size_t rowNr{0}; areNearlyEqual && rowNr < firstMatrix.getNrOfRows(); ++rowNr)
+    {
+        for (matrix_size_t columnNr{0}; areNearlyEqual && columnNr < firstMatrix.getNrOfColumns(); ++columnNr)
+        {
+            const double c_FirstElement{firstMatrix.at(rowNr, columnNr)};
+            const double c_SecondElement{secondMatrix.at(rowNr, columnNr)};
+
+            areNearlyEqual = std::abs(c_FirstElement - c_SecondElement) <= 1e-9 * (1.0 + std::abs(c_FirstElement) + std::abs(c_SecondElement));
+        }
+    }
+
+    return areNearlyEqual;
+}
+
+bool LinearAlgebraTests::_isValidQRDecomposition(const DoubleMatrix& matrix, const DoubleMatrix& orthogonalMatrix, const DoubleMatrix& upperMatrix)
+{
+    const matrix_size_t c_NrOfColumns{matrix.getNrOfColumns()};
+
+    bool isValid{orthogonalMatrix.getNrOfRows() == matrix.getNrOfRows() && orthogonalMatrix.getNrOfColumns() == c_NrOfColumns &&
+                 upperMatrix.getNrOfRows() == c_NrOfColumns && upperMatrix.getNrOfColumns() == c_NrOfColumns};
+
+    for (matrix_size_t rowNr{1}; isValid && rowNr < c_NrOfColumns; ++rowNr)
+    {
+        for (matrix_size_t columnNr{0}; isValid && columnNr < rowNr; ++columnNr)
+        {
+            isValid = upperMatrix.at(rowNr, columnNr) == 0.0;
+        }
+    }
+
+    if (isValid)
+    {
+        DoubleMatrix transposedOrthogonalMatrix{orthogonalMatrix};
+        transposedOrthogonalMatrix.transpose();
+
+        isValid = _areNearlyEqual(multiply(orthogonalMatrix, upperMatrix), matrix) &&
+                  _areNearlyEqual(multiply(transposedOrthogonalMatrix, orthogonalMatrix), DoubleMatrix{c_NrOfColumns, {0.0, 1.0}});
+    }
+
+    return isValid;
+}
+
+QTEST_APPLESS_MAIN(LinearAlgebraTests)
+
+#include "tst_linearalgebratests.moc"
+// clang-format on
@@ -18,6 +18,8 @@ private slots:
     void testIntMatrixReserve();
     void testIntMatrixResizeWithDefaultNewValues();
     void testIntMatrixResizeAndSetNewValues();
+    void testIntMatrixResizeForOverwrite();
+    void testIntMatrixReshape();
     void testIntMatrixReserveAndResizeWithDefaultNewValues();
     void testIntMatrixReserveAndResizeWithSetNewValues();
     void testIntMatrixShrinkToFit();
@@ -27,15 +29,28 @@ private slots:
     void testIntMatrixInsertColumnSetValue();
     void testIntMatrixInsertMultipleRowsSetValue();
     void testIntMatrixInsertMultipleColumnsSetValue();
+    void testIntMatrixInsertRowsSetValue();
+    void testIntMatrixInsertColumnsSetValue();
+    void testIntMatrixInsertRowsFromRange();
+    void testIntMatrixInsertColumnsFromRange();
+    void testIntMatrixInsertRowFromRange();
+    void testIntMatrixInsertColumnFromRange();
+    void testIntMatrixEmplaceRow();
+    void testIntMatrixEmplaceColumn();
     void testIntMatrixEraseRow();
     void testIntMatrixEraseMultipleRows();
     void testIntMatrixEraseColumn();
     void testIntMatrixEraseMultipleColumns();
+    void testIntMatrixEraseRows();
+    void testIntMatrixEraseColumns();
+    void testIntMatrixEraseRowsIf();
     void testIntMatrixClear();
 
     void testStringMatrixReserve();
     void testStringMatrixResizeWithDefaultNewValues();
     void testStringMatrixResizeAndSetNewValues();
+    void testStringMatrixResizeForOverwrite();
+    void testStringMatrixReshape();
     void testStringMatrixReserveAndResizeWithDefaultNewValues();
     void testStringMatrixReserveAndResizeWithSetNewValues();
     void testStringMatrixShrinkToFit();
@@ -45,16 +60,29 @@ private slots:
     void testStringMatrixInsertColumnSetValue();
     void testStringMatrixInsertMultipleRowsSetValue();
     void testStringMatrixInsertMultipleColumnsSetValue();
+    void testStringMatrixInsertRowsSetValue();
+    void testStringMatrixInsertColumnsSetValue();
+    void testStringMatrixInsertRowsFromRange();
+    void testStringMatrixInsertColumnsFromRange();
+    void testStringMatrixInsertRowFromRange();
+    void testStringMatrixInsertColumnFromRange();
+    void testStringMatrixEmplaceRow();
+    void testStringMatrixEmplaceColumn();
     void testStringMatrixEraseRow();
     void testStringMatrixEraseMultipleRows();
     void testStringMatrixEraseColumn();
     void testStringMatrixEraseMultipleColumns();
+    void testStringMatrixEraseRows();
+    void testStringMatrixEraseColumns();
+    void testStringMatrixEraseRowsIf();
     void testStringMatrixClear();
 
     // test data
     void testIntMatrixReserve_data();
     void testIntMatrixResizeWithDefaultNewValues_data();
     void testIntMatrixResizeAndSetNewValues_data();
+    void testIntMatrixResizeForOverwrite_data();
+    void testIntMatrixReshape_data();
     void testIntMatrixReserveAndResizeWithDefaultNewValues_data();
     void testIntMatrixReserveAndResizeWithSetNewValues_data();
     void testIntMatrixShrinkToFit_data();
@@ -64,15 +92,28 @@ private slots:
     void testIntMatrixInsertColumnSetValue_data();
     void testIntMatrixInsertMultipleRowsSetValue_data();
     void testIntMatrixInsertMultipleColumnsSetValue_data();
+    void testIntMatrixInsertRowsSetValue_data();
+    void testIntMatrixInsertColumnsSetValue_data();
+    void testIntMatrixInsertRowsFromRange_data();
+    void testIntMatrixInsertColumnsFromRange_data();
+    void testIntMatrixInsertRowFromRange_data();
+    void testIntMatrixInsertColumnFromRange_data();
+    void testIntMatrixEmplaceRow_data();
+    void testIntMatrixEmplaceColumn_data();
     void testIntMatrixEraseRow_data();
     void testIntMatrixEraseMultipleRows_data();
     void testIntMatrixEraseColumn_data();
     void testIntMatrixEraseMultipleColumns_data();
+    void testIntMatrixEraseRows_data();
+    void testIntMatrixEraseColumns_data();
+    void testIntMatrixEraseRowsIf_data();
     void testIntMatrixClear_data();
 
     void testStringMatrixReserve_data();
     void testStringMatrixResizeWithDefaultNewValues_data();
     void testStringMatrixResizeAndSetNewValues_data();
+    void testStringMatrixResizeForOverwrite_data();
+    void testStringMatrixReshape_data();
     void testStringMatrixReserveAndResizeWithDefaultNewValues_data();
     void testStringMatrixReserveAndResizeWithSetNewValues_data();
     void testStringMatrixShrinkToFit_data();
@@ -82,16 +123,29 @@ private slots:
     void testStringMatrixInsertColumnSetValue_data();
     void testStringMatrixInsertMultipleRowsSetValue_data();
     void testStringMatrixInsertMultipleColumnsSetValue_data();
+    void testStringMatrixInsertRowsSetValue_data();
+    void testStringMatrixInsertColumnsSetValue_data();
+    void testStringMatrixInsertRowsFromRange_data();
+    void testStringMatrixInsertColumnsFromRange_data();
+    void testStringMatrixInsertRowFromRange_data();
+    void testStringMatrixInsertColumnFromRange_data();
+    void testStringMatrixEmplaceRow_data();
+    void testStringMatrixEmplaceColumn_data();
     void testStringMatrixEraseRow_data();
     void testStringMatrixEraseMultipleRows_data();
     void testStringMatrixEraseColumn_data();
     void testStringMatrixEraseMultipleColumns_data();
+    void testStringMatrixEraseRows_data();
+    void testStringMatrixEraseColumns_data();
+    void testStringMatrixEraseRowsIf_data();
     void testStringMatrixClear_data();
 
 private:
     // test data helper methods
     void _buildIntMatrixInsertRowTestingTable();
     void _buildIntMatrixInsertColumnTestingTable();
+    void _buildStringMatrixInsertRowTestingTable();
+    void _buildStringMatrixInsertColumnTestingTable();
 
     IntMatrix mPrimaryIntMatrix;
     StringMatrix mPrimaryStringMatrix;
@@ -124,6 +178,16 @@ void ResizingTests::testIntMatrixResizeAndSetNewValues()
     TEST_MATRIX_RESIZE_WITH_DEFAULT_CAPACITY_AND_SET_NEW_VALUES(int);
 }
 
+void ResizingTests::testIntMatrixResizeForOverwrite()
+{
+    TEST_MATRIX_RESIZE_FOR_OVERWRITE(int);
+}
+
+void ResizingTests::testIntMatrixReshape()
+{
+    TEST_MATRIX_RESHAPE(int);
+}
+
 void ResizingTests::testIntMatrixReserveAndResizeWithDefaultNewValues()
 {
     QFETCH(IntMatrix, matrix);
@@ -240,6 +304,46 @@ void ResizingTests::testIntMatrixInsertMultipleColumnsSetValue()
     TEST_MATRIX_INSERT_MULTIPLE_COLUMNS_SET_VALUE(int);
 }
 
+void ResizingTests::testIntMatrixInsertRowsSetValue()
+{
+    TEST_MATRIX_INSERT_ROWS_SET_VALUE(int);
+}
+
+void ResizingTests::testIntMatrixInsertColumnsSetValue()
+{
+    TEST_MATRIX_INSERT_COLUMNS_SET_VALUE(int);
+}
+
+void ResizingTests::testIntMatrixInsertRowsFromRange()
+{
+    TEST_MATRIX_INSERT_ROWS_FROM_RANGE(int);
+}
+
+void ResizingTests::testIntMatrixInsertColumnsFromRange()
+{
+    TEST_MATRIX_INSERT_COLUMNS_FROM_RANGE(int);
+}
+
+void ResizingTests::testIntMatrixInsertRowFromRange()
+{
+    TEST_MATRIX_INSERT_ROW_FROM_RANGE(int);
+}
+
+void ResizingTests::testIntMatrixInsertColumnFromRange()
+{
+    TEST_MATRIX_INSERT_COLUMN_FROM_RANGE(int);
+}
+
+void ResizingTests::testIntMatrixEmplaceRow()
+{
+    TEST_MATRIX_EMPLACE_ROW(int);
+}
+
+void ResizingTests::testIntMatrixEmplaceColumn()
+{
+    TEST_MATRIX_EMPLACE_COLUMN(int);
+}
+
 void ResizingTests::testIntMatrixEraseRow()
 {
     TEST_MATRIX_ERASE_ROW(int);
@@ -260,6 +364,21 @@ void ResizingTests::testIntMatrixEraseMultipleColumns()
     TEST_MATRIX_ERASE_MULTIPLE_COLUMNS(int);
 }
 
+void ResizingTests::testIntMatrixEraseRows()
+{
+    TEST_MATRIX_ERASE_ROWS(int);
+}
+
+void ResizingTests::testIntMatrixEraseColumns()
+{
+    TEST_MATRIX_ERASE_COLUMNS(int);
+}
+
+void ResizingTests::testIntMatrixEraseRowsIf()
+{
+    TEST_MATRIX_ERASE_ROWS_IF(int);
+}
+
 void ResizingTests::testIntMatrixClear()
 {
     TEST_MATRIX_CLEAR(int, mPrimaryIntMatrix);
@@ -293,6 +412,16 @@ void ResizingTests::testStringMatrixResizeAndSetNewValues()
     TEST_MATRIX_RESIZE_WITH_DEFAULT_CAPACITY_AND_SET_NEW_VALUES(std::string);
 }
 
+void ResizingTests::testStringMatrixResizeForOverwrite()
+{
+    TEST_MATRIX_RESIZE_FOR_OVERWRITE(std::string);
+}
+
+void ResizingTests::testStringMatrixReshape()
+{
+    TEST_MATRIX_RESHAPE(std::string);
+}
+
 void ResizingTests::testStringMatrixReserveAndResizeWithDefaultNewValues()
 {
     QFETCH(StringMatrix, matrix);
@@ -376,6 +505,46 @@ void ResizingTests::testStringMatrixInsertMultipleColumnsSetValue()
     TEST_MATRIX_INSERT_MULTIPLE_COLUMNS_SET_VALUE(std::string);
 }
 
+void ResizingTests::testStringMatrixInsertRowsSetValue()
+{
+    TEST_MATRIX_INSERT_ROWS_SET_VALUE(std::string);
+}
+
+void ResizingTests::testStringMatrixInsertColumnsSetValue()
+{
+    TEST_MATRIX_INSERT_COLUMNS_SET_VALUE(std::string);
+}
+
+void ResizingTests::testStringMatrixInsertRowsFromRange()
+{
+    TEST_MATRIX_INSERT_ROWS_FROM_RANGE(std::string);
+}
+
+void ResizingTests::testStringMatrixInsertColumnsFromRange()
+{
+    TEST_MATRIX_INSERT_COLUMNS_FROM_RANGE(std::string);
+}
+
+void ResizingTests::testStringMatrixInsertRowFromRange()
+{
+    TEST_MATRIX_INSERT_ROW_FROM_RANGE(std::string);
+}
+
+void ResizingTests::testStringMatrixInsertColumnFromRange()
+{
+    TEST_MATRIX_INSERT_COLUMN_FROM_RANGE(std::string);
+}
+
+void ResizingTests::testStringMatrixEmplaceRow()
+{
+    TEST_MATRIX_EMPLACE_ROW(std::string);
+}
+
+void ResizingTests::testStringMatrixEmplaceColumn()
+{
+    TEST_MATRIX_EMPLACE_COLUMN(std::string);
+}
+
 void ResizingTests::testStringMatrixEraseRow()
 {
     TEST_MATRIX_ERASE_ROW(std::string);
@@ -396,6 +565,21 @@ void ResizingTests::testStringMatrixEraseMultipleColumns()
     TEST_MATRIX_ERASE_MULTIPLE_COLUMNS(std::string);
 }
 
+void ResizingTests::testStringMatrixEraseRows()
+{
+    TEST_MATRIX_ERASE_ROWS(std::string);
+}
+
+void ResizingTests::testStringMatrixEraseColumns()
+{
+    TEST_MATRIX_ERASE_COLUMNS(std::string);
+}
+
+void ResizingTests::testStringMatrixEraseRowsIf()
+{
+    TEST_MATRIX_ERASE_ROWS_IF(std::string);
+}
+
 void ResizingTests::testStringMatrixClear()
 {
     TEST_MATRIX_CLEAR(std::string, mPrimaryStringMatrix);
@@ -516,6 +700,47 @@ void ResizingTests::testIntMatrixResizeAndSetNewValues_data()
     QTest::newRow("28: equal rows, equal columns") << IntMatrix{3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9}} << matrix_size_t{3u} << matrix_size_t{3u} << -1 << matrix_size_t{3u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9}};
 }
 
+void ResizingTests::testIntMatrixResizeForOverwrite_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("requestedRowsCount");
+    QTest::addColumn<matrix_size_t>("requestedColumnsCount");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+
+    QTest::newRow("1: equal rows, less columns") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{4u} << matrix_size_t{2u} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("2: less rows, equal columns") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u};
+    QTest::newRow("3: more rows, more columns") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{5u} << matrix_size_t{4u} << matrix_size_t{5u} << matrix_size_t{4u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("4: less rows, more columns") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{3u} << matrix_size_t{4u} << matrix_size_t{5u} << matrix_size_t{4u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u};
+    QTest::newRow("5: more rows, more columns") << IntMatrix{} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("6: less rows, less columns") << c_IntMatrix1_10x9 << matrix_size_t{7u} << matrix_size_t{7u} << matrix_size_t{12u} << matrix_size_t{11u} << matrix_opt_size_t{2u} << matrix_opt_size_t{2u};
+    QTest::newRow("7: more rows, more columns") << c_IntMatrix1_10x9 << matrix_size_t{12u} << matrix_size_t{11u} << matrix_size_t{12u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("8: more rows, equal columns") << c_IntMatrix1_10x9 << matrix_size_t{13u} << matrix_size_t{9u} << matrix_size_t{13u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u};
+}
+
+void ResizingTests::testIntMatrixReshape_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("requestedRowsCount");
+    QTest::addColumn<matrix_size_t>("requestedColumnsCount");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: less rows, more columns, contiguous storage") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{2u} << matrix_size_t{6u} << matrix_size_t{2u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{2, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("2: more rows, less columns, contiguous storage") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{6u} << matrix_size_t{2u} << matrix_size_t{7u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{6, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("3: single column, contiguous storage") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{12u} << matrix_size_t{1u} << matrix_size_t{15u} << matrix_size_t{1u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{12, 1, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("4: single row, contiguous storage") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{1u} << matrix_size_t{12u} << matrix_size_t{1u} << matrix_size_t{12u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{1, 12, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("5: equal rows, equal columns") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{4u} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("6: less rows, more columns, free column capacity") << IntMatrix{4, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{2u} << matrix_size_t{8u} << matrix_size_t{2u} << matrix_size_t{8u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{2, 8, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+    QTest::newRow("7: less rows, more columns, first row not aligned") << IntMatrix{8, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{4u} << matrix_size_t{4u} << matrix_size_t{4u} << matrix_size_t{4u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{4, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+    QTest::newRow("8: more rows, less columns, first row aligned") << IntMatrix{8, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{16u} << matrix_size_t{1u} << matrix_size_t{20u} << matrix_size_t{1u} << matrix_opt_size_t{2u} << matrix_opt_size_t{0u} << IntMatrix{16, 1, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+}
+
 void ResizingTests::testIntMatrixReserveAndResizeWithDefaultNewValues_data()
 {
     QTest::addColumn<IntMatrix>("matrix");
@@ -653,6 +878,122 @@ void ResizingTests::testIntMatrixInsertMultipleColumnsSetValue_data()
     QTest::newRow("16: append, then insert in the middle") << c_IntMatrix1_10x9 << std::vector<matrix_size_t>{9u, 5u} << 5 << matrix_size_t{12u} << matrix_size_t{11u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << c_IntMatrix3d_10x11;
 }
 
+void ResizingTests::testIntMatrixInsertRowsSetValue_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<matrix_size_t>("insertedRowsCount");
+    QTest::addColumn<int>("insertedRowValue");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at beginning position") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{2u} << -1 << matrix_size_t{8u} << matrix_size_t{3u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{6, 3, {-1, -1, -1, -1, -1, -1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("2: insert at random position") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{2u} << matrix_size_t{3u} << -1 << matrix_size_t{8u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{7, 3, {1, 2, 3, 4, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("3: insert at end position") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{4u} << matrix_size_t{1u} << -1 << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{5, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, -1, -1, -1}};
+    QTest::newRow("4: insert at random position") << IntMatrix{8, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{1u} << matrix_size_t{2u} << -1 << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{10, 2, {1, 2, -1, -1, -1, -1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+    QTest::newRow("5: insert at random position") << IntMatrix{8, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{7u} << matrix_size_t{1u} << -1 << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{9, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, -1, -1, 15, 16}};
+    QTest::newRow("6: insert at end position") << IntMatrix{8, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{8u} << matrix_size_t{2u} << -1 << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{10, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, -1, -1, -1, -1}};
+    QTest::newRow("7: insert at random position") << IntMatrix{8, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{3u} << matrix_size_t{3u} << -1 << matrix_size_t{16u} << matrix_size_t{2u} << matrix_opt_size_t{2u} << matrix_opt_size_t{0u} << IntMatrix{11, 2, {1, 2, 3, 4, 5, 6, -1, -1, -1, -1, -1, -1, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+}
+
+void ResizingTests::testIntMatrixInsertColumnsSetValue_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<matrix_size_t>("insertedColumnsCount");
+    QTest::addColumn<int>("insertedColumnValue");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at beginning position") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{2u} << -1 << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{4, 5, {-1, -1, 1, 2, 3, -1, -1, 4, 5, 6, -1, -1, 7, 8, 9, -1, -1, 10, 11, 12}};
+    QTest::newRow("2: insert at random position") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{1u} << matrix_size_t{4u} << -1 << matrix_size_t{5u} << matrix_size_t{7u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{4, 7, {1, -1, -1, -1, -1, 2, 3, 4, -1, -1, -1, -1, 5, 6, 7, -1, -1, -1, -1, 8, 9, 10, -1, -1, -1, -1, 11, 12}};
+    QTest::newRow("3: insert at end position") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{3u} << matrix_size_t{1u} << -1 << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << IntMatrix{4, 4, {1, 2, 3, -1, 4, 5, 6, -1, 7, 8, 9, -1, 10, 11, 12, -1}};
+    QTest::newRow("4: insert at beginning position") << IntMatrix{2, 8, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{0u} << matrix_size_t{2u} << -1 << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{2, 10, {-1, -1, 1, 2, 3, 4, 5, 6, 7, 8, -1, -1, 9, 10, 11, 12, 13, 14, 15, 16}};
+    QTest::newRow("5: insert at random position") << IntMatrix{2, 8, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{4u} << matrix_size_t{3u} << -1 << matrix_size_t{2u} << matrix_size_t{16u} << matrix_opt_size_t{0u} << matrix_opt_size_t{2u} << IntMatrix{2, 11, {1, 2, 3, 4, -1, -1, -1, 5, 6, 7, 8, 9, 10, 11, 12, -1, -1, -1, 13, 14, 15, 16}};
+    QTest::newRow("6: insert at random position") << IntMatrix{2, 8, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{7u} << matrix_size_t{1u} << -1 << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << IntMatrix{2, 9, {1, 2, 3, 4, 5, 6, 7, -1, 8, 9, 10, 11, 12, 13, 14, 15, -1, 16}};
+    QTest::newRow("7: insert at end position") << IntMatrix{2, 8, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{8u} << matrix_size_t{2u} << -1 << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{2, 10, {1, 2, 3, 4, 5, 6, 7, 8, -1, -1, 9, 10, 11, 12, 13, 14, 15, 16, -1, -1}};
+}
+
+void ResizingTests::testIntMatrixInsertRowsFromRange_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<int>>("insertedElements");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at random position") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{1u} << std::vector<int>{-1, -2, -3, -4, -5, -6} << matrix_size_t{8u} << matrix_size_t{3u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{6, 3, {1, 2, 3, -1, -2, -3, -4, -5, -6, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("2: insert at end position") << IntMatrix{8, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{8u} << std::vector<int>{-1, -2, -3, -4} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{10, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, -1, -2, -3, -4}};
+    QTest::newRow("3: insert at beginning position") << IntMatrix{8, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{0u} << std::vector<int>{-1, -2, -3, -4, -5, -6} << matrix_size_t{16u} << matrix_size_t{2u} << matrix_opt_size_t{2u} << matrix_opt_size_t{0u} << IntMatrix{11, 2, {-1, -2, -3, -4, -5, -6, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+}
+
+void ResizingTests::testIntMatrixInsertColumnsFromRange_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<int>>("insertedElements");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at random position") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{2u} << std::vector<int>{-1, -2, -3, -4, -5, -6, -7, -8} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{4, 5, {1, 2, -1, -5, 3, 4, 5, -2, -6, 6, 7, 8, -3, -7, 9, 10, 11, -4, -8, 12}};
+    QTest::newRow("2: insert at end position") << IntMatrix{2, 8, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{8u} << std::vector<int>{-1, -2, -3, -4} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{2, 10, {1, 2, 3, 4, 5, 6, 7, 8, -1, -3, 9, 10, 11, 12, 13, 14, 15, 16, -2, -4}};
+    QTest::newRow("3: insert at beginning position") << IntMatrix{2, 8, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{0u} << std::vector<int>{-1, -2, -3, -4, -5, -6} << matrix_size_t{2u} << matrix_size_t{16u} << matrix_opt_size_t{0u} << matrix_opt_size_t{2u} << IntMatrix{2, 11, {-1, -3, -5, 1, 2, 3, 4, 5, 6, 7, 8, -2, -4, -6, 9, 10, 11, 12, 13, 14, 15, 16}};
+}
+
+void ResizingTests::testIntMatrixInsertRowFromRange_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<int>>("insertedElements");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at random position") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{2u} << std::vector<int>{-1, -2, -3} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{5, 3, {1, 2, 3, 4, 5, 6, -1, -2, -3, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("2: insert at beginning position") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << std::vector<int>{-1, -2, -3, -4} << matrix_size_t{6u} << matrix_size_t{5u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{4, 4, {-1, -2, -3, -4, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("3: insert at end position") << IntMatrix{8, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{8u} << std::vector<int>{-1, -2} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{9, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, -1, -2}};
+}
+
+void ResizingTests::testIntMatrixInsertColumnFromRange_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<int>>("insertedElements");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at random position") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{2u} << std::vector<int>{-1, -2, -3} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{3, 5, {1, 2, -1, 3, 4, 5, 6, -2, 7, 8, 9, 10, -3, 11, 12}};
+    QTest::newRow("2: insert at beginning position") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << std::vector<int>{-1, -2, -3, -4} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << IntMatrix{4, 4, {-1, 1, 2, 3, -2, 4, 5, 6, -3, 7, 8, 9, -4, 10, 11, 12}};
+    QTest::newRow("3: insert at end position") << IntMatrix{2, 8, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << matrix_size_t{8u} << std::vector<int>{-1, -2} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << IntMatrix{2, 9, {1, 2, 3, 4, 5, 6, 7, 8, -1, 9, 10, 11, 12, 13, 14, 15, 16, -2}};
+}
+
+void ResizingTests::testIntMatrixEmplaceRow_data()
+{
+    _buildIntMatrixInsertRowTestingTable();
+}
+
+void ResizingTests::testIntMatrixEmplaceColumn_data()
+{
+    _buildIntMatrixInsertColumnTestingTable();
+}
+
 void ResizingTests::testIntMatrixEraseRow_data()
 {
     QTest::addColumn<IntMatrix>("matrix");
@@ -835,6 +1176,57 @@ void ResizingTests::testIntMatrixEraseMultipleColumns_data()
     QTest::newRow("42: erase from random positions") << IntMatrix{2, 9, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}} << std::vector<matrix_size_t>{1, 6, 5, 1, 3, 1, 0} << matrix_size_t{2u} << matrix_size_t{4u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << IntMatrix{2, 2, {5, 9, 14, 18}};
 }
 
+void ResizingTests::testIntMatrixEraseRows_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("erasePositions");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: erase first and random row") << IntMatrix{8, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}} << std::vector<matrix_size_t>{0u, 3u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{6, 6, {7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}};
+    QTest::newRow("2: erase multiple rows") << IntMatrix{8, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}} << std::vector<matrix_size_t>{1u, 2u, 5u, 7u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{4, 6, {1, 2, 3, 4, 5, 6, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 37, 38, 39, 40, 41, 42}};
+    QTest::newRow("3: erase most rows (reallocation)") << IntMatrix{8, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u, 4u, 5u} << matrix_size_t{4u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{2, 6, {37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}};
+    QTest::newRow("4: erase last row") << IntMatrix{8, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}} << std::vector<matrix_size_t>{7u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{7, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42}};
+    QTest::newRow("5: erase all rows") << IntMatrix{8, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << IntMatrix{};
+}
+
+void ResizingTests::testIntMatrixEraseColumns_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("erasePositions");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: erase first and random column") << IntMatrix{8, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}} << std::vector<matrix_size_t>{0u, 3u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{8, 4, {2, 3, 5, 6, 8, 9, 11, 12, 14, 15, 17, 18, 20, 21, 23, 24, 26, 27, 29, 30, 32, 33, 35, 36, 38, 39, 41, 42, 44, 45, 47, 48}};
+    QTest::newRow("2: erase multiple columns") << IntMatrix{8, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}} << std::vector<matrix_size_t>{1u, 2u, 5u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{8, 3, {1, 4, 5, 7, 10, 11, 13, 16, 17, 19, 22, 23, 25, 28, 29, 31, 34, 35, 37, 40, 41, 43, 46, 47}};
+    QTest::newRow("3: erase most columns (reallocation)") << IntMatrix{8, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u, 4u} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{8, 1, {6, 12, 18, 24, 30, 36, 42, 48}};
+    QTest::newRow("4: erase last column") << IntMatrix{8, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}} << std::vector<matrix_size_t>{5u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{8, 5, {1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 13, 14, 15, 16, 17, 19, 20, 21, 22, 23, 25, 26, 27, 28, 29, 31, 32, 33, 34, 35, 37, 38, 39, 40, 41, 43, 44, 45, 46, 47}};
+    QTest::newRow("5: erase all columns") << IntMatrix{8, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u, 4u, 5u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << IntMatrix{};
+}
+
+void ResizingTests::testIntMatrixEraseRowsIf_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<int>("erasedRowValue");
+    QTest::addColumn<matrix_size_t>("expectedErasedRowsCount");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: erase multiple rows") << IntMatrix{8, 6, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7}} << 0 << matrix_size_t{5u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{3, 6, {2, 3, 4, 5, 6, 7, 4, 5, 6, 7, 8, 9, 2, 3, 4, 5, 6, 7}};
+    QTest::newRow("2: erase multiple rows") << IntMatrix{8, 6, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7}} << 9 << matrix_size_t{4u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{4, 6, {0, 1, 2, 3, 4, 5, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 2, 3, 4, 5, 6, 7}};
+    QTest::newRow("3: no row erased") << IntMatrix{8, 6, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7}} << 10 << matrix_size_t{0u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{8, 6, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3, 4, 5, 6, 7}};
+    QTest::newRow("4: erase most rows (reallocation)") << IntMatrix{8, 3, {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3}} << 0 << matrix_size_t{6u} << matrix_size_t{4u} << matrix_size_t{3u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << IntMatrix{2, 3, {1, 2, 3, 1, 2, 3}};
+}
+
 void ResizingTests::testIntMatrixClear_data()
 {
     QTest::addColumn<IntMatrix>("matrix");
@@ -959,6 +1351,47 @@ void ResizingTests::testStringMatrixResizeAndSetNewValues_data()
     QTest::newRow("28: equal rows, equal columns") << StringMatrix{3, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth"}} << matrix_size_t{3u} << matrix_size_t{3u} << std::string{"/NEW_VALUE/"} << matrix_size_t{3u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth"}};
 }
 
+void ResizingTests::testStringMatrixResizeForOverwrite_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("requestedRowsCount");
+    QTest::addColumn<matrix_size_t>("requestedColumnsCount");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+
+    QTest::newRow("1: equal rows, less columns") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{4u} << matrix_size_t{2u} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("2: less rows, equal columns") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u};
+    QTest::newRow("3: more rows, more columns") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{5u} << matrix_size_t{4u} << matrix_size_t{5u} << matrix_size_t{4u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("4: less rows, more columns") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{3u} << matrix_size_t{4u} << matrix_size_t{5u} << matrix_size_t{4u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u};
+    QTest::newRow("5: more rows, more columns") << StringMatrix{} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("6: less rows, less columns") << c_StringMatrix1_10x9 << matrix_size_t{7u} << matrix_size_t{7u} << matrix_size_t{12u} << matrix_size_t{11u} << matrix_opt_size_t{2u} << matrix_opt_size_t{2u};
+    QTest::newRow("7: more rows, more columns") << c_StringMatrix1_10x9 << matrix_size_t{12u} << matrix_size_t{11u} << matrix_size_t{12u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("8: more rows, equal columns") << c_StringMatrix1_10x9 << matrix_size_t{13u} << matrix_size_t{9u} << matrix_size_t{13u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u};
+}
+
+void ResizingTests::testStringMatrixReshape_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("requestedRowsCount");
+    QTest::addColumn<matrix_size_t>("requestedColumnsCount");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: less rows, more columns, contiguous storage") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << matrix_size_t{6u} << matrix_size_t{2u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 6, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("2: more rows, less columns, contiguous storage") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{6u} << matrix_size_t{2u} << matrix_size_t{7u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{6, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("3: single column, contiguous storage") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{12u} << matrix_size_t{1u} << matrix_size_t{15u} << matrix_size_t{1u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{12, 1, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("4: single row, contiguous storage") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{1u} << matrix_size_t{12u} << matrix_size_t{1u} << matrix_size_t{12u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{1, 12, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("5: equal rows, equal columns") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{4u} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("6: less rows, more columns, free column capacity") << StringMatrix{4, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{2u} << matrix_size_t{8u} << matrix_size_t{2u} << matrix_size_t{8u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 8, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}};
+    QTest::newRow("7: less rows, more columns, first row not aligned") << StringMatrix{8, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{4u} << matrix_size_t{4u} << matrix_size_t{4u} << matrix_size_t{4u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}};
+    QTest::newRow("8: more rows, less columns, first row aligned") << StringMatrix{8, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{16u} << matrix_size_t{1u} << matrix_size_t{20u} << matrix_size_t{1u} << matrix_opt_size_t{2u} << matrix_opt_size_t{0u} << StringMatrix{16, 1, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}};
+}
+
 void ResizingTests::testStringMatrixReserveAndResizeWithDefaultNewValues_data()
 {
     QTest::addColumn<StringMatrix>("matrix");
@@ -1057,39 +1490,7 @@ void ResizingTests::testStringMatrixInsertRowNoSetValue_data()
 
 void ResizingTests::testStringMatrixInsertRowSetValue_data()
 {
-    QTest::addColumn<StringMatrix>("matrix");
-    QTest::addColumn<matrix_size_t>("insertPosition");
-    QTest::addColumn<std::string>("insertedRowValue");
-    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
-    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
-    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
-    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
-    QTest::addColumn<StringMatrix>("referenceMatrix");
-
-    QTest::newRow("1: insert at random position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
-    QTest::newRow("2: insert at beginning position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 3, {"/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
-    QTest::newRow("3: insert at end position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{4u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/"}};
-
-    // test maximum capacity reached scenarios
-    QTest::newRow("4: insert at random position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{1u} << std::string{"/NEW_VALUE/"} << matrix_size_t{6u} << matrix_size_t{5u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"First", "Second", "Third", "Fourth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
-    QTest::newRow("5: insert at beginning position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::string{"/NEW_VALUE/"} << matrix_size_t{6u} << matrix_size_t{5u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
-    QTest::newRow("6: insert at end position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{3u} << std::string{"/NEW_VALUE/"} << matrix_size_t{6u} << matrix_size_t{5u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/"}};
-
-    // test left/right available capacity scenarios
-    QTest::newRow("7: insert at beginning position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{0u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"/New/", "/New/", "1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}};
-    QTest::newRow("8: insert at random position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{2u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "/New/", "/New/", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}};
-    QTest::newRow("9: insert at random position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{3u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "/New/", "/New/", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}};
-    QTest::newRow("10: insert at random position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{4u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "/New/", "/New/", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}};
-    QTest::newRow("11: insert at random position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{5u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "/New/", "/New/", "11th", "12th", "13th", "14th", "15th", "16th"}};
-    QTest::newRow("12: insert at random position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{7u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "/New/", "/New/", "15th", "16th"}};
-    QTest::newRow("13: insert at end position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{8u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "/New/", "/New/"}};
-    QTest::newRow("14: insert at beginning position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{0u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"/New/", "/New/", "1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
-    QTest::newRow("15: insert at random position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{2u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "/New/", "/New/", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
-    QTest::newRow("16: insert at random position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{3u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "/New/", "/New/", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
-    QTest::newRow("17: insert at random position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{4u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "/New/", "/New/", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
-    QTest::newRow("18: insert at random position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{5u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "/New/", "/New/", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
-    QTest::newRow("19: insert at random position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{7u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "/New/", "/New/", "15th", "16th", "17th", "18th"}};
-    QTest::newRow("20: insert at end position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{9u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th", "/New/", "/New/"}};
+    _buildStringMatrixInsertRowTestingTable();
 }
 
 void ResizingTests::testStringMatrixInsertColumnNoSetValue_data()
@@ -1130,39 +1531,7 @@ void ResizingTests::testStringMatrixInsertColumnNoSetValue_data()
 
 void ResizingTests::testStringMatrixInsertColumnSetValue_data()
 {
-    QTest::addColumn<StringMatrix>("matrix");
-    QTest::addColumn<matrix_size_t>("insertPosition");
-    QTest::addColumn<std::string>("insertedColumnValue");
-    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
-    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
-    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
-    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
-    QTest::addColumn<StringMatrix>("referenceMatrix");
-
-    QTest::newRow("1: insert at random position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << std::string{"/NEW_VALUE/"} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 5, {"First", "Second", "/NEW_VALUE/", "Third", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "Tenth", "/NEW_VALUE/", "Eleventh", "Twelfth"}};
-    QTest::newRow("2: insert at beginning position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::string{"/NEW_VALUE/"} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 5, {"/NEW_VALUE/", "First", "Second", "Third", "Fourth", "/NEW_VALUE/", "Fifth", "Sixth", "Seventh", "Eighth", "/NEW_VALUE/", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
-    QTest::newRow("3: insert at end position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{4u} << std::string{"/NEW_VALUE/"} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 5, {"First", "Second", "Third", "Fourth", "/NEW_VALUE/", "Fifth", "Sixth", "Seventh", "Eighth", "/NEW_VALUE/", "Ninth", "Tenth", "Eleventh", "Twelfth", "/NEW_VALUE/"}};
-
-    // test maximum capacity reached scenarios
-    QTest::newRow("4: insert at random position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{1u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{4, 4, {"First", "/NEW_VALUE/", "Second", "Third", "Fourth", "/NEW_VALUE/", "Fifth", "Sixth", "Seventh", "/NEW_VALUE/", "Eighth", "Ninth", "Tenth", "/NEW_VALUE/", "Eleventh", "Twelfth"}};
-    QTest::newRow("5: insert at beginning position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{4, 4, {"/NEW_VALUE/", "First", "Second", "Third", "/NEW_VALUE/", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "/NEW_VALUE/", "Tenth", "Eleventh", "Twelfth"}};
-    QTest::newRow("6: insert at end position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{3u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{4, 4, {"First", "Second", "Third", "/NEW_VALUE/", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "/NEW_VALUE/", "Tenth", "Eleventh", "Twelfth", "/NEW_VALUE/"}};
-
-    // test left/right available capacity scenarios
-    QTest::newRow("7: insert at beginning position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{0u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 9, {"/New/", "1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "/New/", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}};
-    QTest::newRow("8: insert at random position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{2u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 9, {"1st", "2nd", "/New/", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "/New/", "11th", "12th", "13th", "14th", "15th", "16th"}};
-    QTest::newRow("9: insert at random position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{3u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 9, {"1st", "2nd", "3rd", "/New/", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "/New/", "12th", "13th", "14th", "15th", "16th"}};
-    QTest::newRow("10: insert at random position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{4u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "/New/", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "/New/", "13th", "14th", "15th", "16th"}};
-    QTest::newRow("11: insert at random position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{5u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "/New/", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "/New/", "14th", "15th", "16th"}};
-    QTest::newRow("12: insert at random position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{7u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "/New/", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "/New/", "16th"}};
-    QTest::newRow("13: insert at end position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{8u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "/New/", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "/New/"}};
-    QTest::newRow("14: insert at beginning position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{0u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 10, {"/New/", "1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "/New/", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
-    QTest::newRow("15: insert at random position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{2u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 10, {"1st", "2nd", "/New/", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "/New/", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
-    QTest::newRow("16: insert at random position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{3u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 10, {"1st", "2nd", "3rd", "/New/", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "/New/", "13th", "14th", "15th", "16th", "17th", "18th"}};
-    QTest::newRow("17: insert at random position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{4u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 10, {"1st", "2nd", "3rd", "4th", "/New/", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "/New/", "14th", "15th", "16th", "17th", "18th"}};
-    QTest::newRow("18: insert at random position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{5u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 10, {"1st", "2nd", "3rd", "4th", "5th", "/New/", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "/New/", "15th", "16th", "17th", "18th"}};
-    QTest::newRow("19: insert at random position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{7u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 10, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "/New/", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "/New/", "17th", "18th"}};
-    QTest::newRow("20: insert at end position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{9u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 10, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "/New/", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th", "/New/"}};
+    _buildStringMatrixInsertColumnTestingTable();
 }
 
 void ResizingTests::testStringMatrixInsertMultipleRowsSetValue_data()
@@ -1223,6 +1592,122 @@ void ResizingTests::testStringMatrixInsertMultipleColumnsSetValue_data()
     QTest::newRow("16: append, then insert in the middle") << c_StringMatrix1_10x9 << std::vector<matrix_size_t>{9u, 5u} << std::string{"5Z"} << matrix_size_t{12u} << matrix_size_t{11u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << c_StringMatrix3d_10x11;
 }
 
+void ResizingTests::testStringMatrixInsertRowsSetValue_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<matrix_size_t>("insertedRowsCount");
+    QTest::addColumn<std::string>("insertedRowValue");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at beginning position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << matrix_size_t{2u} << std::string{"/NEW_VALUE/"} << matrix_size_t{8u} << matrix_size_t{3u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{6, 3, {"/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("2: insert at random position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << matrix_size_t{3u} << std::string{"/NEW_VALUE/"} << matrix_size_t{8u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{7, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("3: insert at end position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{4u} << matrix_size_t{1u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/"}};
+    QTest::newRow("4: insert at random position") << StringMatrix{8, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{1u} << matrix_size_t{2u} << std::string{"/NEW_VALUE/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"First", "Second", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}};
+    QTest::newRow("5: insert at random position") << StringMatrix{8, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{7u} << matrix_size_t{1u} << std::string{"/NEW_VALUE/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "/NEW_VALUE/", "/NEW_VALUE/", "Fifteenth", "Sixteenth"}};
+    QTest::newRow("6: insert at end position") << StringMatrix{8, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{8u} << matrix_size_t{2u} << std::string{"/NEW_VALUE/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/"}};
+    QTest::newRow("7: insert at random position") << StringMatrix{8, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{3u} << matrix_size_t{3u} << std::string{"/NEW_VALUE/"} << matrix_size_t{16u} << matrix_size_t{2u} << matrix_opt_size_t{2u} << matrix_opt_size_t{0u} << StringMatrix{11, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}};
+}
+
+void ResizingTests::testStringMatrixInsertColumnsSetValue_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<matrix_size_t>("insertedColumnsCount");
+    QTest::addColumn<std::string>("insertedColumnValue");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at beginning position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << matrix_size_t{2u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{4, 5, {"/NEW_VALUE/", "/NEW_VALUE/", "First", "Second", "Third", "/NEW_VALUE/", "/NEW_VALUE/", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "/NEW_VALUE/", "/NEW_VALUE/", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("2: insert at random position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{1u} << matrix_size_t{4u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{7u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{4, 7, {"First", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Second", "Third", "Fourth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Fifth", "Sixth", "Seventh", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Eighth", "Ninth", "Tenth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Eleventh", "Twelfth"}};
+    QTest::newRow("3: insert at end position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{3u} << matrix_size_t{1u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{4, 4, {"First", "Second", "Third", "/NEW_VALUE/", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "/NEW_VALUE/", "Tenth", "Eleventh", "Twelfth", "/NEW_VALUE/"}};
+    QTest::newRow("4: insert at beginning position") << StringMatrix{2, 8, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{0u} << matrix_size_t{2u} << std::string{"/NEW_VALUE/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 10, {"/NEW_VALUE/", "/NEW_VALUE/", "First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "/NEW_VALUE/", "/NEW_VALUE/", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}};
+    QTest::newRow("5: insert at random position") << StringMatrix{2, 8, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{4u} << matrix_size_t{3u} << std::string{"/NEW_VALUE/"} << matrix_size_t{2u} << matrix_size_t{16u} << matrix_opt_size_t{0u} << matrix_opt_size_t{2u} << StringMatrix{2, 11, {"First", "Second", "Third", "Fourth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}};
+    QTest::newRow("6: insert at random position") << StringMatrix{2, 8, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{7u} << matrix_size_t{1u} << std::string{"/NEW_VALUE/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 9, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "/NEW_VALUE/", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "/NEW_VALUE/", "Sixteenth"}};
+    QTest::newRow("7: insert at end position") << StringMatrix{2, 8, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{8u} << matrix_size_t{2u} << std::string{"/NEW_VALUE/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 10, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "/NEW_VALUE/", "/NEW_VALUE/", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "/NEW_VALUE/", "/NEW_VALUE/"}};
+}
+
+void ResizingTests::testStringMatrixInsertRowsFromRange_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<std::string>>("insertedElements");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at random position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{1u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/", "/NEW_VALUE_5/", "/NEW_VALUE_6/"} << matrix_size_t{8u} << matrix_size_t{3u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{6, 3, {"First", "Second", "Third", "/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/", "/NEW_VALUE_5/", "/NEW_VALUE_6/", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("2: insert at end position") << StringMatrix{8, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{8u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/"}};
+    QTest::newRow("3: insert at beginning position") << StringMatrix{8, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{0u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/", "/NEW_VALUE_5/", "/NEW_VALUE_6/"} << matrix_size_t{16u} << matrix_size_t{2u} << matrix_opt_size_t{2u} << matrix_opt_size_t{0u} << StringMatrix{11, 2, {"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/", "/NEW_VALUE_5/", "/NEW_VALUE_6/", "First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}};
+}
+
+void ResizingTests::testStringMatrixInsertColumnsFromRange_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<std::string>>("insertedElements");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at random position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/", "/NEW_VALUE_5/", "/NEW_VALUE_6/", "/NEW_VALUE_7/", "/NEW_VALUE_8/"} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{4, 5, {"First", "Second", "/NEW_VALUE_1/", "/NEW_VALUE_5/", "Third", "Fourth", "Fifth", "/NEW_VALUE_2/", "/NEW_VALUE_6/", "Sixth", "Seventh", "Eighth", "/NEW_VALUE_3/", "/NEW_VALUE_7/", "Ninth", "Tenth", "Eleventh", "/NEW_VALUE_4/", "/NEW_VALUE_8/", "Twelfth"}};
+    QTest::newRow("2: insert at end position") << StringMatrix{2, 8, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{8u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 10, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "/NEW_VALUE_1/", "/NEW_VALUE_3/", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "/NEW_VALUE_2/", "/NEW_VALUE_4/"}};
+    QTest::newRow("3: insert at beginning position") << StringMatrix{2, 8, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{0u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/", "/NEW_VALUE_5/", "/NEW_VALUE_6/"} << matrix_size_t{2u} << matrix_size_t{16u} << matrix_opt_size_t{0u} << matrix_opt_size_t{2u} << StringMatrix{2, 11, {"/NEW_VALUE_1/", "/NEW_VALUE_3/", "/NEW_VALUE_5/", "First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "/NEW_VALUE_2/", "/NEW_VALUE_4/", "/NEW_VALUE_6/", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}};
+}
+
+void ResizingTests::testStringMatrixInsertRowFromRange_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<std::string>>("insertedElements");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at random position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/"} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("2: insert at beginning position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/"} << matrix_size_t{6u} << matrix_size_t{5u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/", "First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("3: insert at end position") << StringMatrix{8, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{8u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "/NEW_VALUE_1/", "/NEW_VALUE_2/"}};
+}
+
+void ResizingTests::testStringMatrixInsertColumnFromRange_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<std::string>>("insertedElements");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at random position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/"} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 5, {"First", "Second", "/NEW_VALUE_1/", "Third", "Fourth", "Fifth", "Sixth", "/NEW_VALUE_2/", "Seventh", "Eighth", "Ninth", "Tenth", "/NEW_VALUE_3/", "Eleventh", "Twelfth"}};
+    QTest::newRow("2: insert at beginning position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/", "/NEW_VALUE_3/", "/NEW_VALUE_4/"} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{4, 4, {"/NEW_VALUE_1/", "First", "Second", "Third", "/NEW_VALUE_2/", "Fourth", "Fifth", "Sixth", "/NEW_VALUE_3/", "Seventh", "Eighth", "Ninth", "/NEW_VALUE_4/", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("3: insert at end position") << StringMatrix{2, 8, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << matrix_size_t{8u} << std::vector<std::string>{"/NEW_VALUE_1/", "/NEW_VALUE_2/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 9, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "/NEW_VALUE_1/", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "/NEW_VALUE_2/"}};
+}
+
+void ResizingTests::testStringMatrixEmplaceRow_data()
+{
+    _buildStringMatrixInsertRowTestingTable();
+}
+
+void ResizingTests::testStringMatrixEmplaceColumn_data()
+{
+    _buildStringMatrixInsertColumnTestingTable();
+}
+
 void ResizingTests::testStringMatrixEraseRow_data()
 {
     QTest::addColumn<StringMatrix>("matrix");
@@ -1405,6 +1890,57 @@ void ResizingTests::testStringMatrixEraseMultipleColumns_data()
     QTest::newRow("42: erase from random positions") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << std::vector<matrix_size_t>{1u, 6u, 5u, 1u, 3u, 1u, 0u} << matrix_size_t{2u} << matrix_size_t{4u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 2, {"5th", "9th", "14th", "18th"}};
 }
 
+void ResizingTests::testStringMatrixEraseRows_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("erasePositions");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: erase first and random row") << StringMatrix{8, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}} << std::vector<matrix_size_t>{0u, 3u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{6, 6, {"Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}};
+    QTest::newRow("2: erase multiple rows") << StringMatrix{8, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}} << std::vector<matrix_size_t>{1u, 2u, 5u, 7u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{4, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42"}};
+    QTest::newRow("3: erase most rows (reallocation)") << StringMatrix{8, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u, 4u, 5u} << matrix_size_t{4u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{2, 6, {"Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}};
+    QTest::newRow("4: erase last row") << StringMatrix{8, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}} << std::vector<matrix_size_t>{7u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{7, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42"}};
+    QTest::newRow("5: erase all rows") << StringMatrix{8, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << StringMatrix{};
+}
+
+void ResizingTests::testStringMatrixEraseColumns_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("erasePositions");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: erase first and random column") << StringMatrix{8, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}} << std::vector<matrix_size_t>{0u, 3u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{8, 4, {"Element02", "Element03", "Element05", "Element06", "Element08", "Element09", "Element11", "Element12", "Element14", "Element15", "Element17", "Element18", "Element20", "Element21", "Element23", "Element24", "Element26", "Element27", "Element29", "Element30", "Element32", "Element33", "Element35", "Element36", "Element38", "Element39", "Element41", "Element42", "Element44", "Element45", "Element47", "Element48"}};
+    QTest::newRow("2: erase multiple columns") << StringMatrix{8, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}} << std::vector<matrix_size_t>{1u, 2u, 5u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{8, 3, {"Element01", "Element04", "Element05", "Element07", "Element10", "Element11", "Element13", "Element16", "Element17", "Element19", "Element22", "Element23", "Element25", "Element28", "Element29", "Element31", "Element34", "Element35", "Element37", "Element40", "Element41", "Element43", "Element46", "Element47"}};
+    QTest::newRow("3: erase most columns (reallocation)") << StringMatrix{8, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u, 4u} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{8, 1, {"Element06", "Element12", "Element18", "Element24", "Element30", "Element36", "Element42", "Element48"}};
+    QTest::newRow("4: erase last column") << StringMatrix{8, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}} << std::vector<matrix_size_t>{5u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{8, 5, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element07", "Element08", "Element09", "Element10", "Element11", "Element13", "Element14", "Element15", "Element16", "Element17", "Element19", "Element20", "Element21", "Element22", "Element23", "Element25", "Element26", "Element27", "Element28", "Element29", "Element31", "Element32", "Element33", "Element34", "Element35", "Element37", "Element38", "Element39", "Element40", "Element41", "Element43", "Element44", "Element45", "Element46", "Element47"}};
+    QTest::newRow("5: erase all columns") << StringMatrix{8, 6, {"Element01", "Element02", "Element03", "Element04", "Element05", "Element06", "Element07", "Element08", "Element09", "Element10", "Element11", "Element12", "Element13", "Element14", "Element15", "Element16", "Element17", "Element18", "Element19", "Element20", "Element21", "Element22", "Element23", "Element24", "Element25", "Element26", "Element27", "Element28", "Element29", "Element30", "Element31", "Element32", "Element33", "Element34", "Element35", "Element36", "Element37", "Element38", "Element39", "Element40", "Element41", "Element42", "Element43", "Element44", "Element45", "Element46", "Element47", "Element48"}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u, 4u, 5u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << StringMatrix{};
+}
+
+void ResizingTests::testStringMatrixEraseRowsIf_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<std::string>("erasedRowValue");
+    QTest::addColumn<matrix_size_t>("expectedErasedRowsCount");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: erase multiple rows") << StringMatrix{8, 6, {"Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven"}} << std::string{"Zero"} << matrix_size_t{5u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{3, 6, {"Two", "Three", "Four", "Five", "Six", "Seven", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Two", "Three", "Four", "Five", "Six", "Seven"}};
+    QTest::newRow("2: erase multiple rows") << StringMatrix{8, 6, {"Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven"}} << std::string{"Nine"} << matrix_size_t{4u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{4, 6, {"Zero", "One", "Two", "Three", "Four", "Five", "Two", "Three", "Four", "Five", "Six", "Seven", "Zero", "One", "Two", "Three", "Four", "Five", "Two", "Three", "Four", "Five", "Six", "Seven"}};
+    QTest::newRow("3: no row erased") << StringMatrix{8, 6, {"Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven"}} << std::string{"Ten"} << matrix_size_t{0u} << matrix_size_t{10u} << matrix_size_t{7u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{8, 6, {"Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Zero", "One", "Two", "Three", "Four", "Five", "Six", "Seven"}};
+    QTest::newRow("4: erase most rows (reallocation)") << StringMatrix{8, 3, {"Zero", "One", "Two", "Three", "Zero", "One", "Two", "Three", "Zero", "One", "Two", "Three", "Zero", "One", "Two", "Three", "Zero", "One", "Two", "Three", "Zero", "One", "Two", "Three"}} << std::string{"Zero"} << matrix_size_t{6u} << matrix_size_t{4u} << matrix_size_t{3u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{2, 3, {"One", "Two", "Three", "One", "Two", "Three"}};
+}
+
 void ResizingTests::testStringMatrixClear_data()
 {
     QTest::addColumn<StringMatrix>("matrix");
@@ -1488,6 +2024,80 @@ void ResizingTests::_buildIntMatrixInsertColumnTestingTable()
     QTest::newRow("20: insert at end position") << IntMatrix{2, 9, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}} << matrix_size_t{9u} << -1 << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << IntMatrix{2, 10, {1, 2, 3, 4, 5, 6, 7, 8, 9, -1, 10, 11, 12, 13, 14, 15, 16, 17, 18, -1}};
 }
 
+void ResizingTests::_buildStringMatrixInsertRowTestingTable()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::string>("insertedRowValue");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at random position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("2: insert at beginning position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 3, {"/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("3: insert at end position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{4u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/"}};
+
+    // test maximum capacity reached scenarios
+    QTest::newRow("4: insert at random position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{1u} << std::string{"/NEW_VALUE/"} << matrix_size_t{6u} << matrix_size_t{5u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"First", "Second", "Third", "Fourth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("5: insert at beginning position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::string{"/NEW_VALUE/"} << matrix_size_t{6u} << matrix_size_t{5u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("6: insert at end position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{3u} << std::string{"/NEW_VALUE/"} << matrix_size_t{6u} << matrix_size_t{5u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/", "/NEW_VALUE/"}};
+
+    // test left/right available capacity scenarios
+    QTest::newRow("7: insert at beginning position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{0u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"/New/", "/New/", "1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}};
+    QTest::newRow("8: insert at random position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{2u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "/New/", "/New/", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}};
+    QTest::newRow("9: insert at random position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{3u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "/New/", "/New/", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}};
+    QTest::newRow("10: insert at random position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{4u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "/New/", "/New/", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}};
+    QTest::newRow("11: insert at random position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{5u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "/New/", "/New/", "11th", "12th", "13th", "14th", "15th", "16th"}};
+    QTest::newRow("12: insert at random position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{7u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "/New/", "/New/", "15th", "16th"}};
+    QTest::newRow("13: insert at end position") << StringMatrix{8, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{8u} << std::string{"/New/"} << matrix_size_t{10u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "/New/", "/New/"}};
+    QTest::newRow("14: insert at beginning position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{0u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"/New/", "/New/", "1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
+    QTest::newRow("15: insert at random position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{2u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "/New/", "/New/", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
+    QTest::newRow("16: insert at random position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{3u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "/New/", "/New/", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
+    QTest::newRow("17: insert at random position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{4u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "/New/", "/New/", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
+    QTest::newRow("18: insert at random position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{5u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "/New/", "/New/", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
+    QTest::newRow("19: insert at random position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{7u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "/New/", "/New/", "15th", "16th", "17th", "18th"}};
+    QTest::newRow("20: insert at end position") << StringMatrix{9, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{9u} << std::string{"/New/"} << matrix_size_t{11u} << matrix_size_t{2u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u} << StringMatrix{10, 2, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th", "/New/", "/New/"}};
+}
+
+void ResizingTests::_buildStringMatrixInsertColumnTestingTable()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::string>("insertedColumnValue");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("referenceMatrix");
+
+    QTest::newRow("1: insert at random position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << std::string{"/NEW_VALUE/"} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 5, {"First", "Second", "/NEW_VALUE/", "Third", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "Tenth", "/NEW_VALUE/", "Eleventh", "Twelfth"}};
+    QTest::newRow("2: insert at beginning position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::string{"/NEW_VALUE/"} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 5, {"/NEW_VALUE/", "First", "Second", "Third", "Fourth", "/NEW_VALUE/", "Fifth", "Sixth", "Seventh", "Eighth", "/NEW_VALUE/", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("3: insert at end position") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{4u} << std::string{"/NEW_VALUE/"} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 5, {"First", "Second", "Third", "Fourth", "/NEW_VALUE/", "Fifth", "Sixth", "Seventh", "Eighth", "/NEW_VALUE/", "Ninth", "Tenth", "Eleventh", "Twelfth", "/NEW_VALUE/"}};
+
+    // test maximum capacity reached scenarios
+    QTest::newRow("4: insert at random position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{1u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{4, 4, {"First", "/NEW_VALUE/", "Second", "Third", "Fourth", "/NEW_VALUE/", "Fifth", "Sixth", "Seventh", "/NEW_VALUE/", "Eighth", "Ninth", "Tenth", "/NEW_VALUE/", "Eleventh", "Twelfth"}};
+    QTest::newRow("5: insert at beginning position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{4, 4, {"/NEW_VALUE/", "First", "Second", "Third", "/NEW_VALUE/", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "/NEW_VALUE/", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("6: insert at end position") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{3u} << std::string{"/NEW_VALUE/"} << matrix_size_t{5u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{4, 4, {"First", "Second", "Third", "/NEW_VALUE/", "Fourth", "Fifth", "Sixth", "/NEW_VALUE/", "Seventh", "Eighth", "Ninth", "/NEW_VALUE/", "Tenth", "Eleventh", "Twelfth", "/NEW_VALUE/"}};
+
+    // test left/right available capacity scenarios
+    QTest::newRow("7: insert at beginning position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{0u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 9, {"/New/", "1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "/New/", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}};
+    QTest::newRow("8: insert at random position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{2u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 9, {"1st", "2nd", "/New/", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "/New/", "11th", "12th", "13th", "14th", "15th", "16th"}};
+    QTest::newRow("9: insert at random position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{3u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 9, {"1st", "2nd", "3rd", "/New/", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "/New/", "12th", "13th", "14th", "15th", "16th"}};
+    QTest::newRow("10: insert at random position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{4u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "/New/", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "/New/", "13th", "14th", "15th", "16th"}};
+    QTest::newRow("11: insert at random position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{5u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "/New/", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "/New/", "14th", "15th", "16th"}};
+    QTest::newRow("12: insert at random position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{7u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "/New/", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "/New/", "16th"}};
+    QTest::newRow("13: insert at end position") << StringMatrix{2, 8, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th"}} << matrix_size_t{8u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{10u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "/New/", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "/New/"}};
+    QTest::newRow("14: insert at beginning position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{0u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 10, {"/New/", "1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "/New/", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
+    QTest::newRow("15: insert at random position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{2u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 10, {"1st", "2nd", "/New/", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "/New/", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}};
+    QTest::newRow("16: insert at random position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{3u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 10, {"1st", "2nd", "3rd", "/New/", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "/New/", "13th", "14th", "15th", "16th", "17th", "18th"}};
+    QTest::newRow("17: insert at random position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{4u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 10, {"1st", "2nd", "3rd", "4th", "/New/", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "/New/", "14th", "15th", "16th", "17th", "18th"}};
+    QTest::newRow("18: insert at random position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{5u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 10, {"1st", "2nd", "3rd", "4th", "5th", "/New/", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "/New/", "15th", "16th", "17th", "18th"}};
+    QTest::newRow("19: insert at random position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{7u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 10, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "/New/", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "/New/", "17th", "18th"}};
+    QTest::newRow("20: insert at end position") << StringMatrix{2, 9, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th"}} << matrix_size_t{9u} << std::string{"/New/"} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{2, 10, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "/New/", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th", "/New/"}};
+}
+
 QTEST_APPLESS_MAIN(ResizingTests)
 
 #include "tst_resizingtests.moc"
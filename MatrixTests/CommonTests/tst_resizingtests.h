@@ -100,6 +100,45 @@
                                                                                                                        \
     QVERIFY2(matrix == expectedMatrix, "Reserving/resizing failed, the matrix does not have the correct values!");
 
+#define TEST_MATRIX_RESIZE_FOR_OVERWRITE(matrixType)                                                                   \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, requestedRowsCount);                                                         \
+    QFETCH(Matrix<matrixType>::size_type, requestedColumnsCount);                                                      \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+                                                                                                                       \
+    matrix.resizeForOverwrite(requestedRowsCount, requestedColumnsCount);                                              \
+                                                                                                                       \
+    TEST_RESERVE_RESIZE_CHECK_MATRIX_SIZE_AND_CAPACITY(matrix, requestedRowsCount, requestedColumnsCount,              \
+                                                       expectedRowCapacity, expectedColumnCapacity,                    \
+                                                       expectedRowCapacityOffset, expectedColumnCapacityOffset);       \
+                                                                                                                       \
+    if constexpr (!std::is_trivial_v<matrixType>)                                                                      \
+    {                                                                                                                  \
+        CHECK_ELEMENTS_ARE_IDENTICAL_AND_HAVE_CORRECT_VALUE(                                                           \
+            matrix, matrixType{}, "Resizing for overwrite failed, the elements have not been default constructed!");   \
+    }
+
+#define TEST_MATRIX_RESHAPE(matrixType)                                                                                \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, requestedRowsCount);                                                         \
+    QFETCH(Matrix<matrixType>::size_type, requestedColumnsCount);                                                      \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    matrix.reshape(requestedRowsCount, requestedColumnsCount);                                                         \
+                                                                                                                       \
+    TEST_RESERVE_RESIZE_CHECK_MATRIX_SIZE_AND_CAPACITY(matrix, requestedRowsCount, requestedColumnsCount,              \
+                                                       expectedRowCapacity, expectedColumnCapacity,                    \
+                                                       expectedRowCapacityOffset, expectedColumnCapacityOffset);       \
+                                                                                                                       \
+    QVERIFY2(matrix == expectedMatrix, "Reshaping failed, the matrix does not have the correct values!");
+
 #define TEST_MATRIX_RESERVE_AND_RESIZE_WITH_SET_NEW_VALUES(matrixType)                                                 \
     QFETCH(Matrix<matrixType>, matrix);                                                                                \
     QFETCH(Matrix<matrixType>::size_type, requestedRowsCount);                                                         \
@@ -235,6 +274,170 @@
                                                                                                                        \
     QVERIFY2(matrix == referenceMatrix, "Insert column failed, the matrix doesn't have the right values!");
 
+#define TEST_MATRIX_INSERT_ROWS_SET_VALUE(matrixType)                                                                  \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, insertPosition);                                                             \
+    QFETCH(Matrix<matrixType>::size_type, insertedRowsCount);                                                          \
+    QFETCH(matrixType, insertedRowValue);                                                                              \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, referenceMatrix);                                                                       \
+                                                                                                                       \
+    matrix.insertRows(insertPosition, insertedRowsCount, insertedRowValue);                                            \
+                                                                                                                       \
+    TEST_INSERT_ROW_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                    \
+        matrix, referenceMatrix.getNrOfRows(), referenceMatrix.getNrOfColumns(), expectedRowCapacity,                  \
+        expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);                              \
+                                                                                                                       \
+    QVERIFY2(matrix == referenceMatrix, "Insert row failed, the matrix doesn't have the right values!");
+
+#define TEST_MATRIX_INSERT_COLUMNS_SET_VALUE(matrixType)                                                               \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, insertPosition);                                                             \
+    QFETCH(Matrix<matrixType>::size_type, insertedColumnsCount);                                                       \
+    QFETCH(matrixType, insertedColumnValue);                                                                           \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, referenceMatrix);                                                                       \
+                                                                                                                       \
+    matrix.insertColumns(insertPosition, insertedColumnsCount, insertedColumnValue);                                   \
+                                                                                                                       \
+    TEST_INSERT_COLUMN_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                 \
+        matrix, referenceMatrix.getNrOfRows(), referenceMatrix.getNrOfColumns(), expectedRowCapacity,                  \
+        expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);                              \
+                                                                                                                       \
+    QVERIFY2(matrix == referenceMatrix, "Insert column failed, the matrix doesn't have the right values!");
+
+#define TEST_MATRIX_INSERT_ROW_FROM_RANGE(matrixType)                                                                  \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, insertPosition);                                                             \
+    QFETCH(std::vector<matrixType>, insertedElements);                                                                 \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, referenceMatrix);                                                                       \
+                                                                                                                       \
+    const std::vector<matrixType> c_InsertedElementsCopy{insertedElements};                                            \
+    Matrix<matrixType> moveMatrix{matrix};                                                                             \
+                                                                                                                       \
+    matrix.insertRow(insertPosition, insertedElements);                                                                \
+                                                                                                                       \
+    TEST_INSERT_ROW_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                    \
+        matrix, referenceMatrix.getNrOfRows(), referenceMatrix.getNrOfColumns(), expectedRowCapacity,                  \
+        expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);                              \
+                                                                                                                       \
+    QVERIFY2(matrix == referenceMatrix, "Insert row failed, the matrix doesn't have the right values!");               \
+    QVERIFY2(insertedElements == c_InsertedElementsCopy,                                                               \
+             "Insert row failed, the elements of the range have been modified!");                                      \
+                                                                                                                       \
+    moveMatrix.insertRow(insertPosition, std::move(insertedElements));                                                 \
+                                                                                                                       \
+    QVERIFY2(moveMatrix == referenceMatrix, "Insert row by moving failed, wrong matrix values!");
+
+#define TEST_MATRIX_INSERT_COLUMN_FROM_RANGE(matrixType)                                                               \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, insertPosition);                                                             \
+    QFETCH(std::vector<matrixType>, insertedElements);                                                                 \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, referenceMatrix);                                                                       \
+                                                                                                                       \
+    const std::vector<matrixType> c_InsertedElementsCopy{insertedElements};                                            \
+    Matrix<matrixType> moveMatrix{matrix};                                                                             \
+                                                                                                                       \
+    matrix.insertColumn(insertPosition, insertedElements);                                                             \
+                                                                                                                       \
+    TEST_INSERT_COLUMN_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                 \
+        matrix, referenceMatrix.getNrOfRows(), referenceMatrix.getNrOfColumns(), expectedRowCapacity,                  \
+        expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);                              \
+                                                                                                                       \
+    QVERIFY2(matrix == referenceMatrix, "Insert column failed, the matrix doesn't have the right values!");            \
+    QVERIFY2(insertedElements == c_InsertedElementsCopy,                                                               \
+             "Insert column failed, the elements of the range have been modified!");                                   \
+                                                                                                                       \
+    moveMatrix.insertColumn(insertPosition, std::move(insertedElements));                                              \
+                                                                                                                       \
+    QVERIFY2(moveMatrix == referenceMatrix, "Insert column by moving failed, wrong matrix values!");
+
+#define TEST_MATRIX_EMPLACE_ROW(matrixType)                                                                            \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, insertPosition);                                                             \
+    QFETCH(matrixType, insertedRowValue);                                                                              \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, referenceMatrix);                                                                       \
+                                                                                                                       \
+    matrix.emplaceRow(insertPosition, insertedRowValue);                                                               \
+                                                                                                                       \
+    TEST_INSERT_ROW_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                    \
+        matrix, referenceMatrix.getNrOfRows(), referenceMatrix.getNrOfColumns(), expectedRowCapacity,                  \
+        expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);                              \
+                                                                                                                       \
+    QVERIFY2(matrix == referenceMatrix, "Emplace row failed, the matrix doesn't have the right values!");
+
+#define TEST_MATRIX_EMPLACE_COLUMN(matrixType)                                                                         \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, insertPosition);                                                             \
+    QFETCH(matrixType, insertedColumnValue);                                                                           \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, referenceMatrix);                                                                       \
+                                                                                                                       \
+    matrix.emplaceColumn(insertPosition, insertedColumnValue);                                                         \
+                                                                                                                       \
+    TEST_INSERT_COLUMN_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                 \
+        matrix, referenceMatrix.getNrOfRows(), referenceMatrix.getNrOfColumns(), expectedRowCapacity,                  \
+        expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);                              \
+                                                                                                                       \
+    QVERIFY2(matrix == referenceMatrix, "Emplace column failed, the matrix doesn't have the right values!");
+
+#define TEST_MATRIX_INSERT_ROWS_FROM_RANGE(matrixType)                                                                 \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, insertPosition);                                                             \
+    QFETCH(std::vector<matrixType>, insertedElements);                                                                 \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, referenceMatrix);                                                                       \
+                                                                                                                       \
+    matrix.insertRows(insertPosition, insertedElements);                                                               \
+                                                                                                                       \
+    TEST_INSERT_ROW_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                    \
+        matrix, referenceMatrix.getNrOfRows(), referenceMatrix.getNrOfColumns(), expectedRowCapacity,                  \
+        expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);                              \
+                                                                                                                       \
+    QVERIFY2(matrix == referenceMatrix, "Insert row failed, the matrix doesn't have the right values!");
+
+#define TEST_MATRIX_INSERT_COLUMNS_FROM_RANGE(matrixType)                                                              \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, insertPosition);                                                             \
+    QFETCH(std::vector<matrixType>, insertedElements);                                                                 \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, referenceMatrix);                                                                       \
+                                                                                                                       \
+    matrix.insertColumns(insertPosition, insertedElements);                                                            \
+                                                                                                                       \
+    TEST_INSERT_COLUMN_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                 \
+        matrix, referenceMatrix.getNrOfRows(), referenceMatrix.getNrOfColumns(), expectedRowCapacity,                  \
+        expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);                              \
+                                                                                                                       \
+    QVERIFY2(matrix == referenceMatrix, "Insert column failed, the matrix doesn't have the right values!");
+
 #define TEST_MATRIX_ERASE_ROW(matrixType)                                                                              \
     QFETCH(Matrix<matrixType>, matrix);                                                                                \
     QFETCH(Matrix<matrixType>::size_type, erasePosition);                                                              \
@@ -279,6 +482,65 @@
     QVERIFY2(matrix == expectedMatrix,                                                                                 \
              "Erase row failed, the matrix doesn't have the right values on the remaining rows!");
 
+#define TEST_MATRIX_ERASE_ROWS(matrixType)                                                                             \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(std::vector<Matrix<matrixType>::size_type>, erasePositions);                                                \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    matrix.eraseRows(erasePositions);                                                                                  \
+                                                                                                                       \
+    TEST_ERASE_ROW_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                     \
+        matrix, expectedMatrix.getNrOfRows(), expectedMatrix.getNrOfColumns(), expectedRowCapacity,                    \
+        expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);                              \
+                                                                                                                       \
+    QVERIFY2(matrix == expectedMatrix,                                                                                 \
+             "Erase rows failed, the matrix doesn't have the right values on the remaining rows!");
+
+#define TEST_MATRIX_ERASE_COLUMNS(matrixType)                                                                          \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(std::vector<Matrix<matrixType>::size_type>, erasePositions);                                                \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    matrix.eraseColumns(erasePositions);                                                                               \
+                                                                                                                       \
+    TEST_ERASE_COLUMN_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                  \
+        matrix, expectedMatrix.getNrOfRows(), expectedMatrix.getNrOfColumns(), expectedRowCapacity,                    \
+        expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);                              \
+                                                                                                                       \
+    QVERIFY2(matrix == expectedMatrix,                                                                                 \
+             "Erase columns failed, the matrix doesn't have the right values on the remaining columns!");
+
+#define TEST_MATRIX_ERASE_ROWS_IF(matrixType)                                                                          \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(matrixType, erasedRowValue);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, expectedErasedRowsCount);                                                    \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    const auto c_ErasedRowsCount{matrix.eraseRowsIf([&erasedRowValue](std::span<const matrixType> row)                 \
+                                                    { return std::ranges::find(row, erasedRowValue) != row.end(); })}; \
+                                                                                                                       \
+    QVERIFY2(c_ErasedRowsCount == expectedErasedRowsCount,                                                             \
+             "Erase rows failed, the number of erased rows is not correct!");                                          \
+                                                                                                                       \
+    TEST_ERASE_ROW_CHECK_MATRIX_SIZE_AND_CAPACITY(                                                                     \
+        matrix, expectedMatrix.getNrOfRows(), expectedMatrix.getNrOfColumns(), expectedRowCapacity,                    \
+        expectedColumnCapacity, expectedRowCapacityOffset, expectedColumnCapacityOffset);                              \
+                                                                                                                       \
+    QVERIFY2(matrix == expectedMatrix,                                                                                 \
+             "Erase rows failed, the matrix doesn't have the right values on the remaining rows!");
+
 #define TEST_MATRIX_ERASE_COLUMN(matrixType)                                                                           \
     QFETCH(Matrix<matrixType>, matrix);                                                                                \
     QFETCH(Matrix<matrixType>::size_type, erasePosition);                                                              \
@@ -16,19 +16,31 @@ private slots:
     void testSwapIntMatrixes();
     void testIntMatrixSwapRows();
     void testIntMatrixSwapColumns();
+    void testIntMatrixPermuteRows();
+    void testIntMatrixPermuteColumns();
+    void testIntMatrixColumnOrderView();
 
     void testSwapStringMatrixes();
     void testStringMatrixSwapRows();
     void testStringMatrixSwapColumns();
+    void testStringMatrixPermuteRows();
+    void testStringMatrixPermuteColumns();
+    void testStringMatrixColumnOrderView();
 
     // test data
     void testSwapIntMatrixes_data();
     void testIntMatrixSwapRows_data();
     void testIntMatrixSwapColumns_data();
+    void testIntMatrixPermuteRows_data();
+    void testIntMatrixPermuteColumns_data();
+    void testIntMatrixColumnOrderView_data();
 
     void testSwapStringMatrixes_data();
     void testStringMatrixSwapRows_data();
     void testStringMatrixSwapColumns_data();
+    void testStringMatrixPermuteRows_data();
+    void testStringMatrixPermuteColumns_data();
+    void testStringMatrixColumnOrderView_data();
 
 private:
     IntMatrix mPrimaryIntMatrix;
@@ -52,6 +64,21 @@ void SwappingTests::testIntMatrixSwapColumns()
     TEST_MATRIX_SWAP_COLUMNS(int);
 }
 
+void SwappingTests::testIntMatrixPermuteRows()
+{
+    TEST_MATRIX_PERMUTE_ROWS(int);
+}
+
+void SwappingTests::testIntMatrixPermuteColumns()
+{
+    TEST_MATRIX_PERMUTE_COLUMNS(int);
+}
+
+void SwappingTests::testIntMatrixColumnOrderView()
+{
+    TEST_MATRIX_COLUMN_ORDER_VIEW(int);
+}
+
 void SwappingTests::testSwapStringMatrixes()
 {
     TEST_MATRIXES_SWAP(std::string, mPrimaryStringMatrix, mSecondaryStringMatrix);
@@ -67,6 +94,21 @@ void SwappingTests::testStringMatrixSwapColumns()
     TEST_MATRIX_SWAP_COLUMNS(std::string);
 }
 
+void SwappingTests::testStringMatrixPermuteRows()
+{
+    TEST_MATRIX_PERMUTE_ROWS(std::string);
+}
+
+void SwappingTests::testStringMatrixPermuteColumns()
+{
+    TEST_MATRIX_PERMUTE_COLUMNS(std::string);
+}
+
+void SwappingTests::testStringMatrixColumnOrderView()
+{
+    TEST_MATRIX_COLUMN_ORDER_VIEW(std::string);
+}
+
 void SwappingTests::testSwapIntMatrixes_data()
 {
     QTest::addColumn<IntMatrix>("firstMatrix");
@@ -113,6 +155,50 @@ void SwappingTests::testIntMatrixSwapColumns_data()
     QTest::newRow("6: same column") << c_IntMatrix1_8x9 << matrix_size_t{3u} << matrix_size_t{3u} << c_IntMatrix1_8x9;
 }
 
+void SwappingTests::testIntMatrixPermuteRows_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("permutation");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single cycle") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{1u, 2u, 3u, 0u} << IntMatrix{4, 3, {4, 5, 6, 7, 8, 9, 10, 11, 12, 1, 2, 3}};
+    QTest::newRow("2: two cycles") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{1u, 0u, 3u, 2u} << IntMatrix{4, 3, {4, 5, 6, 1, 2, 3, 10, 11, 12, 7, 8, 9}};
+    QTest::newRow("3: cycle and fixed point") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{2u, 1u, 3u, 0u} << IntMatrix{4, 3, {7, 8, 9, 4, 5, 6, 10, 11, 12, 1, 2, 3}};
+    QTest::newRow("4: identity") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("5: empty matrix") << IntMatrix{} << std::vector<matrix_size_t>{} << IntMatrix{};
+}
+
+void SwappingTests::testIntMatrixPermuteColumns_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("permutation");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single cycle") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{1u, 2u, 3u, 0u} << IntMatrix{3, 4, {2, 3, 4, 1, 6, 7, 8, 5, 10, 11, 12, 9}};
+    QTest::newRow("2: two cycles") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{1u, 0u, 3u, 2u} << IntMatrix{3, 4, {2, 1, 4, 3, 6, 5, 8, 7, 10, 9, 12, 11}};
+    QTest::newRow("3: cycle and fixed point") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{2u, 1u, 3u, 0u} << IntMatrix{3, 4, {3, 2, 4, 1, 7, 6, 8, 5, 11, 10, 12, 9}};
+    QTest::newRow("4: identity") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("5: empty matrix") << IntMatrix{} << std::vector<matrix_size_t>{} << IntMatrix{};
+}
+
+void SwappingTests::testIntMatrixColumnOrderView_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("permutation");
+    QTest::addColumn<matrix_size_t>("firstColumnNr");
+    QTest::addColumn<matrix_size_t>("secondColumnNr");
+    QTest::addColumn<matrix_size_t>("columnNr");
+    QTest::addColumn<matrix_size_t>("destColumnNr");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: permute only") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{2u, 0u, 3u, 1u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{1u} << IntMatrix{3, 4, {3, 1, 4, 2, 7, 5, 8, 6, 11, 9, 12, 10}};
+    QTest::newRow("2: swap only") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << matrix_size_t{0u} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{2u} << IntMatrix{3, 4, {4, 2, 3, 1, 8, 6, 7, 5, 12, 10, 11, 9}};
+    QTest::newRow("3: move column forward") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{0u} << matrix_size_t{2u} << IntMatrix{3, 4, {2, 3, 1, 4, 6, 7, 5, 8, 10, 11, 9, 12}};
+    QTest::newRow("4: move column backward") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << matrix_size_t{2u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{0u} << IntMatrix{3, 4, {4, 1, 2, 3, 8, 5, 6, 7, 12, 9, 10, 11}};
+    QTest::newRow("5: permute, swap and move") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{3u, 2u, 1u, 0u} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{3u} << IntMatrix{3, 4, {3, 2, 1, 4, 7, 6, 5, 8, 11, 10, 9, 12}};
+    QTest::newRow("6: no reordering") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{2u} << matrix_size_t{2u} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+}
+
 void SwappingTests::testSwapStringMatrixes_data()
 {
     QTest::addColumn<StringMatrix>("firstMatrix");
@@ -159,6 +245,50 @@ void SwappingTests::testStringMatrixSwapColumns_data()
     QTest::newRow("6: same column") << c_StringMatrix1_8x9 << matrix_size_t{3u} << matrix_size_t{3u} << c_StringMatrix1_8x9;
 }
 
+void SwappingTests::testStringMatrixPermuteRows_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("permutation");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single cycle") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{1u, 2u, 3u, 0u} << StringMatrix{4, 3, {"Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "First", "Second", "Third"}};
+    QTest::newRow("2: two cycles") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{1u, 0u, 3u, 2u} << StringMatrix{4, 3, {"Fourth", "Fifth", "Sixth", "First", "Second", "Third", "Tenth", "Eleventh", "Twelfth", "Seventh", "Eighth", "Ninth"}};
+    QTest::newRow("3: cycle and fixed point") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{2u, 1u, 3u, 0u} << StringMatrix{4, 3, {"Seventh", "Eighth", "Ninth", "Fourth", "Fifth", "Sixth", "Tenth", "Eleventh", "Twelfth", "First", "Second", "Third"}};
+    QTest::newRow("4: identity") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("5: empty matrix") << StringMatrix{} << std::vector<matrix_size_t>{} << StringMatrix{};
+}
+
+void SwappingTests::testStringMatrixPermuteColumns_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("permutation");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: single cycle") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{1u, 2u, 3u, 0u} << StringMatrix{3, 4, {"Second", "Third", "Fourth", "First", "Sixth", "Seventh", "Eighth", "Fifth", "Tenth", "Eleventh", "Twelfth", "Ninth"}};
+    QTest::newRow("2: two cycles") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{1u, 0u, 3u, 2u} << StringMatrix{3, 4, {"Second", "First", "Fourth", "Third", "Sixth", "Fifth", "Eighth", "Seventh", "Tenth", "Ninth", "Twelfth", "Eleventh"}};
+    QTest::newRow("3: cycle and fixed point") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{2u, 1u, 3u, 0u} << StringMatrix{3, 4, {"Third", "Second", "Fourth", "First", "Seventh", "Sixth", "Eighth", "Fifth", "Eleventh", "Tenth", "Twelfth", "Ninth"}};
+    QTest::newRow("4: identity") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("5: empty matrix") << StringMatrix{} << std::vector<matrix_size_t>{} << StringMatrix{};
+}
+
+void SwappingTests::testStringMatrixColumnOrderView_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("permutation");
+    QTest::addColumn<matrix_size_t>("firstColumnNr");
+    QTest::addColumn<matrix_size_t>("secondColumnNr");
+    QTest::addColumn<matrix_size_t>("columnNr");
+    QTest::addColumn<matrix_size_t>("destColumnNr");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: permute only") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{2u, 0u, 3u, 1u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{1u} << StringMatrix{3, 4, {"Third", "First", "Fourth", "Second", "Seventh", "Fifth", "Eighth", "Sixth", "Eleventh", "Ninth", "Twelfth", "Tenth"}};
+    QTest::newRow("2: swap only") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << matrix_size_t{0u} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{2u} << StringMatrix{3, 4, {"Fourth", "Second", "Third", "First", "Eighth", "Sixth", "Seventh", "Fifth", "Twelfth", "Tenth", "Eleventh", "Ninth"}};
+    QTest::newRow("3: move column forward") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{0u} << matrix_size_t{2u} << StringMatrix{3, 4, {"Second", "Third", "First", "Fourth", "Sixth", "Seventh", "Fifth", "Eighth", "Tenth", "Eleventh", "Ninth", "Twelfth"}};
+    QTest::newRow("4: move column backward") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << matrix_size_t{2u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{0u} << StringMatrix{3, 4, {"Fourth", "First", "Second", "Third", "Eighth", "Fifth", "Sixth", "Seventh", "Twelfth", "Ninth", "Tenth", "Eleventh"}};
+    QTest::newRow("5: permute, swap and move") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{3u, 2u, 1u, 0u} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{3u} << StringMatrix{3, 4, {"Third", "Second", "First", "Fourth", "Seventh", "Sixth", "Fifth", "Eighth", "Eleventh", "Tenth", "Ninth", "Twelfth"}};
+    QTest::newRow("6: no reordering") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{2u} << matrix_size_t{2u} << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+}
+
 QTEST_APPLESS_MAIN(SwappingTests)
 
 #include "tst_swappingtests.moc"
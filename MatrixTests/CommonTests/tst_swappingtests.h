@@ -41,3 +41,65 @@
                                                                                                                        \
     matrix.swapColumns(firstColumnNr, secondColumnNr);                                                                 \
     QVERIFY2(matrix == expectedMatrix, "Columns are incorrectly swapped!");
+
+#define TEST_MATRIX_PERMUTE_ROWS(matrixType)                                                                           \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(std::vector<Matrix<matrixType>::size_type>, permutation);                                                   \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    const Matrix<matrixType> c_InitialMatrix{matrix};                                                                  \
+                                                                                                                       \
+    matrix.permuteRows(permutation);                                                                                   \
+    QVERIFY2(matrix == expectedMatrix, "Rows are incorrectly permuted!");                                              \
+                                                                                                                       \
+    matrix.permuteRows(Matrix<matrixType>::getInversePermutation(permutation));                                        \
+    QVERIFY2(matrix == c_InitialMatrix, "The inverse permutation doesn't restore the initial row order!");
+
+#define TEST_MATRIX_PERMUTE_COLUMNS(matrixType)                                                                        \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(std::vector<Matrix<matrixType>::size_type>, permutation);                                                   \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    const Matrix<matrixType> c_InitialMatrix{matrix};                                                                  \
+                                                                                                                       \
+    matrix.permuteColumns(permutation);                                                                                \
+    QVERIFY2(matrix == expectedMatrix, "Columns are incorrectly permuted!");                                           \
+                                                                                                                       \
+    matrix.permuteColumns(Matrix<matrixType>::getInversePermutation(permutation));                                     \
+    QVERIFY2(matrix == c_InitialMatrix, "The inverse permutation doesn't restore the initial column order!");
+
+#define TEST_MATRIX_COLUMN_ORDER_VIEW(matrixType)                                                                      \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(std::vector<Matrix<matrixType>::size_type>, permutation);                                                   \
+    QFETCH(Matrix<matrixType>::size_type, firstColumnNr);                                                              \
+    QFETCH(Matrix<matrixType>::size_type, secondColumnNr);                                                             \
+    QFETCH(Matrix<matrixType>::size_type, columnNr);                                                                   \
+    QFETCH(Matrix<matrixType>::size_type, destColumnNr);                                                               \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    const Matrix<matrixType> c_InitialMatrix{matrix};                                                                  \
+    auto columnOrderView{matrix.columnOrderView()};                                                                    \
+                                                                                                                       \
+    columnOrderView.permuteColumns(permutation);                                                                       \
+    columnOrderView.swapColumns(firstColumnNr, secondColumnNr);                                                        \
+    columnOrderView.moveColumn(columnNr, destColumnNr);                                                                \
+                                                                                                                       \
+    bool areElementsMatching{columnOrderView.getNrOfRows() == expectedMatrix.getNrOfRows() &&                          \
+                             columnOrderView.getNrOfColumns() == expectedMatrix.getNrOfColumns()};                     \
+                                                                                                                       \
+    for (Matrix<matrixType>::size_type rowNr{0}; areElementsMatching && rowNr < expectedMatrix.getNrOfRows(); ++rowNr) \
+    {                                                                                                                  \
+        for (Matrix<matrixType>::size_type columnNr{0}; columnNr < expectedMatrix.getNrOfColumns(); ++columnNr)        \
+        {                                                                                                              \
+            areElementsMatching = areElementsMatching &&                                                               \
+                                  columnOrderView.at(rowNr, columnNr) == expectedMatrix.at(rowNr, columnNr);           \
+        }                                                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    QVERIFY2(areElementsMatching && matrix == c_InitialMatrix,                                                         \
+             "The column order view is incorrect or the underlying matrix has been modified!");                        \
+                                                                                                                       \
+    columnOrderView.materializeColumnOrder();                                                                          \
+                                                                                                                       \
+    QVERIFY2(matrix == expectedMatrix && columnOrderView.isPhysicalOrder(),                                            \
+             "The column order has been incorrectly applied to the matrix!");
@@ -10,6 +10,7 @@ using matrix_opt_size_t = std::optional<matrix_size_t>;
 Q_DECLARE_METATYPE(IntMatrix)
 Q_DECLARE_METATYPE(StringMatrix)
 Q_DECLARE_METATYPE(ConcatMode)
+Q_DECLARE_METATYPE(FlipRotateMode)
 
 class TransformationTests : public QObject
 {
@@ -18,29 +19,69 @@ class TransformationTests : public QObject
 private slots:
     // test functions
     void testIntMatrixTranspose();
+    void testIntMatrixTransposedView();
+    void testIntMatrixFlipAndRotate();
     void testIntMatrixCatByRow();
     void testIntMatrixCatByColumn();
+    void testIntMatrixConcatRows();
+    void testIntMatrixConcatColumns();
     void testIntMatrixSplitByRow();
     void testIntMatrixSplitByColumn();
+    void testIntMatrixSplitRows();
+    void testIntMatrixSplitColumns();
+    void testIntMatrixExtract();
+    void testIntMatrixAssignBlock();
+    void testIntMatrixAssignRow();
+    void testIntMatrixAssignColumn();
 
     void testStringMatrixTranspose();
+    void testStringMatrixTransposedView();
+    void testStringMatrixFlipAndRotate();
     void testStringMatrixCatByRow();
     void testStringMatrixCatByColumn();
+    void testStringMatrixConcatRows();
+    void testStringMatrixConcatColumns();
     void testStringMatrixSplitByRow();
     void testStringMatrixSplitByColumn();
+    void testStringMatrixSplitRows();
+    void testStringMatrixSplitColumns();
+    void testStringMatrixExtract();
+    void testStringMatrixAssignBlock();
+    void testStringMatrixAssignRow();
+    void testStringMatrixAssignColumn();
 
     // test data
     void testIntMatrixTranspose_data();
+    void testIntMatrixTransposedView_data();
+    void testIntMatrixFlipAndRotate_data();
     void testIntMatrixCatByRow_data();
     void testIntMatrixCatByColumn_data();
+    void testIntMatrixConcatRows_data();
+    void testIntMatrixConcatColumns_data();
     void testIntMatrixSplitByRow_data();
     void testIntMatrixSplitByColumn_data();
+    void testIntMatrixSplitRows_data();
+    void testIntMatrixSplitColumns_data();
+    void testIntMatrixExtract_data();
+    void testIntMatrixAssignBlock_data();
+    void testIntMatrixAssignRow_data();
+    void testIntMatrixAssignColumn_data();
 
     void testStringMatrixTranspose_data();
+    void testStringMatrixTransposedView_data();
+    void testStringMatrixFlipAndRotate_data();
     void testStringMatrixCatByRow_data();
     void testStringMatrixCatByColumn_data();
+    void testStringMatrixConcatRows_data();
+    void testStringMatrixConcatColumns_data();
     void testStringMatrixSplitByRow_data();
     void testStringMatrixSplitByColumn_data();
+    void testStringMatrixSplitRows_data();
+    void testStringMatrixSplitColumns_data();
+    void testStringMatrixExtract_data();
+    void testStringMatrixAssignBlock_data();
+    void testStringMatrixAssignRow_data();
+    void testStringMatrixAssignColumn_data();
 };
 
 void TransformationTests::testIntMatrixTranspose()
@@ -48,6 +89,16 @@ void TransformationTests::testIntMatrixTranspose()
     TEST_MATRIX_TRANSPOSE(int);
 }
 
+void TransformationTests::testIntMatrixTransposedView()
+{
+    TEST_MATRIX_TRANSPOSED_VIEW(int);
+}
+
+void TransformationTests::testIntMatrixFlipAndRotate()
+{
+    TEST_MATRIX_FLIP_OR_ROTATE(int);
+}
+
 void TransformationTests::testIntMatrixCatByRow()
 {
     TEST_MATRIX_CAT_BY_ROW(int);
@@ -58,6 +109,16 @@ void TransformationTests::testIntMatrixCatByColumn()
     TEST_MATRIX_CAT_BY_COLUMN(int);
 }
 
+void TransformationTests::testIntMatrixConcatRows()
+{
+    TEST_MATRIX_CONCAT(int, concatRows, vstack, "Vertical");
+}
+
+void TransformationTests::testIntMatrixConcatColumns()
+{
+    TEST_MATRIX_CONCAT(int, concatColumns, hstack, "Horizontal");
+}
+
 void TransformationTests::testIntMatrixSplitByRow()
 {
     TEST_MATRIX_SPLIT_BY_ROW(int);
@@ -68,11 +129,51 @@ void TransformationTests::testIntMatrixSplitByColumn()
     TEST_MATRIX_SPLIT_BY_COLUMN(int);
 }
 
+void TransformationTests::testIntMatrixSplitRows()
+{
+    TEST_MATRIX_MULTI_WAY_SPLIT(int, splitRows, splitRowsIntoViews, "Vertical");
+}
+
+void TransformationTests::testIntMatrixSplitColumns()
+{
+    TEST_MATRIX_MULTI_WAY_SPLIT(int, splitColumns, splitColumnsIntoViews, "Horizontal");
+}
+
+void TransformationTests::testIntMatrixExtract()
+{
+    TEST_MATRIX_EXTRACT(int);
+}
+
+void TransformationTests::testIntMatrixAssignBlock()
+{
+    TEST_MATRIX_ASSIGN_BLOCK(int);
+}
+
+void TransformationTests::testIntMatrixAssignRow()
+{
+    TEST_MATRIX_ASSIGN_ROW(int);
+}
+
+void TransformationTests::testIntMatrixAssignColumn()
+{
+    TEST_MATRIX_ASSIGN_COLUMN(int);
+}
+
 void TransformationTests::testStringMatrixTranspose()
 {
     TEST_MATRIX_TRANSPOSE(std::string);
 }
 
+void TransformationTests::testStringMatrixTransposedView()
+{
+    TEST_MATRIX_TRANSPOSED_VIEW(std::string);
+}
+
+void TransformationTests::testStringMatrixFlipAndRotate()
+{
+    TEST_MATRIX_FLIP_OR_ROTATE(std::string);
+}
+
 void TransformationTests::testStringMatrixCatByRow()
 {
     TEST_MATRIX_CAT_BY_ROW(std::string);
@@ -83,6 +184,16 @@ void TransformationTests::testStringMatrixCatByColumn()
     TEST_MATRIX_CAT_BY_COLUMN(std::string);
 }
 
+void TransformationTests::testStringMatrixConcatRows()
+{
+    TEST_MATRIX_CONCAT(std::string, concatRows, vstack, "Vertical");
+}
+
+void TransformationTests::testStringMatrixConcatColumns()
+{
+    TEST_MATRIX_CONCAT(std::string, concatColumns, hstack, "Horizontal");
+}
+
 void TransformationTests::testStringMatrixSplitByRow()
 {
     TEST_MATRIX_SPLIT_BY_ROW(std::string);
@@ -93,6 +204,36 @@ void TransformationTests::testStringMatrixSplitByColumn()
     TEST_MATRIX_SPLIT_BY_COLUMN(std::string);
 }
 
+void TransformationTests::testStringMatrixSplitRows()
+{
+    TEST_MATRIX_MULTI_WAY_SPLIT(std::string, splitRows, splitRowsIntoViews, "Vertical");
+}
+
+void TransformationTests::testStringMatrixSplitColumns()
+{
+    TEST_MATRIX_MULTI_WAY_SPLIT(std::string, splitColumns, splitColumnsIntoViews, "Horizontal");
+}
+
+void TransformationTests::testStringMatrixExtract()
+{
+    TEST_MATRIX_EXTRACT(std::string);
+}
+
+void TransformationTests::testStringMatrixAssignBlock()
+{
+    TEST_MATRIX_ASSIGN_BLOCK(std::string);
+}
+
+void TransformationTests::testStringMatrixAssignRow()
+{
+    TEST_MATRIX_ASSIGN_ROW(std::string);
+}
+
+void TransformationTests::testStringMatrixAssignColumn()
+{
+    TEST_MATRIX_ASSIGN_COLUMN(std::string);
+}
+
 void TransformationTests::testIntMatrixTranspose_data()
 {
     QTest::addColumn<IntMatrix>("matrix");
@@ -106,7 +247,54 @@ void TransformationTests::testIntMatrixTranspose_data()
     QTest::newRow("2: small matrix") << IntMatrix{3, 2, {1, 4, 2, 5, 3, 6}} << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{3u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
     QTest::newRow("3: medium matrix") << c_IntMatrix1_8x9 << c_IntMatrix1_9x8 << matrix_size_t{10u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u};
     QTest::newRow("4: medium matrix") << c_IntMatrix1_9x8 << c_IntMatrix1_8x9 << matrix_size_t{11u} << matrix_size_t{10u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u};
-    QTest::newRow("5: empty matrix") << IntMatrix{} << IntMatrix{} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{};
+    QTest::newRow("5: square matrix") << IntMatrix{3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9}} << IntMatrix{3, 3, {1, 4, 7, 2, 5, 8, 3, 6, 9}} << matrix_size_t{3u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("6: empty matrix") << IntMatrix{} << IntMatrix{} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{};
+}
+
+void TransformationTests::testIntMatrixTransposedView_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: small matrix") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 2, {1, 4, 2, 5, 3, 6}};
+    QTest::newRow("2: small matrix") << IntMatrix{3, 2, {1, 4, 2, 5, 3, 6}} << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}};
+    QTest::newRow("3: medium matrix") << c_IntMatrix1_8x9 << c_IntMatrix1_9x8;
+    QTest::newRow("4: medium matrix") << c_IntMatrix1_9x8 << c_IntMatrix1_8x9;
+    QTest::newRow("5: square matrix") << IntMatrix{3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9}} << IntMatrix{3, 3, {1, 4, 7, 2, 5, 8, 3, 6, 9}};
+    QTest::newRow("6: single row matrix") << IntMatrix{1, 4, {1, 2, 3, 4}} << IntMatrix{4, 1, {1, 2, 3, 4}};
+    QTest::newRow("7: empty matrix") << IntMatrix{} << IntMatrix{};
+}
+
+void TransformationTests::testIntMatrixFlipAndRotate_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<FlipRotateMode>("mode");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: flip vertical") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << FlipRotateMode::FLIP_VERTICAL << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{3, 4, {9, 10, 11, 12, 5, 6, 7, 8, 1, 2, 3, 4}};
+    QTest::newRow("2: flip vertical") << IntMatrix{4, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << FlipRotateMode::FLIP_VERTICAL << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{4, 4, {13, 14, 15, 16, 9, 10, 11, 12, 5, 6, 7, 8, 1, 2, 3, 4}};
+    QTest::newRow("3: flip vertical") << IntMatrix{5, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}} << FlipRotateMode::FLIP_VERTICAL << matrix_size_t{6u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{5, 2, {9, 10, 7, 8, 5, 6, 3, 4, 1, 2}};
+    QTest::newRow("4: flip horizontal") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << FlipRotateMode::FLIP_HORIZONTAL << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{3, 4, {4, 3, 2, 1, 8, 7, 6, 5, 12, 11, 10, 9}};
+    QTest::newRow("5: flip horizontal") << IntMatrix{4, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << FlipRotateMode::FLIP_HORIZONTAL << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{4, 4, {4, 3, 2, 1, 8, 7, 6, 5, 12, 11, 10, 9, 16, 15, 14, 13}};
+    QTest::newRow("6: flip horizontal") << IntMatrix{5, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}} << FlipRotateMode::FLIP_HORIZONTAL << matrix_size_t{6u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{5, 2, {2, 1, 4, 3, 6, 5, 8, 7, 10, 9}};
+    QTest::newRow("7: rotate 90 degrees") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << FlipRotateMode::ROTATE_90 << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << IntMatrix{4, 3, {9, 5, 1, 10, 6, 2, 11, 7, 3, 12, 8, 4}};
+    QTest::newRow("8: rotate 90 degrees") << IntMatrix{4, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << FlipRotateMode::ROTATE_90 << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{4, 4, {13, 9, 5, 1, 14, 10, 6, 2, 15, 11, 7, 3, 16, 12, 8, 4}};
+    QTest::newRow("9: rotate 90 degrees") << IntMatrix{5, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}} << FlipRotateMode::ROTATE_90 << matrix_size_t{6u} << matrix_size_t{6u} << matrix_opt_size_t{2u} << matrix_opt_size_t{0u} << IntMatrix{2, 5, {9, 7, 5, 3, 1, 10, 8, 6, 4, 2}};
+    QTest::newRow("10: rotate 180 degrees") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << FlipRotateMode::ROTATE_180 << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{3, 4, {12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1}};
+    QTest::newRow("11: rotate 180 degrees") << IntMatrix{4, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << FlipRotateMode::ROTATE_180 << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{4, 4, {16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1}};
+    QTest::newRow("12: rotate 180 degrees") << IntMatrix{5, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}} << FlipRotateMode::ROTATE_180 << matrix_size_t{6u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{5, 2, {10, 9, 8, 7, 6, 5, 4, 3, 2, 1}};
+    QTest::newRow("13: rotate 270 degrees") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << FlipRotateMode::ROTATE_270 << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << IntMatrix{4, 3, {4, 8, 12, 3, 7, 11, 2, 6, 10, 1, 5, 9}};
+    QTest::newRow("14: rotate 270 degrees") << IntMatrix{4, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}} << FlipRotateMode::ROTATE_270 << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{4, 4, {4, 8, 12, 16, 3, 7, 11, 15, 2, 6, 10, 14, 1, 5, 9, 13}};
+    QTest::newRow("15: rotate 270 degrees") << IntMatrix{5, 2, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}} << FlipRotateMode::ROTATE_270 << matrix_size_t{6u} << matrix_size_t{6u} << matrix_opt_size_t{2u} << matrix_opt_size_t{0u} << IntMatrix{2, 5, {2, 4, 6, 8, 10, 1, 3, 5, 7, 9}};
+    QTest::newRow("16: flip vertical, empty matrix") << IntMatrix{} << FlipRotateMode::FLIP_VERTICAL << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << IntMatrix{};
+    QTest::newRow("17: flip horizontal, empty matrix") << IntMatrix{} << FlipRotateMode::FLIP_HORIZONTAL << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << IntMatrix{};
+    QTest::newRow("18: rotate 90 degrees, empty matrix") << IntMatrix{} << FlipRotateMode::ROTATE_90 << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << IntMatrix{};
+    QTest::newRow("19: rotate 180 degrees, empty matrix") << IntMatrix{} << FlipRotateMode::ROTATE_180 << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << IntMatrix{};
+    QTest::newRow("20: rotate 270 degrees, empty matrix") << IntMatrix{} << FlipRotateMode::ROTATE_270 << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << IntMatrix{};
 }
 
 void TransformationTests::testIntMatrixCatByRow_data()
@@ -159,6 +347,44 @@ void TransformationTests::testIntMatrixCatByColumn_data()
     QTest::newRow("12: same matrix") << IntMatrix{2, 8, {-1, 2, -3, 4, -5, 6, -7, 8, -9, 10, 11, -12, 13, -14, 15, -16}} << IntMatrix{} << ConcatMode::TO_ITSELF << matrix_size_t{2u} << matrix_size_t{16u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{2, 16, {-1, 2, -3, 4, -5, 6, -7, 8, -1, 2, -3, 4, -5, 6, -7, 8, -9, 10, 11, -12, 13, -14, 15, -16, -9, 10, 11, -12, 13, -14, 15, -16}};
 }
 
+void TransformationTests::testIntMatrixConcatRows_data()
+{
+    QTest::addColumn<IntMatrix>("destMatrix");
+    QTest::addColumn<std::vector<IntMatrix>>("srcMatrixes");
+    QTest::addColumn<matrix_size_t>("requestedRowCapacity");
+    QTest::addColumn<matrix_size_t>("requestedColumnCapacity");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("expectedDestMatrix");
+
+    QTest::newRow("1: multiple matrixes, reallocation") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<IntMatrix>{IntMatrix{1, 3, {7, 8, 9}}, IntMatrix{2, 3, {10, 11, 12, 13, 14, 15}}, IntMatrix{}} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{5, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}};
+    QTest::newRow("2: multiple matrixes, sufficient capacity") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<IntMatrix>{IntMatrix{1, 3, {7, 8, 9}}, IntMatrix{2, 3, {10, 11, 12, 13, 14, 15}}} << matrix_size_t{6u} << matrix_size_t{3u} << matrix_size_t{6u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{5, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}};
+    QTest::newRow("3: empty destination matrix") << IntMatrix{} << std::vector<IntMatrix>{IntMatrix{1, 3, {7, 8, 9}}, IntMatrix{2, 3, {10, 11, 12, 13, 14, 15}}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{3u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{3, 3, {7, 8, 9, 10, 11, 12, 13, 14, 15}};
+    QTest::newRow("4: no matrixes") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<IntMatrix>{} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}};
+    QTest::newRow("5: empty matrixes only") << IntMatrix{} << std::vector<IntMatrix>{IntMatrix{}, IntMatrix{}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << IntMatrix{};
+}
+
+void TransformationTests::testIntMatrixConcatColumns_data()
+{
+    QTest::addColumn<IntMatrix>("destMatrix");
+    QTest::addColumn<std::vector<IntMatrix>>("srcMatrixes");
+    QTest::addColumn<matrix_size_t>("requestedRowCapacity");
+    QTest::addColumn<matrix_size_t>("requestedColumnCapacity");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<IntMatrix>("expectedDestMatrix");
+
+    QTest::newRow("1: multiple matrixes, reallocation") << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}} << std::vector<IntMatrix>{IntMatrix{3, 1, {7, 8, 9}}, IntMatrix{}, IntMatrix{3, 2, {10, 11, 12, 13, 14, 15}}} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{3, 5, {1, 2, 7, 10, 11, 3, 4, 8, 12, 13, 5, 6, 9, 14, 15}};
+    QTest::newRow("2: multiple matrixes, sufficient capacity") << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}} << std::vector<IntMatrix>{IntMatrix{3, 1, {7, 8, 9}}, IntMatrix{3, 2, {10, 11, 12, 13, 14, 15}}} << matrix_size_t{3u} << matrix_size_t{6u} << matrix_size_t{3u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << IntMatrix{3, 5, {1, 2, 7, 10, 11, 3, 4, 8, 12, 13, 5, 6, 9, 14, 15}};
+    QTest::newRow("3: empty destination matrix") << IntMatrix{} << std::vector<IntMatrix>{IntMatrix{3, 1, {7, 8, 9}}, IntMatrix{3, 2, {10, 11, 12, 13, 14, 15}}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{3u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{3, 3, {7, 10, 11, 8, 12, 13, 9, 14, 15}};
+    QTest::newRow("4: no matrixes") << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}} << std::vector<IntMatrix>{} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}};
+    QTest::newRow("5: empty matrixes only") << IntMatrix{} << std::vector<IntMatrix>{IntMatrix{}, IntMatrix{}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << IntMatrix{};
+}
+
 void TransformationTests::testIntMatrixSplitByRow_data()
 {
     QTest::addColumn<IntMatrix>("srcMatrix");
@@ -251,6 +477,94 @@ void TransformationTests::testIntMatrixSplitByColumn_data()
     QTest::newRow("28: larger source matrix") << IntMatrix{2, 9, {-1, 2, -3, 4, -5, 6, -7, 8, -9, 10, -11, 12, -13, 14, -15, 16, -17, 18}} << IntMatrix{{5, 9}, 20} << matrix_size_t{1u} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_size_t{6u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << matrix_opt_size_t{2u} << matrix_opt_size_t{1u} << IntMatrix{2, 1, {-1, 10}} << IntMatrix{2, 8, {2, -3, 4, -5, 6, -7, 8, -9, -11, 12, -13, 14, -15, 16, -17, 18}};
 }
 
+void TransformationTests::testIntMatrixSplitRows_data()
+{
+    QTest::addColumn<IntMatrix>("srcMatrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("splitPositions");
+    QTest::addColumn<std::vector<IntMatrix>>("expectedMatrixes");
+
+    QTest::newRow("1: two split positions") << IntMatrix{6, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}} << std::vector<matrix_size_t>{2u, 5u} << std::vector<IntMatrix>{IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}}, IntMatrix{3, 3, {7, 8, 9, 10, 11, 12, 13, 14, 15}}, IntMatrix{1, 3, {16, 17, 18}}};
+    QTest::newRow("2: one split position") << IntMatrix{6, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}} << std::vector<matrix_size_t>{3u} << std::vector<IntMatrix>{IntMatrix{3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9}}, IntMatrix{3, 3, {10, 11, 12, 13, 14, 15, 16, 17, 18}}};
+    QTest::newRow("3: split into single rows") << IntMatrix{6, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}} << std::vector<matrix_size_t>{1u, 2u, 3u, 4u, 5u} << std::vector<IntMatrix>{IntMatrix{1, 3, {1, 2, 3}}, IntMatrix{1, 3, {4, 5, 6}}, IntMatrix{1, 3, {7, 8, 9}}, IntMatrix{1, 3, {10, 11, 12}}, IntMatrix{1, 3, {13, 14, 15}}, IntMatrix{1, 3, {16, 17, 18}}};
+    QTest::newRow("4: no split position") << IntMatrix{6, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}} << std::vector<matrix_size_t>{} << std::vector<IntMatrix>{IntMatrix{6, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}}};
+    QTest::newRow("5: empty matrix") << IntMatrix{} << std::vector<matrix_size_t>{} << std::vector<IntMatrix>{IntMatrix{}};
+}
+
+void TransformationTests::testIntMatrixSplitColumns_data()
+{
+    QTest::addColumn<IntMatrix>("srcMatrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("splitPositions");
+    QTest::addColumn<std::vector<IntMatrix>>("expectedMatrixes");
+
+    QTest::newRow("1: two split positions") << IntMatrix{3, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}} << std::vector<matrix_size_t>{2u, 5u} << std::vector<IntMatrix>{IntMatrix{3, 2, {1, 2, 7, 8, 13, 14}}, IntMatrix{3, 3, {3, 4, 5, 9, 10, 11, 15, 16, 17}}, IntMatrix{3, 1, {6, 12, 18}}};
+    QTest::newRow("2: one split position") << IntMatrix{3, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}} << std::vector<matrix_size_t>{3u} << std::vector<IntMatrix>{IntMatrix{3, 3, {1, 2, 3, 7, 8, 9, 13, 14, 15}}, IntMatrix{3, 3, {4, 5, 6, 10, 11, 12, 16, 17, 18}}};
+    QTest::newRow("3: split into single columns") << IntMatrix{3, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}} << std::vector<matrix_size_t>{1u, 2u, 3u, 4u, 5u} << std::vector<IntMatrix>{IntMatrix{3, 1, {1, 7, 13}}, IntMatrix{3, 1, {2, 8, 14}}, IntMatrix{3, 1, {3, 9, 15}}, IntMatrix{3, 1, {4, 10, 16}}, IntMatrix{3, 1, {5, 11, 17}}, IntMatrix{3, 1, {6, 12, 18}}};
+    QTest::newRow("4: no split position") << IntMatrix{3, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}} << std::vector<matrix_size_t>{} << std::vector<IntMatrix>{IntMatrix{3, 6, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18}}};
+    QTest::newRow("5: empty matrix") << IntMatrix{} << std::vector<matrix_size_t>{} << std::vector<IntMatrix>{IntMatrix{}};
+}
+
+void TransformationTests::testIntMatrixExtract_data()
+{
+    QTest::addColumn<IntMatrix>("srcMatrix");
+    QTest::addColumn<matrix_size_t>("rowNr");
+    QTest::addColumn<matrix_size_t>("columnNr");
+    QTest::addColumn<matrix_size_t>("nrOfRows");
+    QTest::addColumn<matrix_size_t>("nrOfColumns");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: inner block") << IntMatrix{4, 5, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20}} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{2u} << matrix_size_t{3u} << IntMatrix{2, 3, {7, 8, 9, 12, 13, 14}};
+    QTest::newRow("2: whole matrix") << IntMatrix{4, 5, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{4u} << matrix_size_t{5u} << IntMatrix{4, 5, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20}};
+    QTest::newRow("3: single element") << IntMatrix{4, 5, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20}} << matrix_size_t{3u} << matrix_size_t{4u} << matrix_size_t{1u} << matrix_size_t{1u} << IntMatrix{1, 1, {20}};
+    QTest::newRow("4: first row") << IntMatrix{4, 5, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{5u} << IntMatrix{1, 5, {1, 2, 3, 4, 5}};
+    QTest::newRow("5: last column") << IntMatrix{4, 5, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20}} << matrix_size_t{0u} << matrix_size_t{4u} << matrix_size_t{4u} << matrix_size_t{1u} << IntMatrix{4, 1, {5, 10, 15, 20}};
+    QTest::newRow("6: empty block") << IntMatrix{4, 5, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20}} << matrix_size_t{2u} << matrix_size_t{2u} << matrix_size_t{0u} << matrix_size_t{3u} << IntMatrix{};
+}
+
+void TransformationTests::testIntMatrixAssignBlock_data()
+{
+    QTest::addColumn<IntMatrix>("destMatrix");
+    QTest::addColumn<IntMatrix>("srcMatrix");
+    QTest::addColumn<matrix_size_t>("srcRowNr");
+    QTest::addColumn<matrix_size_t>("srcColumnNr");
+    QTest::addColumn<matrix_size_t>("nrOfRows");
+    QTest::addColumn<matrix_size_t>("nrOfColumns");
+    QTest::addColumn<matrix_size_t>("destRowNr");
+    QTest::addColumn<matrix_size_t>("destColumnNr");
+    QTest::addColumn<IntMatrix>("expectedDestMatrix");
+
+    QTest::newRow("1: inner block") << IntMatrix{4, 5, {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16, -17, -18, -19, -20}} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{2u} << matrix_size_t{2u} << matrix_size_t{1u} << matrix_size_t{2u} << IntMatrix{4, 5, {-1, -2, -3, -4, -5, -6, -7, 2, 3, -10, -11, -12, 6, 7, -15, -16, -17, -18, -19, -20}};
+    QTest::newRow("2: whole source matrix") << IntMatrix{4, 5, {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16, -17, -18, -19, -20}} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{3u} << matrix_size_t{4u} << matrix_size_t{1u} << matrix_size_t{1u} << IntMatrix{4, 5, {-1, -2, -3, -4, -5, -6, 1, 2, 3, 4, -11, 5, 6, 7, 8, -16, 9, 10, 11, 12}};
+    QTest::newRow("3: single element") << IntMatrix{4, 5, {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16, -17, -18, -19, -20}} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{0u} << matrix_size_t{0u} << IntMatrix{4, 5, {12, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16, -17, -18, -19, -20}};
+    QTest::newRow("4: rows") << IntMatrix{4, 5, {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16, -17, -18, -19, -20}} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{1u} << matrix_size_t{0u} << matrix_size_t{2u} << matrix_size_t{4u} << matrix_size_t{2u} << matrix_size_t{0u} << IntMatrix{4, 5, {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, 5, 6, 7, 8, -15, 9, 10, 11, 12, -20}};
+    QTest::newRow("5: empty block") << IntMatrix{4, 5, {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16, -17, -18, -19, -20}} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{2u} << matrix_size_t{0u} << matrix_size_t{2u} << matrix_size_t{3u} << IntMatrix{4, 5, {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16, -17, -18, -19, -20}};
+}
+
+void TransformationTests::testIntMatrixAssignRow_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("rowNr");
+    QTest::addColumn<std::vector<int>>("elements");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: assign first row") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << std::vector<int>{-1, -2, -3} << IntMatrix{4, 3, {-1, -2, -3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+    QTest::newRow("2: assign random row") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{2u} << std::vector<int>{-1, -2, -3} << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, -1, -2, -3, 10, 11, 12}};
+    QTest::newRow("3: assign last row") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{2u} << std::vector<int>{-1, -2, -3, -4} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, -1, -2, -3, -4}};
+    QTest::newRow("4: single element matrix") << IntMatrix{1, 1, {1}} << matrix_size_t{0u} << std::vector<int>{-1} << IntMatrix{1, 1, {-1}};
+}
+
+void TransformationTests::testIntMatrixAssignColumn_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("columnNr");
+    QTest::addColumn<std::vector<int>>("elements");
+    QTest::addColumn<IntMatrix>("expectedMatrix");
+
+    QTest::newRow("1: assign first column") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << std::vector<int>{-1, -2, -3, -4} << IntMatrix{4, 3, {-1, 2, 3, -2, 5, 6, -3, 8, 9, -4, 11, 12}};
+    QTest::newRow("2: assign random column") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{1u} << std::vector<int>{-1, -2, -3, -4} << IntMatrix{4, 3, {1, -1, 3, 4, -2, 6, 7, -3, 9, 10, -4, 12}};
+    QTest::newRow("3: assign last column") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{3u} << std::vector<int>{-1, -2, -3} << IntMatrix{3, 4, {1, 2, 3, -1, 5, 6, 7, -2, 9, 10, 11, -3}};
+    QTest::newRow("4: single element matrix") << IntMatrix{1, 1, {1}} << matrix_size_t{0u} << std::vector<int>{-1} << IntMatrix{1, 1, {-1}};
+}
+
 void TransformationTests::testStringMatrixTranspose_data()
 {
     QTest::addColumn<StringMatrix>("matrix");
@@ -264,7 +578,54 @@ void TransformationTests::testStringMatrixTranspose_data()
     QTest::newRow("2: small matrix") << StringMatrix{3, 2, {"First", "Fourth", "Second", "Fifth", "Third", "Sixth"}} << StringMatrix{2, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}} << matrix_size_t{3u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
     QTest::newRow("3: medium matrix") << c_StringMatrix1_8x9 << c_StringMatrix1_9x8 << matrix_size_t{10u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u};
     QTest::newRow("4: medium matrix") << c_StringMatrix1_9x8 << c_StringMatrix1_8x9 << matrix_size_t{11u} << matrix_size_t{10u} << matrix_opt_size_t{1u} << matrix_opt_size_t{0u};
-    QTest::newRow("5: empty matrix") << StringMatrix{} << StringMatrix{} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{};
+    QTest::newRow("5: square matrix") << StringMatrix{3, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth"}} << StringMatrix{3, 3, {"First", "Fourth", "Seventh", "Second", "Fifth", "Eighth", "Third", "Sixth", "Ninth"}} << matrix_size_t{3u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u};
+    QTest::newRow("6: empty matrix") << StringMatrix{} << StringMatrix{} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{};
+}
+
+void TransformationTests::testStringMatrixTransposedView_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: small matrix") << StringMatrix{2, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}} << StringMatrix{3, 2, {"First", "Fourth", "Second", "Fifth", "Third", "Sixth"}};
+    QTest::newRow("2: small matrix") << StringMatrix{3, 2, {"First", "Fourth", "Second", "Fifth", "Third", "Sixth"}} << StringMatrix{2, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}};
+    QTest::newRow("3: medium matrix") << c_StringMatrix1_8x9 << c_StringMatrix1_9x8;
+    QTest::newRow("4: medium matrix") << c_StringMatrix1_9x8 << c_StringMatrix1_8x9;
+    QTest::newRow("5: square matrix") << StringMatrix{3, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth"}} << StringMatrix{3, 3, {"First", "Fourth", "Seventh", "Second", "Fifth", "Eighth", "Third", "Sixth", "Ninth"}};
+    QTest::newRow("6: single row matrix") << StringMatrix{1, 4, {"First", "Second", "Third", "Fourth"}} << StringMatrix{4, 1, {"First", "Second", "Third", "Fourth"}};
+    QTest::newRow("7: empty matrix") << StringMatrix{} << StringMatrix{};
+}
+
+void TransformationTests::testStringMatrixFlipAndRotate_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<FlipRotateMode>("mode");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: flip vertical") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << FlipRotateMode::FLIP_VERTICAL << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 4, {"Ninth", "Tenth", "Eleventh", "Twelfth", "Fifth", "Sixth", "Seventh", "Eighth", "First", "Second", "Third", "Fourth"}};
+    QTest::newRow("2: flip vertical") << StringMatrix{4, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << FlipRotateMode::FLIP_VERTICAL << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Fifth", "Sixth", "Seventh", "Eighth", "First", "Second", "Third", "Fourth"}};
+    QTest::newRow("3: flip vertical") << StringMatrix{5, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth"}} << FlipRotateMode::FLIP_VERTICAL << matrix_size_t{6u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 2, {"Ninth", "Tenth", "Seventh", "Eighth", "Fifth", "Sixth", "Third", "Fourth", "First", "Second"}};
+    QTest::newRow("4: flip horizontal") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << FlipRotateMode::FLIP_HORIZONTAL << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 4, {"Fourth", "Third", "Second", "First", "Eighth", "Seventh", "Sixth", "Fifth", "Twelfth", "Eleventh", "Tenth", "Ninth"}};
+    QTest::newRow("5: flip horizontal") << StringMatrix{4, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << FlipRotateMode::FLIP_HORIZONTAL << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"Fourth", "Third", "Second", "First", "Eighth", "Seventh", "Sixth", "Fifth", "Twelfth", "Eleventh", "Tenth", "Ninth", "Sixteenth", "Fifteenth", "Fourteenth", "Thirteenth"}};
+    QTest::newRow("6: flip horizontal") << StringMatrix{5, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth"}} << FlipRotateMode::FLIP_HORIZONTAL << matrix_size_t{6u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 2, {"Second", "First", "Fourth", "Third", "Sixth", "Fifth", "Eighth", "Seventh", "Tenth", "Ninth"}};
+    QTest::newRow("7: rotate 90 degrees") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << FlipRotateMode::ROTATE_90 << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{4, 3, {"Ninth", "Fifth", "First", "Tenth", "Sixth", "Second", "Eleventh", "Seventh", "Third", "Twelfth", "Eighth", "Fourth"}};
+    QTest::newRow("8: rotate 90 degrees") << StringMatrix{4, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << FlipRotateMode::ROTATE_90 << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"Thirteenth", "Ninth", "Fifth", "First", "Fourteenth", "Tenth", "Sixth", "Second", "Fifteenth", "Eleventh", "Seventh", "Third", "Sixteenth", "Twelfth", "Eighth", "Fourth"}};
+    QTest::newRow("9: rotate 90 degrees") << StringMatrix{5, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth"}} << FlipRotateMode::ROTATE_90 << matrix_size_t{6u} << matrix_size_t{6u} << matrix_opt_size_t{2u} << matrix_opt_size_t{0u} << StringMatrix{2, 5, {"Ninth", "Seventh", "Fifth", "Third", "First", "Tenth", "Eighth", "Sixth", "Fourth", "Second"}};
+    QTest::newRow("10: rotate 180 degrees") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << FlipRotateMode::ROTATE_180 << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 4, {"Twelfth", "Eleventh", "Tenth", "Ninth", "Eighth", "Seventh", "Sixth", "Fifth", "Fourth", "Third", "Second", "First"}};
+    QTest::newRow("11: rotate 180 degrees") << StringMatrix{4, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << FlipRotateMode::ROTATE_180 << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"Sixteenth", "Fifteenth", "Fourteenth", "Thirteenth", "Twelfth", "Eleventh", "Tenth", "Ninth", "Eighth", "Seventh", "Sixth", "Fifth", "Fourth", "Third", "Second", "First"}};
+    QTest::newRow("12: rotate 180 degrees") << StringMatrix{5, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth"}} << FlipRotateMode::ROTATE_180 << matrix_size_t{6u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 2, {"Tenth", "Ninth", "Eighth", "Seventh", "Sixth", "Fifth", "Fourth", "Third", "Second", "First"}};
+    QTest::newRow("13: rotate 270 degrees") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << FlipRotateMode::ROTATE_270 << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{4, 3, {"Fourth", "Eighth", "Twelfth", "Third", "Seventh", "Eleventh", "Second", "Sixth", "Tenth", "First", "Fifth", "Ninth"}};
+    QTest::newRow("14: rotate 270 degrees") << StringMatrix{4, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth"}} << FlipRotateMode::ROTATE_270 << matrix_size_t{5u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{4, 4, {"Fourth", "Eighth", "Twelfth", "Sixteenth", "Third", "Seventh", "Eleventh", "Fifteenth", "Second", "Sixth", "Tenth", "Fourteenth", "First", "Fifth", "Ninth", "Thirteenth"}};
+    QTest::newRow("15: rotate 270 degrees") << StringMatrix{5, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth"}} << FlipRotateMode::ROTATE_270 << matrix_size_t{6u} << matrix_size_t{6u} << matrix_opt_size_t{2u} << matrix_opt_size_t{0u} << StringMatrix{2, 5, {"Second", "Fourth", "Sixth", "Eighth", "Tenth", "First", "Third", "Fifth", "Seventh", "Ninth"}};
+    QTest::newRow("16: flip vertical, empty matrix") << StringMatrix{} << FlipRotateMode::FLIP_VERTICAL << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << StringMatrix{};
+    QTest::newRow("17: flip horizontal, empty matrix") << StringMatrix{} << FlipRotateMode::FLIP_HORIZONTAL << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << StringMatrix{};
+    QTest::newRow("18: rotate 90 degrees, empty matrix") << StringMatrix{} << FlipRotateMode::ROTATE_90 << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << StringMatrix{};
+    QTest::newRow("19: rotate 180 degrees, empty matrix") << StringMatrix{} << FlipRotateMode::ROTATE_180 << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << StringMatrix{};
+    QTest::newRow("20: rotate 270 degrees, empty matrix") << StringMatrix{} << FlipRotateMode::ROTATE_270 << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << StringMatrix{};
 }
 
 void TransformationTests::testStringMatrixCatByRow_data()
@@ -317,6 +678,44 @@ void TransformationTests::testStringMatrixCatByColumn_data()
     QTest::newRow("12: same matrix") << StringMatrix{2, 8, {"-1a", "2B", "-3c", "4D", "-5e", "6F", "-7g", "8H", "-9i", "10J", "11K", "-12l", "13M", "-14n", "15O", "-16p"}} << StringMatrix{} << ConcatMode::TO_ITSELF << matrix_size_t{2u} << matrix_size_t{16u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 16, {"-1a", "2B", "-3c", "4D", "-5e", "6F", "-7g", "8H", "-1a", "2B", "-3c", "4D", "-5e", "6F", "-7g", "8H", "-9i", "10J", "11K", "-12l", "13M", "-14n", "15O", "-16p", "-9i", "10J", "11K", "-12l", "13M", "-14n", "15O", "-16p"}};
 }
 
+void TransformationTests::testStringMatrixConcatRows_data()
+{
+    QTest::addColumn<StringMatrix>("destMatrix");
+    QTest::addColumn<std::vector<StringMatrix>>("srcMatrixes");
+    QTest::addColumn<matrix_size_t>("requestedRowCapacity");
+    QTest::addColumn<matrix_size_t>("requestedColumnCapacity");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("expectedDestMatrix");
+
+    QTest::newRow("1: multiple matrixes, reallocation") << StringMatrix{2, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}} << std::vector<StringMatrix>{StringMatrix{1, 3, {"Seventh", "Eighth", "Ninth"}}, StringMatrix{2, 3, {"Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth"}}, StringMatrix{}} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth"}};
+    QTest::newRow("2: multiple matrixes, sufficient capacity") << StringMatrix{2, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}} << std::vector<StringMatrix>{StringMatrix{1, 3, {"Seventh", "Eighth", "Ninth"}}, StringMatrix{2, 3, {"Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth"}}} << matrix_size_t{6u} << matrix_size_t{3u} << matrix_size_t{6u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{5, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth"}};
+    QTest::newRow("3: empty destination matrix") << StringMatrix{} << std::vector<StringMatrix>{StringMatrix{1, 3, {"Seventh", "Eighth", "Ninth"}}, StringMatrix{2, 3, {"Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth"}}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{3u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 3, {"Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth"}};
+    QTest::newRow("4: no matrixes") << StringMatrix{2, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}} << std::vector<StringMatrix>{} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{2, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}};
+    QTest::newRow("5: empty matrixes only") << StringMatrix{} << std::vector<StringMatrix>{StringMatrix{}, StringMatrix{}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << StringMatrix{};
+}
+
+void TransformationTests::testStringMatrixConcatColumns_data()
+{
+    QTest::addColumn<StringMatrix>("destMatrix");
+    QTest::addColumn<std::vector<StringMatrix>>("srcMatrixes");
+    QTest::addColumn<matrix_size_t>("requestedRowCapacity");
+    QTest::addColumn<matrix_size_t>("requestedColumnCapacity");
+    QTest::addColumn<matrix_size_t>("expectedRowCapacity");
+    QTest::addColumn<matrix_size_t>("expectedColumnCapacity");
+    QTest::addColumn<matrix_opt_size_t>("expectedRowCapacityOffset");
+    QTest::addColumn<matrix_opt_size_t>("expectedColumnCapacityOffset");
+    QTest::addColumn<StringMatrix>("expectedDestMatrix");
+
+    QTest::newRow("1: multiple matrixes, reallocation") << StringMatrix{3, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}} << std::vector<StringMatrix>{StringMatrix{3, 1, {"Seventh", "Eighth", "Ninth"}}, StringMatrix{}, StringMatrix{3, 2, {"Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth"}}} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{5u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 5, {"First", "Second", "Seventh", "Tenth", "Eleventh", "Third", "Fourth", "Eighth", "Twelfth", "Thirteenth", "Fifth", "Sixth", "Ninth", "Fourteenth", "Fifteenth"}};
+    QTest::newRow("2: multiple matrixes, sufficient capacity") << StringMatrix{3, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}} << std::vector<StringMatrix>{StringMatrix{3, 1, {"Seventh", "Eighth", "Ninth"}}, StringMatrix{3, 2, {"Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth"}}} << matrix_size_t{3u} << matrix_size_t{6u} << matrix_size_t{3u} << matrix_size_t{6u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << StringMatrix{3, 5, {"First", "Second", "Seventh", "Tenth", "Eleventh", "Third", "Fourth", "Eighth", "Twelfth", "Thirteenth", "Fifth", "Sixth", "Ninth", "Fourteenth", "Fifteenth"}};
+    QTest::newRow("3: empty destination matrix") << StringMatrix{} << std::vector<StringMatrix>{StringMatrix{3, 1, {"Seventh", "Eighth", "Ninth"}}, StringMatrix{3, 2, {"Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth"}}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{3u} << matrix_size_t{3u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 3, {"Seventh", "Tenth", "Eleventh", "Eighth", "Twelfth", "Thirteenth", "Ninth", "Fourteenth", "Fifteenth"}};
+    QTest::newRow("4: no matrixes") << StringMatrix{3, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}} << std::vector<StringMatrix>{} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{2u} << matrix_opt_size_t{0u} << matrix_opt_size_t{0u} << StringMatrix{3, 2, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}};
+    QTest::newRow("5: empty matrixes only") << StringMatrix{} << std::vector<StringMatrix>{StringMatrix{}, StringMatrix{}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_opt_size_t{} << matrix_opt_size_t{} << StringMatrix{};
+}
+
 void TransformationTests::testStringMatrixSplitByRow_data()
 {
     QTest::addColumn<StringMatrix>("srcMatrix");
@@ -409,6 +808,94 @@ void TransformationTests::testStringMatrixSplitByColumn_data()
     QTest::newRow("28: larger source matrix") << StringMatrix{2, 9, {"-1a", "2B", "-3c", "4D", "-5e", "6F", "-7g", "8H", "-9i", "10J", "-11K", "12l", "-13M", "14n", "-15O", "16p", "-17Q", "18r"}} << StringMatrix{{5, 9}, "20Z"} << matrix_size_t{1u} << matrix_size_t{2u} << matrix_size_t{11u} << matrix_size_t{6u} << matrix_size_t{11u} << matrix_opt_size_t{0u} << matrix_opt_size_t{1u} << matrix_opt_size_t{2u} << matrix_opt_size_t{1u} << StringMatrix{2, 1, {"-1a", "10J"}} << StringMatrix{2, 8, {"2B", "-3c", "4D", "-5e", "6F", "-7g", "8H", "-9i", "-11K", "12l", "-13M", "14n", "-15O", "16p", "-17Q", "18r"}};
 }
 
+void TransformationTests::testStringMatrixSplitRows_data()
+{
+    QTest::addColumn<StringMatrix>("srcMatrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("splitPositions");
+    QTest::addColumn<std::vector<StringMatrix>>("expectedMatrixes");
+
+    QTest::newRow("1: two split positions") << StringMatrix{6, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth"}} << std::vector<matrix_size_t>{2u, 5u} << std::vector<StringMatrix>{StringMatrix{2, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth"}}, StringMatrix{3, 3, {"Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth"}}, StringMatrix{1, 3, {"Sixteenth", "Seventeenth", "Eighteenth"}}};
+    QTest::newRow("2: one split position") << StringMatrix{6, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth"}} << std::vector<matrix_size_t>{3u} << std::vector<StringMatrix>{StringMatrix{3, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth"}}, StringMatrix{3, 3, {"Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth"}}};
+    QTest::newRow("3: split into single rows") << StringMatrix{6, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth"}} << std::vector<matrix_size_t>{1u, 2u, 3u, 4u, 5u} << std::vector<StringMatrix>{StringMatrix{1, 3, {"First", "Second", "Third"}}, StringMatrix{1, 3, {"Fourth", "Fifth", "Sixth"}}, StringMatrix{1, 3, {"Seventh", "Eighth", "Ninth"}}, StringMatrix{1, 3, {"Tenth", "Eleventh", "Twelfth"}}, StringMatrix{1, 3, {"Thirteenth", "Fourteenth", "Fifteenth"}}, StringMatrix{1, 3, {"Sixteenth", "Seventeenth", "Eighteenth"}}};
+    QTest::newRow("4: no split position") << StringMatrix{6, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth"}} << std::vector<matrix_size_t>{} << std::vector<StringMatrix>{StringMatrix{6, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth"}}};
+    QTest::newRow("5: empty matrix") << StringMatrix{} << std::vector<matrix_size_t>{} << std::vector<StringMatrix>{StringMatrix{}};
+}
+
+void TransformationTests::testStringMatrixSplitColumns_data()
+{
+    QTest::addColumn<StringMatrix>("srcMatrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("splitPositions");
+    QTest::addColumn<std::vector<StringMatrix>>("expectedMatrixes");
+
+    QTest::newRow("1: two split positions") << StringMatrix{3, 6, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth"}} << std::vector<matrix_size_t>{2u, 5u} << std::vector<StringMatrix>{StringMatrix{3, 2, {"First", "Second", "Seventh", "Eighth", "Thirteenth", "Fourteenth"}}, StringMatrix{3, 3, {"Third", "Fourth", "Fifth", "Ninth", "Tenth", "Eleventh", "Fifteenth", "Sixteenth", "Seventeenth"}}, StringMatrix{3, 1, {"Sixth", "Twelfth", "Eighteenth"}}};
+    QTest::newRow("2: one split position") << StringMatrix{3, 6, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth"}} << std::vector<matrix_size_t>{3u} << std::vector<StringMatrix>{StringMatrix{3, 3, {"First", "Second", "Third", "Seventh", "Eighth", "Ninth", "Thirteenth", "Fourteenth", "Fifteenth"}}, StringMatrix{3, 3, {"Fourth", "Fifth", "Sixth", "Tenth", "Eleventh", "Twelfth", "Sixteenth", "Seventeenth", "Eighteenth"}}};
+    QTest::newRow("3: split into single columns") << StringMatrix{3, 6, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth"}} << std::vector<matrix_size_t>{1u, 2u, 3u, 4u, 5u} << std::vector<StringMatrix>{StringMatrix{3, 1, {"First", "Seventh", "Thirteenth"}}, StringMatrix{3, 1, {"Second", "Eighth", "Fourteenth"}}, StringMatrix{3, 1, {"Third", "Ninth", "Fifteenth"}}, StringMatrix{3, 1, {"Fourth", "Tenth", "Sixteenth"}}, StringMatrix{3, 1, {"Fifth", "Eleventh", "Seventeenth"}}, StringMatrix{3, 1, {"Sixth", "Twelfth", "Eighteenth"}}};
+    QTest::newRow("4: no split position") << StringMatrix{3, 6, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth"}} << std::vector<matrix_size_t>{} << std::vector<StringMatrix>{StringMatrix{3, 6, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth"}}};
+    QTest::newRow("5: empty matrix") << StringMatrix{} << std::vector<matrix_size_t>{} << std::vector<StringMatrix>{StringMatrix{}};
+}
+
+void TransformationTests::testStringMatrixExtract_data()
+{
+    QTest::addColumn<StringMatrix>("srcMatrix");
+    QTest::addColumn<matrix_size_t>("rowNr");
+    QTest::addColumn<matrix_size_t>("columnNr");
+    QTest::addColumn<matrix_size_t>("nrOfRows");
+    QTest::addColumn<matrix_size_t>("nrOfColumns");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: inner block") << StringMatrix{4, 5, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth", "Nineteenth", "Twentieth"}} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{2u} << matrix_size_t{3u} << StringMatrix{2, 3, {"Seventh", "Eighth", "Ninth", "Twelfth", "Thirteenth", "Fourteenth"}};
+    QTest::newRow("2: whole matrix") << StringMatrix{4, 5, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth", "Nineteenth", "Twentieth"}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{4u} << matrix_size_t{5u} << StringMatrix{4, 5, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth", "Nineteenth", "Twentieth"}};
+    QTest::newRow("3: single element") << StringMatrix{4, 5, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth", "Nineteenth", "Twentieth"}} << matrix_size_t{3u} << matrix_size_t{4u} << matrix_size_t{1u} << matrix_size_t{1u} << StringMatrix{1, 1, {"Twentieth"}};
+    QTest::newRow("4: first row") << StringMatrix{4, 5, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth", "Nineteenth", "Twentieth"}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{5u} << StringMatrix{1, 5, {"First", "Second", "Third", "Fourth", "Fifth"}};
+    QTest::newRow("5: last column") << StringMatrix{4, 5, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth", "Nineteenth", "Twentieth"}} << matrix_size_t{0u} << matrix_size_t{4u} << matrix_size_t{4u} << matrix_size_t{1u} << StringMatrix{4, 1, {"Fifth", "Tenth", "Fifteenth", "Twentieth"}};
+    QTest::newRow("6: empty block") << StringMatrix{4, 5, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth", "Thirteenth", "Fourteenth", "Fifteenth", "Sixteenth", "Seventeenth", "Eighteenth", "Nineteenth", "Twentieth"}} << matrix_size_t{2u} << matrix_size_t{2u} << matrix_size_t{0u} << matrix_size_t{3u} << StringMatrix{};
+}
+
+void TransformationTests::testStringMatrixAssignBlock_data()
+{
+    QTest::addColumn<StringMatrix>("destMatrix");
+    QTest::addColumn<StringMatrix>("srcMatrix");
+    QTest::addColumn<matrix_size_t>("srcRowNr");
+    QTest::addColumn<matrix_size_t>("srcColumnNr");
+    QTest::addColumn<matrix_size_t>("nrOfRows");
+    QTest::addColumn<matrix_size_t>("nrOfColumns");
+    QTest::addColumn<matrix_size_t>("destRowNr");
+    QTest::addColumn<matrix_size_t>("destColumnNr");
+    QTest::addColumn<StringMatrix>("expectedDestMatrix");
+
+    QTest::newRow("1: inner block") << StringMatrix{4, 5, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th", "19th", "20th"}} << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{2u} << matrix_size_t{2u} << matrix_size_t{1u} << matrix_size_t{2u} << StringMatrix{4, 5, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "Second", "Third", "10th", "11th", "12th", "Sixth", "Seventh", "15th", "16th", "17th", "18th", "19th", "20th"}};
+    QTest::newRow("2: whole source matrix") << StringMatrix{4, 5, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th", "19th", "20th"}} << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{3u} << matrix_size_t{4u} << matrix_size_t{1u} << matrix_size_t{1u} << StringMatrix{4, 5, {"1st", "2nd", "3rd", "4th", "5th", "6th", "First", "Second", "Third", "Fourth", "11th", "Fifth", "Sixth", "Seventh", "Eighth", "16th", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("3: single element") << StringMatrix{4, 5, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th", "19th", "20th"}} << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{0u} << matrix_size_t{0u} << StringMatrix{4, 5, {"Twelfth", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th", "19th", "20th"}};
+    QTest::newRow("4: rows") << StringMatrix{4, 5, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th", "19th", "20th"}} << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{1u} << matrix_size_t{0u} << matrix_size_t{2u} << matrix_size_t{4u} << matrix_size_t{2u} << matrix_size_t{0u} << StringMatrix{4, 5, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "Fifth", "Sixth", "Seventh", "Eighth", "15th", "Ninth", "Tenth", "Eleventh", "Twelfth", "20th"}};
+    QTest::newRow("5: empty block") << StringMatrix{4, 5, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th", "19th", "20th"}} << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{2u} << matrix_size_t{0u} << matrix_size_t{2u} << matrix_size_t{3u} << StringMatrix{4, 5, {"1st", "2nd", "3rd", "4th", "5th", "6th", "7th", "8th", "9th", "10th", "11th", "12th", "13th", "14th", "15th", "16th", "17th", "18th", "19th", "20th"}};
+}
+
+void TransformationTests::testStringMatrixAssignRow_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("rowNr");
+    QTest::addColumn<std::vector<std::string>>("elements");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: assign first row") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::vector<std::string>{"1st", "2nd", "3rd"} << StringMatrix{4, 3, {"1st", "2nd", "3rd", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("2: assign random row") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << std::vector<std::string>{"1st", "2nd", "3rd"} << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "1st", "2nd", "3rd", "Tenth", "Eleventh", "Twelfth"}};
+    QTest::newRow("3: assign last row") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{2u} << std::vector<std::string>{"1st", "2nd", "3rd", "4th"} << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "1st", "2nd", "3rd", "4th"}};
+    QTest::newRow("4: single element matrix") << StringMatrix{1, 1, {"First"}} << matrix_size_t{0u} << std::vector<std::string>{"1st"} << StringMatrix{1, 1, {"1st"}};
+}
+
+void TransformationTests::testStringMatrixAssignColumn_data()
+{
+    QTest::addColumn<StringMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("columnNr");
+    QTest::addColumn<std::vector<std::string>>("elements");
+    QTest::addColumn<StringMatrix>("expectedMatrix");
+
+    QTest::newRow("1: assign first column") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{0u} << std::vector<std::string>{"1st", "2nd", "3rd", "4th"} << StringMatrix{4, 3, {"1st", "Second", "Third", "2nd", "Fifth", "Sixth", "3rd", "Eighth", "Ninth", "4th", "Eleventh", "Twelfth"}};
+    QTest::newRow("2: assign random column") << StringMatrix{4, 3, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{1u} << std::vector<std::string>{"1st", "2nd", "3rd", "4th"} << StringMatrix{4, 3, {"First", "1st", "Third", "Fourth", "2nd", "Sixth", "Seventh", "3rd", "Ninth", "Tenth", "4th", "Twelfth"}};
+    QTest::newRow("3: assign last column") << StringMatrix{3, 4, {"First", "Second", "Third", "Fourth", "Fifth", "Sixth", "Seventh", "Eighth", "Ninth", "Tenth", "Eleventh", "Twelfth"}} << matrix_size_t{3u} << std::vector<std::string>{"1st", "2nd", "3rd"} << StringMatrix{3, 4, {"First", "Second", "Third", "1st", "Fifth", "Sixth", "Seventh", "2nd", "Ninth", "Tenth", "Eleventh", "3rd"}};
+    QTest::newRow("4: single element matrix") << StringMatrix{1, 1, {"First"}} << matrix_size_t{0u} << std::vector<std::string>{"1st"} << StringMatrix{1, 1, {"1st"}};
+}
+
 QTEST_APPLESS_MAIN(TransformationTests)
 
 #include "tst_transformationtests.moc"
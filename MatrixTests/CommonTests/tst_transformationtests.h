@@ -16,6 +16,71 @@
                  matrix.getColumnCapacityOffset() == expectedColumnCapacityOffset,                                     \
              "Transposing failed, the resulting capacity (offset), dimensions and/or values are incorrect!");
 
+#define TEST_MATRIX_TRANSPOSED_VIEW(matrixType)                                                                        \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    const Matrix<matrixType> c_MatrixCopy{matrix};                                                                     \
+    auto transposedView{matrix.transposedView()};                                                                      \
+    const auto c_ConstTransposedView{std::as_const(matrix).transposedView()};                                          \
+    bool areElementsMatching{transposedView.getNrOfRows() == expectedMatrix.getNrOfRows() &&                           \
+                             transposedView.getNrOfColumns() == expectedMatrix.getNrOfColumns()};                      \
+                                                                                                                       \
+    for (Matrix<matrixType>::size_type rowNr{0}; areElementsMatching && rowNr < expectedMatrix.getNrOfRows(); ++rowNr) \
+    {                                                                                                                  \
+        for (Matrix<matrixType>::size_type columnNr{0}; columnNr < expectedMatrix.getNrOfColumns(); ++columnNr)        \
+        {                                                                                                              \
+            areElementsMatching = areElementsMatching &&                                                               \
+                                  transposedView.at(rowNr, columnNr) == expectedMatrix.at(rowNr, columnNr) &&          \
+                                  c_ConstTransposedView.at(rowNr, columnNr) == expectedMatrix.at(rowNr, columnNr);     \
+        }                                                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    QVERIFY2(areElementsMatching && transposedView.isEmpty() == expectedMatrix.isEmpty() &&                            \
+                 std::equal(transposedView.begin(), transposedView.end(), expectedMatrix.constZBegin(),                \
+                            expectedMatrix.constZEnd()) &&                                                             \
+                 std::equal(c_ConstTransposedView.begin(), c_ConstTransposedView.end(), expectedMatrix.constZBegin(),  \
+                            expectedMatrix.constZEnd()) &&                                                             \
+                 matrix == c_MatrixCopy,                                                                               \
+             "The transposed view is incorrect or the underlying matrix has been modified!");
+
+#define TEST_MATRIX_FLIP_OR_ROTATE(matrixType)                                                                         \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(FlipRotateMode, mode);                                                                                      \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    switch (mode)                                                                                                      \
+    {                                                                                                                  \
+    case FlipRotateMode::FLIP_VERTICAL:                                                                                \
+        matrix.flipVertical();                                                                                         \
+        break;                                                                                                         \
+    case FlipRotateMode::FLIP_HORIZONTAL:                                                                              \
+        matrix.flipHorizontal();                                                                                       \
+        break;                                                                                                         \
+    case FlipRotateMode::ROTATE_90:                                                                                    \
+        matrix.rotate90();                                                                                             \
+        break;                                                                                                         \
+    case FlipRotateMode::ROTATE_180:                                                                                   \
+        matrix.rotate180();                                                                                            \
+        break;                                                                                                         \
+    case FlipRotateMode::ROTATE_270:                                                                                   \
+        matrix.rotate270();                                                                                            \
+        break;                                                                                                         \
+    default:                                                                                                           \
+        assert(false);                                                                                                 \
+        break;                                                                                                         \
+    }                                                                                                                  \
+                                                                                                                       \
+    QVERIFY2(matrix == expectedMatrix && matrix.getRowCapacity() == expectedRowCapacity &&                             \
+                 matrix.getColumnCapacity() == expectedColumnCapacity &&                                               \
+                 matrix.getRowCapacityOffset() == expectedRowCapacityOffset &&                                         \
+                 matrix.getColumnCapacityOffset() == expectedColumnCapacityOffset,                                     \
+             "Flipping/rotating failed, the resulting capacity (offset), dimensions and/or values are incorrect!");
+
 #define TEST_MATRIX_CAT_BY_ROW(matrixType)                                                                             \
     QFETCH(Matrix<matrixType>, destMatrix);                                                                            \
     QFETCH(Matrix<matrixType>, srcMatrix);                                                                             \
@@ -86,6 +151,53 @@
     QVERIFY2(destMatrix == expectedDestMatrix,                                                                         \
              "Horizontal concatenation failed, destination matrix has incorrect values!");
 
+#define TEST_MATRIX_CONCAT(matrixType, concatMethod, stackFunction, concatType)                                        \
+    QFETCH(Matrix<matrixType>, destMatrix);                                                                            \
+    QFETCH(std::vector<Matrix<matrixType>>, srcMatrixes);                                                              \
+    QFETCH(Matrix<matrixType>::size_type, requestedRowCapacity);                                                       \
+    QFETCH(Matrix<matrixType>::size_type, requestedColumnCapacity);                                                    \
+    QFETCH(Matrix<matrixType>::size_type, expectedRowCapacity);                                                        \
+    QFETCH(Matrix<matrixType>::size_type, expectedColumnCapacity);                                                     \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedRowCapacityOffset);                                   \
+    QFETCH(std::optional<Matrix<matrixType>::size_type>, expectedColumnCapacityOffset);                                \
+    QFETCH(Matrix<matrixType>, expectedDestMatrix);                                                                    \
+                                                                                                                       \
+    std::vector<Matrix<matrixType>> stackedMatrixes{destMatrix};                                                       \
+    std::vector<Matrix<matrixType>*> srcMatrixPtrs;                                                                    \
+    std::vector<Matrix<matrixType>*> stackedMatrixPtrs;                                                                \
+                                                                                                                       \
+    stackedMatrixes.insert(stackedMatrixes.cend(), srcMatrixes.cbegin(), srcMatrixes.cend());                          \
+                                                                                                                       \
+    for (auto& matrix : srcMatrixes)                                                                                   \
+    {                                                                                                                  \
+        srcMatrixPtrs.push_back(&matrix);                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    for (auto& matrix : stackedMatrixes)                                                                               \
+    {                                                                                                                  \
+        stackedMatrixPtrs.push_back(&matrix);                                                                          \
+    }                                                                                                                  \
+                                                                                                                       \
+    QVERIFY2(stackFunction(stackedMatrixPtrs) == expectedDestMatrix, concatType " stacking failed, wrong result!");    \
+                                                                                                                       \
+    destMatrix.reserve(requestedRowCapacity, requestedColumnCapacity);                                                 \
+    destMatrix.concatMethod(srcMatrixPtrs);                                                                            \
+                                                                                                                       \
+    if (destMatrix.getRowCapacity() != expectedRowCapacity ||                                                          \
+        destMatrix.getColumnCapacity() != expectedColumnCapacity ||                                                    \
+        destMatrix.getRowCapacityOffset() != expectedRowCapacityOffset ||                                              \
+        destMatrix.getColumnCapacityOffset() != expectedColumnCapacityOffset)                                          \
+    {                                                                                                                  \
+        QFAIL(concatType " concatenation failed, capacity (offset) of the destination matrix is not correct!");        \
+    }                                                                                                                  \
+                                                                                                                       \
+    QVERIFY2(destMatrix == expectedDestMatrix, concatType " concatenation failed, destination matrix is incorrect!");  \
+                                                                                                                       \
+    for (const auto& matrix : srcMatrixes)                                                                             \
+    {                                                                                                                  \
+        QVERIFY2(matrix.isEmpty(), concatType " concatenation failed, source matrix has not been cleared!");          \
+    }
+
 #define TEST_MATRIX_SPLIT_BY_ROW(matrixType)                                                                           \
     QFETCH(Matrix<matrixType>, srcMatrix);                                                                             \
     QFETCH(Matrix<matrixType>, destMatrix);                                                                            \
@@ -159,3 +271,130 @@
     }                                                                                                                  \
                                                                                                                        \
     QVERIFY2(destMatrix == expectedDestMatrix, "Horizontal split failed, destination matrix has incorrect values!");
+
+#define TEST_MATRIX_MULTI_WAY_SPLIT(matrixType, splitMethod, splitIntoViewsMethod, splitType)                          \
+    QFETCH(Matrix<matrixType>, srcMatrix);                                                                             \
+    QFETCH(std::vector<Matrix<matrixType>::size_type>, splitPositions);                                                \
+    QFETCH(std::vector<Matrix<matrixType>>, expectedMatrixes);                                                         \
+                                                                                                                       \
+    const auto c_BlockViews{srcMatrix.splitIntoViewsMethod(splitPositions)};                                           \
+                                                                                                                       \
+    QVERIFY2(c_BlockViews.size() == expectedMatrixes.size(), splitType " split into views failed, wrong count!");      \
+                                                                                                                       \
+    for (size_t blockNr{0}; blockNr < c_BlockViews.size(); ++blockNr)                                                  \
+    {                                                                                                                  \
+        const auto& c_BlockView{c_BlockViews[blockNr]};                                                                \
+        const Matrix<matrixType>& c_ExpectedMatrix{expectedMatrixes[blockNr]};                                         \
+                                                                                                                       \
+        QVERIFY2(c_BlockView.getNrOfRows() == c_ExpectedMatrix.getNrOfRows() &&                                        \
+                     c_BlockView.getNrOfColumns() == c_ExpectedMatrix.getNrOfColumns(),                                \
+                 splitType " split into views failed, incorrect view dimensions!");                                    \
+                                                                                                                       \
+        for (Matrix<matrixType>::size_type rowNr{0}; rowNr < c_BlockView.getNrOfRows(); ++rowNr)                       \
+        {                                                                                                              \
+            const auto c_Row{c_BlockView.getRow(rowNr)};                                                               \
+                                                                                                                       \
+            QVERIFY2(std::equal(c_Row.begin(), c_Row.end(), c_ExpectedMatrix.constZRowBegin(rowNr)),                   \
+                     splitType " split into views failed, incorrect view elements!");                                  \
+        }                                                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    const std::vector<Matrix<matrixType>> c_Matrixes{srcMatrix.splitMethod(splitPositions)};                           \
+                                                                                                                       \
+    QVERIFY2(c_Matrixes == expectedMatrixes, splitType " split failed, the resulting matrixes are incorrect!");        \
+    QVERIFY2(srcMatrix.isEmpty(), splitType " split failed, the source matrix has not been cleared!");                 \
+                                                                                                                       \
+    for (const auto& matrix : c_Matrixes)                                                                              \
+    {                                                                                                                  \
+        QVERIFY2(matrix.getRowCapacity() == matrix.getNrOfRows() &&                                                    \
+                     matrix.getColumnCapacity() == matrix.getNrOfColumns(),                                            \
+                 splitType " split failed, the resulting matrixes should have no spare capacity!");                    \
+    }
+
+#define TEST_MATRIX_EXTRACT(matrixType)                                                                                \
+    QFETCH(Matrix<matrixType>, srcMatrix);                                                                             \
+    QFETCH(Matrix<matrixType>::size_type, rowNr);                                                                      \
+    QFETCH(Matrix<matrixType>::size_type, columnNr);                                                                   \
+    QFETCH(Matrix<matrixType>::size_type, nrOfRows);                                                                   \
+    QFETCH(Matrix<matrixType>::size_type, nrOfColumns);                                                                \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    const Matrix<matrixType> c_SrcMatrixCopy{srcMatrix};                                                               \
+    const Matrix<matrixType> c_Matrix{srcMatrix.extract(rowNr, columnNr, nrOfRows, nrOfColumns)};                      \
+                                                                                                                       \
+    QVERIFY2(c_Matrix == expectedMatrix && c_Matrix.getRowCapacity() == c_Matrix.getNrOfRows() &&                      \
+                 c_Matrix.getColumnCapacity() == c_Matrix.getNrOfColumns(),                                            \
+             "Block extraction failed, the resulting matrix is incorrect!");                                           \
+    QVERIFY2(srcMatrix == c_SrcMatrixCopy, "Block extraction failed, the source matrix has been modified!");
+
+#define TEST_MATRIX_ASSIGN_BLOCK(matrixType)                                                                           \
+    QFETCH(Matrix<matrixType>, destMatrix);                                                                            \
+    QFETCH(Matrix<matrixType>, srcMatrix);                                                                             \
+    QFETCH(Matrix<matrixType>::size_type, srcRowNr);                                                                   \
+    QFETCH(Matrix<matrixType>::size_type, srcColumnNr);                                                                \
+    QFETCH(Matrix<matrixType>::size_type, nrOfRows);                                                                   \
+    QFETCH(Matrix<matrixType>::size_type, nrOfColumns);                                                                \
+    QFETCH(Matrix<matrixType>::size_type, destRowNr);                                                                  \
+    QFETCH(Matrix<matrixType>::size_type, destColumnNr);                                                               \
+    QFETCH(Matrix<matrixType>, expectedDestMatrix);                                                                    \
+                                                                                                                       \
+    const Matrix<matrixType> c_SrcMatrixCopy{srcMatrix};                                                               \
+    const Matrix<matrixType>::size_type c_DestRowCapacity{destMatrix.getRowCapacity()};                                \
+    const Matrix<matrixType>::size_type c_DestColumnCapacity{destMatrix.getColumnCapacity()};                          \
+    Matrix<matrixType> moveDestMatrix{destMatrix};                                                                     \
+                                                                                                                       \
+    destMatrix.assignBlock(srcMatrix, srcRowNr, srcColumnNr, nrOfRows, nrOfColumns, destRowNr, destColumnNr);          \
+                                                                                                                       \
+    QVERIFY2(destMatrix == expectedDestMatrix && destMatrix.getRowCapacity() == c_DestRowCapacity &&                   \
+                 destMatrix.getColumnCapacity() == c_DestColumnCapacity,                                               \
+             "Block assignment failed, the destination matrix is incorrect!");                                         \
+    QVERIFY2(srcMatrix == c_SrcMatrixCopy, "Block assignment failed, the source matrix has been modified!");           \
+                                                                                                                       \
+    moveDestMatrix.assignBlock(std::move(srcMatrix), srcRowNr, srcColumnNr, nrOfRows, nrOfColumns, destRowNr,          \
+                               destColumnNr);                                                                          \
+                                                                                                                       \
+    QVERIFY2(moveDestMatrix == expectedDestMatrix, "Block move assignment failed, wrong destination matrix!");
+
+#define TEST_MATRIX_ASSIGN_ROW(matrixType)                                                                             \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, rowNr);                                                                      \
+    QFETCH(std::vector<matrixType>, elements);                                                                         \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    const std::vector<matrixType> c_ElementsCopy{elements};                                                            \
+    const Matrix<matrixType>::size_type c_RowCapacity{matrix.getRowCapacity()};                                        \
+    const Matrix<matrixType>::size_type c_ColumnCapacity{matrix.getColumnCapacity()};                                  \
+    Matrix<matrixType> moveMatrix{matrix};                                                                             \
+                                                                                                                       \
+    matrix.assignRow(rowNr, elements);                                                                                 \
+                                                                                                                       \
+    QVERIFY2(matrix == expectedMatrix && matrix.getRowCapacity() == c_RowCapacity &&                                   \
+                 matrix.getColumnCapacity() == c_ColumnCapacity,                                                       \
+             "Row assignment failed, the matrix is incorrect!");                                                       \
+    QVERIFY2(elements == c_ElementsCopy, "Row assignment failed, the elements of the range have been modified!");      \
+                                                                                                                       \
+    moveMatrix.assignRow(rowNr, std::move(elements));                                                                  \
+                                                                                                                       \
+    QVERIFY2(moveMatrix == expectedMatrix, "Row move assignment failed, the matrix is incorrect!");
+
+#define TEST_MATRIX_ASSIGN_COLUMN(matrixType)                                                                          \
+    QFETCH(Matrix<matrixType>, matrix);                                                                                \
+    QFETCH(Matrix<matrixType>::size_type, columnNr);                                                                   \
+    QFETCH(std::vector<matrixType>, elements);                                                                         \
+    QFETCH(Matrix<matrixType>, expectedMatrix);                                                                        \
+                                                                                                                       \
+    const std::vector<matrixType> c_ElementsCopy{elements};                                                            \
+    const Matrix<matrixType>::size_type c_RowCapacity{matrix.getRowCapacity()};                                        \
+    const Matrix<matrixType>::size_type c_ColumnCapacity{matrix.getColumnCapacity()};                                  \
+    Matrix<matrixType> moveMatrix{matrix};                                                                             \
+                                                                                                                       \
+    matrix.assignColumn(columnNr, elements);                                                                           \
+                                                                                                                       \
+    QVERIFY2(matrix == expectedMatrix && matrix.getRowCapacity() == c_RowCapacity &&                                   \
+                 matrix.getColumnCapacity() == c_ColumnCapacity,                                                       \
+             "Column assignment failed, the matrix is incorrect!");                                                    \
+    QVERIFY2(elements == c_ElementsCopy, "Column assignment failed, the elements of the range have been modified!");   \
+                                                                                                                       \
+    moveMatrix.assignColumn(columnNr, std::move(elements));                                                            \
+                                                                                                                       \
+    QVERIFY2(moveMatrix == expectedMatrix, "Column move assignment failed, the matrix is incorrect!");
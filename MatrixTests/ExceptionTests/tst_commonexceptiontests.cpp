@@ -1,12 +1,43 @@
 // clang-format off
 #include <QTest>
 
+#include <ranges>
+#include <string>
+
 #include "testenums.h"
 #include "testconstants.h"
 
 using IntMatrix = Matrix<int>;
+using DoubleMatrix = Matrix<double>;
+using StringMatrix = Matrix<std::string>;
+
+// element type whose product throws for negative operands (used for checking that the exceptions thrown by the jobs
+// running on helper threads reach the calling thread)
+struct ThrowingNumber
+{
+    ThrowingNumber operator*(const ThrowingNumber& other) const
+    {
+        if (value < 0 || other.value < 0)
+        {
+            throw std::runtime_error{"Negative operand"};
+        }
+
+        return ThrowingNumber{value * other.value};
+    }
+
+    ThrowingNumber& operator+=(const ThrowingNumber& other)
+    {
+        value += other.value;
+        return *this;
+    }
+
+    bool operator==(const ThrowingNumber& other) const = default;
+
+    int value{0};
+};
 
 Q_DECLARE_METATYPE(IntMatrix)
+Q_DECLARE_METATYPE(DoubleMatrix)
 Q_DECLARE_METATYPE(ConcatMode)
 Q_DECLARE_METATYPE(SplitMode)
 
@@ -31,39 +62,116 @@ private slots:
     void testVectorConstructorExceptions();
     void testIdenticalElementsConstructorExceptions();
     void testDiagonalMatrixConstructorExceptions();
+    void testMatrixBuilderExceptions();
+    void testMatrixBuilderExceptionSafety();
     void testFunctionAtExceptions();
+    void testTransposedViewFunctionAtExceptions();
     void testResizeWithoutFillingInNewValuesExceptions();
     void testResizeAndFillInNewValuesExceptions();
+    void testResizeForOverwriteExceptions();
+    void testReshapeExceptions();
     void testInsertRowNoSetValueExceptions();
     void testInsertRowSetValueExceptions();
     void testInsertColumnNoSetValueExceptions();
     void testInsertColumnSetValueExceptions();
+    void testInsertRowsFromRangeExceptions();
+    void testInsertColumnsFromRangeExceptions();
+    void testInsertRowFromRangeExceptions();
+    void testInsertColumnFromRangeExceptions();
+    void testEmplaceRowExceptions();
+    void testEmplaceColumnExceptions();
+    void testAssignRowExceptions();
+    void testAssignColumnExceptions();
     void testEraseRowExceptions();
     void testEraseColumnExceptions();
+    void testEraseRowsExceptions();
+    void testEraseColumnsExceptions();
     void testCatByRowExceptions();
     void testCatByColumnExceptions();
+    void testConcatRowsExceptions();
+    void testConcatColumnsExceptions();
+    void testConcatNullOrDuplicateMatrixExceptions();
     void testSplitByRowExceptions();
     void testSplitByColumnExceptions();
+    void testSplitRowsExceptions();
+    void testSplitColumnsExceptions();
+    void testExtractExceptions();
+    void testAssignBlockExceptions();
     void testSwapRowsOrColumnsExceptions();
+    void testPermuteRowsExceptions();
+    void testPermuteColumnsExceptions();
+    void testColumnOrderViewExceptions();
+    void testElementWiseOperationExceptions();
+    void testExpressionEvaluationExceptionSafety();
+    void testMultiplyExceptions();
+    void testGemmExceptions();
+    void testGemmWithMatrixAsOperandExceptions();
+    void testParallelMultiplyExceptionPropagation();
+    void testParallelReductionExceptionPropagation();
+    void testMatrixVectorMultiplyExceptions();
+    void testGemvExceptions();
+    void testSquareMatrixOperationExceptions();
+    void testSolveExceptions();
+    void testCholeskyExceptions();
+    void testCholeskySolveExceptions();
+    void testQRExceptions();
+    void testLeastSquaresExceptions();
+    void testTraceExceptions();
+    void testDiagonalExtractionExceptions();
 
     // test data
     void testVectorConstructorExceptions_data();
     void testIdenticalElementsConstructorExceptions_data();
     void testDiagonalMatrixConstructorExceptions_data();
+    void testMatrixBuilderExceptions_data();
     void testFunctionAtExceptions_data();
+    void testTransposedViewFunctionAtExceptions_data();
     void testResizeWithoutFillingInNewValuesExceptions_data();
     void testResizeAndFillInNewValuesExceptions_data();
+    void testResizeForOverwriteExceptions_data();
+    void testReshapeExceptions_data();
     void testInsertRowNoSetValueExceptions_data();
     void testInsertRowSetValueExceptions_data();
     void testInsertColumnNoSetValueExceptions_data();
     void testInsertColumnSetValueExceptions_data();
+    void testInsertRowsFromRangeExceptions_data();
+    void testInsertColumnsFromRangeExceptions_data();
+    void testInsertRowFromRangeExceptions_data();
+    void testInsertColumnFromRangeExceptions_data();
+    void testEmplaceRowExceptions_data();
+    void testEmplaceColumnExceptions_data();
+    void testAssignRowExceptions_data();
+    void testAssignColumnExceptions_data();
     void testEraseRowExceptions_data();
     void testEraseColumnExceptions_data();
+    void testEraseRowsExceptions_data();
+    void testEraseColumnsExceptions_data();
     void testCatByRowExceptions_data();
     void testCatByColumnExceptions_data();
+    void testConcatRowsExceptions_data();
+    void testConcatColumnsExceptions_data();
     void testSplitByRowExceptions_data();
     void testSplitByColumnExceptions_data();
+    void testSplitRowsExceptions_data();
+    void testSplitColumnsExceptions_data();
+    void testExtractExceptions_data();
+    void testAssignBlockExceptions_data();
     void testSwapRowsOrColumnsExceptions_data();
+    void testPermuteRowsExceptions_data();
+    void testPermuteColumnsExceptions_data();
+    void testColumnOrderViewExceptions_data();
+    void testElementWiseOperationExceptions_data();
+    void testMultiplyExceptions_data();
+    void testGemmExceptions_data();
+    void testMatrixVectorMultiplyExceptions_data();
+    void testSquareMatrixOperationExceptions_data();
+    void testSolveExceptions_data();
+    void testCholeskyExceptions_data();
+    void testCholeskySolveExceptions_data();
+    void testQRExceptions_data();
+    void testLeastSquaresExceptions_data();
+    void testTraceExceptions_data();
+    void testDiagonalExtractionExceptions_data();
 
 private:
     // test data helper methods
@@ -99,6 +207,45 @@ void CommonExceptionTests::testDiagonalMatrixConstructorExceptions()
     QVERIFY_THROWS_EXCEPTION(std::runtime_error, {IntMatrix matrix(rowsColumnsCount, std::pair<int, int>{nonDiagonalElementValue, diagonalElementValue});});
 }
 
+void CommonExceptionTests::testMatrixBuilderExceptions()
+{
+    QFETCH(matrix_size_t, nrOfColumns);
+    QFETCH(matrix_size_t, rowCapacity);
+    QFETCH(std::vector<std::vector<int>>, rows);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {MatrixBuilder<int> builder(nrOfColumns, rowCapacity); for (const std::vector<int>& row : rows) {builder.appendRow(row);}});
+}
+
+// the builder should remain unchanged when an element of the appended row cannot be obtained
+void CommonExceptionTests::testMatrixBuilderExceptionSafety()
+{
+    auto toString = [](int value) {
+        if (value < 0)
+        {
+            throw std::runtime_error{"Negative value"};
+        }
+
+        return std::to_string(value);
+    };
+
+    const std::vector<int> c_ValidRow{1, 2, 3};
+    const std::vector<int> c_InvalidRow{4, 5, -6};
+
+    MatrixBuilder<std::string> builder{3};
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {builder.appendRow(c_InvalidRow | std::views::transform(toString));});
+    QVERIFY(builder.getNrOfRows() == 0 && builder.getRowCapacity() == 0);
+
+    builder.appendRow(c_ValidRow | std::views::transform(toString));
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {builder.appendRow(c_InvalidRow | std::views::transform(toString));});
+    QVERIFY(builder.getNrOfRows() == 1);
+
+    builder.appendRow(c_ValidRow | std::views::transform(toString));
+
+    QVERIFY(builder.finish() == StringMatrix(2, 3, {"1", "2", "3", "1", "2", "3"}));
+}
+
 void CommonExceptionTests::testFunctionAtExceptions()
 {
     QFETCH(IntMatrix, srcMatrix);
@@ -113,6 +260,19 @@ void CommonExceptionTests::testFunctionAtExceptions()
 
 }
 
+void CommonExceptionTests::testTransposedViewFunctionAtExceptions()
+{
+    QFETCH(IntMatrix, srcMatrix);
+    QFETCH(matrix_size_t, rowNr);
+    QFETCH(matrix_size_t, columnNr);
+    QFETCH(int, value);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {IntMatrix matrix{srcMatrix}; matrix.transposedView().at(rowNr, columnNr) = value;});
+
+    // test for the const view too
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {const IntMatrix c_Matrix{srcMatrix}; value = c_Matrix.transposedView().at(rowNr, columnNr);});
+}
+
 void CommonExceptionTests::testResizeWithoutFillingInNewValuesExceptions()
 {
     QFETCH(IntMatrix, matrix);
@@ -132,6 +292,24 @@ void CommonExceptionTests::testResizeAndFillInNewValuesExceptions()
     QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.resize(requestedRowsCount, requestedColumnsCount, fillValue);});
 }
 
+void CommonExceptionTests::testResizeForOverwriteExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_size_t, requestedRowsCount);
+    QFETCH(matrix_size_t, requestedColumnsCount);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.resizeForOverwrite(requestedRowsCount, requestedColumnsCount);});
+}
+
+void CommonExceptionTests::testReshapeExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_size_t, requestedRowsCount);
+    QFETCH(matrix_size_t, requestedColumnsCount);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.reshape(requestedRowsCount, requestedColumnsCount);});
+}
+
 void CommonExceptionTests::testInsertRowNoSetValueExceptions()
 {
     QFETCH(IntMatrix, matrix);
@@ -166,6 +344,78 @@ void CommonExceptionTests::testInsertColumnSetValueExceptions()
     QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.insertColumn(insertPosition, insertedColumnValue);});
 }
 
+void CommonExceptionTests::testInsertRowsFromRangeExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_size_t, insertPosition);
+    QFETCH(std::vector<int>, insertedElements);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.insertRows(insertPosition, insertedElements);});
+}
+
+void CommonExceptionTests::testInsertColumnsFromRangeExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_size_t, insertPosition);
+    QFETCH(std::vector<int>, insertedElements);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.insertColumns(insertPosition, insertedElements);});
+}
+
+void CommonExceptionTests::testInsertRowFromRangeExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_size_t, insertPosition);
+    QFETCH(std::vector<int>, insertedElements);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.insertRow(insertPosition, insertedElements);});
+}
+
+void CommonExceptionTests::testInsertColumnFromRangeExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_size_t, insertPosition);
+    QFETCH(std::vector<int>, insertedElements);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.insertColumn(insertPosition, insertedElements);});
+}
+
+void CommonExceptionTests::testEmplaceRowExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_size_t, insertPosition);
+    QFETCH(int, insertedRowValue);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.emplaceRow(insertPosition, insertedRowValue);});
+}
+
+void CommonExceptionTests::testEmplaceColumnExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_size_t, insertPosition);
+    QFETCH(int, insertedColumnValue);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.emplaceColumn(insertPosition, insertedColumnValue);});
+}
+
+void CommonExceptionTests::testAssignRowExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_size_t, rowNr);
+    QFETCH(std::vector<int>, elements);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.assignRow(rowNr, elements);});
+}
+
+void CommonExceptionTests::testAssignColumnExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_size_t, columnNr);
+    QFETCH(std::vector<int>, elements);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.assignColumn(columnNr, elements);});
+}
+
 void CommonExceptionTests::testEraseRowExceptions()
 {
     QFETCH(IntMatrix, matrix);
@@ -182,6 +432,22 @@ void CommonExceptionTests::testEraseColumnExceptions()
     QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.eraseColumn(erasePosition);});
 }
 
+void CommonExceptionTests::testEraseRowsExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(std::vector<matrix_size_t>, erasePositions);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.eraseRows(erasePositions);});
+}
+
+void CommonExceptionTests::testEraseColumnsExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(std::vector<matrix_size_t>, erasePositions);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.eraseColumns(erasePositions);});
+}
+
 void CommonExceptionTests::testCatByRowExceptions()
 {
     QFETCH(IntMatrix, destMatrix);
@@ -228,6 +494,76 @@ void CommonExceptionTests::testCatByColumnExceptions()
                              });
 }
 
+void CommonExceptionTests::testConcatRowsExceptions()
+{
+    QFETCH(IntMatrix, destMatrix);
+    QFETCH(std::vector<IntMatrix>, srcMatrixes);
+    QFETCH(ConcatMode, mode);
+
+    std::vector<IntMatrix*> srcMatrixPtrs;
+
+    for (auto& matrix : srcMatrixes)
+    {
+        srcMatrixPtrs.push_back(&matrix);
+    }
+
+    if (mode == ConcatMode::TO_ITSELF)
+    {
+        srcMatrixPtrs.push_back(&destMatrix);
+    }
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, destMatrix.concatRows(srcMatrixPtrs));
+}
+
+void CommonExceptionTests::testConcatColumnsExceptions()
+{
+    QFETCH(IntMatrix, destMatrix);
+    QFETCH(std::vector<IntMatrix>, srcMatrixes);
+    QFETCH(ConcatMode, mode);
+
+    std::vector<IntMatrix*> srcMatrixPtrs;
+
+    for (auto& matrix : srcMatrixes)
+    {
+        srcMatrixPtrs.push_back(&matrix);
+    }
+
+    if (mode == ConcatMode::TO_ITSELF)
+    {
+        srcMatrixPtrs.push_back(&destMatrix);
+    }
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, destMatrix.concatColumns(srcMatrixPtrs));
+}
+
+// the matrixes should remain unchanged when a null or duplicate entry is provided (the arguments are validated first)
+void CommonExceptionTests::testConcatNullOrDuplicateMatrixExceptions()
+{
+    IntMatrix destMatrix{2, 2, {1, 2, 3, 4}};
+    IntMatrix firstSrcMatrix{2, 2, {5, 6, 7, 8}};
+    IntMatrix secondSrcMatrix{2, 2, {9, 10, 11, 12}};
+
+    const std::vector<IntMatrix*> c_NullEntryPtrs{&firstSrcMatrix, nullptr, &secondSrcMatrix};
+    const std::vector<IntMatrix*> c_DuplicateEntryPtrs{&firstSrcMatrix, &secondSrcMatrix, &firstSrcMatrix};
+    const std::vector<IntMatrix*> c_DuplicateDestinationPtrs{&firstSrcMatrix, &destMatrix, &destMatrix};
+
+    for (const std::vector<IntMatrix*>& srcMatrixPtrs : {c_NullEntryPtrs, c_DuplicateEntryPtrs, c_DuplicateDestinationPtrs})
+    {
+        QVERIFY_THROWS_EXCEPTION(std::runtime_error, destMatrix.concatRows(srcMatrixPtrs));
+        QVERIFY_THROWS_EXCEPTION(std::runtime_error, destMatrix.concatColumns(srcMatrixPtrs));
+    }
+
+    for (const std::vector<IntMatrix*>& srcMatrixPtrs : {c_NullEntryPtrs, c_DuplicateEntryPtrs})
+    {
+        QVERIFY_THROWS_EXCEPTION(std::runtime_error, {const IntMatrix c_Matrix{vstack(srcMatrixPtrs)};});
+        QVERIFY_THROWS_EXCEPTION(std::runtime_error, {const IntMatrix c_Matrix{hstack(srcMatrixPtrs)};});
+    }
+
+    QVERIFY(destMatrix == IntMatrix(2, 2, {1, 2, 3, 4}));
+    QVERIFY(firstSrcMatrix == IntMatrix(2, 2, {5, 6, 7, 8}));
+    QVERIFY(secondSrcMatrix == IntMatrix(2, 2, {9, 10, 11, 12}));
+}
+
 void CommonExceptionTests::testSplitByRowExceptions()
 {
     QFETCH(IntMatrix, srcMatrix);
@@ -276,6 +612,52 @@ void CommonExceptionTests::testSplitByColumnExceptions()
                              });
 }
 
+void CommonExceptionTests::testSplitRowsExceptions()
+{
+    QFETCH(IntMatrix, srcMatrix);
+    QFETCH(std::vector<matrix_size_t>, splitPositions);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, std::as_const(srcMatrix).splitRowsIntoViews(splitPositions));
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, srcMatrix.splitRowsIntoViews(splitPositions));
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, srcMatrix.splitRows(splitPositions));
+}
+
+void CommonExceptionTests::testSplitColumnsExceptions()
+{
+    QFETCH(IntMatrix, srcMatrix);
+    QFETCH(std::vector<matrix_size_t>, splitPositions);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, std::as_const(srcMatrix).splitColumnsIntoViews(splitPositions));
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, srcMatrix.splitColumnsIntoViews(splitPositions));
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, srcMatrix.splitColumns(splitPositions));
+}
+
+void CommonExceptionTests::testExtractExceptions()
+{
+    QFETCH(IntMatrix, srcMatrix);
+    QFETCH(matrix_size_t, rowNr);
+    QFETCH(matrix_size_t, columnNr);
+    QFETCH(matrix_size_t, nrOfRows);
+    QFETCH(matrix_size_t, nrOfColumns);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, srcMatrix.extract(rowNr, columnNr, nrOfRows, nrOfColumns));
+}
+
+void CommonExceptionTests::testAssignBlockExceptions()
+{
+    QFETCH(IntMatrix, destMatrix);
+    QFETCH(IntMatrix, srcMatrix);
+    QFETCH(matrix_size_t, srcRowNr);
+    QFETCH(matrix_size_t, srcColumnNr);
+    QFETCH(matrix_size_t, nrOfRows);
+    QFETCH(matrix_size_t, nrOfColumns);
+    QFETCH(matrix_size_t, destRowNr);
+    QFETCH(matrix_size_t, destColumnNr);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {destMatrix.assignBlock(srcMatrix, srcRowNr, srcColumnNr, nrOfRows, nrOfColumns, destRowNr, destColumnNr);});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {destMatrix.assignBlock(std::move(srcMatrix), srcRowNr, srcColumnNr, nrOfRows, nrOfColumns, destRowNr, destColumnNr);});
+}
+
 void CommonExceptionTests::testSwapRowsOrColumnsExceptions()
 {
     QFETCH(IntMatrix, matrix);
@@ -289,6 +671,215 @@ void CommonExceptionTests::testSwapRowsOrColumnsExceptions()
     QVERIFY_THROWS_EXCEPTION(std::runtime_error, {auxMatrix.swapColumns(firstRowColumnNr, secondRowColumnNr);});
 }
 
+void CommonExceptionTests::testPermuteRowsExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(std::vector<matrix_size_t>, permutation);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.permuteRows(permutation);});
+}
+
+void CommonExceptionTests::testPermuteColumnsExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(std::vector<matrix_size_t>, permutation);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix.permuteColumns(permutation);});
+}
+
+void CommonExceptionTests::testColumnOrderViewExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_size_t, firstColumnNr);
+    QFETCH(matrix_size_t, secondColumnNr);
+
+    auto columnOrderView{matrix.columnOrderView()};
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {columnOrderView.swapColumns(firstColumnNr, secondColumnNr);});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {columnOrderView.moveColumn(firstColumnNr, secondColumnNr);});
+}
+
+void CommonExceptionTests::testElementWiseOperationExceptions()
+{
+    QFETCH(IntMatrix, firstMatrix);
+    QFETCH(IntMatrix, secondMatrix);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {IntMatrix matrix{firstMatrix + secondMatrix};});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {IntMatrix matrix{firstMatrix * 2 - secondMatrix};});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {IntMatrix matrix{abs(firstMatrix) * secondMatrix};});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {IntMatrix matrix{firstMatrix / (secondMatrix + 1)};});
+}
+
+// the exception thrown when evaluating an element should reach the caller, the elements computed so far being destroyed
+void CommonExceptionTests::testExpressionEvaluationExceptionSafety()
+{
+    const Matrix<ThrowingNumber> c_FirstMatrix{{3, 4}, ThrowingNumber{2}};
+    Matrix<ThrowingNumber> secondMatrix{{3, 4}, ThrowingNumber{3}};
+    secondMatrix.at(2, 1) = ThrowingNumber{-1};
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {const Matrix<ThrowingNumber> c_Matrix{c_FirstMatrix * secondMatrix};});
+
+    // different dimensions: the matrix is not changed as the expression is evaluated into a new matrix first
+    Matrix<ThrowingNumber> matrix{{2, 2}, ThrowingNumber{5}};
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {matrix = c_FirstMatrix * secondMatrix;});
+    QVERIFY(matrix == Matrix<ThrowingNumber>({2, 2}, ThrowingNumber{5}));
+}
+
+void CommonExceptionTests::testMultiplyExceptions()
+{
+    QFETCH(IntMatrix, firstMatrix);
+    QFETCH(IntMatrix, secondMatrix);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {IntMatrix matrix{multiply(firstMatrix, secondMatrix)};});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {IntMatrix matrix{strassenMultiply(firstMatrix, secondMatrix)};});
+}
+
+void CommonExceptionTests::testGemmExceptions()
+{
+    QFETCH(IntMatrix, firstMatrix);
+    QFETCH(IntMatrix, secondMatrix);
+    QFETCH(IntMatrix, matrix);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {gemm(2, firstMatrix, secondMatrix, 3, matrix);});
+}
+
+void CommonExceptionTests::testGemmWithMatrixAsOperandExceptions()
+{
+    IntMatrix firstMatrix{2, 2, {1, 2, 3, 4}};
+    IntMatrix secondMatrix{2, 2, {5, 6, 7, 8}};
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {gemm(1, firstMatrix, secondMatrix, 0, firstMatrix);});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {gemm(1, firstMatrix, secondMatrix, 0, secondMatrix);});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {gemm(1, firstMatrix, firstMatrix, 1, firstMatrix);});
+}
+
+// each row group contains a negative element so each thread throws once it picks its first group
+void CommonExceptionTests::testParallelMultiplyExceptionPropagation()
+{
+    const Matrix<ThrowingNumber> c_FirstMatrix{{40, 3}, ThrowingNumber{-1}};
+    const Matrix<ThrowingNumber> c_SecondMatrix{{3, 5}, ThrowingNumber{2}};
+
+    for (size_t nrOfThreads : {2u, 4u, 8u})
+    {
+        QVERIFY_THROWS_EXCEPTION(std::runtime_error, {const Matrix<ThrowingNumber> c_Matrix{multiply(c_FirstMatrix, c_SecondMatrix, Matr::ExecutionPolicy{nrOfThreads})};});
+    }
+
+    // no exception when all operands are non-negative
+    QVERIFY(multiply(Matrix<ThrowingNumber>{{40, 3}, ThrowingNumber{1}}, c_SecondMatrix, Matr::ExecutionPolicy{4}) == Matrix<ThrowingNumber>({40, 5}, ThrowingNumber{6}));
+}
+
+// the last rows contain a negative element so the thread reducing them throws (for more than one thread this is a helper thread)
+void CommonExceptionTests::testParallelReductionExceptionPropagation()
+{
+    IntMatrix matrix{{40, 6}, 1};
+    matrix.at(39, 5) = -1;
+
+    auto addNonNegative = [](int first, int second) {
+        if (first < 0 || second < 0)
+        {
+            throw std::runtime_error{"Negative operand"};
+        }
+
+        return first + second;
+    };
+
+    for (size_t nrOfThreads : {1u, 2u, 4u, 8u})
+    {
+        QVERIFY_THROWS_EXCEPTION(std::runtime_error, {const std::vector<int> c_Result{matrix.reduceRows(addNonNegative, 0, Matr::ExecutionPolicy{nrOfThreads})};});
+        QVERIFY_THROWS_EXCEPTION(std::runtime_error, {const std::vector<int> c_Result{matrix.reduceColumns(addNonNegative, 0, Matr::ExecutionPolicy{nrOfThreads})};});
+    }
+
+    matrix.at(39, 5) = 1;
+
+    QVERIFY(matrix.reduceColumns(addNonNegative, 0, Matr::ExecutionPolicy{4}) == std::vector<int>(6, 40));
+}
+
+void CommonExceptionTests::testMatrixVectorMultiplyExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(std::vector<int>, vector);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {std::vector<int> result{multiply(matrix, vector)};});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {std::vector<int> result{multiply(vector, matrix)};});
+}
+
+void CommonExceptionTests::testGemvExceptions()
+{
+    const IntMatrix c_Matrix{2, 3, {1, 2, 3, 4, 5, 6}};
+
+    std::vector<int> resultingVector(2);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {gemv(1, c_Matrix, std::vector<int>{1, 2}, 0, resultingVector);});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {gemv(1, IntMatrix{}, std::vector<int>{1, 2}, 0, resultingVector);});
+
+    resultingVector.resize(3);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {gemv(1, c_Matrix, std::vector<int>{1, 2, 3}, 0, resultingVector);});
+}
+
+void CommonExceptionTests::testSquareMatrixOperationExceptions()
+{
+    QFETCH(DoubleMatrix, matrix);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {auto factors{luDecompose(matrix)};});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {determinant(matrix);});
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {DoubleMatrix result{inverse(matrix)};});
+}
+
+void CommonExceptionTests::testSolveExceptions()
+{
+    QFETCH(DoubleMatrix, firstMatrix);
+    QFETCH(DoubleMatrix, secondMatrix);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {DoubleMatrix result{solve(firstMatrix, secondMatrix)};});
+}
+
+void CommonExceptionTests::testCholeskyExceptions()
+{
+    QFETCH(DoubleMatrix, matrix);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {cholesky(matrix);});
+}
+
+void CommonExceptionTests::testCholeskySolveExceptions()
+{
+    QFETCH(DoubleMatrix, firstMatrix);
+    QFETCH(DoubleMatrix, secondMatrix);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {DoubleMatrix result{choleskySolve(firstMatrix, secondMatrix)};});
+}
+
+void CommonExceptionTests::testQRExceptions()
+{
+    QFETCH(DoubleMatrix, matrix);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {qr(matrix);});
+}
+
+void CommonExceptionTests::testLeastSquaresExceptions()
+{
+    QFETCH(DoubleMatrix, firstMatrix);
+    QFETCH(DoubleMatrix, secondMatrix);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {DoubleMatrix result{leastSquares(firstMatrix, secondMatrix)};});
+}
+
+void CommonExceptionTests::testTraceExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {int result{matrix.trace()}; Q_UNUSED(result);});
+}
+
+void CommonExceptionTests::testDiagonalExtractionExceptions()
+{
+    QFETCH(IntMatrix, matrix);
+    QFETCH(matrix_diff_t, diagonalNr);
+
+    QVERIFY_THROWS_EXCEPTION(std::runtime_error, {std::vector<int> diagonal{matrix.diagonal(diagonalNr)}; Q_UNUSED(diagonal);});
+}
+
 void CommonExceptionTests::testVectorConstructorExceptions_data()
 {
     QTest::addColumn<matrix_size_t>("rowsCount");
@@ -343,6 +934,21 @@ void CommonExceptionTests::testDiagonalMatrixConstructorExceptions_data()
     QTest::newRow("2: exceeding rows and columns count") << c_IncrMaxAllowedDimension << 2 << 5;
 }
 
+void CommonExceptionTests::testMatrixBuilderExceptions_data()
+{
+    QTest::addColumn<matrix_size_t>("nrOfColumns");
+    QTest::addColumn<matrix_size_t>("rowCapacity");
+    QTest::addColumn<std::vector<std::vector<int>>>("rows");
+
+    QTest::newRow("1: elements count not matching provided columns count") << matrix_size_t{3u} << matrix_size_t{0u} << std::vector<std::vector<int>>{{1, 2}};
+    QTest::newRow("2: elements count not matching first row") << matrix_size_t{0u} << matrix_size_t{0u} << std::vector<std::vector<int>>{{1, 2}, {3, 4, 5}};
+    QTest::newRow("3: null elements count") << matrix_size_t{0u} << matrix_size_t{0u} << std::vector<std::vector<int>>{{}};
+    QTest::newRow("4: exceeding columns count") << c_IncrMaxAllowedDimension << matrix_size_t{0u} << std::vector<std::vector<int>>{};
+    QTest::newRow("5: exceeding row capacity") << matrix_size_t{2u} << c_IncrMaxAllowedDimension << std::vector<std::vector<int>>{};
+    QTest::newRow("6: exceeding elements count") << matrix_size_t{0u} << matrix_size_t{0u} << std::vector<std::vector<int>>{std::vector<int>(c_IncrMaxAllowedDimension, 1)};
+    QTest::newRow("7: exceeding rows count") << matrix_size_t{1u} << matrix_size_t{0u} << std::vector<std::vector<int>>(c_IncrMaxAllowedDimension, std::vector<int>{1});
+}
+
 void CommonExceptionTests::testFunctionAtExceptions_data()
 {
     QTest::addColumn<IntMatrix>("srcMatrix");
@@ -356,6 +962,19 @@ void CommonExceptionTests::testFunctionAtExceptions_data()
     QTest::newRow("4: empty matrix") << IntMatrix{} << matrix_size_t{0u} << matrix_size_t{0u} << 0;
 }
 
+void CommonExceptionTests::testTransposedViewFunctionAtExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("srcMatrix");
+    QTest::addColumn<matrix_size_t>("rowNr");
+    QTest::addColumn<matrix_size_t>("columnNr");
+    QTest::addColumn<int>("value");
+
+    QTest::newRow("1: column number out of range") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{1u} << matrix_size_t{2u} << 0;
+    QTest::newRow("2: row number out of range") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{3u} << matrix_size_t{1u} << 0;
+    QTest::newRow("3: row and column number out of range") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{3u} << matrix_size_t{2u} << 0;
+    QTest::newRow("4: empty matrix") << IntMatrix{} << matrix_size_t{0u} << matrix_size_t{0u} << 0;
+}
+
 void CommonExceptionTests::testResizeWithoutFillingInNewValuesExceptions_data()
 {
     _buildResizeExceptionsTestingTable();
@@ -366,6 +985,28 @@ void CommonExceptionTests::testResizeAndFillInNewValuesExceptions_data()
     _buildResizeExceptionsTestingTable();
 }
 
+void CommonExceptionTests::testResizeForOverwriteExceptions_data()
+{
+    _buildResizeExceptionsTestingTable();
+}
+
+void CommonExceptionTests::testReshapeExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("requestedRowsCount");
+    QTest::addColumn<matrix_size_t>("requestedColumnsCount");
+
+    QTest::newRow("1: null rows and columns count") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{0u} << matrix_size_t{0u};
+    QTest::newRow("2: null rows and columns count") << IntMatrix{} << matrix_size_t{0u} << matrix_size_t{0u};
+    QTest::newRow("3: null rows count") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{0u} << matrix_size_t{6u};
+    QTest::newRow("4: null columns count") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{6u} << matrix_size_t{0u};
+    QTest::newRow("5: exceeding rows count") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << c_IncrMaxAllowedDimension << matrix_size_t{1u};
+    QTest::newRow("6: exceeding columns count") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{1u} << c_IncrMaxAllowedDimension;
+    QTest::newRow("7: less elements") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{1u} << matrix_size_t{5u};
+    QTest::newRow("8: more elements") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{3u} << matrix_size_t{3u};
+    QTest::newRow("9: more elements") << IntMatrix{} << matrix_size_t{1u} << matrix_size_t{1u};
+}
+
 void CommonExceptionTests::testInsertRowNoSetValueExceptions_data()
 {
     _buildInsertRowExceptionsTestingTable();
@@ -386,6 +1027,90 @@ void CommonExceptionTests::testInsertColumnSetValueExceptions_data()
     _buildInsertColumnExceptionsTestingTable();
 }
 
+void CommonExceptionTests::testInsertRowsFromRangeExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<int>>("insertedElements");
+
+    QTest::newRow("1: insert position out of range") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{3u} << std::vector<int>{7, 8, 9};
+    QTest::newRow("2: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{1u} << std::vector<int>{7, 8, 9, 10};
+    QTest::newRow("3: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{2u} << std::vector<int>{7, 8};
+    QTest::newRow("4: empty matrix") << IntMatrix{} << matrix_size_t{0u} << std::vector<int>{7, 8, 9};
+}
+
+void CommonExceptionTests::testInsertColumnsFromRangeExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<int>>("insertedElements");
+
+    QTest::newRow("1: insert position out of range") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{4u} << std::vector<int>{7, 8};
+    QTest::newRow("2: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{1u} << std::vector<int>{7, 8, 9};
+    QTest::newRow("3: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{3u} << std::vector<int>{7};
+    QTest::newRow("4: empty matrix") << IntMatrix{} << matrix_size_t{0u} << std::vector<int>{7, 8};
+}
+
+void CommonExceptionTests::testInsertRowFromRangeExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<int>>("insertedElements");
+
+    QTest::newRow("1: insert position out of range") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{3u} << std::vector<int>{7, 8, 9};
+    QTest::newRow("2: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{1u} << std::vector<int>{7, 8};
+    QTest::newRow("3: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{2u} << std::vector<int>{7, 8, 9, 10, 11, 12};
+    QTest::newRow("4: empty matrix") << IntMatrix{} << matrix_size_t{0u} << std::vector<int>{7, 8, 9};
+    QTest::newRow("5: maximum rows count reached") << IntMatrix{{c_MaxAllowedDimension, 2}, -5} << matrix_size_t{2u} << std::vector<int>{7, 8};
+}
+
+void CommonExceptionTests::testInsertColumnFromRangeExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("insertPosition");
+    QTest::addColumn<std::vector<int>>("insertedElements");
+
+    QTest::newRow("1: insert position out of range") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{4u} << std::vector<int>{7, 8};
+    QTest::newRow("2: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{1u} << std::vector<int>{7, 8, 9};
+    QTest::newRow("3: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{3u} << std::vector<int>{7, 8, 9, 10};
+    QTest::newRow("4: empty matrix") << IntMatrix{} << matrix_size_t{0u} << std::vector<int>{7, 8};
+    QTest::newRow("5: maximum columns count reached") << IntMatrix{{2, c_MaxAllowedDimension}, -5} << matrix_size_t{2u} << std::vector<int>{7, 8};
+}
+
+void CommonExceptionTests::testEmplaceRowExceptions_data()
+{
+    _buildInsertRowExceptionsTestingTable();
+}
+
+void CommonExceptionTests::testEmplaceColumnExceptions_data()
+{
+    _buildInsertColumnExceptionsTestingTable();
+}
+
+void CommonExceptionTests::testAssignRowExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("rowNr");
+    QTest::addColumn<std::vector<int>>("elements");
+
+    QTest::newRow("1: row does not exist") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{2u} << std::vector<int>{7, 8, 9};
+    QTest::newRow("2: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{1u} << std::vector<int>{7, 8};
+    QTest::newRow("3: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{0u} << std::vector<int>{7, 8, 9, 10};
+    QTest::newRow("4: empty matrix") << IntMatrix{} << matrix_size_t{0u} << std::vector<int>{};
+}
+
+void CommonExceptionTests::testAssignColumnExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("columnNr");
+    QTest::addColumn<std::vector<int>>("elements");
+
+    QTest::newRow("1: column does not exist") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{3u} << std::vector<int>{7, 8};
+    QTest::newRow("2: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{1u} << std::vector<int>{7};
+    QTest::newRow("3: elements count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_size_t{2u} << std::vector<int>{7, 8, 9};
+    QTest::newRow("4: empty matrix") << IntMatrix{} << matrix_size_t{0u} << std::vector<int>{};
+}
+
 void CommonExceptionTests::testEraseRowExceptions_data()
 {
     QTest::addColumn<IntMatrix>("matrix");
@@ -404,6 +1129,28 @@ void CommonExceptionTests::testEraseColumnExceptions_data()
     QTest::newRow("2: empty matrix") << IntMatrix{} << matrix_size_t{0u};
 }
 
+void CommonExceptionTests::testEraseRowsExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("erasePositions");
+
+    QTest::newRow("1: erase position out of range") << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}} << std::vector<matrix_size_t>{0u, 3u};
+    QTest::newRow("2: positions not sorted") << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}} << std::vector<matrix_size_t>{2u, 0u};
+    QTest::newRow("3: duplicate positions") << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}} << std::vector<matrix_size_t>{1u, 1u};
+    QTest::newRow("4: empty matrix") << IntMatrix{} << std::vector<matrix_size_t>{0u};
+}
+
+void CommonExceptionTests::testEraseColumnsExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("erasePositions");
+
+    QTest::newRow("1: erase position out of range") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<matrix_size_t>{0u, 3u};
+    QTest::newRow("2: positions not sorted") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<matrix_size_t>{2u, 0u};
+    QTest::newRow("3: duplicate positions") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<matrix_size_t>{1u, 1u};
+    QTest::newRow("4: empty matrix") << IntMatrix{} << std::vector<matrix_size_t>{0u};
+}
+
 void CommonExceptionTests::testCatByRowExceptions_data()
 {
     QTest::addColumn<IntMatrix>("destMatrix");
@@ -476,6 +1223,36 @@ void CommonExceptionTests::testCatByColumnExceptions_data()
     }
 }
 
+void CommonExceptionTests::testConcatRowsExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("destMatrix");
+    QTest::addColumn<std::vector<IntMatrix>>("srcMatrixes");
+    QTest::addColumn<ConcatMode>("mode");
+
+    QTest::newRow("1: different columns count") << IntMatrix{2, 1, {1, 2}} << std::vector<IntMatrix>{IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}}} << ConcatMode::SOURCE_TO_DESTINATION;
+    QTest::newRow("2: different columns count") << IntMatrix{} << std::vector<IntMatrix>{IntMatrix{2, 1, {1, 2}}, IntMatrix{}, IntMatrix{1, 2, {3, 4}}} << ConcatMode::SOURCE_TO_DESTINATION;
+    QTest::newRow("3: different columns count") << IntMatrix{{2, 3}, 5} << std::vector<IntMatrix>{IntMatrix{{4, 3}, -1}, IntMatrix{{3, 4}, 2}} << ConcatMode::SOURCE_TO_DESTINATION;
+    QTest::newRow("4: maximum dimension exceeded") << IntMatrix{{c_HalfMaxAllowedDimension, 2}, -3} << std::vector<IntMatrix>{IntMatrix{{c_HalfMaxAllowedDimension, 2}, 2}, IntMatrix{{2, 2}, 1}} << ConcatMode::SOURCE_TO_DESTINATION;
+    QTest::newRow("5: maximum dimension exceeded") << IntMatrix{} << std::vector<IntMatrix>{IntMatrix{{c_MaxAllowedDimension, 2}, 2}, IntMatrix{{1, 2}, 1}} << ConcatMode::SOURCE_TO_DESTINATION;
+    QTest::newRow("6: same matrix") << IntMatrix{{2, 3}, 5} << std::vector<IntMatrix>{IntMatrix{{4, 3}, -1}} << ConcatMode::TO_ITSELF;
+    QTest::newRow("7: same matrix") << IntMatrix{} << std::vector<IntMatrix>{} << ConcatMode::TO_ITSELF;
+}
+
+void CommonExceptionTests::testConcatColumnsExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("destMatrix");
+    QTest::addColumn<std::vector<IntMatrix>>("srcMatrixes");
+    QTest::addColumn<ConcatMode>("mode");
+
+    QTest::newRow("1: different rows count") << IntMatrix{1, 2, {1, 2}} << std::vector<IntMatrix>{IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}}} << ConcatMode::SOURCE_TO_DESTINATION;
+    QTest::newRow("2: different rows count") << IntMatrix{} << std::vector<IntMatrix>{IntMatrix{1, 2, {1, 2}}, IntMatrix{}, IntMatrix{2, 1, {3, 4}}} << ConcatMode::SOURCE_TO_DESTINATION;
+    QTest::newRow("3: different rows count") << IntMatrix{{3, 2}, 5} << std::vector<IntMatrix>{IntMatrix{{3, 4}, -1}, IntMatrix{{4, 3}, 2}} << ConcatMode::SOURCE_TO_DESTINATION;
+    QTest::newRow("4: maximum dimension exceeded") << IntMatrix{{2, c_HalfMaxAllowedDimension}, -3} << std::vector<IntMatrix>{IntMatrix{{2, c_HalfMaxAllowedDimension}, 2}, IntMatrix{{2, 2}, 1}} << ConcatMode::SOURCE_TO_DESTINATION;
+    QTest::newRow("5: maximum dimension exceeded") << IntMatrix{} << std::vector<IntMatrix>{IntMatrix{{2, c_MaxAllowedDimension}, 2}, IntMatrix{{2, 1}, 1}} << ConcatMode::SOURCE_TO_DESTINATION;
+    QTest::newRow("6: same matrix") << IntMatrix{{3, 2}, 5} << std::vector<IntMatrix>{IntMatrix{{3, 4}, -1}} << ConcatMode::TO_ITSELF;
+    QTest::newRow("7: same matrix") << IntMatrix{} << std::vector<IntMatrix>{} << ConcatMode::TO_ITSELF;
+}
+
 void CommonExceptionTests::testSplitByRowExceptions_data()
 {
     QTest::addColumn<IntMatrix>("srcMatrix");
@@ -518,6 +1295,68 @@ void CommonExceptionTests::testSplitByColumnExceptions_data()
     QTest::newRow("12: source split to itself") << IntMatrix{3, 2, {1, -2, 3, -4, 5, -6}} << IntMatrix{} << matrix_size_t{1u} << SplitMode::TO_ITSELF;
 }
 
+void CommonExceptionTests::testSplitRowsExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("srcMatrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("splitPositions");
+
+    QTest::newRow("1: empty matrix") << IntMatrix{} << std::vector<matrix_size_t>{1u};
+    QTest::newRow("2: row does not exist") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{1u, 4u};
+    QTest::newRow("3: row does not exist") << IntMatrix{{c_MaxAllowedDimension, 2}, -3} << std::vector<matrix_size_t>{c_HalfMaxAllowedDimension, c_MaxAllowedDimension};
+    QTest::newRow("4: empty block") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{0u, 2u};
+    QTest::newRow("5: positions not strictly ascending") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{2u, 2u};
+    QTest::newRow("6: positions not strictly ascending") << IntMatrix{4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{3u, 1u};
+}
+
+void CommonExceptionTests::testSplitColumnsExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("srcMatrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("splitPositions");
+
+    QTest::newRow("1: empty matrix") << IntMatrix{} << std::vector<matrix_size_t>{1u};
+    QTest::newRow("2: column does not exist") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{1u, 4u};
+    QTest::newRow("3: column does not exist") << IntMatrix{{2, c_MaxAllowedDimension}, -3} << std::vector<matrix_size_t>{c_HalfMaxAllowedDimension, c_MaxAllowedDimension};
+    QTest::newRow("4: empty block") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{0u, 2u};
+    QTest::newRow("5: positions not strictly ascending") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{2u, 2u};
+    QTest::newRow("6: positions not strictly ascending") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << std::vector<matrix_size_t>{3u, 1u};
+}
+
+void CommonExceptionTests::testExtractExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("srcMatrix");
+    QTest::addColumn<matrix_size_t>("rowNr");
+    QTest::addColumn<matrix_size_t>("columnNr");
+    QTest::addColumn<matrix_size_t>("nrOfRows");
+    QTest::addColumn<matrix_size_t>("nrOfColumns");
+
+    QTest::newRow("1: empty matrix") << IntMatrix{} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{1u};
+    QTest::newRow("2: row out of bounds") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{3u} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{1u};
+    QTest::newRow("3: column out of bounds") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{4u} << matrix_size_t{1u} << matrix_size_t{1u};
+    QTest::newRow("4: too many rows") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{1u} << matrix_size_t{0u} << matrix_size_t{3u} << matrix_size_t{2u};
+    QTest::newRow("5: too many columns") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{2u} << matrix_size_t{2u} << matrix_size_t{3u};
+    QTest::newRow("6: too many rows and columns") << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{4u} << matrix_size_t{5u};
+}
+
+void CommonExceptionTests::testAssignBlockExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("destMatrix");
+    QTest::addColumn<IntMatrix>("srcMatrix");
+    QTest::addColumn<matrix_size_t>("srcRowNr");
+    QTest::addColumn<matrix_size_t>("srcColumnNr");
+    QTest::addColumn<matrix_size_t>("nrOfRows");
+    QTest::addColumn<matrix_size_t>("nrOfColumns");
+    QTest::addColumn<matrix_size_t>("destRowNr");
+    QTest::addColumn<matrix_size_t>("destColumnNr");
+
+    QTest::newRow("1: empty source matrix") << IntMatrix{{4, 5}, -1} << IntMatrix{} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{0u} << matrix_size_t{0u};
+    QTest::newRow("2: empty destination matrix") << IntMatrix{} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{1u} << matrix_size_t{1u} << matrix_size_t{0u} << matrix_size_t{0u};
+    QTest::newRow("3: source block out of bounds") << IntMatrix{{4, 5}, -1} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{2u} << matrix_size_t{0u} << matrix_size_t{2u} << matrix_size_t{2u} << matrix_size_t{0u} << matrix_size_t{0u};
+    QTest::newRow("4: source block out of bounds") << IntMatrix{{4, 5}, -1} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{3u} << matrix_size_t{1u} << matrix_size_t{2u} << matrix_size_t{0u} << matrix_size_t{0u};
+    QTest::newRow("5: destination block out of bounds") << IntMatrix{{4, 5}, -1} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{2u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{0u};
+    QTest::newRow("6: destination block out of bounds") << IntMatrix{{4, 5}, -1} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{2u} << matrix_size_t{3u} << matrix_size_t{0u} << matrix_size_t{3u};
+    QTest::newRow("7: block larger than source matrix") << IntMatrix{{4, 5}, -1} << IntMatrix{3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}} << matrix_size_t{0u} << matrix_size_t{0u} << matrix_size_t{4u} << matrix_size_t{4u} << matrix_size_t{0u} << matrix_size_t{0u};
+}
+
 void CommonExceptionTests::testSwapRowsOrColumnsExceptions_data()
 {
     QTest::addColumn<IntMatrix>("matrix");
@@ -532,6 +1371,179 @@ void CommonExceptionTests::testSwapRowsOrColumnsExceptions_data()
     QTest::newRow("4: empty matrix") << IntMatrix{} << matrix_size_t{0u} << matrix_size_t{0u};
 }
 
+void CommonExceptionTests::testPermuteRowsExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("permutation");
+
+    QTest::newRow("1: position out of range") << IntMatrix{4, 2, {7, 8, 9, 10, 11, 12, 13, 14}} << std::vector<matrix_size_t>{0u, 1u, 4u, 2u};
+    QTest::newRow("2: duplicate position") << IntMatrix{4, 2, {7, 8, 9, 10, 11, 12, 13, 14}} << std::vector<matrix_size_t>{0u, 1u, 1u, 2u};
+    QTest::newRow("3: too few positions") << IntMatrix{4, 2, {7, 8, 9, 10, 11, 12, 13, 14}} << std::vector<matrix_size_t>{0u, 1u, 2u};
+    QTest::newRow("4: too many positions") << IntMatrix{4, 2, {7, 8, 9, 10, 11, 12, 13, 14}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u, 4u};
+    QTest::newRow("5: empty matrix") << IntMatrix{} << std::vector<matrix_size_t>{0u};
+}
+
+void CommonExceptionTests::testPermuteColumnsExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<matrix_size_t>>("permutation");
+
+    QTest::newRow("1: position out of range") << IntMatrix{2, 4, {7, 8, 9, 10, 11, 12, 13, 14}} << std::vector<matrix_size_t>{0u, 1u, 4u, 2u};
+    QTest::newRow("2: duplicate position") << IntMatrix{2, 4, {7, 8, 9, 10, 11, 12, 13, 14}} << std::vector<matrix_size_t>{0u, 1u, 1u, 2u};
+    QTest::newRow("3: too few positions") << IntMatrix{2, 4, {7, 8, 9, 10, 11, 12, 13, 14}} << std::vector<matrix_size_t>{0u, 1u, 2u};
+    QTest::newRow("4: too many positions") << IntMatrix{2, 4, {7, 8, 9, 10, 11, 12, 13, 14}} << std::vector<matrix_size_t>{0u, 1u, 2u, 3u, 4u};
+    QTest::newRow("5: empty matrix") << IntMatrix{} << std::vector<matrix_size_t>{0u};
+}
+
+void CommonExceptionTests::testColumnOrderViewExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_size_t>("firstColumnNr");
+    QTest::addColumn<matrix_size_t>("secondColumnNr");
+
+    QTest::newRow("1: second out of range") << IntMatrix{2, 4, {7, 8, 9, 10, 11, 12, 13, 14}} << matrix_size_t{1u} << matrix_size_t{4u};
+    QTest::newRow("2: first out of range") << IntMatrix{2, 4, {7, 8, 9, 10, 11, 12, 13, 14}} << matrix_size_t{4u} << matrix_size_t{1u};
+    QTest::newRow("3: both out of range") << IntMatrix{2, 4, {7, 8, 9, 10, 11, 12, 13, 14}} << matrix_size_t{4u} << matrix_size_t{4u};
+    QTest::newRow("4: empty matrix") << IntMatrix{} << matrix_size_t{0u} << matrix_size_t{0u};
+}
+
+void CommonExceptionTests::testElementWiseOperationExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("firstMatrix");
+    QTest::addColumn<IntMatrix>("secondMatrix");
+
+    QTest::newRow("1: different number of rows") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    QTest::newRow("2: different number of columns") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{2, 2, {1, 2, 3, 4}};
+    QTest::newRow("3: different number of rows and columns") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}};
+    QTest::newRow("4: first matrix empty") << IntMatrix{} << IntMatrix{2, 2, {1, 2, 3, 4}};
+    QTest::newRow("5: second matrix empty") << IntMatrix{2, 2, {1, 2, 3, 4}} << IntMatrix{};
+}
+
+void CommonExceptionTests::testMultiplyExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("firstMatrix");
+    QTest::addColumn<IntMatrix>("secondMatrix");
+
+    QTest::newRow("1: incompatible dimensions") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}};
+    QTest::newRow("2: incompatible dimensions") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{4, 1, {1, 2, 3, 4}};
+    QTest::newRow("3: first matrix empty") << IntMatrix{} << IntMatrix{2, 2, {1, 2, 3, 4}};
+    QTest::newRow("4: second matrix empty") << IntMatrix{2, 2, {1, 2, 3, 4}} << IntMatrix{};
+    QTest::newRow("5: both matrixes empty") << IntMatrix{} << IntMatrix{};
+}
+
+void CommonExceptionTests::testGemmExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("firstMatrix");
+    QTest::addColumn<IntMatrix>("secondMatrix");
+    QTest::addColumn<IntMatrix>("matrix");
+
+    QTest::newRow("1: incompatible dimensions") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}};
+    QTest::newRow("2: result rows count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}};
+    QTest::newRow("3: result columns count not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}} << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}};
+    QTest::newRow("4: empty result") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << IntMatrix{3, 2, {1, 2, 3, 4, 5, 6}} << IntMatrix{};
+    QTest::newRow("5: first matrix empty") << IntMatrix{} << IntMatrix{2, 2, {1, 2, 3, 4}} << IntMatrix{2, 2, {1, 2, 3, 4}};
+    QTest::newRow("6: second matrix empty") << IntMatrix{2, 2, {1, 2, 3, 4}} << IntMatrix{} << IntMatrix{2, 2, {1, 2, 3, 4}};
+}
+
+void CommonExceptionTests::testMatrixVectorMultiplyExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<std::vector<int>>("vector");
+
+    QTest::newRow("1: vector size not matching") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << std::vector<int>{1, 2, 3, 4};
+    QTest::newRow("2: vector size not matching") << IntMatrix{2, 2, {1, 2, 3, 4}} << std::vector<int>{1};
+    QTest::newRow("3: empty vector") << IntMatrix{2, 2, {1, 2, 3, 4}} << std::vector<int>{};
+    QTest::newRow("4: empty matrix") << IntMatrix{} << std::vector<int>{1, 2};
+    QTest::newRow("5: empty matrix and vector") << IntMatrix{} << std::vector<int>{};
+}
+
+void CommonExceptionTests::testSquareMatrixOperationExceptions_data()
+{
+    QTest::addColumn<DoubleMatrix>("matrix");
+
+    QTest::newRow("1: empty matrix") << DoubleMatrix{};
+    QTest::newRow("2: more columns than rows") << DoubleMatrix{2, 3, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0}};
+    QTest::newRow("3: more rows than columns") << DoubleMatrix{3, 2, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0}};
+}
+
+void CommonExceptionTests::testSolveExceptions_data()
+{
+    QTest::addColumn<DoubleMatrix>("firstMatrix");
+    QTest::addColumn<DoubleMatrix>("secondMatrix");
+
+    QTest::newRow("1: non-square matrix") << DoubleMatrix{2, 3, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0}} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("2: incompatible dimensions") << DoubleMatrix{2, 2, {1.0, 2.0, 3.0, 4.0}} << DoubleMatrix{3, 1, {1.0, 2.0, 3.0}};
+    QTest::newRow("3: singular matrix") << DoubleMatrix{3, 3, {1.0, 2.0, 3.0, 2.0, 4.0, 6.0, 1.0, 1.0, 1.0}} << DoubleMatrix{3, 1, {1.0, 2.0, 3.0}};
+    QTest::newRow("4: null matrix") << DoubleMatrix{2, 2, {0.0, 0.0, 0.0, 0.0}} << DoubleMatrix{2, 2, {1.0, 2.0, 3.0, 4.0}};
+    QTest::newRow("5: first matrix empty") << DoubleMatrix{} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("6: second matrix empty") << DoubleMatrix{2, 2, {1.0, 2.0, 3.0, 4.0}} << DoubleMatrix{};
+}
+
+void CommonExceptionTests::testCholeskyExceptions_data()
+{
+    QTest::addColumn<DoubleMatrix>("matrix");
+
+    QTest::newRow("1: empty matrix") << DoubleMatrix{};
+    QTest::newRow("2: non-square matrix") << DoubleMatrix{2, 3, {4.0, 2.0, 3.0, 2.0, 5.0, 6.0}};
+    QTest::newRow("3: indefinite matrix") << DoubleMatrix{2, 2, {1.0, 2.0, 2.0, 1.0}};
+    QTest::newRow("4: negative definite matrix") << DoubleMatrix{2, 2, {-4.0, 0.0, 0.0, -9.0}};
+    QTest::newRow("5: singular matrix") << DoubleMatrix{2, 2, {1.0, 1.0, 1.0, 1.0}};
+}
+
+void CommonExceptionTests::testCholeskySolveExceptions_data()
+{
+    QTest::addColumn<DoubleMatrix>("firstMatrix");
+    QTest::addColumn<DoubleMatrix>("secondMatrix");
+
+    QTest::newRow("1: non-square matrix") << DoubleMatrix{2, 3, {1.0, 0.0, 0.0, 2.0, 3.0, 0.0}} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("2: incompatible dimensions") << DoubleMatrix{2, 2, {1.0, 0.0, 2.0, 3.0}} << DoubleMatrix{3, 1, {1.0, 2.0, 3.0}};
+    QTest::newRow("3: zero on diagonal") << DoubleMatrix{2, 2, {1.0, 0.0, 2.0, 0.0}} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("4: first matrix empty") << DoubleMatrix{} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("5: second matrix empty") << DoubleMatrix{2, 2, {1.0, 0.0, 2.0, 3.0}} << DoubleMatrix{};
+}
+
+void CommonExceptionTests::testQRExceptions_data()
+{
+    QTest::addColumn<DoubleMatrix>("matrix");
+
+    QTest::newRow("1: empty matrix") << DoubleMatrix{};
+    QTest::newRow("2: less rows than columns") << DoubleMatrix{2, 3, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0}};
+    QTest::newRow("3: single row, multiple columns") << DoubleMatrix{1, 2, {1.0, 2.0}};
+}
+
+void CommonExceptionTests::testLeastSquaresExceptions_data()
+{
+    QTest::addColumn<DoubleMatrix>("firstMatrix");
+    QTest::addColumn<DoubleMatrix>("secondMatrix");
+
+    QTest::newRow("1: less rows than columns") << DoubleMatrix{2, 3, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0}} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("2: different number of rows") << DoubleMatrix{3, 2, {1.0, 0.0, 0.0, 1.0, 1.0, 1.0}} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("3: null column") << DoubleMatrix{3, 2, {0.0, 1.0, 0.0, 2.0, 0.0, 3.0}} << DoubleMatrix{3, 1, {1.0, 2.0, 3.0}};
+    QTest::newRow("4: first matrix empty") << DoubleMatrix{} << DoubleMatrix{2, 1, {1.0, 2.0}};
+    QTest::newRow("5: second matrix empty") << DoubleMatrix{3, 2, {1.0, 0.0, 0.0, 1.0, 1.0, 1.0}} << DoubleMatrix{};
+}
+
+void CommonExceptionTests::testTraceExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+
+    QTest::newRow("1: empty matrix") << IntMatrix{};
+    QTest::newRow("2: more columns than rows") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}};
+    QTest::newRow("3: more rows than columns") << IntMatrix{3, 1, {1, 2, 3}};
+}
+
+void CommonExceptionTests::testDiagonalExtractionExceptions_data()
+{
+    QTest::addColumn<IntMatrix>("matrix");
+    QTest::addColumn<matrix_diff_t>("diagonalNr");
+
+    QTest::newRow("1: empty matrix") << IntMatrix{} << matrix_diff_t{0};
+    QTest::newRow("2: diagonal number too low") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_diff_t{-2};
+    QTest::newRow("3: diagonal number too high") << IntMatrix{2, 3, {1, 2, 3, 4, 5, 6}} << matrix_diff_t{3};
+    QTest::newRow("4: diagonal number too low") << IntMatrix{3, 1, {1, 2, 3}} << matrix_diff_t{-3};
+    QTest::newRow("5: diagonal number too high") << IntMatrix{3, 1, {1, 2, 3}} << matrix_diff_t{1};
+}
+
 void CommonExceptionTests::_buildResizeExceptionsTestingTable()
 {
     QTest::addColumn<IntMatrix>("matrix");
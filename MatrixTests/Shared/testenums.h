@@ -15,3 +15,13 @@ enum class SplitMode : unsigned short
     // for exceptions testing only
     TO_ITSELF
 };
+
+// matrix flipping/rotation
+enum class FlipRotateMode : unsigned short
+{
+    FLIP_VERTICAL,
+    FLIP_HORIZONTAL,
+    ROTATE_90,
+    ROTATE_180,
+    ROTATE_270
+};